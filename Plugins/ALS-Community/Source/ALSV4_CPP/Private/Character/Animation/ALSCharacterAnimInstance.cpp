@@ -15,6 +15,11 @@
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+#include <atomic>
+
 
 static const FName NAME_BasePose_CLF(TEXT("BasePose_CLF"));
 static const FName NAME_BasePose_N(TEXT("BasePose_N"));
@@ -44,6 +49,54 @@ static const FName NAME_VB___foot_target_r(TEXT("VB foot_target_r"));
 static const FName NAME_W_Gait(TEXT("W_Gait"));
 static const FName NAME__ALSCharacterAnimInstance__root(TEXT("root"));
 
+DEFINE_LOG_CATEGORY_STATIC(LogALSAnimInstance, Log, All);
+
+DECLARE_STATS_GROUP(TEXT("ALSAnim"), STATGROUP_ALSAnim, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Game Thread Snapshot"), STAT_ALSAnim_GameThread, STATGROUP_ALSAnim);
+DECLARE_CYCLE_STAT(TEXT("Update"), STAT_ALSAnim_Update, STATGROUP_ALSAnim);
+DECLARE_CYCLE_STAT(TEXT("Game Thread Requests"), STAT_ALSAnim_Requests, STATGROUP_ALSAnim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Async Traces"), STAT_ALSAnim_AsyncTraces, STATGROUP_ALSAnim);
+
+static TAutoConsoleVariable<bool> CVarALSThreadSafeAnimUpdate(
+	TEXT("ALS.ThreadSafeAnimUpdate"),
+	true,
+	TEXT("Run ALS anim instance blend and IK math in NativeThreadSafeUpdateAnimation (1) ")
+	TEXT("or inline in NativeUpdateAnimation on the game thread (0)."));
+
+namespace ALSAnimInstancePrivate
+{
+	// Totals since the last ConsumeUpdateTimings. The update half can run on several workers at once.
+	std::atomic<uint64> GameThreadCycles{0};
+	std::atomic<uint64> UpdateCycles{0};
+	std::atomic<int32> InstanceUpdates{0};
+	std::atomic<int32> AsyncTraces{0};
+	uint64 FirstFrame = 0;
+
+	struct FScopedUpdateTimer
+	{
+		explicit FScopedUpdateTimer(std::atomic<uint64>& InCounter)
+			: Counter(InCounter), StartCycles(FPlatformTime::Cycles64())
+		{
+		}
+
+		~FScopedUpdateTimer()
+		{
+			Counter.fetch_add(FPlatformTime::Cycles64() - StartCycles, std::memory_order_relaxed);
+		}
+
+		std::atomic<uint64>& Counter;
+		uint64 StartCycles;
+	};
+
+	FAutoConsoleCommand ReportAnimTimingsCommand(
+		TEXT("ALS.ReportAnimTimings"),
+		TEXT("Log and reset the ALS anim instance update cost since the last report."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			UALSCharacterAnimInstance::ConsumeUpdateTimings();
+		}));
+}
+
 
 void UALSCharacterAnimInstance::NativeInitializeAnimation()
 {
@@ -70,72 +123,302 @@ void UALSCharacterAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
 {
 	Super::NativeUpdateAnimation(DeltaSeconds);
 
+	bSnapshotValid = false;
 	if (!Character || DeltaSeconds == 0.0f)
 	{
 		return;
 	}
 
-	// Update rest of character information. Others are reflected into anim bp when they're set inside character class
-	CharacterInformation.MovementInputAmount = Character->GetMovementInputAmount();
-	CharacterInformation.bHasMovementInput = Character->HasMovementInput();
-	CharacterInformation.bIsMoving = Character->IsMoving();
-	CharacterInformation.Acceleration = Character->GetAcceleration();
-	CharacterInformation.AimYawRate = Character->GetAimYawRate();
-	CharacterInformation.Speed = Character->GetSpeed();
-	CharacterInformation.Velocity = Character->GetCharacterMovement()->Velocity;
-	CharacterInformation.MovementInput = Character->GetMovementInput();
-	CharacterInformation.AimingRotation = Character->GetAimingRotation();
-	CharacterInformation.CharacterActorRotation = Character->GetActorRotation();
-	CharacterInformation.ViewMode = Character->GetViewMode();
-	CharacterInformation.PrevMovementState = Character->GetPrevMovementState();
-	LayerBlendingValues.OverlayOverrideState = Character->GetOverlayOverrideState();
-	MovementState = Character->GetMovementState();
-	MovementAction = Character->GetMovementAction();
-	Stance = Character->GetStance();
-	RotationMode = Character->GetRotationMode();
-	Gait = Character->GetGait();
-	OverlayState = Character->GetOverlayState();
-	GroundedEntryState = Character->GetGroundedEntryState();
-	WallTransitionData = Character->GetWallTransitionData();
+	{
+		SCOPE_CYCLE_COUNTER(STAT_ALSAnim_GameThread);
+		ALSAnimInstancePrivate::FScopedUpdateTimer Timer(ALSAnimInstancePrivate::GameThreadCycles);
+
+		// Normally done after evaluation; catches requests from an update that was not evaluated.
+		FlushGameThreadRequests();
+
+		// Update rest of character information. Others are reflected into anim bp when they're set inside character class
+		CharacterInformation.MovementInputAmount = Character->GetMovementInputAmount();
+		CharacterInformation.bHasMovementInput = Character->HasMovementInput();
+		CharacterInformation.bIsMoving = Character->IsMoving();
+		CharacterInformation.Acceleration = Character->GetAcceleration();
+		CharacterInformation.AimYawRate = Character->GetAimYawRate();
+		CharacterInformation.Speed = Character->GetSpeed();
+		CharacterInformation.Velocity = Character->GetCharacterMovement()->Velocity;
+		CharacterInformation.MovementInput = Character->GetMovementInput();
+		CharacterInformation.AimingRotation = Character->GetAimingRotation();
+		CharacterInformation.CharacterActorRotation = Character->GetActorRotation();
+		CharacterInformation.ViewMode = Character->GetViewMode();
+		CharacterInformation.PrevMovementState = Character->GetPrevMovementState();
+		LayerBlendingValues.OverlayOverrideState = Character->GetOverlayOverrideState();
+		MovementState = Character->GetMovementState();
+		MovementAction = Character->GetMovementAction();
+		Stance = Character->GetStance();
+		RotationMode = Character->GetRotationMode();
+		Gait = Character->GetGait();
+		OverlayState = Character->GetOverlayState();
+		GroundedEntryState = Character->GetGroundedEntryState();
+		WallTransitionData = Character->GetWallTransitionData();
+
+		GatherGameThreadSnapshot();
+		ConsumeAsyncTraces();
+		RequestAsyncTraces();
+	}
+
+	ALSAnimInstancePrivate::InstanceUpdates.fetch_add(1, std::memory_order_relaxed);
 
-	if (WallTransitionData.bActive)
+	if (CVarALSThreadSafeAnimUpdate.GetValueOnGameThread())
 	{
-		WallToGroundTransitionAlpha = FMath::FInterpConstantTo(
-			WallToGroundTransitionAlpha,
-			1.0f,
-			DeltaSeconds,
-			1.0f / FMath::Max(WallTransitionData.Duration, 0.001f));
+		bSnapshotValid = true;
 	}
 	else
 	{
-		WallToGroundTransitionAlpha = FMath::FInterpTo(
-			WallToGroundTransitionAlpha,
-			0.0f,
-			DeltaSeconds,
-			WallToGroundTransitionBlendOutSpeed);
+		UpdateFromSnapshot(DeltaSeconds);
 	}
+}
 
-	const bool bWallRunning = MovementState.WallRunning();
-	const bool bWallClimbing = MovementState.WallClimbing();
-	const bool bWallTraversal = bWallRunning || bWallClimbing;
-	const float WallBlendSpeed =
-		bWallTraversal ? WallTraversalBlendInSpeed : WallTraversalBlendOutSpeed;
-	WallTraversalBlendAlpha = FMath::FInterpTo(
-		WallTraversalBlendAlpha,
-		bWallTraversal ? 1.0f : 0.0f,
-		DeltaSeconds,
-		WallBlendSpeed);
-	WallRunningBlendAlpha = FMath::FInterpTo(
-		WallRunningBlendAlpha,
-		bWallRunning ? 1.0f : 0.0f,
-		DeltaSeconds,
-		WallBlendSpeed);
-	WallClimbingBlendAlpha = FMath::FInterpTo(
-		WallClimbingBlendAlpha,
-		bWallClimbing ? 1.0f : 0.0f,
-		DeltaSeconds,
-		WallBlendSpeed);
+void UALSCharacterAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+	if (bSnapshotValid)
+	{
+		UpdateFromSnapshot(DeltaSeconds);
+	}
+}
+
+void UALSCharacterAnimInstance::NativePostEvaluateAnimation()
+{
+	Super::NativePostEvaluateAnimation();
+
+	SCOPE_CYCLE_COUNTER(STAT_ALSAnim_Requests);
+	ALSAnimInstancePrivate::FScopedUpdateTimer Timer(ALSAnimInstancePrivate::GameThreadCycles);
+	FlushGameThreadRequests();
+}
+
+FALSAnimUpdateTimings UALSCharacterAnimInstance::ConsumeUpdateTimings()
+{
+	using namespace ALSAnimInstancePrivate;
+
+	FALSAnimUpdateTimings Timings;
+	Timings.Frames = static_cast<int32>(GFrameCounter - FirstFrame);
+	Timings.InstanceUpdates = InstanceUpdates.exchange(0);
+	Timings.GameThreadMilliseconds = FPlatformTime::ToMilliseconds64(GameThreadCycles.exchange(0));
+	Timings.UpdateMilliseconds = FPlatformTime::ToMilliseconds64(UpdateCycles.exchange(0));
+	Timings.AsyncTraces = AsyncTraces.exchange(0);
+	FirstFrame = GFrameCounter;
+
+	const double Frames = FMath::Max(1, Timings.Frames);
+	UE_LOG(LogALSAnimInstance, Log,
+	       TEXT("ALS anim: %.1f instances/frame over %d frames | game thread %.3f ms/frame | update %.3f ms/frame on %s | %.1f async traces/frame"),
+	       Timings.InstanceUpdates / Frames, Timings.Frames,
+	       Timings.GameThreadMilliseconds / Frames,
+	       Timings.UpdateMilliseconds / Frames,
+	       CVarALSThreadSafeAnimUpdate.GetValueOnGameThread() ? TEXT("anim workers") : TEXT("the game thread"),
+	       Timings.AsyncTraces / Frames);
+
+	return Timings;
+}
+
+void UALSCharacterAnimInstance::GatherGameThreadSnapshot()
+{
+	USkeletalMeshComponent* OwnerComp = GetOwningComponent();
+	const UCharacterMovementComponent* MovementComp = Character->GetCharacterMovement();
+
+	Snapshot.ComponentTransform = OwnerComp->GetComponentTransform();
+
+	const FName FootBones[2] = {IkFootL_BoneName, IkFootR_BoneName};
+	const FName FootTargetBones[2] = {NAME_VB___foot_target_l, NAME_VB___foot_target_r};
+	for (int32 Index = 0; Index < 2; ++Index)
+	{
+		Snapshot.FootComponentTransforms[Index] = OwnerComp->GetSocketTransform(FootBones[Index], RTS_Component);
+		Snapshot.FootWorldLocations[Index] =
+			Snapshot.ComponentTransform.TransformPosition(Snapshot.FootComponentTransforms[Index].GetLocation());
+		Snapshot.FootTargetComponentLocations[Index] =
+			OwnerComp->GetSocketTransform(FootTargetBones[Index], RTS_Component).GetLocation();
+	}
+
+	Snapshot.FootIKSurfaceNormal = MovementState.WallRunning() || MovementState.WallClimbing()
+		                               ? Character->GetFootIKSurfaceNormal().GetSafeNormal()
+		                               : FVector::ZeroVector;
+	Snapshot.LastUpdateRotation = MovementComp->GetLastUpdateRotation();
+	Snapshot.bMovingOnGround = MovementComp->IsMovingOnGround();
+	Snapshot.MaxAcceleration = MovementComp->GetMaxAcceleration();
+	Snapshot.MaxBrakingDeceleration = MovementComp->GetMaxBrakingDeceleration();
+	Snapshot.UpdateRate = OwnerComp->AnimUpdateRateParams ? OwnerComp->AnimUpdateRateParams->UpdateRate : 1.0f;
+	Snapshot.bAutonomousProxy = Character->GetLocalRole() == ROLE_AutonomousProxy;
+	Snapshot.bFootIKEnabled = bEnableFootIK;
+	Snapshot.RagdollRootSpeed = MovementState.Ragdoll()
+		                            ? OwnerComp->GetPhysicsLinearVelocity(NAME__ALSCharacterAnimInstance__root).Size()
+		                            : 0.0f;
+}
+
+void UALSCharacterAnimInstance::ConsumeAsyncTraces()
+{
+	UWorld* World = GetWorld();
+	check(World);
+
+	const UCharacterMovementComponent* MovementComp = Character->GetCharacterMovement();
+	const bool bDrawTraces = ALSDebugComponent && ALSDebugComponent->GetShowTraces();
+
+	for (int32 Index = 0; Index < 2; ++Index)
+	{
+		FTraceDatum Datum;
+		const bool bHasData = FootTraceHandles[Index].IsValid() && World->QueryTraceData(FootTraceHandles[Index], Datum);
+		FootTraceHandles[Index].Invalidate();
+		if (!bHasData)
+		{
+			continue;
+		}
+
+		const FHitResult HitResult = Datum.OutHits.Num() > 0 ? Datum.OutHits[0] : FHitResult();
+		const bool bHit = HitResult.bBlockingHit;
+
+		// Keep the impact relative to the foot location the trace was built from, so applying it a
+		// frame later does not add the distance the foot moved in between.
+		FALSFootTraceResult& Result = FootTraces[Index];
+		Result.bWallTrace = bFootTraceIsWall[Index];
+		Result.ImpactOffset = HitResult.ImpactPoint - FootTraceOrigins[Index];
+		Result.ImpactNormal = HitResult.ImpactNormal;
+		Result.bHit = Result.bWallTrace
+			              ? bHit && HitResult.IsValidBlockingHit() &&
+			              FVector::DotProduct(HitResult.ImpactNormal.GetSafeNormal(), FootTraceNormals[Index]) > 0.5f
+			              : MovementComp->IsWalkable(HitResult);
+
+		if (bDrawTraces)
+		{
+			UALSDebugComponent::DrawDebugLineTraceSingle(
+				World,
+				Datum.Start,
+				Datum.End,
+				EDrawDebugTrace::Type::ForOneFrame,
+				bHit,
+				HitResult,
+				Result.bWallTrace ? FLinearColor::Blue : FLinearColor::Red,
+				FLinearColor::Green,
+				5.0f);
+		}
+	}
+
+	FTraceDatum LandDatum;
+	const bool bHasLandData =
+		LandPredictionTraceHandle.IsValid() && World->QueryTraceData(LandPredictionTraceHandle, LandDatum);
+	LandPredictionTraceHandle.Invalidate();
+	if (bHasLandData)
+	{
+		const FHitResult HitResult = LandDatum.OutHits.Num() > 0 ? LandDatum.OutHits[0] : FHitResult();
+		LandPredictionTime = MovementComp->IsWalkable(HitResult) ? HitResult.Time : -1.0f;
+
+		if (bDrawTraces)
+		{
+			UALSDebugComponent::DrawDebugCapsuleTraceSingle(World,
+			                                                LandDatum.Start,
+			                                                LandDatum.End,
+			                                                LandPredictionTraceShape,
+			                                                EDrawDebugTrace::Type::ForOneFrame,
+			                                                HitResult.bBlockingHit,
+			                                                HitResult,
+			                                                FLinearColor::Red,
+			                                                FLinearColor::Green,
+			                                                5.0f);
+		}
+	}
+}
+
+void UALSCharacterAnimInstance::RequestAsyncTraces()
+{
+	const bool bWallTraversal = MovementState.WallRunning() || MovementState.WallClimbing();
+	const bool bGroundFootIK = bEnableFootIK && !MovementState.InAir() && !bWallTraversal && !MovementState.Ragdoll();
+	const bool bWallFootIK = bEnableFootIK && bWallTraversal && !WallTransitionData.bActive &&
+		!Snapshot.FootIKSurfaceNormal.IsNearlyZero();
+	const FName FootIKCurves[2] = {NAME_Enable_FootIK_L, NAME_Enable_FootIK_R};
+
+	// Same conditions UpdateFootIK traces under; a foot that is not traced this frame drops its old result.
+	for (int32 Index = 0; Index < 2; ++Index)
+	{
+		const bool bFootIKEnabled = GetCurveValue(FootIKCurves[Index]) > 0.0f;
+		if (bFootIKEnabled && bGroundFootIK)
+		{
+			FVector FootFloorLocation = Snapshot.FootWorldLocations[Index];
+			FootFloorLocation.Z = GetOwningComponent()->GetSocketLocation(NAME__ALSCharacterAnimInstance__root).Z;
+			RequestFootTrace(Index, FootFloorLocation, FVector::UpVector, false);
+		}
+		else if (bFootIKEnabled && bWallFootIK)
+		{
+			RequestFootTrace(Index, Snapshot.FootWorldLocations[Index], Snapshot.FootIKSurfaceNormal, true);
+		}
+		else
+		{
+			FootTraces[Index] = FALSFootTraceResult();
+		}
+	}
+
+	if (!bEnableLandPrediction || !MovementState.InAir() || CharacterInformation.Velocity.Z >= -200.0f)
+	{
+		LandPredictionTime = -1.0f;
+		return;
+	}
+
+	const UCapsuleComponent* CapsuleComp = Character->GetCapsuleComponent();
+	const FVector& CapsuleWorldLoc = CapsuleComp->GetComponentLocation();
+	const float VelocityZ = CharacterInformation.Velocity.Z;
+	FVector VelocityClamped = CharacterInformation.Velocity;
+	VelocityClamped.Z = FMath::Clamp(VelocityZ, -4000.0f, -200.0f);
+	VelocityClamped.Normalize();
+
+	const FVector TraceLength = VelocityClamped * FMath::GetMappedRangeValueClamped<float, float>(
+		{0.0f, -4000.0f}, {50.0f, 2000.0f}, VelocityZ);
+
+	const FCollisionQueryParams Params(SCENE_QUERY_STAT(ALSLandPrediction), false, Character);
+	LandPredictionTraceShape = FCollisionShape::MakeCapsule(CapsuleComp->GetUnscaledCapsuleRadius(),
+	                                                        CapsuleComp->GetUnscaledCapsuleHalfHeight());
+	LandPredictionTraceHandle = GetWorld()->AsyncSweepByChannel(EAsyncTraceType::Single, CapsuleWorldLoc,
+	                                                            CapsuleWorldLoc + TraceLength, FQuat::Identity,
+	                                                            ECC_Visibility, LandPredictionTraceShape, Params);
+
+	INC_DWORD_STAT(STAT_ALSAnim_AsyncTraces);
+	ALSAnimInstancePrivate::AsyncTraces.fetch_add(1, std::memory_order_relaxed);
+}
+
+void UALSCharacterAnimInstance::RequestFootTrace(const int32 FootIndex, const FVector& Origin, const FVector& Normal,
+                                                 const bool bWallTrace)
+{
+	const FCollisionQueryParams Params = bWallTrace
+		                                     ? FCollisionQueryParams(SCENE_QUERY_STAT(ALSWallFootIK), false, Character)
+		                                     : FCollisionQueryParams(SCENE_QUERY_STAT(ALSFootIK), false, Character);
+
+	FootTraceHandles[FootIndex] = GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single,
+	                                                                  Origin + Normal * Config.IK_TraceDistanceAboveFoot,
+	                                                                  Origin - Normal * Config.IK_TraceDistanceBelowFoot,
+	                                                                  ECC_Visibility, Params);
+	FootTraceOrigins[FootIndex] = Origin;
+	FootTraceNormals[FootIndex] = Normal;
+	bFootTraceIsWall[FootIndex] = bWallTrace;
+
+	INC_DWORD_STAT(STAT_ALSAnim_AsyncTraces);
+	ALSAnimInstancePrivate::AsyncTraces.fetch_add(1, std::memory_order_relaxed);
+}
+
+void UALSCharacterAnimInstance::FlushGameThreadRequests()
+{
+	if (bPendingTurnInPlace)
+	{
+		bPendingTurnInPlace = false;
+		TurnInPlace(PendingTurnInPlaceRotation, 1.0f, 0.0f, false);
+	}
+
+	if (bPendingDynamicTransition)
+	{
+		bPendingDynamicTransition = false;
+		PlayDynamicTransition(0.1f, PendingDynamicTransition);
+	}
+}
 
+void UALSCharacterAnimInstance::UpdateFromSnapshot(float DeltaSeconds)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ALSAnim_Update);
+	ALSAnimInstancePrivate::FScopedUpdateTimer Timer(ALSAnimInstancePrivate::UpdateCycles);
+
+	UpdateWallTraversalValues(DeltaSeconds);
 	UpdateAimingValues(DeltaSeconds);
 	UpdateLayerValues();
 	UpdateFootIK(DeltaSeconds);
@@ -203,6 +486,47 @@ void UALSCharacterAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
 	}
 }
 
+void UALSCharacterAnimInstance::UpdateWallTraversalValues(float DeltaSeconds)
+{
+	if (WallTransitionData.bActive)
+	{
+		WallToGroundTransitionAlpha = FMath::FInterpConstantTo(
+			WallToGroundTransitionAlpha,
+			1.0f,
+			DeltaSeconds,
+			1.0f / FMath::Max(WallTransitionData.Duration, 0.001f));
+	}
+	else
+	{
+		WallToGroundTransitionAlpha = FMath::FInterpTo(
+			WallToGroundTransitionAlpha,
+			0.0f,
+			DeltaSeconds,
+			WallToGroundTransitionBlendOutSpeed);
+	}
+
+	const bool bWallRunning = MovementState.WallRunning();
+	const bool bWallClimbing = MovementState.WallClimbing();
+	const bool bWallTraversal = bWallRunning || bWallClimbing;
+	const float WallBlendSpeed =
+		bWallTraversal ? WallTraversalBlendInSpeed : WallTraversalBlendOutSpeed;
+	WallTraversalBlendAlpha = FMath::FInterpTo(
+		WallTraversalBlendAlpha,
+		bWallTraversal ? 1.0f : 0.0f,
+		DeltaSeconds,
+		WallBlendSpeed);
+	WallRunningBlendAlpha = FMath::FInterpTo(
+		WallRunningBlendAlpha,
+		bWallRunning ? 1.0f : 0.0f,
+		DeltaSeconds,
+		WallBlendSpeed);
+	WallClimbingBlendAlpha = FMath::FInterpTo(
+		WallClimbingBlendAlpha,
+		bWallClimbing ? 1.0f : 0.0f,
+		DeltaSeconds,
+		WallBlendSpeed);
+}
+
 void UALSCharacterAnimInstance::PlayTransition(const FALSDynamicMontageParams& Parameters)
 {
 	PlaySlotAnimationAsDynamicMontage(Parameters.Animation, NAME_Grounded___Slot,
@@ -366,6 +690,15 @@ void UALSCharacterAnimInstance::UpdateFootIK(float DeltaSeconds)
 	const bool bWallTraversal = MovementState.WallRunning() || MovementState.WallClimbing();
 	const bool bWallToGroundTransition = WallTransitionData.bActive;
 
+	if (!Snapshot.bFootIKEnabled)
+	{
+		FootIKValues.FootLock_L_Alpha = 0.0f;
+		FootIKValues.FootLock_R_Alpha = 0.0f;
+		SetPelvisIKOffset(DeltaSeconds, FVector::ZeroVector, FVector::ZeroVector);
+		ResetIKOffsets(DeltaSeconds);
+		return;
+	}
+
 	// Update Foot Locking values.
 	if (bWallToGroundTransition)
 	{
@@ -375,10 +708,10 @@ void UALSCharacterAnimInstance::UpdateFootIK(float DeltaSeconds)
 	else
 	{
 		SetFootLocking(DeltaSeconds, NAME_Enable_FootIK_L, NAME_FootLock_L,
-		               IkFootL_BoneName, FootIKValues.FootLock_L_Alpha, FootIKValues.UseFootLockCurve_L,
+		               Snapshot.FootComponentTransforms[0], FootIKValues.FootLock_L_Alpha, FootIKValues.UseFootLockCurve_L,
 		               FootIKValues.FootLock_L_Location, FootIKValues.FootLock_L_Rotation);
 		SetFootLocking(DeltaSeconds, NAME_Enable_FootIK_R, NAME_FootLock_R,
-		               IkFootR_BoneName, FootIKValues.FootLock_R_Alpha, FootIKValues.UseFootLockCurve_R,
+		               Snapshot.FootComponentTransforms[1], FootIKValues.FootLock_R_Alpha, FootIKValues.UseFootLockCurve_R,
 		               FootIKValues.FootLock_R_Location, FootIKValues.FootLock_R_Rotation);
 	}
 
@@ -401,7 +734,7 @@ void UALSCharacterAnimInstance::UpdateFootIK(float DeltaSeconds)
 			SetTransitionFootOffset(
 				DeltaSeconds,
 				NAME_Enable_FootIK_L,
-				IkFootL_BoneName,
+				Snapshot.FootWorldLocations[0],
 				WallPoint,
 				WallNormal,
 				bLeftLeads ? GroundPoint : WallPoint,
@@ -413,7 +746,7 @@ void UALSCharacterAnimInstance::UpdateFootIK(float DeltaSeconds)
 			SetTransitionFootOffset(
 				DeltaSeconds,
 				NAME_Enable_FootIK_R,
-				IkFootR_BoneName,
+				Snapshot.FootWorldLocations[1],
 				WallPoint,
 				WallNormal,
 				bLeftLeads ? WallPoint : GroundPoint,
@@ -426,8 +759,7 @@ void UALSCharacterAnimInstance::UpdateFootIK(float DeltaSeconds)
 			return;
 		}
 
-		const FVector SurfaceNormal = Character->GetFootIKSurfaceNormal().GetSafeNormal();
-		if (SurfaceNormal.IsNearlyZero())
+		if (Snapshot.FootIKSurfaceNormal.IsNearlyZero())
 		{
 			SetPelvisIKOffset(DeltaSeconds, FVector::ZeroVector, FVector::ZeroVector);
 			ResetIKOffsets(DeltaSeconds);
@@ -437,16 +769,14 @@ void UALSCharacterAnimInstance::UpdateFootIK(float DeltaSeconds)
 		SetWallFootOffsets(
 			DeltaSeconds,
 			NAME_Enable_FootIK_L,
-			IkFootL_BoneName,
-			SurfaceNormal,
+			FootTraces[0],
 			FootOffsetLTarget,
 			FootIKValues.FootOffset_L_Location,
 			FootIKValues.FootOffset_L_Rotation);
 		SetWallFootOffsets(
 			DeltaSeconds,
 			NAME_Enable_FootIK_R,
-			IkFootR_BoneName,
-			SurfaceNormal,
+			FootTraces[1],
 			FootOffsetRTarget,
 			FootIKValues.FootOffset_R_Location,
 			FootIKValues.FootOffset_R_Rotation);
@@ -455,10 +785,10 @@ void UALSCharacterAnimInstance::UpdateFootIK(float DeltaSeconds)
 	else if (!MovementState.Ragdoll())
 	{
 		// Update all Foot Lock and Foot Offset values when not In Air
-		SetFootOffsets(DeltaSeconds, NAME_Enable_FootIK_L, IkFootL_BoneName, NAME__ALSCharacterAnimInstance__root,
+		SetFootOffsets(DeltaSeconds, NAME_Enable_FootIK_L, FootTraces[0],
 		               FootOffsetLTarget,
 		               FootIKValues.FootOffset_L_Location, FootIKValues.FootOffset_L_Rotation);
-		SetFootOffsets(DeltaSeconds, NAME_Enable_FootIK_R, IkFootR_BoneName, NAME__ALSCharacterAnimInstance__root,
+		SetFootOffsets(DeltaSeconds, NAME_Enable_FootIK_R, FootTraces[1],
 		               FootOffsetRTarget,
 		               FootIKValues.FootOffset_R_Location, FootIKValues.FootOffset_R_Rotation);
 		SetPelvisIKOffset(DeltaSeconds, FootOffsetLTarget, FootOffsetRTarget);
@@ -468,8 +798,7 @@ void UALSCharacterAnimInstance::UpdateFootIK(float DeltaSeconds)
 void UALSCharacterAnimInstance::SetWallFootOffsets(
 	const float DeltaSeconds,
 	const FName EnableFootIKCurve,
-	const FName IKFootBone,
-	const FVector& SurfaceNormal,
+	const FALSFootTraceResult& FootTrace,
 	FVector& CurLocationTarget,
 	FVector& CurLocationOffset,
 	FRotator& CurRotationOffset)
@@ -491,61 +820,21 @@ void UALSCharacterAnimInstance::SetWallFootOffsets(
 		return;
 	}
 
-	USkeletalMeshComponent* OwnerComp = GetOwningComponent();
-	UWorld* World = GetWorld();
-	if (!OwnerComp || !World)
-	{
-		return;
-	}
-
-	const FVector Normal = SurfaceNormal.GetSafeNormal();
-	const FVector FootLocation = OwnerComp->GetSocketLocation(IKFootBone);
-	const FVector TraceStart = FootLocation + Normal * Config.IK_TraceDistanceAboveFoot;
-	const FVector TraceEnd = FootLocation - Normal * Config.IK_TraceDistanceBelowFoot;
-
-	FCollisionQueryParams Params(SCENE_QUERY_STAT(ALSWallFootIK), false, Character);
-	FHitResult HitResult;
-	const bool bHit = World->LineTraceSingleByChannel(
-		HitResult,
-		TraceStart,
-		TraceEnd,
-		ECC_Visibility,
-		Params);
-
-	if (ALSDebugComponent && ALSDebugComponent->GetShowTraces())
-	{
-		UALSDebugComponent::DrawDebugLineTraceSingle(
-			World,
-			TraceStart,
-			TraceEnd,
-			EDrawDebugTrace::Type::ForOneFrame,
-			bHit,
-			HitResult,
-			FLinearColor::Blue,
-			FLinearColor::Green,
-			5.0f);
-	}
-
 	FVector TargetLocationOffset = FVector::ZeroVector;
 	FRotator TargetRotationOffset = FRotator::ZeroRotator;
 
-	const bool bHitRequestedSurface =
-		bHit &&
-		HitResult.IsValidBlockingHit() &&
-		FVector::DotProduct(HitResult.ImpactNormal.GetSafeNormal(), Normal) > 0.5f;
-
-	if (bHitRequestedSurface)
+	// The last completed trace along the wall normal, issued from the foot in RequestAsyncTraces.
+	if (FootTrace.bHit && FootTrace.bWallTrace)
 	{
-		const FVector TargetFootLocation =
-			HitResult.ImpactPoint + HitResult.ImpactNormal.GetSafeNormal() * WallFootSurfaceOffset;
-		const FVector WorldOffset = TargetFootLocation - FootLocation;
-		TargetLocationOffset = OwnerComp->GetComponentTransform().InverseTransformVectorNoScale(WorldOffset);
+		const FVector WorldOffset =
+			FootTrace.ImpactOffset + FootTrace.ImpactNormal.GetSafeNormal() * WallFootSurfaceOffset;
+		TargetLocationOffset = Snapshot.ComponentTransform.InverseTransformVectorNoScale(WorldOffset);
 		TargetLocationOffset = TargetLocationOffset.GetClampedToMaxSize(MaxWallFootIKOffset);
 
 		const FVector LocalImpactNormal =
-			OwnerComp->GetComponentTransform()
-			         .InverseTransformVectorNoScale(HitResult.ImpactNormal)
-			         .GetSafeNormal();
+			Snapshot.ComponentTransform
+			        .InverseTransformVectorNoScale(FootTrace.ImpactNormal)
+			        .GetSafeNormal();
 		TargetRotationOffset.Pitch =
 			-FMath::RadiansToDegrees(FMath::Atan2(LocalImpactNormal.X, LocalImpactNormal.Z));
 		TargetRotationOffset.Roll =
@@ -568,7 +857,7 @@ void UALSCharacterAnimInstance::SetWallFootOffsets(
 void UALSCharacterAnimInstance::SetTransitionFootOffset(
 	const float DeltaSeconds,
 	const FName EnableFootIKCurve,
-	const FName IKFootBone,
+	const FVector& FootLocation,
 	const FVector& StartSurfacePoint,
 	const FVector& StartSurfaceNormal,
 	const FVector& TargetSurfacePoint,
@@ -578,12 +867,6 @@ void UALSCharacterAnimInstance::SetTransitionFootOffset(
 	FVector& CurLocationOffset,
 	FRotator& CurRotationOffset)
 {
-	USkeletalMeshComponent* OwnerComp = GetOwningComponent();
-	if (!OwnerComp)
-	{
-		return;
-	}
-
 	const float IKAlpha = FMath::Max(
 		GetCurveValue(EnableFootIKCurve),
 		WallTransitionMinFootIKAlpha);
@@ -594,7 +877,6 @@ void UALSCharacterAnimInstance::SetTransitionFootOffset(
 		return;
 	}
 
-	const FVector FootLocation = OwnerComp->GetSocketLocation(IKFootBone);
 	const FVector StartTarget =
 		FootLocation -
 		StartNormal * FVector::DotProduct(FootLocation - StartSurfacePoint, StartNormal) +
@@ -612,16 +894,16 @@ void UALSCharacterAnimInstance::SetTransitionFootOffset(
 	const FVector WorldOffset = TargetFootLocation - FootLocation;
 
 	CurLocationTarget =
-		OwnerComp->GetComponentTransform().InverseTransformVectorNoScale(WorldOffset);
+		Snapshot.ComponentTransform.InverseTransformVectorNoScale(WorldOffset);
 	CurLocationTarget =
 		CurLocationTarget.GetClampedToMaxSize(MaxWallTransitionFootIKOffset) * IKAlpha;
 
 	const FVector WorldTargetNormal =
 		FMath::Lerp(StartNormal, EndNormal, SmoothTransferAlpha).GetSafeNormal();
 	const FVector LocalTargetNormal =
-		OwnerComp->GetComponentTransform()
-		         .InverseTransformVectorNoScale(WorldTargetNormal)
-		         .GetSafeNormal();
+		Snapshot.ComponentTransform
+		        .InverseTransformVectorNoScale(WorldTargetNormal)
+		        .GetSafeNormal();
 	FRotator TargetRotationOffset = FRotator::ZeroRotator;
 	TargetRotationOffset.Pitch =
 		-FMath::RadiansToDegrees(FMath::Atan2(LocalTargetNormal.X, LocalTargetNormal.Z));
@@ -668,7 +950,8 @@ void UALSCharacterAnimInstance::SetWallPelvisIKOffset(
 }
 
 void UALSCharacterAnimInstance::SetFootLocking(float DeltaSeconds, FName EnableFootIKCurve, FName FootLockCurve,
-                                               FName IKFootBone, float& CurFootLockAlpha, bool& UseFootLockCurve,
+                                               const FTransform& FootComponentTransform,
+                                               float& CurFootLockAlpha, bool& UseFootLockCurve,
                                                FVector& CurFootLockLoc, FRotator& CurFootLockRot)
 {
 	if (GetCurveValue(EnableFootIKCurve) <= 0.0f)
@@ -682,8 +965,8 @@ void UALSCharacterAnimInstance::SetFootLocking(float DeltaSeconds, FName EnableF
 	if (UseFootLockCurve)
 	{
 		UseFootLockCurve = FMath::Abs(GetCurveValue(NAME__ALSCharacterAnimInstance__RotationAmount)) <= 0.001f ||
-			Character->GetLocalRole() != ROLE_AutonomousProxy;
-		FootLockCurveVal = GetCurveValue(FootLockCurve) * (1.f / GetSkelMeshComponent()->AnimUpdateRateParams->UpdateRate);
+			!Snapshot.bAutonomousProxy;
+		FootLockCurveVal = GetCurveValue(FootLockCurve) * (1.f / Snapshot.UpdateRate);
 	}
 	else
 	{
@@ -701,10 +984,8 @@ void UALSCharacterAnimInstance::SetFootLocking(float DeltaSeconds, FName EnableF
 	// Step 3: If the Foot Lock curve equals 1, save the new lock location and rotation in component space as the target.
 	if (CurFootLockAlpha >= 0.99f)
 	{
-		const FTransform& OwnerTransform =
-			GetOwningComponent()->GetSocketTransform(IKFootBone, RTS_Component);
-		CurFootLockLoc = OwnerTransform.GetLocation();
-		CurFootLockRot = OwnerTransform.Rotator();
+		CurFootLockLoc = FootComponentTransform.GetLocation();
+		CurFootLockRot = FootComponentTransform.Rotator();
 	}
 
 	// Step 4: If the Foot Lock Alpha has a weight,
@@ -720,16 +1001,15 @@ void UALSCharacterAnimInstance::SetFootLockOffsets(float DeltaSeconds, FVector&
 	FRotator RotationDifference = FRotator::ZeroRotator;
 	// Use the delta between the current and last updated rotation to find how much the foot should be rotated
 	// to remain planted on the ground.
-	if (Character->GetCharacterMovement()->IsMovingOnGround())
+	if (Snapshot.bMovingOnGround)
 	{
-		RotationDifference = CharacterInformation.CharacterActorRotation - Character->GetCharacterMovement()->
-			GetLastUpdateRotation();
+		RotationDifference = CharacterInformation.CharacterActorRotation - Snapshot.LastUpdateRotation;
 		RotationDifference.Normalize();
 	}
 
 	// Get the distance traveled between frames relative to the mesh rotation
 	// to find how much the foot should be offset to remain planted on the ground.
-	const FVector& LocationDifference = GetOwningComponent()->GetComponentRotation().UnrotateVector(
+	const FVector& LocationDifference = Snapshot.ComponentTransform.GetRotation().UnrotateVector(
 		CharacterInformation.Velocity * DeltaSeconds);
 
 	// Subtract the location difference from the current local location and rotate
@@ -779,9 +1059,9 @@ void UALSCharacterAnimInstance::ResetIKOffsets(float DeltaSeconds)
 	                                                      FRotator::ZeroRotator, DeltaSeconds, 15.0f);
 }
 
-void UALSCharacterAnimInstance::SetFootOffsets(float DeltaSeconds, FName EnableFootIKCurve, FName IKFootBone,
-                                               FName RootBone, FVector& CurLocationTarget, FVector& CurLocationOffset,
-                                               FRotator& CurRotationOffset)
+void UALSCharacterAnimInstance::SetFootOffsets(float DeltaSeconds, FName EnableFootIKCurve,
+                                               const FALSFootTraceResult& FootTrace, FVector& CurLocationTarget,
+                                               FVector& CurLocationOffset, FRotator& CurRotationOffset)
 {
 	// Only update Foot IK offset values if the Foot IK curve has a weight. If it equals 0, clear the offset values.
 	if (GetCurveValue(EnableFootIKCurve) <= 0)
@@ -791,52 +1071,18 @@ void UALSCharacterAnimInstance::SetFootOffsets(float DeltaSeconds, FName EnableF
 		return;
 	}
 
-	// Step 1: Trace downward from the foot location to find the geometry.
-	// If the surface is walkable, save the Impact Location and Normal.
-	USkeletalMeshComponent* OwnerComp = GetOwningComponent();
-	FVector IKFootFloorLoc = OwnerComp->GetSocketLocation(IKFootBone);
-	IKFootFloorLoc.Z = OwnerComp->GetSocketLocation(RootBone).Z;
-
-	UWorld* World = GetWorld();
-	check(World);
-
-	FCollisionQueryParams Params;
-	Params.AddIgnoredActor(Character);
-
-	const FVector TraceStart = IKFootFloorLoc + FVector(0.0, 0.0, Config.IK_TraceDistanceAboveFoot);
-	const FVector TraceEnd = IKFootFloorLoc - FVector(0.0, 0.0, Config.IK_TraceDistanceBelowFoot);
-
-	FHitResult HitResult;
-	const bool bHit = World->LineTraceSingleByChannel(HitResult,
-	                                                  TraceStart,
-	                                                  TraceEnd,
-	                                                  ECC_Visibility, Params);
-
-	if (ALSDebugComponent && ALSDebugComponent->GetShowTraces())
-	{
-		UALSDebugComponent::DrawDebugLineTraceSingle(
-			World,
-			TraceStart,
-			TraceEnd,
-			EDrawDebugTrace::Type::ForOneFrame,
-			bHit,
-			HitResult,
-			FLinearColor::Red,
-			FLinearColor::Green,
-			5.0f);
-	}
-
+	// Step 1: Use the last completed trace downward from the foot location (see RequestAsyncTraces).
+	// If the surface is walkable, use the Impact Location and Normal.
 	FRotator TargetRotOffset = FRotator::ZeroRotator;
-	if (Character->GetCharacterMovement()->IsWalkable(HitResult))
+	if (FootTrace.bHit && !FootTrace.bWallTrace)
 	{
-		FVector ImpactPoint = HitResult.ImpactPoint;
-		FVector ImpactNormal = HitResult.ImpactNormal;
+		const FVector& ImpactNormal = FootTrace.ImpactNormal;
 
-		// Step 1.1: Find the difference in location from the Impact point and the expected (flat) floor location.
-		// These values are offset by the normal multiplied by the
+		// Step 1.1: Find the difference in location from the Impact point and the expected (flat) floor location
+		// the trace started at. These values are offset by the normal multiplied by the
 		// foot height to get better behavior on angled surfaces.
-		CurLocationTarget = (ImpactPoint + ImpactNormal * Config.FootHeight) -
-			(IKFootFloorLoc + FVector(0, 0, Config.FootHeight));
+		CurLocationTarget = (FootTrace.ImpactOffset + ImpactNormal * Config.FootHeight) -
+			FVector(0, 0, Config.FootHeight);
 
 		// Step 1.2: Calculate the Rotation offset by getting the Atan2 of the Impact Normal.
 		TargetRotOffset.Pitch = -FMath::RadiansToDegrees(FMath::Atan2(ImpactNormal.X, ImpactNormal.Z));
@@ -892,10 +1138,11 @@ void UALSCharacterAnimInstance::TurnInPlaceCheck(float DeltaSeconds)
 	// Step 2: Check if the Elapsed Delay time exceeds the set delay (mapped to the turn angle range). If so, trigger a Turn In Place.
 	if (TurnInPlaceValues.ElapsedDelayTime > ClampedAimAngle)
 	{
-		FRotator TurnInPlaceYawRot = CharacterInformation.AimingRotation;
-		TurnInPlaceYawRot.Roll = 0.0f;
-		TurnInPlaceYawRot.Pitch = 0.0f;
-		TurnInPlace(TurnInPlaceYawRot, 1.0f, 0.0f, false);
+		// Montages can only be played on the game thread, see FlushGameThreadRequests.
+		PendingTurnInPlaceRotation = CharacterInformation.AimingRotation;
+		PendingTurnInPlaceRotation.Roll = 0.0f;
+		PendingTurnInPlaceRotation.Pitch = 0.0f;
+		bPendingTurnInPlace = true;
 	}
 }
 
@@ -905,34 +1152,31 @@ void UALSCharacterAnimInstance::DynamicTransitionCheck()
 	// (determined via a virtual bone) exceeds a threshold. If it does, play an additive transition animation on that foot.
 	// The currently set transition plays the second half of a 2 foot transition animation, so that only a single foot moves.
 	// Because only the IK_Foot bone can be locked, the separate virtual bone allows the system to know its desired location when locked.
-	FTransform SocketTransformA = GetOwningComponent()->GetSocketTransform(IkFootL_BoneName, RTS_Component);
-	FTransform SocketTransformB = GetOwningComponent()->GetSocketTransform(
-		NAME_VB___foot_target_l, RTS_Component);
-	float Distance = (SocketTransformB.GetLocation() - SocketTransformA.GetLocation()).Size();
-	if (Distance > Config.DynamicTransitionThreshold)
+	// Only the first foot can start a transition: the second would be blocked by the re-trigger delay anyway.
+	FALSDynamicMontageParams Params;
+	if (FVector::Distance(Snapshot.FootTargetComponentLocations[0], Snapshot.FootComponentTransforms[0].GetLocation()) >
+		Config.DynamicTransitionThreshold)
 	{
-		FALSDynamicMontageParams Params;
 		Params.Animation = TransitionAnim_R;
-		Params.BlendInTime = 0.2f;
-		Params.BlendOutTime = 0.2f;
-		Params.PlayRate = 1.5f;
-		Params.StartTime = 0.8f;
-		PlayDynamicTransition(0.1f, Params);
 	}
-
-	SocketTransformA = GetOwningComponent()->GetSocketTransform(IkFootR_BoneName, RTS_Component);
-	SocketTransformB = GetOwningComponent()->GetSocketTransform(NAME_VB___foot_target_r, RTS_Component);
-	Distance = (SocketTransformB.GetLocation() - SocketTransformA.GetLocation()).Size();
-	if (Distance > Config.DynamicTransitionThreshold)
+	else if (FVector::Distance(Snapshot.FootTargetComponentLocations[1], Snapshot.FootComponentTransforms[1].GetLocation()) >
+		Config.DynamicTransitionThreshold)
 	{
-		FALSDynamicMontageParams Params;
 		Params.Animation = TransitionAnim_L;
-		Params.BlendInTime = 0.2f;
-		Params.BlendOutTime = 0.2f;
-		Params.PlayRate = 1.5f;
-		Params.StartTime = 0.8f;
-		PlayDynamicTransition(0.1f, Params);
 	}
+	else
+	{
+		return;
+	}
+
+	Params.BlendInTime = 0.2f;
+	Params.BlendOutTime = 0.2f;
+	Params.PlayRate = 1.5f;
+	Params.StartTime = 0.8f;
+
+	// Played from FlushGameThreadRequests.
+	PendingDynamicTransition = Params;
+	bPendingDynamicTransition = true;
 }
 
 void UALSCharacterAnimInstance::UpdateMovementValues(float DeltaSeconds)
@@ -1001,8 +1245,7 @@ void UALSCharacterAnimInstance::UpdateInAirValues(float DeltaSeconds)
 void UALSCharacterAnimInstance::UpdateRagdollValues()
 {
 	// Scale the Flail Rate by the velocity length. The faster the ragdoll moves, the faster the character will flail.
-	const float VelocityLength = GetOwningComponent()->GetPhysicsLinearVelocity(NAME__ALSCharacterAnimInstance__root).Size();
-	FlailRate = FMath::GetMappedRangeValueClamped<float, float>({0.0f, 1000.0f}, {0.0f, 1.0f}, VelocityLength);
+	FlailRate = FMath::GetMappedRangeValueClamped<float, float>({0.0f, 1000.0f}, {0.0f, 1.0f}, Snapshot.RagdollRootSpeed);
 }
 
 float UALSCharacterAnimInstance::GetAnimCurveClamped(const FName& Name, float Bias, float ClampMin,
@@ -1036,12 +1279,12 @@ FVector UALSCharacterAnimInstance::CalculateRelativeAccelerationAmount() const
 	// and 1 equals the Max Acceleration of the Character Movement Component.
 	if (FVector::DotProduct(CharacterInformation.Acceleration, CharacterInformation.Velocity) > 0.0f)
 	{
-		const float MaxAcc = Character->GetCharacterMovement()->GetMaxAcceleration();
+		const float MaxAcc = Snapshot.MaxAcceleration;
 		return CharacterInformation.CharacterActorRotation.UnrotateVector(
 			CharacterInformation.Acceleration.GetClampedToMaxSize(MaxAcc) / MaxAcc);
 	}
 
-	const float MaxBrakingDec = Character->GetCharacterMovement()->GetMaxBrakingDeceleration();
+	const float MaxBrakingDec = Snapshot.MaxBrakingDeceleration;
 	return
 		CharacterInformation.CharacterActorRotation.UnrotateVector(
 			CharacterInformation.Acceleration.GetClampedToMaxSize(MaxBrakingDec) / MaxBrakingDec);
@@ -1054,7 +1297,7 @@ float UALSCharacterAnimInstance::CalculateStrideBlend() const
 	// It also allows the walk or run gait animations to blend independently while still matching the animation speed to
 	// the movement speed, preventing the character from needing to play a half walk+half run blend.
 	// The curves are used to map the stride amount to the speed for maximum control.
-	const float CurveTime = CharacterInformation.Speed / GetOwningComponent()->GetComponentScale().Z;
+	const float CurveTime = CharacterInformation.Speed / Snapshot.ComponentTransform.GetScale3D().Z;
 	const float ClampedGait = GetAnimCurveClamped(NAME_W_Gait, -1.0, 0.0f, 1.0f);
 	const float LerpedStrideBlend =
 		FMath::Lerp(StrideBlend_N_Walk->GetFloatValue(CurveTime), StrideBlend_N_Run->GetFloatValue(CurveTime),
@@ -1082,7 +1325,7 @@ float UALSCharacterAnimInstance::CalculateStandingPlayRate() const
 	const float SprintAffectedSpeed = FMath::Lerp(LerpedSpeed, CharacterInformation.Speed / Config.AnimatedSprintSpeed,
 	                                              GetAnimCurveClamped(NAME_W_Gait, -2.0f, 0.0f, 1.0f));
 
-	return FMath::Clamp((SprintAffectedSpeed / Grounded.StrideBlend) / GetOwningComponent()->GetComponentScale().Z,
+	return FMath::Clamp((SprintAffectedSpeed / Grounded.StrideBlend) / Snapshot.ComponentTransform.GetScale3D().Z,
 	                    0.0f, 3.0f);
 }
 
@@ -1099,64 +1342,24 @@ float UALSCharacterAnimInstance::CalculateCrouchingPlayRate() const
 	// Calculate the Crouching Play Rate by dividing the Character's speed by the Animated Speed.
 	// This value needs to be separate from the standing play rate to improve the blend from crouch to stand while in motion.
 	return FMath::Clamp(
-		CharacterInformation.Speed / Config.AnimatedCrouchSpeed / Grounded.StrideBlend / GetOwningComponent()->
-		GetComponentScale().Z,
+		CharacterInformation.Speed / Config.AnimatedCrouchSpeed / Grounded.StrideBlend /
+		Snapshot.ComponentTransform.GetScale3D().Z,
 		0.0f, 2.0f);
 }
 
 float UALSCharacterAnimInstance::CalculateLandPrediction() const
 {
-	// Calculate the land prediction weight by tracing in the velocity direction to find a walkable surface the character
-	// is falling toward, and getting the 'Time' (range of 0-1, 1 being maximum, 0 being about to land) till impact.
-	// The Land Prediction Curve is used to control how the time affects the final weight for a smooth blend.
-	if (InAir.FallSpeed >= -200.0f)
+	// Calculate the land prediction weight from the last capsule sweep in the velocity direction (see RequestAsyncTraces)
+	// that found a walkable surface the character is falling toward, using its 'Time' (range of 0-1, 1 being maximum,
+	// 0 being about to land) till impact. The Land Prediction Curve is used to control how the time affects the final
+	// weight for a smooth blend.
+	if (InAir.FallSpeed >= -200.0f || LandPredictionTime < 0.0f)
 	{
 		return 0.0f;
 	}
 
-	const UCapsuleComponent* CapsuleComp = Character->GetCapsuleComponent();
-	const FVector& CapsuleWorldLoc = CapsuleComp->GetComponentLocation();
-	const float VelocityZ = CharacterInformation.Velocity.Z;
-	FVector VelocityClamped = CharacterInformation.Velocity;
-	VelocityClamped.Z = FMath::Clamp(VelocityZ, -4000.0f, -200.0f);
-	VelocityClamped.Normalize();
-
-	const FVector TraceLength = VelocityClamped * FMath::GetMappedRangeValueClamped<float, float>(
-		{0.0f, -4000.0f}, {50.0f, 2000.0f}, VelocityZ);
-
-	UWorld* World = GetWorld();
-	check(World);
-
-	FCollisionQueryParams Params;
-	Params.AddIgnoredActor(Character);
-
-	FHitResult HitResult;
-	const FCollisionShape CapsuleCollisionShape = FCollisionShape::MakeCapsule(CapsuleComp->GetUnscaledCapsuleRadius(),
-	                                                                           CapsuleComp->GetUnscaledCapsuleHalfHeight());
-	const bool bHit = World->SweepSingleByChannel(HitResult, CapsuleWorldLoc, CapsuleWorldLoc + TraceLength, FQuat::Identity,
-	                                              ECC_Visibility, CapsuleCollisionShape, Params);
-
-	if (ALSDebugComponent && ALSDebugComponent->GetShowTraces())
-	{
-		UALSDebugComponent::DrawDebugCapsuleTraceSingle(World,
-		                                                CapsuleWorldLoc,
-		                                                CapsuleWorldLoc + TraceLength,
-		                                                CapsuleCollisionShape,
-		                                                EDrawDebugTrace::Type::ForOneFrame,
-		                                                bHit,
-		                                                HitResult,
-		                                                FLinearColor::Red,
-		                                                FLinearColor::Green,
-		                                                5.0f);
-	}
-
-	if (Character->GetCharacterMovement()->IsWalkable(HitResult))
-	{
-		return FMath::Lerp(LandPredictionCurve->GetFloatValue(HitResult.Time), 0.0f,
-		                   GetCurveValue(NAME_Mask_LandPrediction));
-	}
-
-	return 0.0f;
+	return FMath::Lerp(LandPredictionCurve->GetFloatValue(LandPredictionTime), 0.0f,
+	                   GetCurveValue(NAME_Mask_LandPrediction));
 }
 
 FALSLeanAmount UALSCharacterAnimInstance::CalculateAirLeanAmount() const
@@ -388,7 +388,23 @@ void UALSMantleComponent::MantleEnd()
 	}
 
 	// Enable ticking back after mantle ends
-	SetComponentTickEnabledAsync(true);
+	SetComponentTickEnabledAsync(bMantleChecksEnabled);
+}
+
+void UALSMantleComponent::SetMantleChecksEnabled(bool bEnabled)
+{
+	if (bMantleChecksEnabled == bEnabled)
+	{
+		return;
+	}
+
+	bMantleChecksEnabled = bEnabled;
+
+	// While mantling the tick stays off and MantleEnd restores it.
+	if (!OwnerCharacter || OwnerCharacter->GetMovementState() != EALSMovementState::Mantling)
+	{
+		SetComponentTickEnabled(bEnabled);
+	}
 }
 
 void UALSMantleComponent::OnOwnerJumpInput()
@@ -8,6 +8,7 @@
 #include "Library/ALSAnimationStructLibrary.h"
 #include "Library/ALSCharacterStructLibrary.h"
 #include "Library/ALSStructEnumLibrary.h"
+#include "WorldCollision.h"
 
 #include "ALSCharacterAnimInstance.generated.h"
 
@@ -18,8 +19,64 @@ class UCurveFloat;
 class UAnimSequence;
 class UCurveVector;
 
+/** Result of a foot IK trace, kept until the next one for that foot completes. */
+struct FALSFootTraceResult
+{
+	/** Impact point minus the foot location the trace was built from, world space. */
+	FVector ImpactOffset = FVector::ZeroVector;
+
+	FVector ImpactNormal = FVector::UpVector;
+
+	/** Walkable ground for a floor trace, or the requested surface for a wall trace. */
+	bool bHit = false;
+
+	bool bWallTrace = false;
+};
+
+/**
+ * Everything the thread-safe update needs from the character and mesh, copied in
+ * NativeUpdateAnimation so the worker never touches either.
+ */
+struct FALSAnimGameThreadSnapshot
+{
+	FTransform ComponentTransform = FTransform::Identity;
+
+	/** IK foot bones in component space, left then right. */
+	FTransform FootComponentTransforms[2];
+
+	/** IK foot bones in world space, left then right. */
+	FVector FootWorldLocations[2] = {FVector::ZeroVector, FVector::ZeroVector};
+
+	/** Dynamic transition virtual bones in component space, left then right. */
+	FVector FootTargetComponentLocations[2] = {FVector::ZeroVector, FVector::ZeroVector};
+
+	FVector FootIKSurfaceNormal = FVector::ZeroVector;
+
+	FRotator LastUpdateRotation = FRotator::ZeroRotator;
+
+	float MaxAcceleration = 0.0f;
+
+	float MaxBrakingDeceleration = 0.0f;
+
+	float UpdateRate = 1.0f;
+
+	float RagdollRootSpeed = 0.0f;
+
+	bool bMovingOnGround = false;
+
+	bool bAutonomousProxy = false;
+
+	bool bFootIKEnabled = true;
+};
+
 /**
  * Main anim instance class for character
+ *
+ * NativeUpdateAnimation only copies character state into a snapshot, reads last frame's
+ * async foot IK and land prediction traces and issues this frame's. All blend and IK
+ * math runs in NativeThreadSafeUpdateAnimation, which is on a worker thread when the anim
+ * blueprint has multi-threaded update enabled. Montages requested by the update (turn in
+ * place, dynamic transitions) are played back on the game thread after evaluation.
  */
 UCLASS(Blueprintable, BlueprintType)
 class ALSV4_CPP_API UALSCharacterAnimInstance : public UAnimInstance
@@ -33,6 +90,10 @@ public:
 
 	virtual void NativeUpdateAnimation(float DeltaSeconds) override;
 
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
+
+	virtual void NativePostEvaluateAnimation() override;
+
 	UFUNCTION(BlueprintCallable, Category = "ALS|Animation")
 	void PlayTransition(const FALSDynamicMontageParams& Parameters);
 
@@ -48,6 +109,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ALS|Event")
 	void OnPivot();
 
+	/**
+	 * Update cost of every ALS anim instance since the last call, split into the game-thread
+	 * and thread-safe halves, then reset. Run with ALS.ThreadSafeAnimUpdate 0 for the
+	 * game-thread-only baseline. Also available as the ALS.ReportAnimTimings console command.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ALS|Debug")
+	static FALSAnimUpdateTimings ConsumeUpdateTimings();
+
 protected:
 
 	UFUNCTION(BlueprintCallable, Category = "ALS|Grounded")
@@ -93,8 +162,27 @@ private:
 
 	void OnPivotDelay();
 
+	/** Game Thread */
+
+	void GatherGameThreadSnapshot();
+
+	/** Read the traces issued on the previous update into FootTraces and LandPredictionTime. */
+	void ConsumeAsyncTraces();
+
+	void RequestAsyncTraces();
+
+	void RequestFootTrace(int32 FootIndex, const FVector& Origin, const FVector& Normal, bool bWallTrace);
+
+	/** Play the montages the last update asked for. */
+	void FlushGameThreadRequests();
+
 	/** Update Values */
 
+	/** Everything NativeUpdateAnimation used to do after reading the character. Reads only the snapshot. */
+	void UpdateFromSnapshot(float DeltaSeconds);
+
+	void UpdateWallTraversalValues(float DeltaSeconds);
+
 	void UpdateAimingValues(float DeltaSeconds);
 
 	void UpdateLayerValues();
@@ -111,7 +199,8 @@ private:
 
 	/** Foot IK */
 
-	void SetFootLocking(float DeltaSeconds, FName EnableFootIKCurve, FName FootLockCurve, FName IKFootBone,
+	void SetFootLocking(float DeltaSeconds, FName EnableFootIKCurve, FName FootLockCurve,
+	                    const FTransform& FootComponentTransform,
                           float& CurFootLockAlpha, bool& UseFootLockCurve,
                           FVector& CurFootLockLoc, FRotator& CurFootLockRot);
 
@@ -121,17 +210,17 @@ private:
 
 	void ResetIKOffsets(float DeltaSeconds);
 
-	void SetFootOffsets(float DeltaSeconds, FName EnableFootIKCurve, FName IKFootBone, FName RootBone,
+	void SetFootOffsets(float DeltaSeconds, FName EnableFootIKCurve, const FALSFootTraceResult& FootTrace,
 	                    FVector& CurLocationTarget, FVector& CurLocationOffset, FRotator& CurRotationOffset);
 
-	void SetWallFootOffsets(float DeltaSeconds, FName EnableFootIKCurve, FName IKFootBone,
-	                        const FVector& SurfaceNormal, FVector& CurLocationTarget,
+	void SetWallFootOffsets(float DeltaSeconds, FName EnableFootIKCurve, const FALSFootTraceResult& FootTrace,
+	                        FVector& CurLocationTarget,
 	                        FVector& CurLocationOffset, FRotator& CurRotationOffset);
 
 	void SetTransitionFootOffset(
 		float DeltaSeconds,
 		FName EnableFootIKCurve,
-		FName IKFootBone,
+		const FVector& FootLocation,
 		const FVector& StartSurfacePoint,
 		const FVector& StartSurfaceNormal,
 		const FVector& TargetSurfacePoint,
@@ -154,6 +243,7 @@ private:
 
 	FALSVelocityBlend CalculateVelocityBlend() const;
 
+	/** Game thread only; the update queues it through PendingTurnInPlaceRotation. */
 	void TurnInPlace(FRotator TargetRotation, float PlayRateScale, float StartTime, bool OverrideCurrent);
 
 	/** Movement */
@@ -369,6 +459,14 @@ public:
 		meta = (ClampMin = "0.0"))
 	float MaxWallTransitionFootIKOffset = 100.0f;
 
+	/** Foot IK traces, foot locking and pelvis offset. Off relaxes the feet to the animated pose. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Configuration|Level Of Detail")
+	bool bEnableFootIK = true;
+
+	/** Land prediction sweep while falling. Off leaves the land prediction weight at 0. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Configuration|Level Of Detail")
+	bool bEnableLandPrediction = true;
+
 	/** Keeps procedural transition IK active even if the source animation lacks foot curves. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Configuration|Anim Graph - Wall Traversal",
 		meta = (ClampMin = "0.0", ClampMax = "1.0"))
@@ -383,6 +481,40 @@ private:
 
 	bool bCanPlayDynamicTransition = true;
 
+	/** Written by NativeUpdateAnimation, read by the thread-safe update. */
+	FALSAnimGameThreadSnapshot Snapshot;
+
+	/** False while there is no character or the frame has no time step; the update then does nothing. */
+	bool bSnapshotValid = false;
+
+	/** In-flight async traces from the last update, left then right foot. */
+	FTraceHandle FootTraceHandles[2];
+
+	/** Origin and normal each in-flight foot trace was built from. */
+	FVector FootTraceOrigins[2] = {FVector::ZeroVector, FVector::ZeroVector};
+
+	FVector FootTraceNormals[2] = {FVector::UpVector, FVector::UpVector};
+
+	bool bFootTraceIsWall[2] = {false, false};
+
+	FALSFootTraceResult FootTraces[2];
+
+	FTraceHandle LandPredictionTraceHandle;
+
+	FCollisionShape LandPredictionTraceShape;
+
+	/** Hit time of the last walkable land prediction sweep, or a negative value for none. */
+	float LandPredictionTime = -1.0f;
+
+	/** Montage requests from the thread-safe update, played in FlushGameThreadRequests. */
+	bool bPendingTurnInPlace = false;
+
+	FRotator PendingTurnInPlaceRotation = FRotator::ZeroRotator;
+
+	bool bPendingDynamicTransition = false;
+
+	FALSDynamicMontageParams PendingDynamicTransition;
+
 	UPROPERTY()
 	TObjectPtr<UALSDebugComponent> ALSDebugComponent = nullptr;
 };
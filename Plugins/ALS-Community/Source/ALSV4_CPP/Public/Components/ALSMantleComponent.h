@@ -43,6 +43,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ALS|Mantle System")
 	void OnOwnerRagdollStateChanged(bool bRagdollState);
 
+	/**
+	 * Turn the per-tick mantle check while falling on or off. Disabled, the component stops ticking
+	 * outside a mantle; checks on jump input still run.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ALS|Mantle System")
+	void SetMantleChecksEnabled(bool bEnabled);
+
+	UFUNCTION(BlueprintPure, Category = "ALS|Mantle System")
+	bool AreMantleChecksEnabled() const { return bMantleChecksEnabled; }
+
 	/** Implement on BP to get correct mantle parameter set according to character state */
 	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category = "ALS|Mantle System")
 	FALSMantleAsset GetMantleAsset(EALSMantleType MantleType, EALSOverlayState CurrentOverlayState);
@@ -112,4 +122,6 @@ private:
 
 	UPROPERTY()
 	TObjectPtr<UALSDebugComponent> ALSDebugComponent = nullptr;
+
+	bool bMantleChecksEnabled = true;
 };
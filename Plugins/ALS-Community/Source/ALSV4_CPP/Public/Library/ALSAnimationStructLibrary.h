@@ -489,3 +489,28 @@ struct FALSAnimConfiguration
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS|Main Configuration")
 	float IK_TraceDistanceBelowFoot = 45.0f;
 };
+
+/** Anim instance update cost across all ALS characters, split by the thread it ran on. */
+USTRUCT(BlueprintType)
+struct FALSAnimUpdateTimings
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "ALS|Debug")
+	int32 Frames = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ALS|Debug")
+	int32 InstanceUpdates = 0;
+
+	/** Snapshot, trace bookkeeping and montage requests. Always on the game thread. */
+	UPROPERTY(BlueprintReadOnly, Category = "ALS|Debug")
+	double GameThreadMilliseconds = 0.0;
+
+	/** Blend and IK math. On a worker when the anim blueprint uses multi-threaded update and ALS.ThreadSafeAnimUpdate is 1. */
+	UPROPERTY(BlueprintReadOnly, Category = "ALS|Debug")
+	double UpdateMilliseconds = 0.0;
+
+	/** Foot IK and land prediction queries issued asynchronously instead of traced inline. */
+	UPROPERTY(BlueprintReadOnly, Category = "ALS|Debug")
+	int32 AsyncTraces = 0;
+};
@@ -10,6 +10,7 @@ public class ALS_ProjectHunterTarget : TargetRules
 		Type = TargetType.Game;
 		DefaultBuildSettings = BuildSettingsVersion.V6;
 		IncludeOrderVersion = EngineIncludeOrderVersion.Unreal5_7;
+		bWithPushModel = true;
 		ExtraModuleNames.Add("ALS_ProjectHunter");
 	}
 }
@@ -27,7 +27,8 @@ public class ALS_ProjectHunter : ModuleRules
 		{
 			"Slate",
 			"SlateCore",
-			"GameplayTasks"
+			"GameplayTasks",
+			"NetCore"
 		});
 	}
 }
@@ -1,5 +1,6 @@
 #include "AI/Mob/MobManagerActor.h"
 #include "AI/Mob/MobPoolSubsystem.h"
+#include "AI/Mob/MobSpawnSchedulerSubsystem.h"
 #include "AI/Mob/MobWanderInterface.h"
 #include "AI/Helpers/MobSpawnConditionEvaluator.h"
 #include "AI/ALSAIController.h"
@@ -46,6 +47,36 @@ void AMobManagerActor::BeginPlay()
 		CachedPoolSubsystem = GetWorld()->GetSubsystem<UMobPoolSubsystem>();
 	}
 
+	if (bUseSpawnScheduler && GetWorld())
+	{
+		CachedSpawnScheduler = GetWorld()->GetSubsystem<UMobSpawnSchedulerSubsystem>();
+	}
+
+	if (bUseSpawnPointCache && HasAuthority())
+	{
+		CacheTickValues();
+
+		const bool bBakeStillValid = BakedSpawnPoints.Num() > 0
+			&& BakedSpawnAreaTransform.Equals(CachedBoxXform, 1.0f)
+			&& BakedSpawnAreaExtent.Equals(CachedBoxExtent, 1.0f);
+
+		SpawnPointCache.Reset();
+		if (bBakeStillValid)
+		{
+			SpawnPointCache = BakedSpawnPoints;
+		}
+		else
+		{
+			RefillSpawnPointCache(0.0);
+		}
+		SpawnPointCacheBuildTime = GetWorld()->GetTimeSeconds();
+
+		UE_LOG(LogMobManager, Log,
+			TEXT("[%s] BeginPlay: spawn-point cache ready (%d/%d points, %s)"),
+			*GetName(), SpawnPointCache.Num(), SpawnPointCacheSize,
+			bBakeStillValid ? TEXT("editor bake") : TEXT("runtime bake"));
+	}
+
 	if (bAutoActivate && HasAuthority())
 	{
 		StartSpawning();
@@ -59,6 +90,10 @@ void AMobManagerActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 	GetWorldTimerManager().ClearTimer(InitialBurstTimerHandle);
 
+	if (CachedSpawnScheduler)
+	{
+		CachedSpawnScheduler->CancelSpawnRequests(this);
+	}
 
 	for (FTimerHandle& Handle : PendingRecycleTimers)
 	{
@@ -145,7 +180,7 @@ void AMobManagerActor::StartSpawning()
 				{
 					while (Filled < SlotsToFill && Self->GetActiveCount() < Self->MaxNumOfMobs)
 					{
-						const int32 Count = Self->SpawnBatch();
+						const int32 Count = Self->SpawnBatch(Self->GetSpawnBudgetSeconds());
 						if (Count == 0) { break; }
 						Filled += Count;
 					}
@@ -155,7 +190,7 @@ void AMobManagerActor::StartSpawning()
 					for (int32 i = 0; i < SlotsToFill; ++i)
 					{
 						if (Self->GetActiveCount() >= Self->MaxNumOfMobs) { break; }
-						if (!Self->TrySpawnMob()) { break; }
+						if (!Self->TrySpawnMob(Self->GetSpawnBudgetSeconds())) { break; }
 						++Filled;
 					}
 				}
@@ -181,6 +216,11 @@ void AMobManagerActor::StopAndClear()
 	ManagerState = EMobManagerState::Disabled;
 	GetWorldTimerManager().ClearTimer(SpawnTimerHandle);
 
+	if (CachedSpawnScheduler)
+	{
+		CachedSpawnScheduler->CancelSpawnRequests(this);
+	}
+
 	for (FTimerHandle& Handle : PendingRecycleTimers)
 	{
 		GetWorldTimerManager().ClearTimer(Handle);
@@ -213,7 +253,7 @@ void AMobManagerActor::ForceSpawnOne()
 	if (!HasAuthority()) { return; }
 
 	CacheTickValues();
-	TrySpawnMob();
+	TrySpawnMob(GetSpawnBudgetSeconds());
 }
 
 void AMobManagerActor::ForceSpawnBatch()
@@ -224,11 +264,11 @@ void AMobManagerActor::ForceSpawnBatch()
 
 	if (bSpawnInPacks)
 	{
-		SpawnBatch();
+		SpawnBatch(GetSpawnBudgetSeconds());
 	}
 	else
 	{
-		TrySpawnMob();
+		TrySpawnMob(GetSpawnBudgetSeconds());
 	}
 }
 
@@ -296,7 +336,49 @@ void AMobManagerActor::SpawnTick()
 		return;
 	}
 
-	
+	if (bUseSpawnScheduler && CachedSpawnScheduler)
+	{
+		CachedSpawnScheduler->EnqueueSpawnRequest(this);
+		return;
+	}
+
+	RunSpawnTick();
+}
+
+void AMobManagerActor::ExecuteScheduledSpawnTick(double BudgetSeconds)
+{
+	if (ManagerState != EMobManagerState::Active || !HasAuthority())
+	{
+		return;
+	}
+
+	// Fully spent scheduler budget still gets a token slice so this tick can
+	// run at least its first validation batch instead of silently doing nothing.
+	ScheduledBudgetSeconds = FMath::Max(BudgetSeconds, 0.0001);
+	RunSpawnTick();
+	ScheduledBudgetSeconds = 0.0;
+}
+
+double AMobManagerActor::GetSpawnBudgetSeconds() const
+{
+	const double OwnBudgetSeconds = SpawnBudgetMs > 0.0f
+		? (static_cast<double>(SpawnBudgetMs) / 1000.0)
+		: 0.0;
+
+	if (ScheduledBudgetSeconds <= 0.0)
+	{
+		return OwnBudgetSeconds;
+	}
+
+	return OwnBudgetSeconds > 0.0
+		? FMath::Min(OwnBudgetSeconds, ScheduledBudgetSeconds)
+		: ScheduledBudgetSeconds;
+}
+
+void AMobManagerActor::RunSpawnTick()
+{
+	const double TickStartSeconds = FPlatformTime::Seconds();
+
 	CleanActiveMobs();
 
 
@@ -323,6 +405,14 @@ void AMobManagerActor::SpawnTick()
 
 	bFullEventFired = false;
 
+	// One slice for the whole tick: every spawn call (SpawnActor included) and
+	// the cache refill draw from it, so the scheduler's per-frame budget holds.
+	// 0 stays unbudgeted.
+	const double TickBudgetSeconds = GetSpawnBudgetSeconds();
+	const auto GetRemainingBudgetSeconds = [TickBudgetSeconds, TickStartSeconds]()
+	{
+		return TickBudgetSeconds - (FPlatformTime::Seconds() - TickStartSeconds);
+	};
 
 	if (bSpawnInPacks)
 	{
@@ -330,7 +420,10 @@ void AMobManagerActor::SpawnTick()
 		int32 PacksThisTick = 0;
 		while (PacksThisTick < MaxSpawnsPerTick && GetActiveCount() < MaxNumOfMobs)
 		{
-			const int32 BatchCount = SpawnBatch();
+			const double RemainingSeconds = TickBudgetSeconds > 0.0 ? GetRemainingBudgetSeconds() : 0.0;
+			if (TickBudgetSeconds > 0.0 && RemainingSeconds <= 0.0) { break; }
+
+			const int32 BatchCount = SpawnBatch(RemainingSeconds);
 			if (BatchCount == 0) { break; }
 			++PacksThisTick;
 		}
@@ -340,17 +433,29 @@ void AMobManagerActor::SpawnTick()
 		for (int32 i = 0; i < MaxSpawnsPerTick; ++i)
 		{
 			if (GetActiveCount() >= MaxNumOfMobs) { break; }
-			if (!TrySpawnMob()) { break; }
+
+			const double RemainingSeconds = TickBudgetSeconds > 0.0 ? GetRemainingBudgetSeconds() : 0.0;
+			if (TickBudgetSeconds > 0.0 && RemainingSeconds <= 0.0) { break; }
+
+			if (!TrySpawnMob(RemainingSeconds)) { break; }
 		}
 	}
 
+	if (bUseSpawnPointCache)
+	{
+		// Expiry always runs; only the refill is skipped once the slice is spent.
+		const double RemainingSeconds = TickBudgetSeconds > 0.0 ? GetRemainingBudgetSeconds() : 0.0;
+		const bool bCanRefill = TickBudgetSeconds <= 0.0 || RemainingSeconds > 0.0;
+		MaintainSpawnPointCache(bCanRefill, RemainingSeconds);
+	}
+
 	if (bShowDebug)
 	{
 		DrawDebugVisuals();
 	}
 }
 
-bool AMobManagerActor::TrySpawnMob()
+bool AMobManagerActor::TrySpawnMob(double BudgetSeconds)
 {
 	
 	const int32 TypeIndex = GetWeightedRandomMobTypeIndex();
@@ -372,28 +477,29 @@ bool AMobManagerActor::TrySpawnMob()
 
 	
 	const double BudgetStartSeconds = FPlatformTime::Seconds();
-	const double BudgetLimitSeconds = SpawnBudgetMs > 0.0f
-		? (static_cast<double>(SpawnBudgetMs) / 1000.0)
-		: 0.0;
 
 	for (int32 Attempt = 0; Attempt < MaxSpawnAttempts; ++Attempt)
 	{
 
-		if (BudgetLimitSeconds > 0.0 && (Attempt & 3) == 3)
+		if (BudgetSeconds > 0.0 && (Attempt & 3) == 3)
 		{
-			if ((FPlatformTime::Seconds() - BudgetStartSeconds) >= BudgetLimitSeconds)
+			if ((FPlatformTime::Seconds() - BudgetStartSeconds) >= BudgetSeconds)
 			{
 				UE_LOG(LogMobManager, Verbose,
 					TEXT("[%s] TrySpawnMob: budget exhausted (%.1fms) after %d/%d attempts"),
-					*GetName(), SpawnBudgetMs, Attempt, MaxSpawnAttempts);
+					*GetName(), BudgetSeconds * 1000.0, Attempt, MaxSpawnAttempts);
 				break;
 			}
 		}
 
 		FVector SpawnLoc = FVector::ZeroVector;
-		bool bGotLocation = false;
 
-		if (bUseSmartSpawnPlacement && CachedPlayerLocations.Num() > 0 && MinDistanceFromPlayer > 0.0f)
+		// Cached points were nav/ground/collision-validated when baked, so only
+		// the player-distance filter (done inside the pick) applies to them.
+		const bool bFromCache = bUseSpawnPointCache && TakeCachedSpawnLocation(SpawnLoc);
+		bool bGotLocation = bFromCache;
+
+		if (!bGotLocation && bUseSmartSpawnPlacement && CachedPlayerLocations.Num() > 0 && MinDistanceFromPlayer > 0.0f)
 		{
 			bGotLocation = GetSmartSpawnLocation(SpawnLoc);
 		}
@@ -408,14 +514,14 @@ bool AMobManagerActor::TrySpawnMob()
 		}
 
 		const bool bNeedDistCheck = (MinDistanceFromPlayer > 0.0f || MaxDistanceFromPlayer > 0.0f);
-		if (bNeedDistCheck && !CheckDistanceFromPlayers(SpawnLoc))
+		if (!bFromCache && bNeedDistCheck && !CheckDistanceFromPlayers(SpawnLoc))
 		{
 			++DistanceFailCount;
 			RecordDebugAttempt(SpawnLoc, false, EMobSpawnFailReason::DistanceFailed);
 			continue;
 		}
 
-		if (bUseCollisionCheck && !CheckCollision(SpawnLoc))
+		if (!bFromCache && bUseCollisionCheck && !CheckCollision(SpawnLoc))
 		{
 			RecordDebugAttempt(SpawnLoc, false, EMobSpawnFailReason::CollisionFailed);
 			continue;
@@ -473,7 +579,7 @@ bool AMobManagerActor::TrySpawnMob()
 	return false;
 }
 
-int32 AMobManagerActor::SpawnBatch()
+int32 AMobManagerActor::SpawnBatch(double BudgetSeconds)
 {
 	const int32 TypeIndex = GetWeightedRandomMobTypeIndex();
 	if (TypeIndex == INDEX_NONE)
@@ -488,14 +594,11 @@ int32 AMobManagerActor::SpawnBatch()
 
 
 	const double BudgetStartSeconds = FPlatformTime::Seconds();
-	const double BudgetLimitSeconds = SpawnBudgetMs > 0.0f
-		? (static_cast<double>(SpawnBudgetMs) / 1000.0)
-		: 0.0;
 
 	auto IsBudgetExhausted = [&]() -> bool
 	{
-		return BudgetLimitSeconds > 0.0
-			&& (FPlatformTime::Seconds() - BudgetStartSeconds) >= BudgetLimitSeconds;
+		return BudgetSeconds > 0.0
+			&& (FPlatformTime::Seconds() - BudgetStartSeconds) >= BudgetSeconds;
 	};
 
 	FVector LeaderLoc = FVector::ZeroVector;
@@ -512,6 +615,15 @@ int32 AMobManagerActor::SpawnBatch()
 		}
 
 		FVector SpawnLoc = FVector::ZeroVector;
+
+		const bool bFromCache = bUseSpawnPointCache && TakeCachedSpawnLocation(SpawnLoc);
+		if (bFromCache)
+		{
+			LeaderLoc = SpawnLoc;
+			bFoundLeader = true;
+			break;
+		}
+
 		bool bGotLocation = false;
 
 		if (bUseSmartSpawnPlacement && CachedPlayerLocations.Num() > 0 && MinDistanceFromPlayer > 0.0f)
@@ -884,6 +996,169 @@ bool AMobManagerActor::CheckGround(FVector Candidate, FVector& OutGroundLocation
 	return false;
 }
 
+bool AMobManagerActor::TakeCachedSpawnLocation(FVector& OutLocation, bool bConsume)
+{
+	const int32 NumPoints = SpawnPointCache.Num();
+	if (NumPoints == 0) { return false; }
+
+	const bool bNeedDistCheck = (MinDistanceFromPlayer > 0.0f || MaxDistanceFromPlayer > 0.0f);
+	const int32 StartIndex = FMath::RandRange(0, NumPoints - 1);
+
+	for (int32 Offset = 0; Offset < NumPoints; ++Offset)
+	{
+		const int32 Index = (StartIndex + Offset) % NumPoints;
+		if (bNeedDistCheck && !CheckDistanceFromPlayers(SpawnPointCache[Index]))
+		{
+			continue;
+		}
+
+		OutLocation = SpawnPointCache[Index];
+		if (bConsume)
+		{
+			SpawnPointCache.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		}
+		return true;
+	}
+
+	return false;
+}
+
+int32 AMobManagerActor::RefillSpawnPointCache(double BudgetSeconds)
+{
+	const int32 Missing = SpawnPointCacheSize - SpawnPointCache.Num();
+	if (Missing <= 0) { return 0; }
+
+	SpawnPointCache.Reserve(SpawnPointCacheSize);
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	const int32 MaxAttempts = Missing * FMath::Max(1, SpawnPointBakeAttemptsPerPoint);
+	int32 Added = 0;
+
+	for (int32 Attempt = 0; Attempt < MaxAttempts && Added < Missing; ++Attempt)
+	{
+		if (BudgetSeconds > 0.0 && (Attempt & 3) == 3
+			&& (FPlatformTime::Seconds() - StartSeconds) >= BudgetSeconds)
+		{
+			break;
+		}
+
+		FVector Candidate;
+		if (!GetRandomSpawnLocation(Candidate)) { continue; }
+		if (bUseCollisionCheck && !CheckCollision(Candidate)) { continue; }
+
+		SpawnPointCache.Add(Candidate);
+		++Added;
+	}
+
+	return Added;
+}
+
+void AMobManagerActor::MaintainSpawnPointCache(bool bRefill, double RefillBudgetSeconds)
+{
+	UWorld* World = GetWorld();
+	if (!World) { return; }
+
+	const float Now = World->GetTimeSeconds();
+	if (SpawnPointCacheRefreshInterval > 0.0f
+		&& (Now - SpawnPointCacheBuildTime) >= SpawnPointCacheRefreshInterval)
+	{
+		SpawnPointCache.Reset();
+		SpawnPointCacheBuildTime = Now;
+	}
+
+	if (!bRefill) { return; }
+
+	const int32 Added = RefillSpawnPointCache(RefillBudgetSeconds);
+
+	if (Added > 0)
+	{
+		UE_LOG(LogMobManager, VeryVerbose,
+			TEXT("[%s] MaintainSpawnPointCache: +%d points (%d/%d)"),
+			*GetName(), Added, SpawnPointCache.Num(), SpawnPointCacheSize);
+	}
+}
+
+void AMobManagerActor::BakeSpawnPoints()
+{
+	if (!GetWorld()) { return; }
+
+	CacheTickValues();
+
+	SpawnPointCache.Reset();
+	RefillSpawnPointCache(0.0);
+	SpawnPointCacheBuildTime = GetWorld()->GetTimeSeconds();
+
+	Modify();
+	BakedSpawnPoints = SpawnPointCache;
+	BakedSpawnAreaTransform = CachedBoxXform;
+	BakedSpawnAreaExtent = CachedBoxExtent;
+
+	UE_LOG(LogMobManager, Log,
+		TEXT("[%s] BakeSpawnPoints: baked %d/%d points"),
+		*GetName(), BakedSpawnPoints.Num(), SpawnPointCacheSize);
+}
+
+void AMobManagerActor::InvalidateSpawnPointCache()
+{
+	SpawnPointCache.Reset();
+	if (const UWorld* World = GetWorld())
+	{
+		SpawnPointCacheBuildTime = World->GetTimeSeconds();
+	}
+}
+
+FMobSpawnPointBenchmarkResult AMobManagerActor::BenchmarkSpawnPointSelection(int32 Iterations)
+{
+	FMobSpawnPointBenchmarkResult Result;
+	Result.Iterations = FMath::Max(1, Iterations);
+
+	if (!GetWorld()) { return Result; }
+
+	CacheTickValues();
+	if (SpawnPointCache.IsEmpty())
+	{
+		RefillSpawnPointCache(0.0);
+	}
+
+	const bool bNeedDistCheck = (MinDistanceFromPlayer > 0.0f || MaxDistanceFromPlayer > 0.0f);
+
+	// Live path: the same checks TrySpawnMob runs per attempt.
+	const double LiveStart = FPlatformTime::Seconds();
+	for (int32 i = 0; i < Result.Iterations; ++i)
+	{
+		FVector Candidate;
+		if (!GetRandomSpawnLocation(Candidate)) { continue; }
+		if (bNeedDistCheck && !CheckDistanceFromPlayers(Candidate)) { continue; }
+		if (bUseCollisionCheck && !CheckCollision(Candidate)) { continue; }
+		++Result.LiveValidCount;
+	}
+	const double LiveSeconds = FPlatformTime::Seconds() - LiveStart;
+
+	const double CachedStart = FPlatformTime::Seconds();
+	for (int32 i = 0; i < Result.Iterations; ++i)
+	{
+		FVector Candidate;
+		if (TakeCachedSpawnLocation(Candidate, false))
+		{
+			++Result.CachedValidCount;
+		}
+	}
+	const double CachedSeconds = FPlatformTime::Seconds() - CachedStart;
+
+	Result.LivePointsPerSecond = LiveSeconds > 0.0 ? Result.LiveValidCount / LiveSeconds : 0.0;
+	Result.CachedPointsPerSecond = CachedSeconds > 0.0 ? Result.CachedValidCount / CachedSeconds : 0.0;
+
+	UE_LOG(LogMobManager, Log,
+		TEXT("[%s] BenchmarkSpawnPointSelection: %d iterations | live %d valid in %.3fms (%.0f pts/s) | "
+		     "cached %d valid in %.3fms (%.0f pts/s) | pool=%d"),
+		*GetName(), Result.Iterations,
+		Result.LiveValidCount, LiveSeconds * 1000.0, Result.LivePointsPerSecond,
+		Result.CachedValidCount, CachedSeconds * 1000.0, Result.CachedPointsPerSecond,
+		SpawnPointCache.Num());
+
+	return Result;
+}
+
 APHBaseCharacter* AMobManagerActor::HiddenSpawn(
 	TSubclassOf<APHBaseCharacter> Class,
 	const FVector& Location,
@@ -1315,7 +1590,8 @@ void AMobManagerActor::EvaluateSpecialSpawnRules()
 			PendingForcedTier = Rule.ForcedTier;
 
 			FVector Location;
-			if (!GetRandomSpawnLocation(Location))
+			if (!(bUseSpawnPointCache && TakeCachedSpawnLocation(Location))
+				&& !GetRandomSpawnLocation(Location))
 			{
 				PH_LOG_WARNING(LogMobManager,
 					TEXT("Rule '%s' could not find a valid spawn location"),
@@ -1397,7 +1673,8 @@ bool AMobManagerActor::ForceSpawnSpecial(FName RuleId)
 			CacheTickValues();
 
 			FVector Location;
-			if (!GetRandomSpawnLocation(Location))
+			if (!(bUseSpawnPointCache && TakeCachedSpawnLocation(Location))
+				&& !GetRandomSpawnLocation(Location))
 			{
 				PendingForcedTier = EMonsterTier::MT_Normal;
 				return false;
@@ -1,5 +1,7 @@
 #include "AI/Mob/MobPoolSubsystem.h"
+#include "AI/Mob/MobManagerActor.h"
 #include "Character/PHBaseCharacter.h"
+#include "EngineUtils.h"
 #include "AbilitySystemComponent.h"
 #include "GameplayEffect.h"
 #include "AI/Components/MonsterModifierComponent.h"
@@ -7,15 +9,42 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "AIController.h"
 #include "BrainComponent.h"
+#include "Combat/Subsystems/CombatAilmentSubsystem.h"
 
 DEFINE_LOG_CATEGORY(LogMobPool);
 
+void UMobPoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (bPrewarmOnWorldBeginPlay && InWorld.GetNetMode() != NM_Client)
+	{
+		PrewarmFromLevelManagers(PrewarmInstancesPerClass);
+	}
+}
+
 void UMobPoolSubsystem::Deinitialize()
 {
+	PrewarmQueue.Empty();
 	DrainAllPools();
 	Super::Deinitialize();
 }
 
+TStatId UMobPoolSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMobPoolSubsystem, STATGROUP_Tickables);
+}
+
+void UMobPoolSubsystem::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (!PrewarmQueue.IsEmpty())
+	{
+		ProcessPrewarmQueue();
+	}
+}
+
 APHBaseCharacter* UMobPoolSubsystem::Acquire(
 	TSubclassOf<APHBaseCharacter> MobClass,
 	const FVector& Location,
@@ -33,6 +62,29 @@ APHBaseCharacter* UMobPoolSubsystem::Acquire(
 		return nullptr;
 	}
 
+	const double AcquireStartSeconds = FPlatformTime::Seconds();
+	FMobPoolClassStats& Stats = ClassStats.FindOrAdd(MobClass.Get());
+
+	auto RecordAcquire = [&Stats, AcquireStartSeconds](bool bHit)
+	{
+		const float ElapsedMs = static_cast<float>((FPlatformTime::Seconds() - AcquireStartSeconds) * 1000.0);
+		if (bHit)
+		{
+			++Stats.Hits;
+		}
+		else
+		{
+			++Stats.Misses;
+		}
+		Stats.TotalAcquireMs += ElapsedMs;
+		Stats.MaxAcquireMs = FMath::Max(Stats.MaxAcquireMs, ElapsedMs);
+		++Stats.Outstanding;
+		Stats.PeakOutstanding = FMath::Max(Stats.PeakOutstanding, Stats.Outstanding);
+	};
+
+	APHBaseCharacter* Mob = nullptr;
+	bool bHit = false;
+
 	if (TArray<TWeakObjectPtr<APHBaseCharacter>>* ClassPool = Pool.Find(MobClass.Get()))
 	{
 		while (ClassPool->Num() > 0)
@@ -43,7 +95,7 @@ APHBaseCharacter* UMobPoolSubsystem::Acquire(
 				continue;
 			}
 
-			APHBaseCharacter* Mob = Weak.Get();
+			Mob = Weak.Get();
 			PrepareMobForReuse(Mob, Location, Rotation);
 
 			ClassPool->RemoveAll([](const TWeakObjectPtr<APHBaseCharacter>& W)
@@ -55,8 +107,47 @@ APHBaseCharacter* UMobPoolSubsystem::Acquire(
 				TEXT("Acquire: recycled '%s' from pool (class=%s, remaining=%d)"),
 				*Mob->GetName(), *MobClass->GetName(), ClassPool->Num());
 
-			return Mob;
+			bHit = true;
+			break;
+		}
+	}
+
+	if (!Mob)
+	{
+		Mob = SpawnInertMob(MobClass.Get(), Location, Rotation);
+		if (!Mob)
+		{
+			UE_LOG(LogMobPool, Warning,
+				TEXT("Acquire: SpawnActor failed for class '%s'"),
+				*MobClass->GetName());
+			return nullptr;
 		}
+
+		UE_LOG(LogMobPool, Verbose,
+			TEXT("Acquire: spawned fresh '%s' (class=%s)"),
+			*Mob->GetName(), *MobClass->GetName());
+	}
+
+	RecordAcquire(bHit);
+	Mob->OnDestroyed.AddUniqueDynamic(this, &UMobPoolSubsystem::OnOutstandingMobDestroyed);
+
+	if (PoolLowWaterMark > 0 && GetPooledCount(MobClass) < PoolLowWaterMark)
+	{
+		PrewarmClass(MobClass, PoolRefillTarget, Location);
+	}
+
+	return Mob;
+}
+
+APHBaseCharacter* UMobPoolSubsystem::SpawnInertMob(
+	UClass* MobClass,
+	const FVector& Location,
+	const FRotator& Rotation) const
+{
+	UWorld* World = GetWorld();
+	if (!World || !MobClass)
+	{
+		return nullptr;
 	}
 
 	FActorSpawnParameters Params;
@@ -68,9 +159,6 @@ APHBaseCharacter* UMobPoolSubsystem::Acquire(
 
 	if (!Mob)
 	{
-		UE_LOG(LogMobPool, Warning,
-			TEXT("Acquire: SpawnActor failed for class '%s'"),
-			*MobClass->GetName());
 		return nullptr;
 	}
 
@@ -91,13 +179,189 @@ APHBaseCharacter* UMobPoolSubsystem::Acquire(
 		Move->SetComponentTickEnabled(false);
 	}
 
-	UE_LOG(LogMobPool, Verbose,
-		TEXT("Acquire: spawned fresh '%s' (class=%s)"),
-		*Mob->GetName(), *MobClass->GetName());
-
 	return Mob;
 }
 
+void UMobPoolSubsystem::PrewarmClass(
+	TSubclassOf<APHBaseCharacter> MobClass,
+	int32 Count,
+	const FVector& Location)
+{
+	if (!MobClass || Count <= 0)
+	{
+		return;
+	}
+
+	const UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	const int32 Target = FMath::Min(Count, MaxPoolSizePerClass);
+
+	for (FPrewarmRequest& Request : PrewarmQueue)
+	{
+		if (Request.MobClass.Get() == MobClass.Get())
+		{
+			Request.TargetPooled = FMath::Max(Request.TargetPooled, Target);
+			return;
+		}
+	}
+
+	FPrewarmRequest& Request = PrewarmQueue.AddDefaulted_GetRef();
+	Request.MobClass = MobClass.Get();
+	Request.TargetPooled = Target;
+	Request.Location = Location;
+}
+
+int32 UMobPoolSubsystem::PrewarmFromLevelManagers(int32 InstancesPerClass)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return 0;
+	}
+
+	struct FClassDemand
+	{
+		int32 Count = 0;
+		FVector Location = FVector::ZeroVector;
+	};
+	TMap<UClass*, FClassDemand> Demand;
+
+	for (TActorIterator<AMobManagerActor> It(World); It; ++It)
+	{
+		const AMobManagerActor* Manager = *It;
+		if (!Manager || !Manager->bUseActorPooling)
+		{
+			continue;
+		}
+
+		for (const FMobTypeEntry& Entry : Manager->MobTypes)
+		{
+			if (!Entry.MobClass || Entry.SpawnWeight <= 0)
+			{
+				continue;
+			}
+
+			FClassDemand& ClassDemand = Demand.FindOrAdd(Entry.MobClass.Get());
+			if (ClassDemand.Count == 0)
+			{
+				ClassDemand.Location = Manager->GetActorLocation();
+			}
+			ClassDemand.Count += Manager->MaxNumOfMobs;
+		}
+	}
+
+	for (const TPair<UClass*, FClassDemand>& Pair : Demand)
+	{
+		const int32 Count = InstancesPerClass > 0 ? InstancesPerClass : Pair.Value.Count;
+		PrewarmClass(Pair.Key, Count, Pair.Value.Location);
+	}
+
+	UE_LOG(LogMobPool, Log,
+		TEXT("PrewarmFromLevelManagers: queued %d class(es)"), Demand.Num());
+
+	return Demand.Num();
+}
+
+void UMobPoolSubsystem::ProcessPrewarmQueue()
+{
+	const double StartSeconds = FPlatformTime::Seconds();
+	const double BudgetSeconds = static_cast<double>(PrewarmBudgetMs) / 1000.0;
+	int32 SpawnedThisFrame = 0;
+
+	while (!PrewarmQueue.IsEmpty() && SpawnedThisFrame < MaxPrewarmSpawnsPerFrame)
+	{
+		if (SpawnedThisFrame > 0 && (FPlatformTime::Seconds() - StartSeconds) >= BudgetSeconds)
+		{
+			break;
+		}
+
+		FPrewarmRequest& Request = PrewarmQueue[0];
+		UClass* MobClass = Request.MobClass.Get();
+		if (!MobClass || GetPooledCount(MobClass) >= Request.TargetPooled)
+		{
+			PrewarmQueue.RemoveAt(0, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		APHBaseCharacter* Mob = SpawnInertMob(MobClass, Request.Location, FRotator::ZeroRotator);
+		if (!Mob)
+		{
+			UE_LOG(LogMobPool, Warning,
+				TEXT("ProcessPrewarmQueue: SpawnActor failed for class '%s' - dropping request"),
+				*MobClass->GetName());
+			PrewarmQueue.RemoveAt(0, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		DeactivateMob(Mob);
+		Pool.FindOrAdd(MobClass).Add(TWeakObjectPtr<APHBaseCharacter>(Mob));
+		++ClassStats.FindOrAdd(MobClass).Prewarmed;
+		++SpawnedThisFrame;
+	}
+
+	if (PrewarmQueue.IsEmpty() && SpawnedThisFrame > 0)
+	{
+		UE_LOG(LogMobPool, Log,
+			TEXT("ProcessPrewarmQueue: pre-warm complete (pooled=%d)"), GetTotalPooledCount());
+	}
+}
+
+FMobPoolClassStats UMobPoolSubsystem::GetClassStats(TSubclassOf<APHBaseCharacter> MobClass) const
+{
+	if (const FMobPoolClassStats* Stats = MobClass ? ClassStats.Find(MobClass.Get()) : nullptr)
+	{
+		return *Stats;
+	}
+	return FMobPoolClassStats();
+}
+
+void UMobPoolSubsystem::LogPoolStats() const
+{
+	UE_LOG(LogMobPool, Log, TEXT("Mob pool stats (%d class(es), MaxPoolSizePerClass=%d):"),
+		ClassStats.Num(), MaxPoolSizePerClass);
+
+	int32 SuggestedMaxPoolSize = 0;
+	for (const TPair<UClass*, FMobPoolClassStats>& Pair : ClassStats)
+	{
+		const FMobPoolClassStats& Stats = Pair.Value;
+		SuggestedMaxPoolSize = FMath::Max(SuggestedMaxPoolSize, Stats.PeakOutstanding);
+
+		const int32 Total = Stats.Hits + Stats.Misses;
+		const float HitRate = Total > 0 ? 100.0f * Stats.Hits / Total : 0.0f;
+
+		UE_LOG(LogMobPool, Log,
+			TEXT("  %s: hits=%d misses=%d (%.0f%% hit) prewarmed=%d destroyedOnRelease=%d "
+			     "acquire avg=%.3fms max=%.3fms pooled=%d outstanding=%d peak=%d"),
+			*GetNameSafe(Pair.Key), Stats.Hits, Stats.Misses, HitRate,
+			Stats.Prewarmed, Stats.DestroyedOnRelease,
+			Stats.GetAverageAcquireMs(), Stats.MaxAcquireMs,
+			GetPooledCount(Pair.Key), Stats.Outstanding, Stats.PeakOutstanding);
+	}
+
+	if (SuggestedMaxPoolSize > 0)
+	{
+		UE_LOG(LogMobPool, Log, TEXT("  Suggested MaxPoolSizePerClass=%d (highest peak outstanding)%s"),
+			SuggestedMaxPoolSize,
+			SuggestedMaxPoolSize > MaxPoolSizePerClass ? TEXT(" - releases past the current cap are destroyed") : TEXT(""));
+	}
+}
+
+void UMobPoolSubsystem::ResetPoolStats()
+{
+	// Outstanding tracks live actors, not history, so it survives the reset.
+	for (TPair<UClass*, FMobPoolClassStats>& Pair : ClassStats)
+	{
+		const int32 Outstanding = Pair.Value.Outstanding;
+		Pair.Value = FMobPoolClassStats();
+		Pair.Value.Outstanding = Outstanding;
+		Pair.Value.PeakOutstanding = Outstanding;
+	}
+}
+
 void UMobPoolSubsystem::Release(APHBaseCharacter* Mob)
 {
 	if (!IsValid(Mob))
@@ -108,6 +372,10 @@ void UMobPoolSubsystem::Release(APHBaseCharacter* Mob)
 	UClass* MobClass = Mob->GetClass();
 	TArray<TWeakObjectPtr<APHBaseCharacter>>& ClassPool = Pool.FindOrAdd(MobClass);
 
+	FMobPoolClassStats& Stats = ClassStats.FindOrAdd(MobClass);
+	Stats.Outstanding = FMath::Max(0, Stats.Outstanding - 1);
+	Mob->OnDestroyed.RemoveDynamic(this, &UMobPoolSubsystem::OnOutstandingMobDestroyed);
+
 	// Compact stale weak pointers before checking pool size: Num() counts dead
 	// entries and can make the pool appear full while holding zero valid actors,
 	// causing every Release to destroy rather than pool after a mass-death event.
@@ -121,6 +389,7 @@ void UMobPoolSubsystem::Release(APHBaseCharacter* Mob)
 		UE_LOG(LogMobPool, Verbose,
 			TEXT("Release: pool full for '%s' (%d/%d) - destroying '%s'"),
 			*MobClass->GetName(), ClassPool.Num(), MaxPoolSizePerClass, *Mob->GetName());
+		++Stats.DestroyedOnRelease;
 		Mob->Destroy();
 		return;
 	}
@@ -135,6 +404,19 @@ void UMobPoolSubsystem::Release(APHBaseCharacter* Mob)
 		*Mob->GetName(), *MobClass->GetName(), ClassPool.Num());
 }
 
+void UMobPoolSubsystem::OnOutstandingMobDestroyed(AActor* DestroyedActor)
+{
+	if (!DestroyedActor)
+	{
+		return;
+	}
+
+	if (FMobPoolClassStats* Stats = ClassStats.Find(DestroyedActor->GetClass()))
+	{
+		Stats->Outstanding = FMath::Max(0, Stats->Outstanding - 1);
+	}
+}
+
 void UMobPoolSubsystem::DrainAllPools()
 {
 	int32 TotalDestroyed = 0;
@@ -195,6 +477,13 @@ void UMobPoolSubsystem::ResetMobState(APHBaseCharacter* Mob) const
 	// managers never hear about its death.
 	Mob->ResetDeathState();
 
+	// Simulated DoTs live outside the ASC; drop them (and their tags) before
+	// the tag sweep so the pooled mob is not ticked for the previous life.
+	if (UCombatAilmentSubsystem* Ailments = GetWorld()->GetSubsystem<UCombatAilmentSubsystem>())
+	{
+		Ailments->ClearAilments(Mob);
+	}
+
 	if (UAbilitySystemComponent* ASC = Mob->GetAbilitySystemComponent())
 	{
 		// UAbilitySystemComponent has no RemoveAllActiveEffects(); iterate handles instead.
@@ -0,0 +1,466 @@
+#include "AI/Mob/MobSignificanceSubsystem.h"
+
+#include "AI/Mob/PlayerLocationCacheSubsystem.h"
+#include "Character/Animation/ALSCharacterAnimInstance.h"
+#include "Character/PHBaseCharacter.h"
+#include "Components/ALSMantleComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Tags/Components/TagManager.h"
+
+DEFINE_LOG_CATEGORY(LogMobSignificance);
+
+DECLARE_STATS_GROUP(TEXT("MobSignificance"), STATGROUP_MobSignificance, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Evaluate"), STAT_MobSignificance_Evaluate, STATGROUP_MobSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Full Mobs"), STAT_MobSignificance_Full, STATGROUP_MobSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Reduced Mobs"), STAT_MobSignificance_Reduced, STATGROUP_MobSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Low Mobs"), STAT_MobSignificance_Low, STATGROUP_MobSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Dormant Mobs"), STAT_MobSignificance_Dormant, STATGROUP_MobSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Budget Demotions"), STAT_MobSignificance_BudgetDemotions, STATGROUP_MobSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Offscreen Demotions"), STAT_MobSignificance_OffscreenDemotions, STATGROUP_MobSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tier Changes"), STAT_MobSignificance_TierChanges, STATGROUP_MobSignificance);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Mob Actor Tick (ms)"), STAT_MobSignificance_ActorTickMs, STATGROUP_MobSignificance);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Estimated Saved (ms/frame)"), STAT_MobSignificance_SavedMs, STATGROUP_MobSignificance);
+
+#if !UE_BUILD_SHIPPING
+static TAutoConsoleVariable<int32> CVarMobSignificance(
+	TEXT("Hunter.Debug.MobSignificance"),
+	1,
+	TEXT("Apply significance tiers to mobs, for A/B with `stat MobSignificance` and `stat unit`\n")
+	TEXT("0: Restore every mob's authored tick and animation settings\n")
+	TEXT("1: Tier mobs by distance and visibility (default)"),
+	ECVF_Cheat
+);
+#endif
+
+namespace MobSignificancePrivate
+{
+	// EMobSignificanceTier::MAX on a tracked mob means its authored settings are in place.
+	constexpr EMobSignificanceTier Unapplied = EMobSignificanceTier::MAX;
+	constexpr int32 NumTiers = static_cast<int32>(EMobSignificanceTier::MAX);
+
+	/** Share of frames on which something with this tick interval ticks. */
+	float GetTickFraction(float Interval, float FrameSeconds)
+	{
+		return Interval > 0.0f ? FMath::Min(1.0f, FrameSeconds / Interval) : 1.0f;
+	}
+
+	bool IsEnabled()
+	{
+#if !UE_BUILD_SHIPPING
+		return CVarMobSignificance.GetValueOnGameThread() != 0;
+#else
+		return true;
+#endif
+	}
+}
+
+UMobSignificanceSubsystem::UMobSignificanceSubsystem()
+{
+	FullTier.MaxDistance = 1500.0f;
+	FullTier.MaxMobs = 12;
+
+	ReducedTier.MaxDistance = 3500.0f;
+	ReducedTier.MaxMobs = 24;
+	ReducedTier.ActorTickInterval = 0.033f;
+	ReducedTier.bUpdateRateOptimizations = true;
+	ReducedTier.bOverrideAnimTickOption = true;
+	ReducedTier.AnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPose;
+	ReducedTier.bLandPrediction = false;
+
+	LowTier.MaxDistance = 6000.0f;
+	LowTier.ActorTickInterval = 0.1f;
+	LowTier.AnimTickInterval = 0.066f;
+	LowTier.bUpdateRateOptimizations = true;
+	LowTier.bOverrideAnimTickOption = true;
+	LowTier.AnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+	LowTier.bFootIK = false;
+	LowTier.bLandPrediction = false;
+	LowTier.bMantleChecks = false;
+
+	DormantTier = LowTier;
+	DormantTier.MaxDistance = 0.0f;
+	DormantTier.ActorTickInterval = 0.25f;
+	DormantTier.AnimTickInterval = 0.2f;
+	DormantTier.MovementTickInterval = 0.1f;
+}
+
+void UMobSignificanceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	CachedPlayerLocationCache = Collection.InitializeDependency<UPlayerLocationCacheSubsystem>();
+	Mobs.Reset();
+	Stats = FMobSignificanceStats();
+	TimeSinceLastEvaluation = 0.0f;
+	bApplied = true;
+}
+
+void UMobSignificanceSubsystem::Deinitialize()
+{
+	RestoreAll();
+	Mobs.Reset();
+	CachedPlayerLocationCache = nullptr;
+	Super::Deinitialize();
+}
+
+TStatId UMobSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMobSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+void UMobSignificanceSubsystem::RegisterMob(APHBaseCharacter* Character)
+{
+	if (!IsValid(Character))
+	{
+		return;
+	}
+
+	for (const FTrackedMob& Existing : Mobs)
+	{
+		if (Existing.Character.Get() == Character)
+		{
+			return;
+		}
+	}
+
+	FTrackedMob& Mob = Mobs.AddDefaulted_GetRef();
+	Mob.Character = Character;
+	Mob.MantleComponent = Character->FindComponentByClass<UALSMantleComponent>();
+	Mob.Tier = MobSignificancePrivate::Unapplied;
+	Mob.ActorTickInterval = Character->GetActorTickInterval();
+
+	if (const UTagManager* TagManager = Character->GetTagManager())
+	{
+		Mob.TagManagerTickInterval = TagManager->GetComponentTickInterval();
+	}
+
+	if (const USkeletalMeshComponent* Mesh = Character->GetMesh())
+	{
+		Mob.MeshTickInterval = Mesh->GetComponentTickInterval();
+		Mob.AnimTickOption = Mesh->VisibilityBasedAnimTickOption;
+		Mob.bUpdateRateOptimizations = Mesh->bEnableUpdateRateOptimizations;
+
+		if (const UALSCharacterAnimInstance* AnimInstance = Cast<UALSCharacterAnimInstance>(Mesh->GetAnimInstance()))
+		{
+			Mob.bFootIK = AnimInstance->bEnableFootIK;
+			Mob.bLandPrediction = AnimInstance->bEnableLandPrediction;
+		}
+	}
+
+	if (const UCharacterMovementComponent* Movement = Character->GetCharacterMovement())
+	{
+		Mob.MovementTickInterval = Movement->GetComponentTickInterval();
+	}
+
+	if (const UALSMantleComponent* Mantle = Mob.MantleComponent.Get())
+	{
+		Mob.bMantleChecks = Mantle->AreMantleChecksEnabled();
+	}
+}
+
+void UMobSignificanceSubsystem::UnregisterMob(APHBaseCharacter* Character)
+{
+	const int32 Index = Mobs.IndexOfByPredicate([Character](const FTrackedMob& Mob)
+	{
+		return Mob.Character.Get() == Character;
+	});
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (Mobs[Index].Tier != MobSignificancePrivate::Unapplied)
+	{
+		ApplySettings(Mobs[Index], FMobSignificanceTierSettings());
+	}
+	Mobs.RemoveAtSwap(Index);
+}
+
+EMobSignificanceTier UMobSignificanceSubsystem::GetMobTier(const APHBaseCharacter* Character) const
+{
+	for (const FTrackedMob& Mob : Mobs)
+	{
+		if (Mob.Character.Get() == Character)
+		{
+			return Mob.Tier == MobSignificancePrivate::Unapplied ? EMobSignificanceTier::Full : Mob.Tier;
+		}
+	}
+	return EMobSignificanceTier::Full;
+}
+
+const FMobSignificanceTierSettings& UMobSignificanceSubsystem::GetTierSettings(EMobSignificanceTier Tier) const
+{
+	switch (Tier)
+	{
+	case EMobSignificanceTier::Reduced:
+		return ReducedTier;
+	case EMobSignificanceTier::Low:
+		return LowTier;
+	case EMobSignificanceTier::Dormant:
+		return DormantTier;
+	default:
+		return FullTier;
+	}
+}
+
+void UMobSignificanceSubsystem::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	AverageFrameSeconds = FMath::Lerp(AverageFrameSeconds, FMath::Max(DeltaSeconds, UE_KINDA_SMALL_NUMBER), 0.1f);
+
+	if (!MobSignificancePrivate::IsEnabled())
+	{
+		if (bApplied)
+		{
+			RestoreAll();
+			Stats = FMobSignificanceStats();
+			bApplied = false;
+		}
+		return;
+	}
+
+	TimeSinceLastEvaluation += DeltaSeconds;
+	if (!bApplied || TimeSinceLastEvaluation >= EvaluationIntervalSeconds)
+	{
+		TimeSinceLastEvaluation = 0.0f;
+		bApplied = true;
+		Evaluate();
+	}
+}
+
+EMobSignificanceTier UMobSignificanceSubsystem::GetDistanceTier(const FTrackedMob& Mob) const
+{
+	for (int32 TierIndex = 0; TierIndex < MobSignificancePrivate::NumTiers - 1; ++TierIndex)
+	{
+		const EMobSignificanceTier Tier = static_cast<EMobSignificanceTier>(TierIndex);
+		float Threshold = GetTierSettings(Tier).MaxDistance;
+		if (Mob.Tier != MobSignificancePrivate::Unapplied && Tier < Mob.Tier)
+		{
+			Threshold -= HysteresisDistance;
+		}
+
+		if (Threshold > 0.0f && Mob.DistanceSq <= FMath::Square(Threshold))
+		{
+			return Tier;
+		}
+	}
+	return EMobSignificanceTier::Dormant;
+}
+
+void UMobSignificanceSubsystem::Evaluate()
+{
+	using namespace MobSignificancePrivate;
+
+	SCOPE_CYCLE_COUNTER(STAT_MobSignificance_Evaluate);
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	Mobs.RemoveAllSwap([](const FTrackedMob& Mob)
+	{
+		return !Mob.Character.IsValid();
+	});
+
+	if (ActorTickCount > 0)
+	{
+		const float SampleMs = static_cast<float>(FPlatformTime::ToMilliseconds64(ActorTickCycles)) / ActorTickCount;
+		Stats.ActorTickMs = Stats.ActorTickMs > 0.0f ? FMath::Lerp(Stats.ActorTickMs, SampleMs, 0.2f) : SampleMs;
+		ActorTickCycles = 0;
+		ActorTickCount = 0;
+	}
+
+	static const TArray<FPlayerLocationSnapshot> NoPlayers;
+	const TArray<FPlayerLocationSnapshot>& Players = CachedPlayerLocationCache
+		? CachedPlayerLocationCache->GetPlayerSnapshots()
+		: NoPlayers;
+
+	// Only a client's own view says anything about what is on screen.
+	const ENetMode NetMode = World->GetNetMode();
+	const bool bCheckRendered = NetMode == NM_Standalone || NetMode == NM_Client;
+	const float OffscreenMinDistanceSq = FMath::Square(OffscreenMinDistance);
+
+	TArray<int32, TInlineAllocator<128>> Ranked;
+	int32 TierChanges = 0;
+
+	for (int32 Index = 0; Index < Mobs.Num(); ++Index)
+	{
+		FTrackedMob& Mob = Mobs[Index];
+		const APHBaseCharacter* Character = Mob.Character.Get();
+
+		// Pooled mobs are hidden with movement off; leave them until the pool hands them out again.
+		if (Character->IsHidden())
+		{
+			continue;
+		}
+
+		if (Character->IsPlayerControlled() || Character->IsPlayer())
+		{
+			if (Mob.Tier != Unapplied)
+			{
+				ApplySettings(Mob, FMobSignificanceTierSettings());
+				Mob.Tier = Unapplied;
+				++TierChanges;
+			}
+			continue;
+		}
+
+		const FVector Location = Character->GetActorLocation();
+		Mob.DistanceSq = MAX_flt;
+		for (const FPlayerLocationSnapshot& Player : Players)
+		{
+			Mob.DistanceSq = FMath::Min(Mob.DistanceSq, static_cast<float>(FVector::DistSquared(Location, Player.Location)));
+		}
+
+		const USkeletalMeshComponent* Mesh = Character->GetMesh();
+		Mob.bOffscreen = bCheckRendered && Mesh && Mob.DistanceSq > OffscreenMinDistanceSq &&
+			!Mesh->WasRecentlyRendered(OffscreenGraceSeconds);
+
+		Ranked.Add(Index);
+	}
+
+	Ranked.Sort([this](int32 A, int32 B)
+	{
+		return Mobs[A].DistanceSq < Mobs[B].DistanceSq;
+	});
+
+	int32 TierCounts[NumTiers] = {};
+	int32 BudgetDemotions = 0;
+	int32 OffscreenDemotions = 0;
+
+	for (const int32 Index : Ranked)
+	{
+		FTrackedMob& Mob = Mobs[Index];
+		EMobSignificanceTier Tier = GetDistanceTier(Mob);
+
+		if (Mob.bOffscreen && Tier < OffscreenTier)
+		{
+			Tier = OffscreenTier;
+			++OffscreenDemotions;
+		}
+
+		bool bDemoted = false;
+		while (Tier < EMobSignificanceTier::Dormant)
+		{
+			const int32 MaxMobs = GetTierSettings(Tier).MaxMobs;
+			if (MaxMobs <= 0 || TierCounts[static_cast<int32>(Tier)] < MaxMobs)
+			{
+				break;
+			}
+			Tier = static_cast<EMobSignificanceTier>(static_cast<int32>(Tier) + 1);
+			bDemoted = true;
+		}
+		BudgetDemotions += bDemoted ? 1 : 0;
+		++TierCounts[static_cast<int32>(Tier)];
+
+		if (Tier != Mob.Tier)
+		{
+			ApplySettings(Mob, GetTierSettings(Tier));
+			Mob.Tier = Tier;
+			++TierChanges;
+		}
+	}
+
+	Stats.FullMobs = TierCounts[static_cast<int32>(EMobSignificanceTier::Full)];
+	Stats.ReducedMobs = TierCounts[static_cast<int32>(EMobSignificanceTier::Reduced)];
+	Stats.LowMobs = TierCounts[static_cast<int32>(EMobSignificanceTier::Low)];
+	Stats.DormantMobs = TierCounts[static_cast<int32>(EMobSignificanceTier::Dormant)];
+	Stats.BudgetDemotions = BudgetDemotions;
+	Stats.OffscreenDemotions = OffscreenDemotions;
+	Stats.TierChanges = TierChanges;
+	Stats.EstimatedSavedMs = EstimateSavedMs();
+
+	SET_DWORD_STAT(STAT_MobSignificance_Full, Stats.FullMobs);
+	SET_DWORD_STAT(STAT_MobSignificance_Reduced, Stats.ReducedMobs);
+	SET_DWORD_STAT(STAT_MobSignificance_Low, Stats.LowMobs);
+	SET_DWORD_STAT(STAT_MobSignificance_Dormant, Stats.DormantMobs);
+	SET_DWORD_STAT(STAT_MobSignificance_BudgetDemotions, Stats.BudgetDemotions);
+	SET_DWORD_STAT(STAT_MobSignificance_OffscreenDemotions, Stats.OffscreenDemotions);
+	SET_DWORD_STAT(STAT_MobSignificance_TierChanges, Stats.TierChanges);
+	SET_FLOAT_STAT(STAT_MobSignificance_ActorTickMs, Stats.ActorTickMs);
+	SET_FLOAT_STAT(STAT_MobSignificance_SavedMs, Stats.EstimatedSavedMs);
+}
+
+void UMobSignificanceSubsystem::ApplySettings(const FTrackedMob& Mob, const FMobSignificanceTierSettings& Settings)
+{
+	APHBaseCharacter* Character = Mob.Character.Get();
+	if (!Character)
+	{
+		return;
+	}
+
+	Character->SetActorTickInterval(FMath::Max(Mob.ActorTickInterval, Settings.ActorTickInterval));
+
+	if (UTagManager* TagManager = Character->GetTagManager())
+	{
+		TagManager->SetComponentTickInterval(FMath::Max(Mob.TagManagerTickInterval, Settings.ActorTickInterval));
+	}
+
+	if (USkeletalMeshComponent* Mesh = Character->GetMesh())
+	{
+		Mesh->SetComponentTickInterval(FMath::Max(Mob.MeshTickInterval, Settings.AnimTickInterval));
+		Mesh->bEnableUpdateRateOptimizations = Mob.bUpdateRateOptimizations || Settings.bUpdateRateOptimizations;
+		Mesh->VisibilityBasedAnimTickOption = Settings.bOverrideAnimTickOption
+			? Settings.AnimTickOption
+			: Mob.AnimTickOption;
+
+		if (UALSCharacterAnimInstance* AnimInstance = Cast<UALSCharacterAnimInstance>(Mesh->GetAnimInstance()))
+		{
+			AnimInstance->bEnableFootIK = Mob.bFootIK && Settings.bFootIK;
+			AnimInstance->bEnableLandPrediction = Mob.bLandPrediction && Settings.bLandPrediction;
+		}
+	}
+
+	if (UCharacterMovementComponent* Movement = Character->GetCharacterMovement())
+	{
+		Movement->SetComponentTickInterval(FMath::Max(Mob.MovementTickInterval, Settings.MovementTickInterval));
+	}
+
+	if (UALSMantleComponent* Mantle = Mob.MantleComponent.Get())
+	{
+		Mantle->SetMantleChecksEnabled(Mob.bMantleChecks && Settings.bMantleChecks);
+	}
+}
+
+void UMobSignificanceSubsystem::RestoreAll()
+{
+	for (FTrackedMob& Mob : Mobs)
+	{
+		if (Mob.Tier != MobSignificancePrivate::Unapplied)
+		{
+			ApplySettings(Mob, FMobSignificanceTierSettings());
+			Mob.Tier = MobSignificancePrivate::Unapplied;
+		}
+	}
+}
+
+float UMobSignificanceSubsystem::EstimateSavedMs() const
+{
+	using namespace MobSignificancePrivate;
+
+	float SavedMs = 0.0f;
+	for (const FTrackedMob& Mob : Mobs)
+	{
+		if (Mob.Tier == Unapplied)
+		{
+			continue;
+		}
+
+		const FMobSignificanceTierSettings& Settings = GetTierSettings(Mob.Tier);
+		const auto SavedFraction = [this](float Authored, float TierInterval)
+		{
+			return GetTickFraction(Authored, AverageFrameSeconds) -
+				GetTickFraction(FMath::Max(Authored, TierInterval), AverageFrameSeconds);
+		};
+
+		SavedMs += SavedFraction(Mob.ActorTickInterval, Settings.ActorTickInterval) * Stats.ActorTickMs;
+		SavedMs += SavedFraction(Mob.MeshTickInterval, Settings.AnimTickInterval) * EstimatedAnimUpdateMs;
+		SavedMs += SavedFraction(Mob.MovementTickInterval, Settings.MovementTickInterval) * EstimatedMovementTickMs;
+	}
+	return SavedMs;
+}
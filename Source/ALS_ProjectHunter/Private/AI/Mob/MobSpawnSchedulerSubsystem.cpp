@@ -0,0 +1,184 @@
+#include "AI/Mob/MobSpawnSchedulerSubsystem.h"
+
+#include "AI/Mob/MobManagerActor.h"
+#include "AI/Mob/PlayerLocationCacheSubsystem.h"
+#include "Components/BoxComponent.h"
+#include "Engine/World.h"
+
+DEFINE_LOG_CATEGORY(LogMobSpawnScheduler);
+
+DECLARE_STATS_GROUP(TEXT("MobSpawnScheduler"), STATGROUP_MobSpawnScheduler, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Queue Depth"), STAT_MobSpawnScheduler_QueueDepth, STATGROUP_MobSpawnScheduler);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Serviced Per Frame"), STAT_MobSpawnScheduler_Serviced, STATGROUP_MobSpawnScheduler);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Frame Spend (ms)"), STAT_MobSpawnScheduler_FrameSpendMs, STATGROUP_MobSpawnScheduler);
+
+void UMobSpawnSchedulerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	CachedPlayerLocationCache = Collection.InitializeDependency<UPlayerLocationCacheSubsystem>();
+	Requests.Reset();
+	LastFrameSpendMs = 0.0f;
+	LastFrameServicedCount = 0;
+}
+
+void UMobSpawnSchedulerSubsystem::Deinitialize()
+{
+	Requests.Reset();
+	CachedPlayerLocationCache = nullptr;
+	Super::Deinitialize();
+}
+
+TStatId UMobSpawnSchedulerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMobSpawnSchedulerSubsystem, STATGROUP_Tickables);
+}
+
+void UMobSpawnSchedulerSubsystem::EnqueueSpawnRequest(AMobManagerActor* Manager)
+{
+	if (!IsValid(Manager))
+	{
+		return;
+	}
+
+	for (const FSpawnRequest& Request : Requests)
+	{
+		if (Request.Manager.Get() == Manager)
+		{
+			return;
+		}
+	}
+
+	FSpawnRequest& NewRequest = Requests.AddDefaulted_GetRef();
+	NewRequest.Manager = Manager;
+	NewRequest.EnqueueTimeSeconds = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+}
+
+void UMobSpawnSchedulerSubsystem::CancelSpawnRequests(const AMobManagerActor* Manager)
+{
+	Requests.RemoveAll([Manager](const FSpawnRequest& Request)
+	{
+		return !Request.Manager.IsValid() || Request.Manager.Get() == Manager;
+	});
+}
+
+void UMobSpawnSchedulerSubsystem::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	LastFrameSpendMs = 0.0f;
+	LastFrameServicedCount = 0;
+
+	Requests.RemoveAll([](const FSpawnRequest& Request)
+	{
+		return !Request.Manager.IsValid();
+	});
+
+	if (Requests.IsEmpty())
+	{
+		SET_DWORD_STAT(STAT_MobSpawnScheduler_QueueDepth, 0);
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+
+	for (FSpawnRequest& Request : Requests)
+	{
+		const float WaitSeconds = static_cast<float>(Now - Request.EnqueueTimeSeconds);
+		Request.Score = ScoreManager(*Request.Manager.Get()) + WaitSeconds * WaitPriorityPerSecond;
+	}
+
+	Requests.StableSort([](const FSpawnRequest& A, const FSpawnRequest& B)
+	{
+		return A.Score > B.Score;
+	});
+
+	// Drain from a local copy: a manager's spawn side effects (BP events,
+	// StopAndClear) may enqueue or cancel requests while we iterate.
+	TArray<FSpawnRequest> Pending = MoveTemp(Requests);
+	Requests.Reset();
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	const double BudgetSeconds = static_cast<double>(FrameBudgetMs) / 1000.0;
+
+	int32 Serviced = 0;
+	while (Serviced < Pending.Num())
+	{
+		const double Spent = FPlatformTime::Seconds() - StartSeconds;
+		if (Serviced > 0 && Spent >= BudgetSeconds)
+		{
+			break;
+		}
+
+		if (AMobManagerActor* Manager = Pending[Serviced].Manager.Get())
+		{
+			Manager->ExecuteScheduledSpawnTick(FMath::Max(BudgetSeconds - Spent, 0.0));
+		}
+		++Serviced;
+	}
+
+	// Unserviced requests keep their original enqueue time so they keep aging.
+	for (int32 Index = Serviced; Index < Pending.Num(); ++Index)
+	{
+		FSpawnRequest& Request = Pending[Index];
+		const bool bAlreadyRequeued = Requests.ContainsByPredicate([&Request](const FSpawnRequest& Other)
+		{
+			return Other.Manager == Request.Manager;
+		});
+		if (!bAlreadyRequeued && Request.Manager.IsValid())
+		{
+			Requests.Add(MoveTemp(Request));
+		}
+	}
+
+	LastFrameServicedCount = Serviced;
+	LastFrameSpendMs = static_cast<float>((FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+
+	SET_DWORD_STAT(STAT_MobSpawnScheduler_QueueDepth, Requests.Num());
+	SET_DWORD_STAT(STAT_MobSpawnScheduler_Serviced, LastFrameServicedCount);
+	SET_FLOAT_STAT(STAT_MobSpawnScheduler_FrameSpendMs, LastFrameSpendMs);
+
+	UE_LOG(LogMobSpawnScheduler, VeryVerbose,
+		TEXT("Tick: serviced %d request(s) in %.3fms, %d still queued"),
+		LastFrameServicedCount, LastFrameSpendMs, Requests.Num());
+}
+
+float UMobSpawnSchedulerSubsystem::ScoreManager(const AMobManagerActor& Manager) const
+{
+	switch (PriorityMode)
+	{
+	case EMobSpawnSchedulerPriority::PopulationDeficit:
+	{
+		const int32 MaxMobs = FMath::Max(1, Manager.MaxNumOfMobs);
+		const int32 Missing = FMath::Max(0, MaxMobs - Manager.GetActiveCount());
+		return static_cast<float>(Missing) / static_cast<float>(MaxMobs);
+	}
+
+	case EMobSpawnSchedulerPriority::NearestPlayer:
+	default:
+	{
+		if (!CachedPlayerLocationCache)
+		{
+			return 0.0f;
+		}
+
+		const FVector Origin = Manager.SpawnArea
+			? Manager.SpawnArea->GetComponentLocation()
+			: Manager.GetActorLocation();
+
+		float NearestDistSq = TNumericLimits<float>::Max();
+		for (const FPlayerLocationSnapshot& Snap : CachedPlayerLocationCache->GetPlayerSnapshots())
+		{
+			NearestDistSq = FMath::Min(NearestDistSq, static_cast<float>(FVector::DistSquared(Origin, Snap.Location)));
+		}
+
+		if (NearestDistSq == TNumericLimits<float>::Max())
+		{
+			return 0.0f;
+		}
+
+		return 1.0f - FMath::Clamp(FMath::Sqrt(NearestDistSq) / PriorityDistanceRange, 0.0f, 1.0f);
+	}
+	}
+}
@@ -0,0 +1,238 @@
+#include "AbilitySystem/HunterAttributeRegistry.h"
+
+#include "AbilitySystem/HunterAttributeSet.h"
+#include "Stats/Data/BaseStatsData.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogHunterAttributeRegistry, Log, All);
+
+namespace HunterAttributeRegistryPrivate
+{
+	// Average keys per bucket; lower means more buckets and a faster seed search.
+	constexpr int32 KeysPerBucket = 4;
+
+	// Seeds tried for one bucket before the slot table is grown and the search restarts.
+	constexpr uint32 MaxSeedAttempts = 1u << 16;
+}
+
+const FGameplayAttribute FHunterAttributeRegistry::InvalidAttribute;
+
+const FHunterAttributeRegistry& FHunterAttributeRegistry::Get()
+{
+	static const FHunterAttributeRegistry Registry;
+	return Registry;
+}
+
+FHunterAttributeRegistry::FHunterAttributeRegistry()
+{
+	const double StartSeconds = FPlatformTime::Seconds();
+
+	BuildAttributes();
+	BuildNameHash();
+	BuildEnumTable();
+	BuildDefinitions();
+
+	UE_LOG(LogHunterAttributeRegistry, Log,
+		TEXT("Attribute registry built in %.2f ms: %d attributes, %d definitions, %d hash slots over %d buckets."),
+		(FPlatformTime::Seconds() - StartSeconds) * 1000.0,
+		Attributes.Num(),
+		Definitions.Num(),
+		Slots.Num(),
+		BucketSeeds.Num());
+}
+
+uint32 FHunterAttributeRegistry::HashName(FName Name, uint32 Seed)
+{
+	// Murmur3 finalizer over the name's comparison hash, so case-only differences
+	// hash alike exactly as FName equality treats them.
+	uint32 Key = GetTypeHash(Name) ^ (Seed * 0x9E3779B9u);
+	Key ^= Key >> 16;
+	Key *= 0x85EBCA6Bu;
+	Key ^= Key >> 13;
+	Key *= 0xC2B2AE35u;
+	Key ^= Key >> 16;
+	return Key;
+}
+
+int32 FHunterAttributeRegistry::FindIndex(FName AttributeName) const
+{
+	if (Slots.Num() == 0 || AttributeName.IsNone())
+	{
+		return INDEX_NONE;
+	}
+
+	const uint32 Bucket = HashName(AttributeName, 0) & static_cast<uint32>(BucketSeeds.Num() - 1);
+	const uint32 Slot = HashName(AttributeName, BucketSeeds[Bucket]) & static_cast<uint32>(Slots.Num() - 1);
+	const int32 Index = Slots[Slot];
+
+	// Names outside the set land on an arbitrary slot; the compare rejects them.
+	return Index != INDEX_NONE && Names[Index] == AttributeName ? Index : INDEX_NONE;
+}
+
+void FHunterAttributeRegistry::BuildAttributes()
+{
+	for (TFieldIterator<FProperty> PropIt(UHunterAttributeSet::StaticClass()); PropIt; ++PropIt)
+	{
+		FProperty* Property = *PropIt;
+
+		const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+		if (StructProperty && StructProperty->Struct == FGameplayAttributeData::StaticStruct())
+		{
+			Attributes.Add(FGameplayAttribute(Property));
+			Names.Add(Property->GetFName());
+		}
+	}
+
+	check(Attributes.Num() < MAX_int16);
+}
+
+void FHunterAttributeRegistry::BuildNameHash()
+{
+	using namespace HunterAttributeRegistryPrivate;
+
+	const int32 KeyCount = Names.Num();
+	if (KeyCount == 0)
+	{
+		return;
+	}
+
+	const int32 BucketCount = static_cast<int32>(FMath::RoundUpToPowerOfTwo(FMath::Max(1, KeyCount / KeysPerBucket)));
+	BucketSeeds.Init(0, BucketCount);
+
+	TArray<TArray<int32>> Buckets;
+	Buckets.SetNum(BucketCount);
+	for (int32 Index = 0; Index < KeyCount; ++Index)
+	{
+		Buckets[HashName(Names[Index], 0) & static_cast<uint32>(BucketCount - 1)].Add(Index);
+	}
+
+	// Place the crowded buckets while the table is still empty.
+	TArray<int32> BucketOrder;
+	BucketOrder.Reserve(BucketCount);
+	for (int32 Bucket = 0; Bucket < BucketCount; ++Bucket)
+	{
+		BucketOrder.Add(Bucket);
+	}
+	BucketOrder.Sort([&Buckets](int32 A, int32 B)
+	{
+		return Buckets[A].Num() > Buckets[B].Num();
+	});
+
+	TArray<uint32, TInlineAllocator<16>> CandidateSlots;
+	for (int32 SlotCount = static_cast<int32>(FMath::RoundUpToPowerOfTwo(KeyCount)) * 2; ; SlotCount *= 2)
+	{
+		Slots.Init(INDEX_NONE, SlotCount);
+		const uint32 SlotMask = static_cast<uint32>(SlotCount - 1);
+
+		bool bPlacedAll = true;
+		for (const int32 Bucket : BucketOrder)
+		{
+			const TArray<int32>& Keys = Buckets[Bucket];
+			if (Keys.Num() == 0)
+			{
+				break;
+			}
+
+			bool bPlacedBucket = false;
+			for (uint32 Seed = 1; Seed <= MaxSeedAttempts && !bPlacedBucket; ++Seed)
+			{
+				CandidateSlots.Reset();
+				bPlacedBucket = true;
+
+				for (const int32 Key : Keys)
+				{
+					const uint32 Slot = HashName(Names[Key], Seed) & SlotMask;
+					if (Slots[Slot] != INDEX_NONE || CandidateSlots.Contains(Slot))
+					{
+						bPlacedBucket = false;
+						break;
+					}
+					CandidateSlots.Add(Slot);
+				}
+
+				if (bPlacedBucket)
+				{
+					for (int32 KeyIt = 0; KeyIt < Keys.Num(); ++KeyIt)
+					{
+						Slots[CandidateSlots[KeyIt]] = static_cast<int16>(Keys[KeyIt]);
+					}
+					BucketSeeds[Bucket] = Seed;
+				}
+			}
+
+			if (!bPlacedBucket)
+			{
+				bPlacedAll = false;
+				break;
+			}
+		}
+
+		if (bPlacedAll)
+		{
+			return;
+		}
+
+		UE_LOG(LogHunterAttributeRegistry, Verbose,
+			TEXT("BuildNameHash: no seed placed every bucket in %d slots, retrying with %d."),
+			SlotCount,
+			SlotCount * 2);
+		BucketSeeds.Init(0, BucketCount);
+	}
+}
+
+void FHunterAttributeRegistry::BuildEnumTable()
+{
+	const int32 EnumCount = static_cast<int32>(EHunterAttribute::MAX);
+	EnumToIndex.Init(INDEX_NONE, EnumCount);
+
+	const UEnum* Enum = StaticEnum<EHunterAttribute>();
+	if (!Enum)
+	{
+		return;
+	}
+
+	int32 MappedCount = 0;
+	for (int32 EnumIndex = 0; EnumIndex < Enum->NumEnums(); ++EnumIndex)
+	{
+		const int64 Value = Enum->GetValueByIndex(EnumIndex);
+		if (Value < 0 || Value >= EnumCount)
+		{
+			continue;
+		}
+
+		const FName ShortName(*Enum->GetNameStringByIndex(EnumIndex));
+		const int32 AttributeIndex = FindIndex(ShortName);
+		if (AttributeIndex == INDEX_NONE)
+		{
+			UE_LOG(LogHunterAttributeRegistry, Warning,
+				TEXT("BuildEnumTable: EHunterAttribute::%s has no matching attribute on UHunterAttributeSet."),
+				*ShortName.ToString());
+			continue;
+		}
+
+		EnumToIndex[static_cast<int32>(Value)] = static_cast<int16>(AttributeIndex);
+		++MappedCount;
+	}
+
+	if (MappedCount != Attributes.Num())
+	{
+		UE_LOG(LogHunterAttributeRegistry, Warning,
+			TEXT("BuildEnumTable: EHunterAttribute covers %d of %d attributes; add the missing entries to StatsEnumLibrary.h."),
+			MappedCount,
+			Attributes.Num());
+	}
+}
+
+void FHunterAttributeRegistry::BuildDefinitions()
+{
+	UBaseStatsData::GatherStatDefinitionsFromAttributeSet(UHunterAttributeSet::StaticClass(), Definitions);
+
+	DefinitionIndexByAttribute.Init(INDEX_NONE, Attributes.Num());
+	for (int32 DefinitionIndex = 0; DefinitionIndex < Definitions.Num(); ++DefinitionIndex)
+	{
+		const int32 AttributeIndex = FindIndex(Definitions[DefinitionIndex].StatName);
+		if (AttributeIndex != INDEX_NONE)
+		{
+			DefinitionIndexByAttribute[AttributeIndex] = static_cast<int16>(DefinitionIndex);
+		}
+	}
+}
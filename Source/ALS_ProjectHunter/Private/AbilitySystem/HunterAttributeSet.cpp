@@ -1,9 +1,15 @@
 #include "AbilitySystem/HunterAttributeSet.h"
 #include "AbilitySystem/HunterAbilitySystemComponent.h"
+#include "AbilitySystem/HunterAttributeRegistry.h"
 #include "AbilitySystem/Library/FunctionLibraries/PHResourceFunctionLibrary.h"
 #include "AbilitySystemBlueprintLibrary.h"
+#include "Combat/Calculators/CombatOutgoingDamageCalculator.h"
+#include "Combat/Resolvers/CombatIncomingDamageResolver.h"
 #include "GameplayEffectExtension.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Net/UnrealNetwork.h"
+#include "Serialization/BitWriter.h"
+#include "UObject/Package.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogHunterAttributeSet, Log, All);
 
@@ -26,12 +32,148 @@ namespace HunterAttributeSetPrivate
 		Attribute.SetCurrentValue(NewValue);
 	}
 
-	void AssignAttributeDirectIfNeeded(FGameplayAttributeData& Attribute, float NewValue)
+	// Resources (regen, reservation, leech, utility) is the default group, so only the
+	// other groups are listed. New attributes replicate as cold resources until listed.
+	const TMap<FName, EHunterAttributeRepGroup>& GetAttributeRepGroupTable()
 	{
-		if (ShouldAssignAttributeDataValue(Attribute, NewValue))
+		static const TMap<FName, EHunterAttributeRepGroup> Table = []()
 		{
-			AssignAttributeDirect(Attribute, NewValue);
+			const FName VitalsAttributes[] =
+			{
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, Health), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MaxHealth), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MaxEffectiveHealth),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, Mana), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MaxMana), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MaxEffectiveMana),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, Stamina), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MaxStamina), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MaxEffectiveStamina),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ArcaneShield), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MaxArcaneShield), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MaxEffectiveArcaneShield),
+			};
+
+			const FName PrimaryAttributes[] =
+			{
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, Strength), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, Intelligence), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, Dexterity),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, Endurance), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, Affliction), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, Luck),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, Covenant), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, PlayerLevel), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, GlobalXPGain),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LocalXPGain), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, XPGainMultiplier), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, XPPenalty),
+			};
+
+			const FName OffenseAttributes[] =
+			{
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, GlobalDamages), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MinPhysicalDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MaxPhysicalDamage),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, PhysicalFlatDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, PhysicalPercentDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MinFireDamage),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MaxFireDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, FireFlatDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, FirePercentDamage),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MinIceDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MaxIceDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, IceFlatDamage),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, IcePercentDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MinLightDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MaxLightDamage),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightFlatDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightPercentDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MinLightningDamage),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MaxLightningDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightningFlatDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightningPercentDamage),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MinCorruptionDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MaxCorruptionDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, CorruptionFlatDamage),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, CorruptionPercentDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, DamageBonusWhileAtFullHP), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, DamageBonusWhileAtLowHP),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, GlobalMoreDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, PhysicalMoreDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ElementalMoreDamage),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, FireMoreDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, IceMoreDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightningMoreDamage),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightMoreDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, CorruptionMoreDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, AreaDamage),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, AreaOfEffect), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, AttackRange), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, AttackSpeed),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, CastSpeed), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, CritChance), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, CritMultiplier),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, DamageOverTime), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ElementalDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MeleeDamage),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, SpellDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ProjectileCount), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ProjectileSpeed),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, RangedDamage), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, SpellsCritChance), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, SpellsCritMultiplier),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ChainCount), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ForkCount), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ChainDamage),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, PhysicalToFire), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, PhysicalToIce), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, PhysicalToLightning),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, PhysicalToLight), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, PhysicalToCorruption), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, FireToPhysical),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, FireToIce), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, FireToLightning), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, FireToLight),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, FireToCorruption), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, IceToPhysical), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, IceToFire),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, IceToLightning), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, IceToLight), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, IceToCorruption),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightningToPhysical), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightningToFire), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightningToIce),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightningToLight), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightningToCorruption), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightToPhysical),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightToFire), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightToIce), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightToLightning),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightToCorruption), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, CorruptionToPhysical), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, CorruptionToFire),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, CorruptionToIce), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, CorruptionToLightning), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, CorruptionToLight),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ArmourPiercing), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, FirePiercing), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightPiercing),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightningPiercing), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, CorruptionPiercing), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, IcePiercing),
+			};
+
+			const FName DefenseAttributes[] =
+			{
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, GlobalDefenses), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, BlockStrength), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, FlatBlockAmount),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ChipDamageWhileBlocking), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, BlockStaminaCostMultiplier), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, GuardBreakThreshold),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, BlockAngle), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, BlockPhysicalMultiplier), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, BlockElementalMultiplier),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, BlockCorruptionMultiplier), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, Armour), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ArmourFlatBonus),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ArmourPercentBonus), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, CorruptionResistanceFlatBonus), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, CorruptionResistancePercentBonus),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MaxCorruptionResistance), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, FireResistanceFlatBonus), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, FireResistancePercentBonus),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MaxFireResistance), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, IceResistanceFlatBonus), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, IceResistancePercentBonus),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MaxIceResistance), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightResistanceFlatBonus), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightResistancePercentBonus),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MaxLightResistance), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightningResistanceFlatBonus), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightningResistancePercentBonus),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, MaxLightningResistance), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, GlobalDamageTakenMultiplier), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, PhysicalDamageTakenMultiplier),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ElementalDamageTakenMultiplier), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, FireDamageTakenMultiplier), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, IceDamageTakenMultiplier),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightningDamageTakenMultiplier), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, LightDamageTakenMultiplier), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, CorruptionDamageTakenMultiplier),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ReflectPhysical), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ReflectElemental), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ReflectChancePhysical),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ReflectChanceElemental),
+			};
+
+			const FName AilmentsAttributes[] =
+			{
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ChanceToBleed), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ChanceToCorrupt), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ChanceToFreeze),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ChanceToPurify), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ChanceToIgnite), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ChanceToKnockBack),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ChanceToPetrify), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ChanceToShock), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ChanceToStun),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, BurnDuration), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, BleedDuration), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, FreezeDuration),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, CorruptionDuration), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, ShockDuration), GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, PetrifyBuildUpDuration),
+				GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, PurifyDuration),
+			};
+
+			TMap<FName, EHunterAttributeRepGroup> Result;
+			auto AddGroup = [&Result](TConstArrayView<FName> Names, EHunterAttributeRepGroup Group)
+			{
+				for (const FName Name : Names)
+				{
+					Result.Add(Name, Group);
+				}
+			};
+
+			AddGroup(VitalsAttributes, EHunterAttributeRepGroup::Vitals);
+			AddGroup(PrimaryAttributes, EHunterAttributeRepGroup::Primary);
+			AddGroup(OffenseAttributes, EHunterAttributeRepGroup::Offense);
+			AddGroup(DefenseAttributes, EHunterAttributeRepGroup::Defense);
+			AddGroup(AilmentsAttributes, EHunterAttributeRepGroup::Ailments);
+			return Result;
+		}();
+
+		return Table;
+	}
+
+	/** Replicated FGameplayAttributeData properties declared by UHunterAttributeSet, paired with their lifetime settings. */
+	struct FAttributeRepEntry
+	{
+		FStructProperty* Property = nullptr;
+		EHunterAttributeRepGroup Group = EHunterAttributeRepGroup::Resources;
+		bool bSentToNonOwner = false;
+	};
+
+	TArray<FAttributeRepEntry> GatherAttributeRepEntries()
+	{
+		TArray<FLifetimeProperty> LifetimeProps;
+		GetDefault<UHunterAttributeSet>()->GetLifetimeReplicatedProps(LifetimeProps);
+
+		const UClass* AttributeSetClass = UHunterAttributeSet::StaticClass();
+		TArray<FAttributeRepEntry> Entries;
+
+		for (const FLifetimeProperty& LifetimeProp : LifetimeProps)
+		{
+			if (!AttributeSetClass->ClassReps.IsValidIndex(LifetimeProp.RepIndex))
+			{
+				continue;
+			}
+
+			FStructProperty* StructProperty = CastField<FStructProperty>(AttributeSetClass->ClassReps[LifetimeProp.RepIndex].Property);
+			if (!StructProperty
+				|| StructProperty->GetOwnerClass() != AttributeSetClass
+				|| !StructProperty->Struct->IsChildOf(FGameplayAttributeData::StaticStruct()))
+			{
+				continue;
+			}
+
+			FAttributeRepEntry& Entry = Entries.AddDefaulted_GetRef();
+			Entry.Property = StructProperty;
+			Entry.Group = UHunterAttributeSet::GetAttributeRepGroup(FGameplayAttribute(StructProperty));
+			Entry.bSentToNonOwner = LifetimeProp.Condition == COND_None;
 		}
+
+		return Entries;
 	}
 
 }
@@ -84,6 +226,7 @@ void UHunterAttributeSet::SetIsInitializingStats(bool bInInitializing)
 	}
 
 	bIsInitializingStats = bInInitializing;
+	InvalidateCombatSnapshots();
 
 	UE_LOG(
 		LogHunterAttributeSet,
@@ -138,48 +281,12 @@ void UHunterAttributeSet::RecalculateAllDerivedVitals()
 
 FGameplayAttribute UHunterAttributeSet::FindAttributeByName(FName AttributeName)
 {
-	const UHunterAttributeSet* ClassCDO = GetDefault<UHunterAttributeSet>();
-	
-	if (!ClassCDO)
-	{
-		return FGameplayAttribute();
-	}
-
-	for (TFieldIterator<FProperty> PropIt(UHunterAttributeSet::StaticClass()); PropIt; ++PropIt)
-	{
-		FProperty* Property = *PropIt;
-
-		if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
-		{
-			if (StructProperty->Struct == FGameplayAttributeData::StaticStruct())
-			{
-				if (Property->GetFName() == AttributeName)
-				{
-					return FGameplayAttribute(Property);
-				}
-			}
-		}
-	}
-
-	return FGameplayAttribute();
+	return FHunterAttributeRegistry::Get().FindAttribute(AttributeName);
 }
 
 void UHunterAttributeSet::GetAllAttributes(TArray<FGameplayAttribute>& OutAttributes)
 {
-	OutAttributes.Empty();
-
-	for (TFieldIterator<FProperty> PropIt(UHunterAttributeSet::StaticClass()); PropIt; ++PropIt)
-	{
-		FProperty* Property = *PropIt;
-		
-		if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
-		{
-			if (StructProperty->Struct == FGameplayAttributeData::StaticStruct())
-			{
-				OutAttributes.Add(FGameplayAttribute(Property));
-			}
-		}
-	}
+	OutAttributes = FHunterAttributeRegistry::Get().GetAttributes();
 }
 
 void UHunterAttributeSet::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -442,6 +549,293 @@ void UHunterAttributeSet::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>&
 	DOREPLIFETIME_CONDITION_NOTIFY(UHunterAttributeSet, Mana,     COND_OwnerOnly, REPNOTIFY_Always);
 	DOREPLIFETIME_CONDITION_NOTIFY(UHunterAttributeSet, Stamina,  COND_OwnerOnly, REPNOTIFY_Always);
 	DOREPLIFETIME_CONDITION_NOTIFY(UHunterAttributeSet, Gems,     COND_OwnerOnly, REPNOTIFY_Always);
+
+	// OPT-REPLICATION: only the hot vitals stay on per-update property comparison. Every
+	// other attribute is push-model and is compared only after MarkAttributeDirty flags it.
+	// With net.IsPushModelEnabled=0 the flag is ignored and everything is compared as before.
+	const UClass* AttributeSetClass = UHunterAttributeSet::StaticClass();
+	for (FLifetimeProperty& LifetimeProp : OutLifetimeProps)
+	{
+		const FProperty* Property = AttributeSetClass->ClassReps.IsValidIndex(LifetimeProp.RepIndex)
+			? AttributeSetClass->ClassReps[LifetimeProp.RepIndex].Property
+			: nullptr;
+
+		if (Property && Property->GetOwnerClass() == AttributeSetClass
+			&& GetPropertyRepGroup(Property) != EHunterAttributeRepGroup::Vitals)
+		{
+			LifetimeProp.bIsPushBased = true;
+		}
+	}
+}
+
+EHunterAttributeRepGroup UHunterAttributeSet::GetAttributeRepGroup(const FGameplayAttribute& Attribute)
+{
+	return GetPropertyRepGroup(Attribute.GetUProperty());
+}
+
+EHunterAttributeRepGroup UHunterAttributeSet::GetPropertyRepGroup(const FProperty* Property)
+{
+	if (!Property)
+	{
+		return EHunterAttributeRepGroup::None;
+	}
+
+	const EHunterAttributeRepGroup* Group = HunterAttributeSetPrivate::GetAttributeRepGroupTable().Find(Property->GetFName());
+	return Group ? *Group : EHunterAttributeRepGroup::Resources;
+}
+
+void UHunterAttributeSet::SetReplicatedGroups(EHunterAttributeRepGroup InGroups)
+{
+	// Vitals are not push-model, so they replicate regardless of registration.
+	InGroups |= EHunterAttributeRepGroup::Vitals;
+
+	const EHunterAttributeRepGroup AddedGroups = InGroups & ~ReplicatedGroups;
+	ReplicatedGroups = InGroups;
+
+	if (AddedGroups != EHunterAttributeRepGroup::None)
+	{
+		MarkAllAttributesDirty();
+	}
+}
+
+void UHunterAttributeSet::MarkAttributeDirty(const FGameplayAttribute& Attribute)
+{
+	const FProperty* Property = Attribute.GetUProperty();
+	if (!Property || Property->GetOwnerClass() != UHunterAttributeSet::StaticClass())
+	{
+		return;
+	}
+
+	const EHunterAttributeRepGroup Group = GetPropertyRepGroup(Property);
+	if (Group != EHunterAttributeRepGroup::Vitals && EnumHasAnyFlags(ReplicatedGroups, Group))
+	{
+		MARK_PROPERTY_DIRTY(this, Property);
+	}
+}
+
+void UHunterAttributeSet::MarkAllAttributesDirty()
+{
+	for (TFieldIterator<FStructProperty> It(UHunterAttributeSet::StaticClass(), EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		if (It->HasAnyPropertyFlags(CPF_Net) && FGameplayAttribute::IsGameplayAttributeDataProperty(*It))
+		{
+			MarkAttributeDirty(FGameplayAttribute(*It));
+		}
+	}
+}
+
+const FCombatOffenseSnapshot& UHunterAttributeSet::GetCombatOffenseSnapshot() const
+{
+	if (bOffenseSnapshotDirty || !bCombatSnapshotsTracked)
+	{
+		FCombatOutgoingDamageCalculator::BuildOffenseSnapshot(this, CachedOffenseSnapshot);
+		bOffenseSnapshotDirty = false;
+	}
+	return CachedOffenseSnapshot;
+}
+
+const FCombatDefenseSnapshot& UHunterAttributeSet::GetCombatDefenseSnapshot() const
+{
+	if (bDefenseSnapshotDirty || !bCombatSnapshotsTracked)
+	{
+		FCombatIncomingDamageResolver::BuildDefenseSnapshot(this, CachedDefenseSnapshot);
+		bDefenseSnapshotDirty = false;
+	}
+	return CachedDefenseSnapshot;
+}
+
+void UHunterAttributeSet::BindCombatSnapshotInvalidation(UAbilitySystemComponent* ASC)
+{
+	if (SnapshotInvalidationASC.Get() == ASC)
+	{
+		return;
+	}
+
+	UnbindCombatSnapshotInvalidation();
+	if (!ASC)
+	{
+		return;
+	}
+
+	// Value-change delegates fire for aggregator updates on the server and for
+	// replicated values on clients, so both sides keep their snapshots fresh.
+	TArray<FGameplayAttribute> Attributes;
+	GetAllAttributes(Attributes);
+	for (const FGameplayAttribute& Attribute : Attributes)
+	{
+		const EHunterAttributeRepGroup Group = GetAttributeRepGroup(Attribute);
+		if (Group == EHunterAttributeRepGroup::Offense || Group == EHunterAttributeRepGroup::Defense)
+		{
+			ASC->GetGameplayAttributeValueChangeDelegate(Attribute).AddUObject(
+				this, &UHunterAttributeSet::HandleCombatSnapshotAttributeChanged);
+		}
+	}
+
+	SnapshotInvalidationASC = ASC;
+	bCombatSnapshotsTracked = true;
+	InvalidateCombatSnapshots();
+}
+
+void UHunterAttributeSet::UnbindCombatSnapshotInvalidation()
+{
+	UAbilitySystemComponent* ASC = SnapshotInvalidationASC.Get();
+	SnapshotInvalidationASC.Reset();
+	bCombatSnapshotsTracked = false;
+	if (!ASC)
+	{
+		return;
+	}
+
+	TArray<FGameplayAttribute> Attributes;
+	GetAllAttributes(Attributes);
+	for (const FGameplayAttribute& Attribute : Attributes)
+	{
+		const EHunterAttributeRepGroup Group = GetAttributeRepGroup(Attribute);
+		if (Group == EHunterAttributeRepGroup::Offense || Group == EHunterAttributeRepGroup::Defense)
+		{
+			ASC->GetGameplayAttributeValueChangeDelegate(Attribute).RemoveAll(this);
+		}
+	}
+}
+
+void UHunterAttributeSet::TrackCombatSnapshotsManually()
+{
+	bCombatSnapshotsTracked = true;
+	InvalidateCombatSnapshots();
+}
+
+void UHunterAttributeSet::InvalidateCombatSnapshots()
+{
+	bOffenseSnapshotDirty = true;
+	bDefenseSnapshotDirty = true;
+}
+
+void UHunterAttributeSet::HandleCombatSnapshotAttributeChanged(const FOnAttributeChangeData& Data)
+{
+	switch (GetAttributeRepGroup(Data.Attribute))
+	{
+	case EHunterAttributeRepGroup::Offense: bOffenseSnapshotDirty = true; break;
+	case EHunterAttributeRepGroup::Defense: bDefenseSnapshotDirty = true; break;
+	default: break;
+	}
+}
+
+FHunterAttributeRepBenchmarkResult UHunterAttributeSet::BenchmarkMobReplication(int32 Updates, int32 ColdChangeInterval)
+{
+	FHunterAttributeRepBenchmarkResult Result;
+	Result.Updates = FMath::Max(Updates, 1);
+	ColdChangeInterval = FMath::Max(ColdChangeInterval, 1);
+
+	const TArray<HunterAttributeSetPrivate::FAttributeRepEntry> Entries = HunterAttributeSetPrivate::GatherAttributeRepEntries();
+	Result.ReplicatedAttributeCount = Entries.Num();
+
+	TArray<int32> ColdEntryIndices;
+	int32 HealthEntryIndex = INDEX_NONE;
+	for (int32 Index = 0; Index < Entries.Num(); ++Index)
+	{
+		if (Entries[Index].Group == EHunterAttributeRepGroup::Vitals)
+		{
+			++Result.HotAttributeCount;
+			if (Entries[Index].Property->GetFName() == GET_MEMBER_NAME_CHECKED(UHunterAttributeSet, Health))
+			{
+				HealthEntryIndex = Index;
+			}
+		}
+		else
+		{
+			ColdEntryIndices.Add(Index);
+		}
+	}
+
+	if (HealthEntryIndex == INDEX_NONE || ColdEntryIndices.Num() == 0)
+	{
+		UE_LOG(LogHunterAttributeSet, Warning, TEXT("BenchmarkMobReplication: Attribute layout had no Health or no cold attributes."));
+		return Result;
+	}
+
+	UHunterAttributeSet* Set = NewObject<UHunterAttributeSet>(GetTransientPackage());
+
+	// Stand-in for the rep layout: compare each candidate against shadow state and
+	// serialize changed values (handle + base + current) for a non-owning connection.
+	auto RunPass = [&](bool bTrimmed, FHunterAttributeRepProfile& OutProfile)
+	{
+		TArray<FGameplayAttributeData> Shadow;
+		Shadow.Reserve(Entries.Num());
+		for (const HunterAttributeSetPrivate::FAttributeRepEntry& Entry : Entries)
+		{
+			Shadow.Add(*Entry.Property->ContainerPtrToValuePtr<FGameplayAttributeData>(Set));
+		}
+
+		TBitArray<> Dirty(false, Entries.Num());
+		FBitWriter Writer(0, true);
+		int64 Compared = 0;
+
+		const double StartTime = FPlatformTime::Seconds();
+
+		for (int32 Update = 0; Update < Result.Updates; ++Update)
+		{
+			FGameplayAttributeData* Health = Entries[HealthEntryIndex].Property->ContainerPtrToValuePtr<FGameplayAttributeData>(Set);
+			Health->SetCurrentValue(Health->GetCurrentValue() - 1.0f);
+
+			if (Update % ColdChangeInterval == 0)
+			{
+				const int32 ColdIndex = ColdEntryIndices[(Update / ColdChangeInterval) % ColdEntryIndices.Num()];
+				FGameplayAttributeData* Cold = Entries[ColdIndex].Property->ContainerPtrToValuePtr<FGameplayAttributeData>(Set);
+				Cold->SetBaseValue(Cold->GetBaseValue() + 1.0f);
+				Cold->SetCurrentValue(Cold->GetCurrentValue() + 1.0f);
+
+				if (!bTrimmed || EnumHasAnyFlags(HunterDefaultMobAttributeRepGroups, Entries[ColdIndex].Group))
+				{
+					Dirty[ColdIndex] = true;
+				}
+			}
+
+			for (int32 Index = 0; Index < Entries.Num(); ++Index)
+			{
+				const HunterAttributeSetPrivate::FAttributeRepEntry& Entry = Entries[Index];
+				if (bTrimmed && Entry.Group != EHunterAttributeRepGroup::Vitals && !Dirty[Index])
+				{
+					continue;
+				}
+
+				Dirty[Index] = false;
+				++Compared;
+
+				const FGameplayAttributeData& Value = *Entry.Property->ContainerPtrToValuePtr<FGameplayAttributeData>(Set);
+				FGameplayAttributeData& Previous = Shadow[Index];
+				if (Value.GetBaseValue() == Previous.GetBaseValue() && Value.GetCurrentValue() == Previous.GetCurrentValue())
+				{
+					continue;
+				}
+
+				Previous = Value;
+				if (Entry.bSentToNonOwner)
+				{
+					uint32 Handle = static_cast<uint32>(Index + 1);
+					float BaseValue = Value.GetBaseValue();
+					float CurrentValue = Value.GetCurrentValue();
+					Writer.SerializeIntPacked(Handle);
+					Writer << BaseValue << CurrentValue;
+				}
+			}
+		}
+
+		const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+		OutProfile.PropertiesComparedPerUpdate = static_cast<float>(Compared) / Result.Updates;
+		OutProfile.BytesPerUpdate = static_cast<float>(Writer.GetNumBits()) / 8.0f / Result.Updates;
+		OutProfile.MicrosecondsPerUpdate = static_cast<float>(ElapsedSeconds * 1000000.0 / Result.Updates);
+	};
+
+	RunPass(false, Result.Before);
+	RunPass(true, Result.After);
+
+	UE_LOG(LogHunterAttributeSet, Log,
+		TEXT("BenchmarkMobReplication: %d updates, %d attributes (%d hot) | before: %.1f compares, %.1f B, %.2f us | after: %.1f compares, %.1f B, %.2f us per update"),
+		Result.Updates, Result.ReplicatedAttributeCount, Result.HotAttributeCount,
+		Result.Before.PropertiesComparedPerUpdate, Result.Before.BytesPerUpdate, Result.Before.MicrosecondsPerUpdate,
+		Result.After.PropertiesComparedPerUpdate, Result.After.BytesPerUpdate, Result.After.MicrosecondsPerUpdate);
+
+	return Result;
 }
 
 
@@ -487,6 +881,8 @@ void UHunterAttributeSet::PostAttributeChange(const FGameplayAttribute& Attribut
 {
 	Super::PostAttributeChange(Attribute, OldValue, NewValue);
 
+	MarkAttributeDirty(Attribute);
+
 	if (ShouldSkipDerivedVitalUpdate(TEXT("PostAttributeChange"), Attribute))
 	{
 		return;
@@ -495,6 +891,24 @@ void UHunterAttributeSet::PostAttributeChange(const FGameplayAttribute& Attribut
 	UpdateDerivedVitalAttributes(Attribute);
 }
 
+void UHunterAttributeSet::PostAttributeBaseChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) const
+{
+	Super::PostAttributeBaseChange(Attribute, OldValue, NewValue);
+
+	// Base-only changes (current value held by an aggregator) never reach PostAttributeChange,
+	// but the base value is replicated too. Marking dirty does not change attribute state.
+	const_cast<UHunterAttributeSet*>(this)->MarkAttributeDirty(Attribute);
+}
+
+void UHunterAttributeSet::AssignDerivedAttributeIfNeeded(const FGameplayAttribute& Attribute, FGameplayAttributeData& Data, float NewValue)
+{
+	if (HunterAttributeSetPrivate::ShouldAssignAttributeDataValue(Data, NewValue))
+	{
+		HunterAttributeSetPrivate::AssignAttributeDirect(Data, NewValue);
+		MarkAttributeDirty(Attribute);
+	}
+}
+
 void UHunterAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data)
 {
 	Super::PostGameplayEffectExecute(Data);
@@ -611,12 +1025,12 @@ void UHunterAttributeSet::UpdateHealthDerivedAttributes()
 
 	if (Reservation.bUsesComponentReservation)
 	{
-		HunterAttributeSetPrivate::AssignAttributeDirectIfNeeded(ReservedHealth, Reservation.ReservedValue);
+		AssignDerivedAttributeIfNeeded(GetReservedHealthAttribute(), ReservedHealth, Reservation.ReservedValue);
 	}
-	HunterAttributeSetPrivate::AssignAttributeDirectIfNeeded(MaxEffectiveHealth, Reservation.MaxEffectiveValue);
-	HunterAttributeSetPrivate::AssignAttributeDirectIfNeeded(Health, TargetHealth);
-	HunterAttributeSetPrivate::AssignAttributeDirectIfNeeded(HealthRegenRate, TargetHealthRegenRate);
-	HunterAttributeSetPrivate::AssignAttributeDirectIfNeeded(HealthRegenAmount, TargetHealthRegenAmount);
+	AssignDerivedAttributeIfNeeded(GetMaxEffectiveHealthAttribute(), MaxEffectiveHealth, Reservation.MaxEffectiveValue);
+	AssignDerivedAttributeIfNeeded(GetHealthAttribute(), Health, TargetHealth);
+	AssignDerivedAttributeIfNeeded(GetHealthRegenRateAttribute(), HealthRegenRate, TargetHealthRegenRate);
+	AssignDerivedAttributeIfNeeded(GetHealthRegenAmountAttribute(), HealthRegenAmount, TargetHealthRegenAmount);
 
 	UE_LOG(
 		LogHunterAttributeSet,
@@ -647,12 +1061,12 @@ void UHunterAttributeSet::UpdateManaDerivedAttributes()
 
 	if (Reservation.bUsesComponentReservation)
 	{
-		HunterAttributeSetPrivate::AssignAttributeDirectIfNeeded(ReservedMana, Reservation.ReservedValue);
+		AssignDerivedAttributeIfNeeded(GetReservedManaAttribute(), ReservedMana, Reservation.ReservedValue);
 	}
-	HunterAttributeSetPrivate::AssignAttributeDirectIfNeeded(MaxEffectiveMana, Reservation.MaxEffectiveValue);
-	HunterAttributeSetPrivate::AssignAttributeDirectIfNeeded(Mana, TargetMana);
-	HunterAttributeSetPrivate::AssignAttributeDirectIfNeeded(ManaRegenRate, TargetManaRegenRate);
-	HunterAttributeSetPrivate::AssignAttributeDirectIfNeeded(ManaRegenAmount, TargetManaRegenAmount);
+	AssignDerivedAttributeIfNeeded(GetMaxEffectiveManaAttribute(), MaxEffectiveMana, Reservation.MaxEffectiveValue);
+	AssignDerivedAttributeIfNeeded(GetManaAttribute(), Mana, TargetMana);
+	AssignDerivedAttributeIfNeeded(GetManaRegenRateAttribute(), ManaRegenRate, TargetManaRegenRate);
+	AssignDerivedAttributeIfNeeded(GetManaRegenAmountAttribute(), ManaRegenAmount, TargetManaRegenAmount);
 
 	UE_LOG(
 		LogHunterAttributeSet,
@@ -683,12 +1097,12 @@ void UHunterAttributeSet::UpdateStaminaDerivedAttributes()
 
 	if (Reservation.bUsesComponentReservation)
 	{
-		HunterAttributeSetPrivate::AssignAttributeDirectIfNeeded(ReservedStamina, Reservation.ReservedValue);
+		AssignDerivedAttributeIfNeeded(GetReservedStaminaAttribute(), ReservedStamina, Reservation.ReservedValue);
 	}
-	HunterAttributeSetPrivate::AssignAttributeDirectIfNeeded(MaxEffectiveStamina, Reservation.MaxEffectiveValue);
-	HunterAttributeSetPrivate::AssignAttributeDirectIfNeeded(Stamina, TargetStamina);
-	HunterAttributeSetPrivate::AssignAttributeDirectIfNeeded(StaminaRegenRate, TargetStaminaRegenRate);
-	HunterAttributeSetPrivate::AssignAttributeDirectIfNeeded(StaminaRegenAmount, TargetStaminaRegenAmount);
+	AssignDerivedAttributeIfNeeded(GetMaxEffectiveStaminaAttribute(), MaxEffectiveStamina, Reservation.MaxEffectiveValue);
+	AssignDerivedAttributeIfNeeded(GetStaminaAttribute(), Stamina, TargetStamina);
+	AssignDerivedAttributeIfNeeded(GetStaminaRegenRateAttribute(), StaminaRegenRate, TargetStaminaRegenRate);
+	AssignDerivedAttributeIfNeeded(GetStaminaRegenAmountAttribute(), StaminaRegenAmount, TargetStaminaRegenAmount);
 
 	UE_LOG(
 		LogHunterAttributeSet,
@@ -720,13 +1134,13 @@ void UHunterAttributeSet::UpdateArcaneShieldDerivedAttributes()
 
 	if (Reservation.bUsesComponentReservation)
 	{
-		HunterAttributeSetPrivate::AssignAttributeDirectIfNeeded(ReservedArcaneShield, Reservation.ReservedValue);
+		AssignDerivedAttributeIfNeeded(GetReservedArcaneShieldAttribute(), ReservedArcaneShield, Reservation.ReservedValue);
 	}
 
-	HunterAttributeSetPrivate::AssignAttributeDirectIfNeeded(MaxEffectiveArcaneShield, Reservation.MaxEffectiveValue);
-	HunterAttributeSetPrivate::AssignAttributeDirectIfNeeded(ArcaneShield, TargetArcaneShield);
-	HunterAttributeSetPrivate::AssignAttributeDirectIfNeeded(ArcaneShieldRegenRate, TargetArcaneShieldRegenRate);
-	HunterAttributeSetPrivate::AssignAttributeDirectIfNeeded(ArcaneShieldRegenAmount, TargetArcaneShieldRegenAmount);
+	AssignDerivedAttributeIfNeeded(GetMaxEffectiveArcaneShieldAttribute(), MaxEffectiveArcaneShield, Reservation.MaxEffectiveValue);
+	AssignDerivedAttributeIfNeeded(GetArcaneShieldAttribute(), ArcaneShield, TargetArcaneShield);
+	AssignDerivedAttributeIfNeeded(GetArcaneShieldRegenRateAttribute(), ArcaneShieldRegenRate, TargetArcaneShieldRegenRate);
+	AssignDerivedAttributeIfNeeded(GetArcaneShieldRegenAmountAttribute(), ArcaneShieldRegenAmount, TargetArcaneShieldRegenAmount);
 
 	UE_LOG(
 		LogHunterAttributeSet,
@@ -181,14 +181,8 @@ void UCharacterSystemCoordinatorComponent::HandleEquipmentChanged(
 	if (StatsManager && EquipmentManager && EquipmentManager->bApplyStatsOnEquip
 		&& GetOwner() && GetOwner()->HasAuthority())
 	{
-		if (OldItem)
-		{
-			StatsManager->RemoveEquipmentStats(OldItem);
-		}
-		if (NewItem)
-		{
-			StatsManager->ApplyEquipmentStats(NewItem);
-		}
+		// One call so a swap updates shared attributes once instead of removing and re-adding them.
+		StatsManager->HandleEquipmentChanged(Slot, NewItem, OldItem);
 	}
 
 	if (EquipmentPresentation && EquipmentManager && EquipmentManager->bAutoUpdateWeapons)
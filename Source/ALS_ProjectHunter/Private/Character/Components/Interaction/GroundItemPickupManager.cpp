@@ -243,8 +243,9 @@ bool FGroundItemPickupManager::PickupToInventoryInternal(int32 ItemID, FVector C
 
 bool FGroundItemPickupManager::PickupAndEquipInternal(int32 ItemID, FVector ClientLocation)
 {
-	const FVector OriginalLocation = CachedGroundItemSubsystem->GetInstanceLocations().FindRef(ItemID);
-	const bool bHadOriginalLocation = CachedGroundItemSubsystem->GetInstanceLocations().Contains(ItemID);
+	const FVector* OriginalLocationPtr = CachedGroundItemSubsystem->FindItemLocation(ItemID);
+	const bool bHadOriginalLocation = OriginalLocationPtr != nullptr;
+	const FVector OriginalLocation = bHadOriginalLocation ? *OriginalLocationPtr : FVector::ZeroVector;
 
 	UItemInstance* Item = CachedGroundItemSubsystem->RemoveItemFromGround(ItemID);
 	if (!Item)
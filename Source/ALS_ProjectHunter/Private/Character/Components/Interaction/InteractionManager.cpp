@@ -65,7 +65,7 @@ namespace InteractionManagerPrivate
 			return false;
 		}
 
-		const FVector* ItemLocation = GroundItems->GetInstanceLocations().Find(ItemID);
+		const FVector* ItemLocation = GroundItems->FindItemLocation(ItemID);
 		if (!ItemLocation)
 		{
 			UE_LOG(LogInteractionManager, Warning,
@@ -133,6 +133,7 @@ void UInteractionManager::Initialize()
 	}
 
 	World->GetTimerManager().ClearTimer(InteractionCheckTimer);
+	TraceManager.InvalidateCandidateCache();
 
 	if (!bSystemInitialized)
 	{
@@ -182,6 +183,7 @@ void UInteractionManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 		World->GetTimerManager().ClearTimer(InteractionCheckTimer);
 	}
 	CurrentInteractionCheckInterval = -1.0f;
+	TraceManager.InvalidateCandidateCache();
 
 	if (UObject* CurrentInteractableTarget = GetCurrentInteractableObject())
 	{
@@ -13,6 +13,11 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "Engine/World.h"
 DEFINE_LOG_CATEGORY(LogInteractionTraceManager);
+
+DECLARE_STATS_GROUP(TEXT("Interaction"), STATGROUP_Interaction, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Evaluations Performed"), STAT_InteractionEvaluationsPerformed, STATGROUP_Interaction);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Evaluations Skipped"), STAT_InteractionEvaluationsSkipped, STATGROUP_Interaction);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Candidate Queries"), STAT_InteractionCandidateQueries, STATGROUP_Interaction);
 FInteractionTraceManager::FInteractionTraceManager()
 	: InteractionDistance(300.0f)
 	  // 20Hz focus updates - 0.1 (10Hz) read as visibly steppy when sweeping
@@ -115,6 +120,45 @@ void FInteractionTraceManager::FindBestInteractionTarget(
 	}
 
 	const float SafeInteractionDistance = FMath::Max(InteractionDistance, 1.0f);
+	const float SafeInteractionDistanceSq = FMath::Square(SafeInteractionDistance);
+
+	AActor* CurrentFocusActor = nullptr;
+	if (UObject* CurrentObj = CurrentInteractable.GetObject())
+	{
+		if (const UInteractableManager* Comp = Cast<UInteractableManager>(CurrentObj))
+		{
+			CurrentFocusActor = Comp->GetOwner();
+		}
+		else
+		{
+			CurrentFocusActor = Cast<AActor>(CurrentObj);
+		}
+	}
+
+	// OPT-INTERACT: nothing that feeds the ranking moved and the candidate set
+	// is unchanged, so the previous result still holds.
+	const bool bCandidatesRefreshed = bUseIncrementalCandidates
+		&& RefreshCandidateSetIfNeeded(PlayerCenter, SafeInteractionDistance);
+	if (bUseIncrementalCandidates && !bCandidatesRefreshed
+		&& CanReuseLastEvaluation(PlayerCenter, PlayerForward, TraceStart, CameraForward,
+			CurrentInteractable.GetObject(), CurrentItemID))
+	{
+		if (AActor* CachedBestActor = LastBestActor.Get())
+		{
+			OutInteractable = MakeInteractableInterface(CachedBestActor);
+		}
+		OutGroundItemID = LastBestItemID;
+		OutGroundItemCandidates = LastGroundItemCandidates;
+		bOutHasProximityCandidates = bLastHadProximityCandidates;
+
+		++EvaluationsSkipped;
+		INC_DWORD_STAT(STAT_InteractionEvaluationsSkipped);
+		return;
+	}
+
+	++EvaluationsPerformed;
+	INC_DWORD_STAT(STAT_InteractionEvaluationsPerformed);
+
 	auto CalculateScore =
 		[&](const FVector& TargetLocation, bool bIsCurrent,
 			float& OutCameraDot, float& OutPlayerDot, float& OutDistance,
@@ -157,43 +201,55 @@ void FInteractionTraceManager::FindBestInteractionTarget(
 			return true;
 		};
 
-	// Actor interactables use one player-centered physics overlap.
-	TArray<FOverlapResult> Overlaps;
-	FCollisionQueryParams OverlapParams;
-	OverlapParams.AddIgnoredActor(OwnerActor);
-
-	WorldContext->OverlapMultiByChannel(
-		Overlaps,
-		PlayerCenter,
-		FQuat::Identity,
-		InteractionTraceChannel,
-		FCollisionShape::MakeSphere(SafeInteractionDistance),
-		OverlapParams
-	);
-
-	AActor* CurrentFocusActor = nullptr;
-	if (UObject* CurrentObj = CurrentInteractable.GetObject())
+	// Actor interactables use one player-centered physics overlap, or the
+	// cached result of one when incremental candidates are enabled.
+	TArray<AActor*, TInlineAllocator<16>> NearbyActors;
+	if (bUseIncrementalCandidates)
 	{
-		if (const UInteractableManager* Comp = Cast<UInteractableManager>(CurrentObj))
+		for (const TWeakObjectPtr<AActor>& CachedActor : CachedActorCandidates)
 		{
-			CurrentFocusActor = Comp->GetOwner();
+			if (AActor* Actor = CachedActor.Get())
+			{
+				NearbyActors.Add(Actor);
+			}
 		}
-		else
+	}
+	else
+	{
+		TArray<FOverlapResult> Overlaps;
+		FCollisionQueryParams OverlapParams;
+		OverlapParams.AddIgnoredActor(OwnerActor);
+
+		WorldContext->OverlapMultiByChannel(
+			Overlaps,
+			PlayerCenter,
+			FQuat::Identity,
+			InteractionTraceChannel,
+			FCollisionShape::MakeSphere(SafeInteractionDistance),
+			OverlapParams
+		);
+
+		for (const FOverlapResult& Overlap : Overlaps)
 		{
-			CurrentFocusActor = Cast<AActor>(CurrentObj);
+			AActor* OverlapActor = Overlap.GetActor();
+			if (IsActorInteractable(OverlapActor))
+			{
+				NearbyActors.AddUnique(OverlapActor);
+			}
 		}
 	}
 
 	float BestScore = -BIG_NUMBER;
 	AActor* BestActor = nullptr;
-	TSet<AActor*> ScoredActors;
 
-	for (const FOverlapResult& Overlap : Overlaps)
+	// The incremental candidate sets are gathered with a refresh margin, so
+	// proximity only counts what is inside the real interaction range.
+	for (AActor* OverlapActor : NearbyActors)
 	{
-		AActor* OverlapActor = Overlap.GetActor();
-		if (!IsActorInteractable(OverlapActor) || ScoredActors.Contains(OverlapActor)) continue;
-		ScoredActors.Add(OverlapActor);
-		bOutHasProximityCandidates = true;
+		if (FVector::DistSquared(OverlapActor->GetActorLocation(), PlayerCenter) <= SafeInteractionDistanceSq)
+		{
+			bOutHasProximityCandidates = true;
+		}
 
 		float CameraDot = -1.0f;
 		float PlayerDot = -1.0f;
@@ -221,22 +277,29 @@ void FInteractionTraceManager::FindBestInteractionTarget(
 	// collision components or per-item actors.
 	if (CachedGroundItemSubsystem)
 	{
-		TArray<int32> NearbyItemIDs;
-		CachedGroundItemSubsystem->GetItemsInRadius(
-			PlayerCenter,
-			SafeInteractionDistance,
-			NearbyItemIDs);
-		bOutHasProximityCandidates |= !NearbyItemIDs.IsEmpty();
+		TArray<int32> QueriedItemIDs;
+		if (!bUseIncrementalCandidates)
+		{
+			CachedGroundItemSubsystem->GetItemsInRadius(
+				PlayerCenter,
+				SafeInteractionDistance,
+				QueriedItemIDs);
+		}
+		const TArray<int32>& NearbyItemIDs = bUseIncrementalCandidates ? CachedGroundItemIDs : QueriedItemIDs;
 
-		const TMap<int32, FVector>& Locations = CachedGroundItemSubsystem->GetInstanceLocations();
 		for (int32 ItemID : NearbyItemIDs)
 		{
-			const FVector* ItemLocation = Locations.Find(ItemID);
+			const FVector* ItemLocation = CachedGroundItemSubsystem->FindItemLocation(ItemID);
 			if (!ItemLocation)
 			{
 				continue;
 			}
 
+			if (FVector::DistSquared(*ItemLocation, PlayerCenter) <= SafeInteractionDistanceSq)
+			{
+				bOutHasProximityCandidates = true;
+			}
+
 			float CameraDot = -1.0f;
 			float PlayerDot = -1.0f;
 			float Distance = 0.0f;
@@ -296,6 +359,136 @@ void FInteractionTraceManager::FindBestInteractionTarget(
 	{
 		OutGroundItemID = BestItemID;
 	}
+
+	LastScoredPlayerCenter = PlayerCenter;
+	LastScoredPlayerForward = PlayerForward;
+	LastScoredTraceStart = TraceStart;
+	LastScoredCameraForward = CameraForward;
+	LastScoredCurrentObject = CurrentInteractable.GetObject();
+	LastScoredCurrentItemID = CurrentItemID;
+	LastBestActor = BestActor;
+	LastBestItemID = OutGroundItemID;
+	LastGroundItemCandidates = OutGroundItemCandidates;
+	bLastHadProximityCandidates = bOutHasProximityCandidates;
+	bHasLastEvaluation = true;
+}
+
+bool FInteractionTraceManager::RefreshCandidateSetIfNeeded(const FVector& PlayerCenter, float SearchRadius)
+{
+	const double NowSeconds = WorldContext ? WorldContext->GetTimeSeconds() : 0.0;
+	const uint32 GroundItemVersion = CachedGroundItemSubsystem ? CachedGroundItemSubsystem->GetContentVersion() : 0;
+	const float Margin = FMath::Max(CandidateRefreshDistance, 0.0f);
+
+	// The cached sphere covers every point within SearchRadius of any player
+	// position that stays inside Margin of the query center.
+	const bool bStale = !bHasCandidateSet
+		|| GroundItemVersion != CandidateGroundItemVersion
+		|| !FMath::IsNearlyEqual(CandidateQueryRadius, SearchRadius + Margin)
+		|| FVector::DistSquared(PlayerCenter, CandidateQueryCenter) > FMath::Square(Margin)
+		|| NowSeconds - CandidateQueryTimeSeconds >= ActorCandidateRefreshInterval;
+	if (!bStale)
+	{
+		return false;
+	}
+
+	CandidateQueryCenter = PlayerCenter;
+	CandidateQueryRadius = SearchRadius + Margin;
+	CandidateQueryTimeSeconds = NowSeconds;
+	CandidateGroundItemVersion = GroundItemVersion;
+	bHasCandidateSet = true;
+
+	++CandidateQueries;
+	INC_DWORD_STAT(STAT_InteractionCandidateQueries);
+
+	CachedActorCandidates.Reset();
+	if (WorldContext)
+	{
+		TArray<FOverlapResult> Overlaps;
+		FCollisionQueryParams OverlapParams;
+		OverlapParams.AddIgnoredActor(OwnerActor);
+
+		WorldContext->OverlapMultiByChannel(
+			Overlaps,
+			CandidateQueryCenter,
+			FQuat::Identity,
+			InteractionTraceChannel,
+			FCollisionShape::MakeSphere(CandidateQueryRadius),
+			OverlapParams
+		);
+
+		for (const FOverlapResult& Overlap : Overlaps)
+		{
+			AActor* OverlapActor = Overlap.GetActor();
+			if (IsActorInteractable(OverlapActor))
+			{
+				CachedActorCandidates.AddUnique(OverlapActor);
+			}
+		}
+	}
+
+	CachedGroundItemIDs.Reset();
+	if (CachedGroundItemSubsystem)
+	{
+		CachedGroundItemSubsystem->GetItemsInRadius(CandidateQueryCenter, CandidateQueryRadius, CachedGroundItemIDs);
+	}
+
+	return true;
+}
+
+bool FInteractionTraceManager::CanReuseLastEvaluation(const FVector& PlayerCenter, const FVector& PlayerForward,
+	const FVector& TraceStart, const FVector& CameraForward,
+	const UObject* CurrentObject, int32 CurrentItemID) const
+{
+	if (!bHasLastEvaluation)
+	{
+		return false;
+	}
+
+	// Focus hysteresis depends on the current target, so a focus change made
+	// outside this helper (pickup, manual cycling) needs a fresh ranking.
+	if (CurrentItemID != LastScoredCurrentItemID || CurrentObject != LastScoredCurrentObject.Get())
+	{
+		return false;
+	}
+
+	if (LastBestActor.IsStale())
+	{
+		return false;
+	}
+
+	const float MoveThresholdSq = FMath::Square(RescoreMoveThreshold);
+	if (FVector::DistSquared(PlayerCenter, LastScoredPlayerCenter) > MoveThresholdSq
+		|| FVector::DistSquared(TraceStart, LastScoredTraceStart) > MoveThresholdSq)
+	{
+		return false;
+	}
+
+	const float MinFacingDot = FMath::Cos(FMath::DegreesToRadians(RescoreAngleThreshold));
+	return FVector::DotProduct(CameraForward, LastScoredCameraForward) >= MinFacingDot
+		&& FVector::DotProduct(PlayerForward, LastScoredPlayerForward) >= MinFacingDot;
+}
+
+void FInteractionTraceManager::InvalidateCandidateCache()
+{
+	CachedActorCandidates.Reset();
+	CachedGroundItemIDs.Reset();
+	bHasCandidateSet = false;
+	bHasLastEvaluation = false;
+	LastBestActor.Reset();
+	LastBestItemID = INDEX_NONE;
+	LastGroundItemCandidates.Reset();
+}
+
+void FInteractionTraceManager::LogEvaluationStats() const
+{
+	const int32 TotalEvaluations = EvaluationsPerformed + EvaluationsSkipped;
+	const float SkipRate = TotalEvaluations > 0
+		? (static_cast<float>(EvaluationsSkipped) / TotalEvaluations) * 100.0f
+		: 0.0f;
+
+	UE_LOG(LogInteractionTraceManager, Display, TEXT("Evaluations Performed: %d"), EvaluationsPerformed);
+	UE_LOG(LogInteractionTraceManager, Display, TEXT("Evaluations Skipped: %d (%.1f%%)"), EvaluationsSkipped, SkipRate);
+	UE_LOG(LogInteractionTraceManager, Display, TEXT("Candidate Queries: %d"), CandidateQueries);
 }
 
 bool FInteractionTraceManager::PassesPlayerForwardGate(const FVector& TargetLocation, float& OutDot) const
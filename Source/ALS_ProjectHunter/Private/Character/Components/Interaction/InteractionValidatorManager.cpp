@@ -86,7 +86,7 @@ bool FInteractionValidatorManager::ValidateGroundItemPickup(int32 ItemID, FVecto
 		return false;
 	}
 
-	const FVector* ItemLocation = CachedGroundItemSubsystem->GetInstanceLocations().Find(ItemID);
+	const FVector* ItemLocation = CachedGroundItemSubsystem->FindItemLocation(ItemID);
 	if (!ItemLocation)
 	{
 		if (bLogValidationFailures)
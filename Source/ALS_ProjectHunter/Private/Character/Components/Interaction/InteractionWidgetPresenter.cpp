@@ -196,8 +196,7 @@ void FInteractionWidgetPresenter::PositionWidgetAtGroundItem(int32 GroundItemID)
 		return;
 	}
 
-	const TMap<int32, FVector>& Locations = GroundSub->GetInstanceLocations();
-	const FVector* WorldLocPtr = Locations.Find(GroundItemID);
+	const FVector* WorldLocPtr = GroundSub->FindItemLocation(GroundItemID);
 	if (!WorldLocPtr)
 	{
 		return;
@@ -240,8 +239,7 @@ void FInteractionWidgetPresenter::ShowGroundItemWorldWidget(int32 GroundItemID)
 		return;
 	}
 
-	const TMap<int32, FVector>& Locations = GroundSub->GetInstanceLocations();
-	const FVector* WorldLocPtr = Locations.Find(GroundItemID);
+	const FVector* WorldLocPtr = GroundSub->FindItemLocation(GroundItemID);
 	if (!WorldLocPtr)
 	{
 		return;
@@ -307,8 +305,7 @@ void FInteractionWidgetPresenter::TickGroundItemWorldWidget(int32 GroundItemID)
 		return;
 	}
 
-	const TMap<int32, FVector>& Locations = GroundSub->GetInstanceLocations();
-	const FVector* LocPtr = Locations.Find(GroundItemID);
+	const FVector* LocPtr = GroundSub->FindItemLocation(GroundItemID);
 	if (!LocPtr)
 	{
 		return;
@@ -599,8 +596,7 @@ void FInteractionWidgetPresenter::ShowItemTooltipForGroundItem(int32 GroundItemI
 		return;
 	}
 
-	const TMap<int32, FVector>& Locations = GroundSub->GetInstanceLocations();
-	const FVector* WorldLocPtr = Locations.Find(GroundItemID);
+	const FVector* WorldLocPtr = GroundSub->FindItemLocation(GroundItemID);
 	if (!WorldLocPtr)
 	{
 		HideItemTooltip();
@@ -563,6 +563,39 @@ void UPHCharacterMovementComponent::HandleImpact(
 	}
 }
 
+void UPHCharacterMovementComponent::OnMovementUpdated(
+	const float DeltaTime,
+	const FVector& OldLocation,
+	const FVector& OldVelocity)
+{
+	Super::OnMovementUpdated(DeltaTime, OldLocation, OldVelocity);
+	UpdateMovementConditionState(false);
+}
+
+void UPHCharacterMovementComponent::OnMovementModeChanged(
+	const EMovementMode PreviousMovementMode,
+	const uint8 PreviousCustomMode)
+{
+	Super::OnMovementModeChanged(PreviousMovementMode, PreviousCustomMode);
+	UpdateMovementConditionState(true);
+}
+
+void UPHCharacterMovementComponent::UpdateMovementConditionState(const bool bForceBroadcast)
+{
+	const float SpeedSq = MovementMode == MOVE_None ? 0.0f : Velocity.SizeSquared2D();
+	const bool bMoving = bMovingForConditions
+		? SpeedSq > MovementConditionStopSpeedSq
+		: SpeedSq > MovementConditionStartSpeedSq;
+
+	if (bMoving == bMovingForConditions && !bForceBroadcast)
+	{
+		return;
+	}
+
+	bMovingForConditions = bMoving;
+	OnMovementConditionChanged.Broadcast(bMoving);
+}
+
 void UPHCharacterMovementComponent::PhysCustom(const float DeltaTime, const int32 Iterations)
 {
 	const EPHCustomMovementMode Mode = static_cast<EPHCustomMovementMode>(CustomMovementMode);
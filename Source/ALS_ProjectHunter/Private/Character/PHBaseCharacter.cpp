@@ -22,6 +22,8 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Net/UnrealNetwork.h"
 #include "Tags/PHGameplayTags.h"
+#include "AI/Mob/MobSignificanceSubsystem.h"
+#include "Misc/ScopeExit.h"
 
 DEFINE_LOG_CATEGORY(LogPHBaseCharacter);
 
@@ -178,10 +180,40 @@ void APHBaseCharacter::BeginPlay()
 	}
 
 	Super::BeginPlay();
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UMobSignificanceSubsystem* Significance = World->GetSubsystem<UMobSignificanceSubsystem>())
+		{
+			Significance->RegisterMob(this);
+			MobSignificance = Significance;
+		}
+	}
+}
+
+void APHBaseCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UMobSignificanceSubsystem* Significance = MobSignificance.Get())
+	{
+		Significance->UnregisterMob(this);
+	}
+	MobSignificance.Reset();
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void APHBaseCharacter::Tick(float DeltaSeconds)
 {
+	// Mob tick cost feeds the significance subsystem's saved-time estimate.
+	const uint64 TickStartCycles = FPlatformTime::Cycles64();
+	ON_SCOPE_EXIT
+	{
+		if (UMobSignificanceSubsystem* Significance = MobSignificance.Get(); Significance && !IsPlayerControlled())
+		{
+			Significance->RecordActorTickCost(FPlatformTime::Cycles64() - TickStartCycles);
+		}
+	};
+
 	Super::Tick(DeltaSeconds);
 
 	// Forward wall-traversal intent into the movement component so it is captured
@@ -234,6 +266,13 @@ void APHBaseCharacter::PossessedBy(AController* NewController)
 {
 	Super::PossessedBy(NewController);
 
+	if (AttributeSet && NewController)
+	{
+		AttributeSet->SetReplicatedGroups(NewController->IsPlayerController()
+			? HunterAllAttributeRepGroups
+			: static_cast<EHunterAttributeRepGroup>(MobReplicatedAttributeGroups));
+	}
+
 	if (AbilitySystemComponent)
 	{
 		InitializeAbilitySystem();
@@ -786,6 +825,8 @@ void APHBaseCharacter::BindAttributeDelegates()
 
 	AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(
 		AttributeSet->GetHealthAttribute()).AddUObject(this, &APHBaseCharacter::HandleHealthChanged);
+
+	AttributeSet->BindCombatSnapshotInvalidation(AbilitySystemComponent);
 }
 
 void APHBaseCharacter::OnAbilitySystemInitialized()
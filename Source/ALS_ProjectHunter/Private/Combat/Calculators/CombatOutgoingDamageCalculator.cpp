@@ -172,18 +172,215 @@ namespace CombatOutgoingDamageCalculatorPrivate
 			return 0.f;
 		}
 	}
+
+	void GetPacketLanes(const FCombatDamagePacket& Packet, float (&OutLanes)[HunterDamageTypeLaneCount])
+	{
+		for (const EHunterDamageType DamageType : AllDamageTypes)
+		{
+			OutLanes[GetDamageTypeLane(DamageType)] = GetPacketDamage(Packet, DamageType);
+		}
+	}
+
+	void SetPacketLanes(FCombatDamagePacket& Packet, const float (&Lanes)[HunterDamageTypeLaneCount])
+	{
+		for (const EHunterDamageType DamageType : AllDamageTypes)
+		{
+			SetPacketDamage(Packet, DamageType, Lanes[GetDamageTypeLane(DamageType)]);
+		}
+		UpdatePacketTotal(Packet);
+	}
+
+	void GetAnimationBaseMultiLanes(const FAnimationBaseDamageMulti& BaseMulti, float (&OutLanes)[HunterDamageTypeLaneCount])
+	{
+		OutLanes[GetDamageTypeLane(EHunterDamageType::Physical)] = BaseMulti.Physical;
+		OutLanes[GetDamageTypeLane(EHunterDamageType::Fire)] = BaseMulti.Fire;
+		OutLanes[GetDamageTypeLane(EHunterDamageType::Ice)] = BaseMulti.Ice;
+		OutLanes[GetDamageTypeLane(EHunterDamageType::Lightning)] = BaseMulti.Lightning;
+		OutLanes[GetDamageTypeLane(EHunterDamageType::Light)] = BaseMulti.Light;
+		OutLanes[GetDamageTypeLane(EHunterDamageType::Corruption)] = BaseMulti.Corruption;
+	}
+
+	/** Source lanes times the snapshot conversion matrix. Negative sources never convert. */
+	void ConvertLanes(
+		const FCombatOffenseSnapshot& Offense,
+		const float (&SourceLanes)[HunterDamageTypeLaneCount],
+		float (&OutLanes)[HunterDamageTypeLaneCount])
+	{
+		for (float& Lane : OutLanes)
+		{
+			Lane = 0.f;
+		}
+
+		for (int32 FromLane = 0; FromLane < HunterDamageTypeLaneCount; ++FromLane)
+		{
+			const float SourceDamage = FMath::Max(0.f, SourceLanes[FromLane]);
+			if (SourceDamage <= 0.f)
+			{
+				continue;
+			}
+
+			const float (&Row)[HunterDamageTypeLaneCount] = Offense.ConversionFraction[FromLane];
+			for (int32 ToLane = 0; ToLane < HunterDamageTypeLaneCount; ++ToLane)
+			{
+				OutLanes[ToLane] += SourceDamage * Row[ToLane];
+			}
+		}
+	}
+
+	/**
+	 * Increased percent shared by every type of one hit: skill-tag buckets
+	 * the hit opts into and the attacker's current health-state bonus.
+	 */
+	float GetConditionalIncreasedPercent(
+		const FCombatOffenseSnapshot& Offense,
+		const UHunterAttributeSet* AttackerAttributes,
+		const FAnimationDamageInfo& DamageInfo)
+	{
+		const FAnimationSkillTags& Tags = DamageInfo.Tags;
+		float IncreasedPercent =
+			(Tags.bIsMelee ? Offense.MeleeIncreased : 0.f) +
+			(Tags.bIsRanged ? Offense.RangedIncreased : 0.f) +
+			(Tags.bIsSpell ? Offense.SpellIncreased : 0.f) +
+			(Tags.bIsArea ? Offense.AreaIncreased : 0.f) +
+			(Tags.bIsDamageOverTime ? Offense.DamageOverTimeIncreased : 0.f) +
+			(Tags.bIsChainHit ? Offense.ChainIncreased : 0.f);
+
+		const float MaxEffectiveHealth = FMath::Max(
+			AttackerAttributes->GetMaxEffectiveHealth(), AttackerAttributes->GetMaxHealth());
+		if (MaxEffectiveHealth > 0.f)
+		{
+			const float HealthPercent = AttackerAttributes->GetHealth() / MaxEffectiveHealth;
+			if (HealthPercent >= 0.999f)
+			{
+				IncreasedPercent += Offense.FullHealthIncreased;
+			}
+			else if (HealthPercent <= 0.35f)
+			{
+				IncreasedPercent += Offense.LowHealthIncreased;
+			}
+		}
+
+		return IncreasedPercent;
+	}
 }
 
-float FCombatOutgoingDamageCalculator::RollDamageRange(const float MinDamage, const float MaxDamage)
+float FCombatOutgoingDamageCalculator::RollDamageRange(
+	const float MinDamage,
+	const float MaxDamage,
+	FRandomStream& RandStream)
 {
 	const float Low = FMath::Max(0.f, FMath::Min(MinDamage, MaxDamage));
 	const float High = FMath::Max(0.f, FMath::Max(MinDamage, MaxDamage));
-	return High > Low ? FMath::FRandRange(Low, High) : High;
+	return High > Low ? RandStream.FRandRange(Low, High) : High;
+}
+
+void FCombatOutgoingDamageCalculator::BuildOffenseSnapshot(
+	const UHunterAttributeSet* AttackerAttributes,
+	FCombatOffenseSnapshot& OutSnapshot)
+{
+	OutSnapshot = FCombatOffenseSnapshot();
+	if (!AttackerAttributes)
+	{
+		return;
+	}
+
+	using namespace CombatOutgoingDamageCalculatorPrivate;
+
+	const auto SetLanes = [](float (&Lanes)[HunterDamageTypeLaneCount],
+		const float Physical, const float Fire, const float Ice,
+		const float Lightning, const float Light, const float Corruption)
+	{
+		Lanes[GetDamageTypeLane(EHunterDamageType::Physical)] = Physical;
+		Lanes[GetDamageTypeLane(EHunterDamageType::Fire)] = Fire;
+		Lanes[GetDamageTypeLane(EHunterDamageType::Ice)] = Ice;
+		Lanes[GetDamageTypeLane(EHunterDamageType::Lightning)] = Lightning;
+		Lanes[GetDamageTypeLane(EHunterDamageType::Light)] = Light;
+		Lanes[GetDamageTypeLane(EHunterDamageType::Corruption)] = Corruption;
+	};
+
+	const UHunterAttributeSet& A = *AttackerAttributes;
+
+	SetLanes(OutSnapshot.MinDamage,
+		A.GetMinPhysicalDamage(), A.GetMinFireDamage(), A.GetMinIceDamage(),
+		A.GetMinLightningDamage(), A.GetMinLightDamage(), A.GetMinCorruptionDamage());
+	SetLanes(OutSnapshot.MaxDamage,
+		A.GetMaxPhysicalDamage(), A.GetMaxFireDamage(), A.GetMaxIceDamage(),
+		A.GetMaxLightningDamage(), A.GetMaxLightDamage(), A.GetMaxCorruptionDamage());
+	SetLanes(OutSnapshot.FlatDamage,
+		A.GetPhysicalFlatDamage(), A.GetFireFlatDamage(), A.GetIceFlatDamage(),
+		A.GetLightningFlatDamage(), A.GetLightFlatDamage(), A.GetCorruptionFlatDamage());
+	SetLanes(OutSnapshot.IncreasedPercent,
+		A.GetPhysicalPercentDamage(), A.GetFirePercentDamage(), A.GetIcePercentDamage(),
+		A.GetLightningPercentDamage(), A.GetLightPercentDamage(), A.GetCorruptionPercentDamage());
+	SetLanes(OutSnapshot.MoreMultiplier,
+		GetNeutralMultiplier(A.GetPhysicalMoreDamage()), GetNeutralMultiplier(A.GetFireMoreDamage()),
+		GetNeutralMultiplier(A.GetIceMoreDamage()), GetNeutralMultiplier(A.GetLightningMoreDamage()),
+		GetNeutralMultiplier(A.GetLightMoreDamage()), GetNeutralMultiplier(A.GetCorruptionMoreDamage()));
+	SetLanes(OutSnapshot.ResistancePierce,
+		0.f, A.GetFirePiercing(), A.GetIcePiercing(),
+		A.GetLightningPiercing(), A.GetLightPiercing(), A.GetCorruptionPiercing());
+
+	const float GlobalMore = GetNeutralMultiplier(A.GetGlobalMoreDamage());
+	const float ElementalMore = GetNeutralMultiplier(A.GetElementalMoreDamage());
+	for (const EHunterDamageType DamageType : AllDamageTypes)
+	{
+		const int32 Lane = GetDamageTypeLane(DamageType);
+		const bool bElemental = IsElementalDamageType(DamageType);
+
+		OutSnapshot.IncreasedPercent[Lane] += A.GetGlobalDamages() + (bElemental ? A.GetElementalDamage() : 0.f);
+		OutSnapshot.MoreMultiplier[Lane] = FMath::Max(
+			0.f, GlobalMore * (bElemental ? ElementalMore : 1.f) * OutSnapshot.MoreMultiplier[Lane]);
+	}
+
+	// Over-allocated conversion (total > 100%) scales down proportionally
+	// so the hit never gains free damage from stacking conversion sources.
+	for (const EHunterDamageType FromType : AllDamageTypes)
+	{
+		float (&Row)[HunterDamageTypeLaneCount] = OutSnapshot.ConversionFraction[GetDamageTypeLane(FromType)];
+
+		float TotalConversionPercent = 0.f;
+		for (const EHunterDamageType ToType : AllDamageTypes)
+		{
+			Row[GetDamageTypeLane(ToType)] = FMath::Max(0.f, GetConversionPercent(AttackerAttributes, FromType, ToType));
+			TotalConversionPercent += Row[GetDamageTypeLane(ToType)];
+		}
+
+		const float ConversionScale = TotalConversionPercent > 100.f
+			? 100.f / TotalConversionPercent
+			: 1.f;
+
+		float ConvertedAway = 0.f;
+		for (float& Fraction : Row)
+		{
+			Fraction *= ConversionScale / 100.f;
+			ConvertedAway += Fraction;
+		}
+
+		Row[GetDamageTypeLane(FromType)] = FMath::Max(0.f, 1.f - ConvertedAway);
+	}
+
+	OutSnapshot.ArmourPiercing = A.GetArmourPiercing();
+
+	OutSnapshot.MeleeIncreased = A.GetMeleeDamage();
+	OutSnapshot.RangedIncreased = A.GetRangedDamage();
+	OutSnapshot.SpellIncreased = A.GetSpellDamage();
+	OutSnapshot.AreaIncreased = A.GetAreaDamage();
+	OutSnapshot.DamageOverTimeIncreased = A.GetDamageOverTime();
+	OutSnapshot.ChainIncreased = A.GetChainDamage();
+
+	OutSnapshot.FullHealthIncreased = A.GetDamageBonusWhileAtFullHP();
+	OutSnapshot.LowHealthIncreased = A.GetDamageBonusWhileAtLowHP();
+
+	OutSnapshot.CritChance = A.GetCritChance();
+	OutSnapshot.SpellCritChance = A.GetSpellsCritChance();
+	OutSnapshot.CritMultiplier = A.GetCritMultiplier() > 0.f ? A.GetCritMultiplier() : DefaultCritMultiplier;
+	OutSnapshot.SpellCritMultiplierBonus = FMath::Max(0.f, GetNeutralMultiplier(A.GetSpellsCritMultiplier()) - 1.f);
 }
 
 FCombatDamagePacket FCombatOutgoingDamageCalculator::BuildOutgoingDamagePacket(
 	const UHunterAttributeSet* AttackerAttributes,
-	const FAnimationDamageInfo& DamageInfo)
+	const FAnimationDamageInfo& DamageInfo,
+	FRandomStream& RandStream)
 {
 	FCombatDamagePacket Packet;
 	if (!AttackerAttributes)
@@ -191,65 +388,72 @@ FCombatDamagePacket FCombatOutgoingDamageCalculator::BuildOutgoingDamagePacket(
 		return Packet;
 	}
 
-	const bool bDebugLog = CombatOutgoingDamageCalculatorPrivate::IsCombatDebugLoggingEnabled();
+	using namespace CombatOutgoingDamageCalculatorPrivate;
 
-	for (const EHunterDamageType DamageType : CombatOutgoingDamageCalculatorPrivate::AllDamageTypes)
+	// OPT-COMBATSNAPSHOT: every attacker attribute the packet needs comes from
+	// the cached lanes; only the health ratio is read live.
+	const FCombatOffenseSnapshot& Offense = AttackerAttributes->GetCombatOffenseSnapshot();
+	const bool bDebugLog = IsCombatDebugLoggingEnabled();
+
+	// Rolls run in lane order so a seeded stream is consumed identically everywhere.
+	float BaseLanes[HunterDamageTypeLaneCount];
+	for (int32 Lane = 0; Lane < HunterDamageTypeLaneCount; ++Lane)
 	{
-		CombatOutgoingDamageCalculatorPrivate::SetPacketDamage(
-			Packet, DamageType, CalculateBaseDamageForType(DamageType, AttackerAttributes));
+		BaseLanes[Lane] = FMath::Max(0.f,
+			RollDamageRange(Offense.MinDamage[Lane], Offense.MaxDamage[Lane], RandStream) + Offense.FlatDamage[Lane]);
 	}
 
 	if (bDebugLog)
 	{
+		SetPacketLanes(Packet, BaseLanes);
 		UE_LOG(LogCombatOutgoingDamageCalculator, Log,
 			TEXT("[CombatDebug] Weapon attrs: Phys %.1f-%.1f (+%.1f flat) Fire %.1f-%.1f (+%.1f) Ice %.1f-%.1f (+%.1f) Lightning %.1f-%.1f (+%.1f) Light %.1f-%.1f (+%.1f) Corruption %.1f-%.1f (+%.1f)"),
-			AttackerAttributes->GetMinPhysicalDamage(), AttackerAttributes->GetMaxPhysicalDamage(), AttackerAttributes->GetPhysicalFlatDamage(),
-			AttackerAttributes->GetMinFireDamage(), AttackerAttributes->GetMaxFireDamage(), AttackerAttributes->GetFireFlatDamage(),
-			AttackerAttributes->GetMinIceDamage(), AttackerAttributes->GetMaxIceDamage(), AttackerAttributes->GetIceFlatDamage(),
-			AttackerAttributes->GetMinLightningDamage(), AttackerAttributes->GetMaxLightningDamage(), AttackerAttributes->GetLightningFlatDamage(),
-			AttackerAttributes->GetMinLightDamage(), AttackerAttributes->GetMaxLightDamage(), AttackerAttributes->GetLightFlatDamage(),
-			AttackerAttributes->GetMinCorruptionDamage(), AttackerAttributes->GetMaxCorruptionDamage(), AttackerAttributes->GetCorruptionFlatDamage());
+			Offense.MinDamage[0], Offense.MaxDamage[0], Offense.FlatDamage[0],
+			Offense.MinDamage[1], Offense.MaxDamage[1], Offense.FlatDamage[1],
+			Offense.MinDamage[2], Offense.MaxDamage[2], Offense.FlatDamage[2],
+			Offense.MinDamage[3], Offense.MaxDamage[3], Offense.FlatDamage[3],
+			Offense.MinDamage[4], Offense.MaxDamage[4], Offense.FlatDamage[4],
+			Offense.MinDamage[5], Offense.MaxDamage[5], Offense.FlatDamage[5]);
 		UE_LOG(LogCombatOutgoingDamageCalculator, Log, TEXT("[CombatDebug] Stage 1 base roll:      %s"),
 			*FormatPacket(Packet));
 	}
 
 	// Conversion first: converted damage scales only with modifiers of its
 	// final type, never both.
-	Packet = ApplyDamageConversion(Packet, AttackerAttributes);
+	float ConvertedLanes[HunterDamageTypeLaneCount];
+	ConvertLanes(Offense, BaseLanes, ConvertedLanes);
 
 	if (bDebugLog)
 	{
+		SetPacketLanes(Packet, ConvertedLanes);
 		UE_LOG(LogCombatOutgoingDamageCalculator, Log, TEXT("[CombatDebug] Stage 2 post-conversion: %s"),
 			*FormatPacket(Packet));
 	}
 
-	for (const EHunterDamageType DamageType : CombatOutgoingDamageCalculatorPrivate::AllDamageTypes)
-	{
-		const float BaseDamage = CombatOutgoingDamageCalculatorPrivate::GetPacketDamage(Packet, DamageType);
-		if (BaseDamage <= 0.f)
-		{
-			continue;
-		}
+	const float SharedIncreasedPercent = GetConditionalIncreasedPercent(Offense, AttackerAttributes, DamageInfo);
+	float AnimationLanes[HunterDamageTypeLaneCount];
+	GetAnimationBaseMultiLanes(DamageInfo.BaseMulti, AnimationLanes);
 
-		const float IncreasedPercent = GetIncreasedDamagePercent(DamageType, AttackerAttributes, DamageInfo);
-		const float AfterIncreased = FMath::Max(
-			0.f, CombatOutgoingDamageCalculatorPrivate::ApplyPercentIncrease(BaseDamage, IncreasedPercent));
-		const float MoreMultiplier = GetMoreDamageMultiplier(DamageType, AttackerAttributes);
+	float ScaledLanes[HunterDamageTypeLaneCount];
+	for (int32 Lane = 0; Lane < HunterDamageTypeLaneCount; ++Lane)
+	{
+		const float IncreasedPercent = Offense.IncreasedPercent[Lane] + AnimationLanes[Lane] + SharedIncreasedPercent;
+		const float AfterIncreased = FMath::Max(0.f, ApplyPercentIncrease(ConvertedLanes[Lane], IncreasedPercent));
+		ScaledLanes[Lane] = ConvertedLanes[Lane] > 0.f
+			? FMath::Max(0.f, AfterIncreased * Offense.MoreMultiplier[Lane])
+			: 0.f;
 
-		if (bDebugLog)
+		if (bDebugLog && ConvertedLanes[Lane] > 0.f)
 		{
 			UE_LOG(LogCombatOutgoingDamageCalculator, Log,
 				TEXT("[CombatDebug] Stage 3 scaling %-10s base=%.2f increased=%+.1f%% more=x%.3f -> %.2f"),
-				*UEnum::GetDisplayValueAsText(DamageType).ToString(),
-				BaseDamage, IncreasedPercent, MoreMultiplier,
-				FMath::Max(0.f, AfterIncreased * MoreMultiplier));
+				*UEnum::GetDisplayValueAsText(AllDamageTypes[Lane]).ToString(),
+				ConvertedLanes[Lane], IncreasedPercent, Offense.MoreMultiplier[Lane], ScaledLanes[Lane]);
 		}
-
-		CombatOutgoingDamageCalculatorPrivate::SetPacketDamage(
-			Packet, DamageType, FMath::Max(0.f, AfterIncreased * MoreMultiplier));
 	}
 
-	ResolveCriticalStrike(Packet, AttackerAttributes, DamageInfo);
+	SetPacketLanes(Packet, ScaledLanes);
+	ResolveCriticalStrike(Packet, AttackerAttributes, DamageInfo, RandStream);
 
 	if (bDebugLog)
 	{
@@ -262,54 +466,18 @@ FCombatDamagePacket FCombatOutgoingDamageCalculator::BuildOutgoingDamagePacket(
 
 float FCombatOutgoingDamageCalculator::CalculateBaseDamageForType(
 	const EHunterDamageType DamageType,
-	const UHunterAttributeSet* AttackerAttributes)
+	const UHunterAttributeSet* AttackerAttributes,
+	FRandomStream& RandStream)
 {
 	if (!AttackerAttributes)
 	{
 		return 0.f;
 	}
 
-	float WeaponMin = 0.f;
-	float WeaponMax = 0.f;
-	float FlatDamage = 0.f;
-
-	switch (DamageType)
-	{
-	case EHunterDamageType::Physical:
-		WeaponMin = AttackerAttributes->GetMinPhysicalDamage();
-		WeaponMax = AttackerAttributes->GetMaxPhysicalDamage();
-		FlatDamage = AttackerAttributes->GetPhysicalFlatDamage();
-		break;
-	case EHunterDamageType::Fire:
-		WeaponMin = AttackerAttributes->GetMinFireDamage();
-		WeaponMax = AttackerAttributes->GetMaxFireDamage();
-		FlatDamage = AttackerAttributes->GetFireFlatDamage();
-		break;
-	case EHunterDamageType::Ice:
-		WeaponMin = AttackerAttributes->GetMinIceDamage();
-		WeaponMax = AttackerAttributes->GetMaxIceDamage();
-		FlatDamage = AttackerAttributes->GetIceFlatDamage();
-		break;
-	case EHunterDamageType::Lightning:
-		WeaponMin = AttackerAttributes->GetMinLightningDamage();
-		WeaponMax = AttackerAttributes->GetMaxLightningDamage();
-		FlatDamage = AttackerAttributes->GetLightningFlatDamage();
-		break;
-	case EHunterDamageType::Light:
-		WeaponMin = AttackerAttributes->GetMinLightDamage();
-		WeaponMax = AttackerAttributes->GetMaxLightDamage();
-		FlatDamage = AttackerAttributes->GetLightFlatDamage();
-		break;
-	case EHunterDamageType::Corruption:
-		WeaponMin = AttackerAttributes->GetMinCorruptionDamage();
-		WeaponMax = AttackerAttributes->GetMaxCorruptionDamage();
-		FlatDamage = AttackerAttributes->GetCorruptionFlatDamage();
-		break;
-	default:
-		return 0.f;
-	}
-
-	return FMath::Max(0.f, RollDamageRange(WeaponMin, WeaponMax) + FlatDamage);
+	const FCombatOffenseSnapshot& Offense = AttackerAttributes->GetCombatOffenseSnapshot();
+	const int32 Lane = GetDamageTypeLane(DamageType);
+	return FMath::Max(0.f,
+		RollDamageRange(Offense.MinDamage[Lane], Offense.MaxDamage[Lane], RandStream) + Offense.FlatDamage[Lane]);
 }
 
 FCombatDamagePacket FCombatOutgoingDamageCalculator::ApplyDamageConversion(
@@ -321,59 +489,15 @@ FCombatDamagePacket FCombatOutgoingDamageCalculator::ApplyDamageConversion(
 		return InPacket;
 	}
 
-	FCombatDamagePacket OutPacket = InPacket;
-	for (const EHunterDamageType DamageType : CombatOutgoingDamageCalculatorPrivate::AllDamageTypes)
-	{
-		CombatOutgoingDamageCalculatorPrivate::SetPacketDamage(OutPacket, DamageType, 0.f);
-	}
+	float SourceLanes[HunterDamageTypeLaneCount];
+	CombatOutgoingDamageCalculatorPrivate::GetPacketLanes(InPacket, SourceLanes);
 
-	for (const EHunterDamageType FromType : CombatOutgoingDamageCalculatorPrivate::AllDamageTypes)
-	{
-		const float SourceDamage = FMath::Max(
-			0.f, CombatOutgoingDamageCalculatorPrivate::GetPacketDamage(InPacket, FromType));
-		if (SourceDamage <= 0.f)
-		{
-			continue;
-		}
+	float ConvertedLanes[HunterDamageTypeLaneCount];
+	CombatOutgoingDamageCalculatorPrivate::ConvertLanes(
+		AttackerAttributes->GetCombatOffenseSnapshot(), SourceLanes, ConvertedLanes);
 
-		float TotalConversionPercent = 0.f;
-		for (const EHunterDamageType ToType : CombatOutgoingDamageCalculatorPrivate::AllDamageTypes)
-		{
-			TotalConversionPercent += FMath::Max(
-				0.f, CombatOutgoingDamageCalculatorPrivate::GetConversionPercent(AttackerAttributes, FromType, ToType));
-		}
-
-		// Over-allocated conversion (total > 100%) scales down proportionally
-		// so the hit never gains free damage from stacking conversion sources.
-		const float ConversionScale = TotalConversionPercent > 100.f
-			? 100.f / TotalConversionPercent
-			: 1.f;
-
-		float ConvertedAway = 0.f;
-		for (const EHunterDamageType ToType : CombatOutgoingDamageCalculatorPrivate::AllDamageTypes)
-		{
-			const float Percent = FMath::Max(
-				0.f, CombatOutgoingDamageCalculatorPrivate::GetConversionPercent(AttackerAttributes, FromType, ToType))
-				* ConversionScale;
-			if (Percent <= 0.f)
-			{
-				continue;
-			}
-
-			const float ConvertedAmount = SourceDamage * (Percent / 100.f);
-			ConvertedAway += ConvertedAmount;
-			CombatOutgoingDamageCalculatorPrivate::SetPacketDamage(
-				OutPacket, ToType,
-				CombatOutgoingDamageCalculatorPrivate::GetPacketDamage(OutPacket, ToType) + ConvertedAmount);
-		}
-
-		const float Remainder = FMath::Max(0.f, SourceDamage - ConvertedAway);
-		CombatOutgoingDamageCalculatorPrivate::SetPacketDamage(
-			OutPacket, FromType,
-			CombatOutgoingDamageCalculatorPrivate::GetPacketDamage(OutPacket, FromType) + Remainder);
-	}
-
-	CombatOutgoingDamageCalculatorPrivate::UpdatePacketTotal(OutPacket);
+	FCombatDamagePacket OutPacket = InPacket;
+	CombatOutgoingDamageCalculatorPrivate::SetPacketLanes(OutPacket, ConvertedLanes);
 	return OutPacket;
 }
 
@@ -387,86 +511,13 @@ float FCombatOutgoingDamageCalculator::GetIncreasedDamagePercent(
 		return 0.f;
 	}
 
-	float TotalIncreasedPercent = AttackerAttributes->GetGlobalDamages();
-
-	switch (DamageType)
-	{
-	case EHunterDamageType::Physical:
-		TotalIncreasedPercent += AttackerAttributes->GetPhysicalPercentDamage();
-		TotalIncreasedPercent += DamageInfo.BaseMulti.Physical;
-		break;
-	case EHunterDamageType::Fire:
-		TotalIncreasedPercent += AttackerAttributes->GetFirePercentDamage();
-		TotalIncreasedPercent += DamageInfo.BaseMulti.Fire;
-		break;
-	case EHunterDamageType::Ice:
-		TotalIncreasedPercent += AttackerAttributes->GetIcePercentDamage();
-		TotalIncreasedPercent += DamageInfo.BaseMulti.Ice;
-		break;
-	case EHunterDamageType::Lightning:
-		TotalIncreasedPercent += AttackerAttributes->GetLightningPercentDamage();
-		TotalIncreasedPercent += DamageInfo.BaseMulti.Lightning;
-		break;
-	case EHunterDamageType::Light:
-		TotalIncreasedPercent += AttackerAttributes->GetLightPercentDamage();
-		TotalIncreasedPercent += DamageInfo.BaseMulti.Light;
-		break;
-	case EHunterDamageType::Corruption:
-		TotalIncreasedPercent += AttackerAttributes->GetCorruptionPercentDamage();
-		TotalIncreasedPercent += DamageInfo.BaseMulti.Corruption;
-		break;
-	default:
-		return 0.f;
-	}
-
-	if (CombatOutgoingDamageCalculatorPrivate::IsElementalDamageType(DamageType))
-	{
-		TotalIncreasedPercent += AttackerAttributes->GetElementalDamage();
-	}
-
-	// Tag-conditional increased buckets. Each true flag opts this hit into the
-	// matching attribute the same way skill tags gate support scaling.
-	if (DamageInfo.Tags.bIsMelee)
-	{
-		TotalIncreasedPercent += AttackerAttributes->GetMeleeDamage();
-	}
-	if (DamageInfo.Tags.bIsRanged)
-	{
-		TotalIncreasedPercent += AttackerAttributes->GetRangedDamage();
-	}
-	if (DamageInfo.Tags.bIsSpell)
-	{
-		TotalIncreasedPercent += AttackerAttributes->GetSpellDamage();
-	}
-	if (DamageInfo.Tags.bIsArea)
-	{
-		TotalIncreasedPercent += AttackerAttributes->GetAreaDamage();
-	}
-	if (DamageInfo.Tags.bIsDamageOverTime)
-	{
-		TotalIncreasedPercent += AttackerAttributes->GetDamageOverTime();
-	}
-	if (DamageInfo.Tags.bIsChainHit)
-	{
-		TotalIncreasedPercent += AttackerAttributes->GetChainDamage();
-	}
-
-	const float MaxEffectiveHealth = FMath::Max(
-		AttackerAttributes->GetMaxEffectiveHealth(), AttackerAttributes->GetMaxHealth());
-	if (MaxEffectiveHealth > 0.f)
-	{
-		const float HealthPercent = AttackerAttributes->GetHealth() / MaxEffectiveHealth;
-		if (HealthPercent >= 0.999f)
-		{
-			TotalIncreasedPercent += AttackerAttributes->GetDamageBonusWhileAtFullHP();
-		}
-		else if (HealthPercent <= 0.35f)
-		{
-			TotalIncreasedPercent += AttackerAttributes->GetDamageBonusWhileAtLowHP();
-		}
-	}
+	const FCombatOffenseSnapshot& Offense = AttackerAttributes->GetCombatOffenseSnapshot();
+	float AnimationLanes[HunterDamageTypeLaneCount];
+	CombatOutgoingDamageCalculatorPrivate::GetAnimationBaseMultiLanes(DamageInfo.BaseMulti, AnimationLanes);
 
-	return TotalIncreasedPercent;
+	const int32 Lane = GetDamageTypeLane(DamageType);
+	return Offense.IncreasedPercent[Lane] + AnimationLanes[Lane]
+		+ CombatOutgoingDamageCalculatorPrivate::GetConditionalIncreasedPercent(Offense, AttackerAttributes, DamageInfo);
 }
 
 float FCombatOutgoingDamageCalculator::GetMoreDamageMultiplier(
@@ -478,44 +529,14 @@ float FCombatOutgoingDamageCalculator::GetMoreDamageMultiplier(
 		return 1.f;
 	}
 
-	float Multiplier = CombatOutgoingDamageCalculatorPrivate::GetNeutralMultiplier(AttackerAttributes->GetGlobalMoreDamage());
-
-	if (CombatOutgoingDamageCalculatorPrivate::IsElementalDamageType(DamageType))
-	{
-		Multiplier *= CombatOutgoingDamageCalculatorPrivate::GetNeutralMultiplier(AttackerAttributes->GetElementalMoreDamage());
-	}
-
-	switch (DamageType)
-	{
-	case EHunterDamageType::Physical:
-		Multiplier *= CombatOutgoingDamageCalculatorPrivate::GetNeutralMultiplier(AttackerAttributes->GetPhysicalMoreDamage());
-		break;
-	case EHunterDamageType::Fire:
-		Multiplier *= CombatOutgoingDamageCalculatorPrivate::GetNeutralMultiplier(AttackerAttributes->GetFireMoreDamage());
-		break;
-	case EHunterDamageType::Ice:
-		Multiplier *= CombatOutgoingDamageCalculatorPrivate::GetNeutralMultiplier(AttackerAttributes->GetIceMoreDamage());
-		break;
-	case EHunterDamageType::Lightning:
-		Multiplier *= CombatOutgoingDamageCalculatorPrivate::GetNeutralMultiplier(AttackerAttributes->GetLightningMoreDamage());
-		break;
-	case EHunterDamageType::Light:
-		Multiplier *= CombatOutgoingDamageCalculatorPrivate::GetNeutralMultiplier(AttackerAttributes->GetLightMoreDamage());
-		break;
-	case EHunterDamageType::Corruption:
-		Multiplier *= CombatOutgoingDamageCalculatorPrivate::GetNeutralMultiplier(AttackerAttributes->GetCorruptionMoreDamage());
-		break;
-	default:
-		break;
-	}
-
-	return FMath::Max(0.f, Multiplier);
+	return AttackerAttributes->GetCombatOffenseSnapshot().MoreMultiplier[GetDamageTypeLane(DamageType)];
 }
 
 void FCombatOutgoingDamageCalculator::ResolveCriticalStrike(
 	FCombatDamagePacket& Packet,
 	const UHunterAttributeSet* AttackerAttributes,
-	const FAnimationDamageInfo& DamageInfo)
+	const FAnimationDamageInfo& DamageInfo,
+	FRandomStream& RandStream)
 {
 	Packet.bCrit = false;
 	Packet.CritMultiplierApplied = 1.f;
@@ -528,29 +549,27 @@ void FCombatOutgoingDamageCalculator::ResolveCriticalStrike(
 		return;
 	}
 
-	float CritChance = AttackerAttributes->GetCritChance() + DamageInfo.Crit.CritChance;
+	const FCombatOffenseSnapshot& Offense = AttackerAttributes->GetCombatOffenseSnapshot();
+
+	float CritChance = Offense.CritChance + DamageInfo.Crit.CritChance;
 	if (DamageInfo.Tags.bIsSpell)
 	{
-		CritChance += AttackerAttributes->GetSpellsCritChance();
+		CritChance += Offense.SpellCritChance;
 	}
 	CritChance = FMath::Clamp(CritChance, 0.f, 100.f);
 
 	const bool bCritSucceeded = DamageInfo.Crit.bForceCrit
-		|| (CritChance > 0.f && FMath::FRandRange(0.f, 100.f) < CritChance);
+		|| (CritChance > 0.f && RandStream.FRandRange(0.f, 100.f) < CritChance);
 	if (!bCritSucceeded)
 	{
 		CombatOutgoingDamageCalculatorPrivate::UpdatePacketTotal(Packet);
 		return;
 	}
 
-	float CritMultiplier = AttackerAttributes->GetCritMultiplier() > 0.f
-		? AttackerAttributes->GetCritMultiplier()
-		: CombatOutgoingDamageCalculatorPrivate::DefaultCritMultiplier;
+	float CritMultiplier = Offense.CritMultiplier;
 	if (DamageInfo.Tags.bIsSpell)
 	{
-		const float SpellCritMultiplier =
-			CombatOutgoingDamageCalculatorPrivate::GetNeutralMultiplier(AttackerAttributes->GetSpellsCritMultiplier());
-		CritMultiplier += FMath::Max(0.f, SpellCritMultiplier - 1.f);
+		CritMultiplier += Offense.SpellCritMultiplierBonus;
 	}
 	CritMultiplier += FMath::Max(0.f, DamageInfo.Crit.CritMultiplier);
 	CritMultiplier = FMath::Max(CritMultiplier, 0.f);
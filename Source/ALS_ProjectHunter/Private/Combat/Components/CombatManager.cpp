@@ -7,8 +7,11 @@
 #include "Combat/Calculators/CombatOutgoingDamageCalculator.h"
 #include "Combat/Resolvers/CombatIncomingDamageResolver.h"
 #include "Combat/Library/FunctionLibraries/CombatFunctionLibrary.h"
+#include "Combat/Simulation/CombatSimulationHarness.h"
+#include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "GameplayEffect.h"
+#include "HAL/PlatformTime.h"
 #include "Tags/PHGameplayTags.h"
 
 DEFINE_LOG_CATEGORY(LogCombatManager);
@@ -41,6 +44,38 @@ namespace CombatManagerPrivate
 		return TargetActor->GetActorLocation() +
 			FVector(0.f, 0.f, TargetActor->GetSimpleCollisionHalfHeight());
 	}
+
+	FCombatDamagePopupData MakeDamagePopupData(
+		AActor* AttackerActor,
+		AActor* DefenderActor,
+		const FCombatResolveResult& Result)
+	{
+		FCombatDamagePopupData PopupData;
+		PopupData.SourceActor = AttackerActor;
+		PopupData.TargetActor = DefenderActor;
+		PopupData.ResolveResult = Result;
+		PopupData.TotalDamage = Result.TotalDamageTaken;
+		PopupData.DominantDamageType = UCombatFunctionLibrary::GetDominantDamageTypeFromResolveResult(Result);
+		PopupData.DisplayColor = UCombatFunctionLibrary::GetDefaultDamageTypeColor(PopupData.DominantDamageType);
+		PopupData.WorldLocation = ResolveDamagePopupWorldLocation(DefenderActor);
+		PopupData.bWasCrit = Result.bWasCrit;
+		PopupData.bWasBlocked = Result.bWasBlocked;
+		PopupData.bKilledTarget = Result.bKilledTarget;
+		return PopupData;
+	}
+
+	bool IsSameDamageInfo(const FAnimationDamageInfo& A, const FAnimationDamageInfo& B)
+	{
+		return FAnimationDamageInfo::StaticStruct()->CompareScriptStruct(&A, &B, PPF_None);
+	}
+
+	// Fixed so benchmark runs compare the same rolls.
+	constexpr int32 BenchmarkSeed = 0x48554E54;
+
+	bool RollChance(FRandomStream& RandStream, const float ChancePercent)
+	{
+		return ChancePercent > 0.f && RandStream.FRandRange(0.f, 100.f) < FMath::Min(ChancePercent, 100.f);
+	}
 }
 
 void UCombatIncomingHitEditContext::RejectHit()
@@ -58,6 +93,39 @@ UCombatManager::UCombatManager()
 	CombatStatus = CreateDefaultSubobject<UCombatStatusEffectApplier>(TEXT("CombatStatus"));
 }
 
+void UCombatManager::BeginPlay()
+{
+	Super::BeginPlay();
+
+	ResetCombatRandomStream(CombatSeed);
+}
+
+void UCombatManager::ResetCombatRandomStream(const int32 NewSeed)
+{
+	CombatSeed = NewSeed;
+	if (NewSeed != 0)
+	{
+		CombatRandomStream.Initialize(NewSeed);
+	}
+	else
+	{
+		CombatRandomStream.GenerateNewSeed();
+	}
+}
+
+FRandomStream& UCombatManager::GetCombatantRandomStream(const AActor* Combatant)
+{
+	if (IsValid(Combatant) && Combatant != GetOwner())
+	{
+		if (UCombatManager* CombatantManager = Combatant->FindComponentByClass<UCombatManager>())
+		{
+			return CombatantManager->CombatRandomStream;
+		}
+	}
+
+	return CombatRandomStream;
+}
+
 UAbilitySystemComponent* UCombatManager::GetAbilitySystemComponentFromActor(const AActor* Actor)
 {
 	if (!IsValid(Actor))
@@ -113,32 +181,21 @@ bool UCombatManager::ApplyHit(
 	bool bEffectiveCanApplyAilments = bCanApplyAilments;
 
 	const bool bHasAuthority = DefenderActor->HasAuthority();
-	if (bHasAuthority && OnEditIncomingHit.IsBound())
+	if (bHasAuthority && !RunIncomingHitEdit(
+		AttackerActor, DefenderActor, EffectiveInfo, EffectiveHitResponse, bEffectiveCanApplyAilments))
 	{
-		UCombatIncomingHitEditContext* EditContext = NewObject<UCombatIncomingHitEditContext>(this);
-		EditContext->AttackerActor = AttackerActor;
-		EditContext->DefenderActor = DefenderActor;
-		EditContext->DamageInfo = EffectiveInfo;
-		EditContext->HitResponse = EffectiveHitResponse;
-		EditContext->bCanApplyAilments = bEffectiveCanApplyAilments;
-
-		OnEditIncomingHit.Broadcast(EditContext);
-
-		if (!EditContext->bApplyHit)
-		{
-			UE_LOG(LogCombatManager, Verbose,
-				TEXT("ApplyHit rejected by incoming hit edit. Attacker=%s Defender=%s"),
-				*GetNameSafe(AttackerActor), *GetNameSafe(DefenderActor));
-			return false;
-		}
+		return false;
+	}
 
-		EffectiveInfo = EditContext->DamageInfo;
-		EffectiveHitResponse = EditContext->HitResponse;
-		bEffectiveCanApplyAilments = EditContext->bCanApplyAilments;
+	if (bHasAuthority && bRecordingHitLog)
+	{
+		RecordHit(AttackerActor, DefenderActor, EffectiveInfo, EffectiveHitResponse,
+			bEffectiveCanApplyAilments, AttackerAttributes, DefenderAttributes);
 	}
 
 	// Outgoing: base -> conversion -> increased/more -> crit.
-	FCombatDamagePacket OutgoingPacket = FCombatOutgoingDamageCalculator::BuildOutgoingDamagePacket(AttackerAttributes, EffectiveInfo);
+	FCombatDamagePacket OutgoingPacket = FCombatOutgoingDamageCalculator::BuildOutgoingDamagePacket(
+		AttackerAttributes, EffectiveInfo, GetCombatantRandomStream(AttackerActor));
 	UE_LOG(LogCombatManager, Verbose, TEXT("ApplyHit outgoing packet: %s"),
 		*FCombatOutgoingDamageCalculator::FormatPacket(OutgoingPacket));
 
@@ -167,9 +224,8 @@ bool UCombatManager::ApplyHit(
 		&& DefenderAttributes->GetHealth() <= 0.f;
 	OutResult.HealthAfterHit = DefenderAttributes->GetHealth();
 
-	ApplyOnHitRecovery(AttackerActor, OutResult, AttackerASC, AttackerAttributes);
-	ApplyAilments(AttackerActor, DefenderActor, OutResult);
-	ApplyReflect(AttackerActor, DefenderActor, OutResult);
+	ApplyOnHitRecovery(AttackerActor, OutResult.TotalDamageTaken, 1, AttackerASC, AttackerAttributes);
+	ApplyHitRolls(AttackerActor, DefenderActor, OutResult, AttackerAttributes, DefenderAttributes);
 
 	BroadcastDamagePopup(AttackerActor, DefenderActor, OutResult);
 
@@ -180,6 +236,371 @@ bool UCombatManager::ApplyHit(
 	return true;
 }
 
+int32 UCombatManager::ApplyHitBatch(
+	AActor* AttackerActor,
+	const TArray<AActor*>& Defenders,
+	const FAnimationDamageInfo& DamageInfo,
+	TArray<FCombatResolveResult>& OutResults,
+	const EHitResponse HitResponse,
+	const bool bCanApplyAilments)
+{
+	OutResults.Reset();
+	OutResults.SetNum(Defenders.Num());
+
+	if (!IsValid(AttackerActor) || Defenders.IsEmpty())
+	{
+		UE_LOG(LogCombatManager, Warning,
+			TEXT("ApplyHitBatch failed because attacker was invalid or no defenders were given. Attacker=%s Defenders=%d"),
+			*GetNameSafe(AttackerActor), Defenders.Num());
+		return 0;
+	}
+
+	// OPT-COMBATBATCH: attacker lookups and the outgoing packet are built once
+	// per swing instead of once per defender.
+	UAbilitySystemComponent* AttackerASC = GetAbilitySystemComponentFromActor(AttackerActor);
+	const UHunterAttributeSet* AttackerAttributes = AttackerASC ? AttackerASC->GetSet<UHunterAttributeSet>() : nullptr;
+	if (!AttackerAttributes)
+	{
+		UE_LOG(LogCombatManager, Warning,
+			TEXT("ApplyHitBatch requires a UHunterAttributeSet on the attacker. Attacker=%s"),
+			*GetNameSafe(AttackerActor));
+		return 0;
+	}
+
+	// Opened before the shared roll so the attacker's seed is captured ahead of it.
+	const int32 RecordedBatchIndex = bRecordingHitLog && AttackerActor->HasAuthority()
+		? RecordHitBatch(AttackerActor, DamageInfo, AttackerAttributes)
+		: INDEX_NONE;
+
+	FRandomStream& AttackerStream = GetCombatantRandomStream(AttackerActor);
+	const FCombatDamagePacket SharedPacket =
+		FCombatOutgoingDamageCalculator::BuildOutgoingDamagePacket(AttackerAttributes, DamageInfo, AttackerStream);
+	UE_LOG(LogCombatManager, Verbose, TEXT("ApplyHitBatch outgoing packet: %s (%d defenders)"),
+		*FCombatOutgoingDamageCalculator::FormatPacket(SharedPacket), Defenders.Num());
+
+	TArray<FCombatDamagePopupData> PopupBatch;
+	const bool bWantsPopups = OnDamagePopupBatchRequested.IsBound() || OnDamagePopupRequested.IsBound();
+	if (bWantsPopups)
+	{
+		PopupBatch.Reserve(Defenders.Num());
+	}
+
+	float RecoveryDamageDealt = 0.f;
+	int32 RecoveryLandedHits = 0;
+	int32 ResolvedCount = 0;
+
+	for (int32 Index = 0; Index < Defenders.Num(); ++Index)
+	{
+		AActor* DefenderActor = Defenders[Index];
+		if (!IsValid(DefenderActor) || DefenderActor == AttackerActor)
+		{
+			continue;
+		}
+
+		const UHunterAttributeSet* DefenderAttributes = GetHunterAttributeSetFromActor(DefenderActor);
+		if (!DefenderAttributes)
+		{
+			UE_LOG(LogCombatManager, Verbose,
+				TEXT("ApplyHitBatch skipped %s: no UHunterAttributeSet."), *GetNameSafe(DefenderActor));
+			continue;
+		}
+
+		FAnimationDamageInfo EffectiveInfo = DamageInfo;
+		EHitResponse EffectiveHitResponse = HitResponse;
+		bool bEffectiveCanApplyAilments = bCanApplyAilments;
+
+		const bool bHasAuthority = DefenderActor->HasAuthority();
+		if (bHasAuthority && !RunIncomingHitEdit(
+			AttackerActor, DefenderActor, EffectiveInfo, EffectiveHitResponse, bEffectiveCanApplyAilments))
+		{
+			continue;
+		}
+
+		// Only an edit that actually changed the animation info pays for a rebuild.
+		const bool bInfoEdited = bHasAuthority && OnEditIncomingHit.IsBound()
+			&& !CombatManagerPrivate::IsSameDamageInfo(EffectiveInfo, DamageInfo);
+
+		if (bHasAuthority && RecordedBatchIndex != INDEX_NONE)
+		{
+			RecordHit(AttackerActor, DefenderActor, EffectiveInfo, EffectiveHitResponse,
+				bEffectiveCanApplyAilments, AttackerAttributes, DefenderAttributes, RecordedBatchIndex, !bInfoEdited);
+		}
+		const FCombatDamagePacket OutgoingPacket = bInfoEdited
+			? FCombatOutgoingDamageCalculator::BuildOutgoingDamagePacket(AttackerAttributes, EffectiveInfo, AttackerStream)
+			: SharedPacket;
+
+		FCombatResolveResult& Result = OutResults[Index];
+		Result = FCombatIncomingDamageResolver::MitigateDamagePacket(
+			OutgoingPacket, AttackerActor, DefenderActor,
+			AttackerAttributes, DefenderAttributes, EffectiveInfo);
+		FCombatIncomingDamageResolver::EvaluateStagger(DefenderActor, DefenderAttributes, Result);
+		FCombatIncomingDamageResolver::ApplyHitResponse(EffectiveHitResponse, bEffectiveCanApplyAilments, Result);
+		++ResolvedCount;
+
+		if (!bHasAuthority)
+		{
+			continue;
+		}
+
+		ApplyResolvedDamage(AttackerActor, DefenderActor, Result);
+		Result.bKilledTarget = Result.HitResponse != EHitResponse::Invincible
+			&& DefenderAttributes->GetHealth() <= 0.f;
+		Result.HealthAfterHit = DefenderAttributes->GetHealth();
+
+		if (Result.TotalDamageTaken > 0.f)
+		{
+			RecoveryDamageDealt += Result.TotalDamageTaken;
+			++RecoveryLandedHits;
+		}
+
+		ApplyHitRolls(AttackerActor, DefenderActor, Result, AttackerAttributes, DefenderAttributes);
+
+		if (bWantsPopups && Result.TotalDamageTaken > KINDA_SMALL_NUMBER)
+		{
+			PopupBatch.Add(CombatManagerPrivate::MakeDamagePopupData(AttackerActor, DefenderActor, Result));
+		}
+	}
+
+	ApplyOnHitRecovery(AttackerActor, RecoveryDamageDealt, RecoveryLandedHits, AttackerASC, AttackerAttributes);
+
+	BroadcastDamagePopupBatch(PopupBatch);
+
+	UE_LOG(LogCombatManager, Verbose, TEXT("ApplyHitBatch completed. Attacker=%s Resolved=%d/%d"),
+		*GetNameSafe(AttackerActor), ResolvedCount, Defenders.Num());
+
+	return ResolvedCount;
+}
+
+FCombatHitBatchBenchmarkResult UCombatManager::BenchmarkHitResolution(
+	AActor* AttackerActor,
+	const TArray<AActor*>& Defenders,
+	const FAnimationDamageInfo& DamageInfo,
+	const int32 Iterations)
+{
+	FCombatHitBatchBenchmarkResult Result;
+	Result.Iterations = FMath::Max(1, Iterations);
+
+	const UHunterAttributeSet* AttackerAttributes = GetHunterAttributeSetFromActor(AttackerActor);
+	if (!AttackerAttributes)
+	{
+		UE_LOG(LogCombatManager, Warning,
+			TEXT("BenchmarkHitResolution requires a UHunterAttributeSet on the attacker. Attacker=%s"),
+			*GetNameSafe(AttackerActor));
+		return Result;
+	}
+
+	TArray<AActor*> ValidDefenders;
+	ValidDefenders.Reserve(Defenders.Num());
+	for (AActor* DefenderActor : Defenders)
+	{
+		if (IsValid(DefenderActor) && DefenderActor != AttackerActor && GetHunterAttributeSetFromActor(DefenderActor))
+		{
+			ValidDefenders.Add(DefenderActor);
+		}
+	}
+
+	Result.DefenderCount = ValidDefenders.Num();
+	if (ValidDefenders.IsEmpty())
+	{
+		return Result;
+	}
+
+	FRandomStream BenchmarkStream(CombatManagerPrivate::BenchmarkSeed);
+
+	// Per-pair path: the lookups and outgoing build ApplyHit repeats for every defender.
+	const double PerHitStart = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Result.Iterations; ++Iteration)
+	{
+		for (AActor* DefenderActor : ValidDefenders)
+		{
+			const UHunterAttributeSet* PairAttackerAttributes = GetHunterAttributeSetFromActor(AttackerActor);
+			const UHunterAttributeSet* DefenderAttributes = GetHunterAttributeSetFromActor(DefenderActor);
+			const FCombatDamagePacket Packet =
+				FCombatOutgoingDamageCalculator::BuildOutgoingDamagePacket(PairAttackerAttributes, DamageInfo, BenchmarkStream);
+			FCombatResolveResult HitResult = FCombatIncomingDamageResolver::MitigateDamagePacket(
+				Packet, AttackerActor, DefenderActor, PairAttackerAttributes, DefenderAttributes, DamageInfo);
+			FCombatIncomingDamageResolver::EvaluateStagger(DefenderActor, DefenderAttributes, HitResult);
+			FCombatIncomingDamageResolver::ApplyHitResponse(EHitResponse::Normal, true, HitResult);
+		}
+	}
+	const double PerHitSeconds = FPlatformTime::Seconds() - PerHitStart;
+
+	// Batched path: attacker side once per swing, mitigation per defender.
+	BenchmarkStream.Reset();
+	const double BatchStart = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Result.Iterations; ++Iteration)
+	{
+		const FCombatDamagePacket SharedPacket =
+			FCombatOutgoingDamageCalculator::BuildOutgoingDamagePacket(AttackerAttributes, DamageInfo, BenchmarkStream);
+		for (AActor* DefenderActor : ValidDefenders)
+		{
+			const UHunterAttributeSet* DefenderAttributes = GetHunterAttributeSetFromActor(DefenderActor);
+			FCombatResolveResult HitResult = FCombatIncomingDamageResolver::MitigateDamagePacket(
+				SharedPacket, AttackerActor, DefenderActor, AttackerAttributes, DefenderAttributes, DamageInfo);
+			FCombatIncomingDamageResolver::EvaluateStagger(DefenderActor, DefenderAttributes, HitResult);
+			FCombatIncomingDamageResolver::ApplyHitResponse(EHitResponse::Normal, true, HitResult);
+		}
+	}
+	const double BatchSeconds = FPlatformTime::Seconds() - BatchStart;
+
+	const double TotalHits = static_cast<double>(Result.Iterations) * Result.DefenderCount;
+	Result.PerHitTotalMs = PerHitSeconds * 1000.0;
+	Result.BatchTotalMs = BatchSeconds * 1000.0;
+	Result.PerHitHitsPerMs = Result.PerHitTotalMs > 0.0 ? TotalHits / Result.PerHitTotalMs : 0.0;
+	Result.BatchHitsPerMs = Result.BatchTotalMs > 0.0 ? TotalHits / Result.BatchTotalMs : 0.0;
+
+	UE_LOG(LogCombatManager, Log,
+		TEXT("BenchmarkHitResolution: %d swings x %d defenders | per-hit %.3fms (%.1f hits/ms) | "
+		     "batch %.3fms (%.1f hits/ms)"),
+		Result.Iterations, Result.DefenderCount,
+		Result.PerHitTotalMs, Result.PerHitHitsPerMs,
+		Result.BatchTotalMs, Result.BatchHitsPerMs);
+
+	return Result;
+}
+
+bool UCombatManager::RunIncomingHitEdit(
+	AActor* AttackerActor,
+	AActor* DefenderActor,
+	FAnimationDamageInfo& InOutDamageInfo,
+	EHitResponse& InOutHitResponse,
+	bool& bInOutCanApplyAilments)
+{
+	if (!OnEditIncomingHit.IsBound())
+	{
+		return true;
+	}
+
+	UCombatIncomingHitEditContext* EditContext = nullptr;
+	const bool bUsePooledContext = !bPooledEditContextInUse;
+	if (bUsePooledContext)
+	{
+		if (!PooledEditContext)
+		{
+			PooledEditContext = NewObject<UCombatIncomingHitEditContext>(this);
+		}
+		EditContext = PooledEditContext;
+		bPooledEditContextInUse = true;
+	}
+	else
+	{
+		EditContext = NewObject<UCombatIncomingHitEditContext>(this);
+	}
+
+	EditContext->AttackerActor = AttackerActor;
+	EditContext->DefenderActor = DefenderActor;
+	EditContext->DamageInfo = InOutDamageInfo;
+	EditContext->HitResponse = InOutHitResponse;
+	EditContext->bCanApplyAilments = bInOutCanApplyAilments;
+	EditContext->bApplyHit = true;
+
+	OnEditIncomingHit.Broadcast(EditContext);
+
+	const bool bApplyHit = EditContext->bApplyHit;
+	if (bApplyHit)
+	{
+		InOutDamageInfo = EditContext->DamageInfo;
+		InOutHitResponse = EditContext->HitResponse;
+		bInOutCanApplyAilments = EditContext->bCanApplyAilments;
+	}
+	else
+	{
+		UE_LOG(LogCombatManager, Verbose,
+			TEXT("Hit rejected by incoming hit edit. Attacker=%s Defender=%s"),
+			*GetNameSafe(AttackerActor), *GetNameSafe(DefenderActor));
+	}
+
+	// Drop actor references so the pooled context never keeps dead actors reachable.
+	EditContext->AttackerActor = nullptr;
+	EditContext->DefenderActor = nullptr;
+	if (bUsePooledContext)
+	{
+		bPooledEditContextInUse = false;
+	}
+
+	return bApplyHit;
+}
+
+// Hit log
+
+void UCombatManager::StartHitLogRecording()
+{
+	RecordedHitLog = FCombatHitLog{};
+	RecordedCombatantIndices.Reset();
+	bRecordingHitLog = true;
+}
+
+FCombatHitLog UCombatManager::StopHitLogRecording()
+{
+	bRecordingHitLog = false;
+	RecordedCombatantIndices.Reset();
+	return MoveTemp(RecordedHitLog);
+}
+
+void UCombatManager::RecordHit(
+	AActor* AttackerActor,
+	AActor* DefenderActor,
+	const FAnimationDamageInfo& DamageInfo,
+	const EHitResponse HitResponse,
+	const bool bCanApplyAilments,
+	const UHunterAttributeSet* AttackerAttributes,
+	const UHunterAttributeSet* DefenderAttributes,
+	const int32 BatchIndex,
+	const bool bUsesBatchPacket)
+{
+	// Both indices resolve before the entry is added, so a combatant's capture
+	// always precedes its first hit and the rolls that hit makes.
+	const int32 AttackerIndex = FindOrAddRecordedCombatant(AttackerActor, AttackerAttributes);
+	const int32 DefenderIndex = FindOrAddRecordedCombatant(DefenderActor, DefenderAttributes);
+
+	FCombatHitLogEntry& Entry = RecordedHitLog.Hits.AddDefaulted_GetRef();
+	Entry.AttackerIndex = AttackerIndex;
+	Entry.DefenderIndex = DefenderIndex;
+	const UWorld* World = GetWorld();
+	Entry.TimeSeconds = World ? World->GetTimeSeconds() : 0.f;
+	Entry.DamageInfo = DamageInfo;
+	Entry.HitResponse = HitResponse;
+	Entry.bCanApplyAilments = bCanApplyAilments;
+	Entry.BatchIndex = BatchIndex;
+	Entry.bUsesBatchPacket = bUsesBatchPacket;
+}
+
+int32 UCombatManager::RecordHitBatch(
+	AActor* AttackerActor,
+	const FAnimationDamageInfo& DamageInfo,
+	const UHunterAttributeSet* AttackerAttributes)
+{
+	const int32 AttackerIndex = FindOrAddRecordedCombatant(AttackerActor, AttackerAttributes);
+
+	const int32 Index = RecordedHitLog.Batches.AddDefaulted();
+	FCombatHitLogBatch& Batch = RecordedHitLog.Batches[Index];
+	Batch.AttackerIndex = AttackerIndex;
+	Batch.FirstHitIndex = RecordedHitLog.Hits.Num();
+	Batch.DamageInfo = DamageInfo;
+	return Index;
+}
+
+int32 UCombatManager::FindOrAddRecordedCombatant(AActor* Actor, const UHunterAttributeSet* Attributes)
+{
+	if (const int32* Existing = RecordedCombatantIndices.Find(Actor))
+	{
+		return *Existing;
+	}
+
+	// Captured before the hit rolls anything, so replay starts from the same stream state.
+	const int32 Index = RecordedHitLog.Combatants.AddDefaulted();
+	FCombatHitLogCombatant& Combatant = RecordedHitLog.Combatants[Index];
+	Combatant.Seed = GetCombatantRandomStream(Actor).GetCurrentSeed();
+	Combatant.Profile = FCombatSimulationHarness::CaptureAttributeProfile(Attributes);
+	RecordedCombatantIndices.Add(Actor, Index);
+	return Index;
+}
+
+FCombatSimulationReport UCombatManager::ReplayHitLog(const FCombatHitLog& HitLog, const int32 Repetitions)
+{
+	return FCombatSimulationHarness::ReplayHitLog(HitLog, Repetitions);
+}
+
 // Application
 
 void UCombatManager::ApplyResolvedDamage(
@@ -255,21 +676,22 @@ void UCombatManager::ApplyResolvedDamage(
 
 void UCombatManager::ApplyOnHitRecovery(
 	AActor* AttackerActor,
-	const FCombatResolveResult& Result,
+	const float DamageDealt,
+	const int32 LandedHits,
 	UAbilitySystemComponent* AttackerASC,
 	const UHunterAttributeSet* AttackerAttributes) const
 {
-	if (!AttackerASC || !AttackerAttributes || Result.TotalDamageTaken <= 0.f)
+	if (!AttackerASC || !AttackerAttributes || DamageDealt <= 0.f || LandedHits <= 0)
 	{
 		return;
 	}
 
-	const float HealthRecovery = FMath::Max(0.f, AttackerAttributes->GetLifeOnHit())
-		+ FMath::Max(0.f, Result.TotalDamageTaken * (AttackerAttributes->GetLifeLeech() / 100.f));
-	const float ManaRecovery = FMath::Max(0.f, AttackerAttributes->GetManaOnHit())
-		+ FMath::Max(0.f, Result.TotalDamageTaken * (AttackerAttributes->GetManaLeech() / 100.f));
-	const float StaminaRecovery = FMath::Max(0.f, AttackerAttributes->GetStaminaOnHit())
-		+ FMath::Max(0.f, Result.TotalDamageTaken * (AttackerAttributes->GetStaminaLeechPercent() / 100.f));
+	const float HealthRecovery = FMath::Max(0.f, AttackerAttributes->GetLifeOnHit()) * LandedHits
+		+ FMath::Max(0.f, DamageDealt * (AttackerAttributes->GetLifeLeech() / 100.f));
+	const float ManaRecovery = FMath::Max(0.f, AttackerAttributes->GetManaOnHit()) * LandedHits
+		+ FMath::Max(0.f, DamageDealt * (AttackerAttributes->GetManaLeech() / 100.f));
+	const float StaminaRecovery = FMath::Max(0.f, AttackerAttributes->GetStaminaOnHit()) * LandedHits
+		+ FMath::Max(0.f, DamageDealt * (AttackerAttributes->GetStaminaLeechPercent() / 100.f));
 
 	if (HealthRecovery <= 0.f && ManaRecovery <= 0.f && StaminaRecovery <= 0.f)
 	{
@@ -310,18 +732,85 @@ void UCombatManager::ApplyOnHitRecovery(
 	AttackerASC->ApplyGameplayEffectSpecToSelf(*Spec.Data.Get());
 }
 
-void UCombatManager::ApplyAilments(
+void UCombatManager::ApplyHitRolls(
 	AActor* AttackerActor,
 	AActor* DefenderActor,
-	const FCombatResolveResult& Result) const
+	const FCombatResolveResult& Result,
+	const UHunterAttributeSet* AttackerAttributes,
+	const UHunterAttributeSet* DefenderAttributes)
+{
+	// Attacker procs come from the attacker's stream, reflect from the defender's.
+	const FCombatAilmentRolls Rolls =
+		RollAilments(Result, AttackerAttributes, GetCombatantRandomStream(AttackerActor));
+	ApplyAilments(AttackerActor, DefenderActor, Result, Rolls, AttackerAttributes);
+
+	const float ReflectedDamage =
+		RollReflectDamage(Result, DefenderAttributes, GetCombatantRandomStream(DefenderActor));
+	ApplyReflect(AttackerActor, DefenderActor, ReflectedDamage);
+}
+
+FCombatAilmentRolls UCombatManager::RollAilments(
+	const FCombatResolveResult& Result,
+	const UHunterAttributeSet* AttackerAttributes,
+	FRandomStream& RandStream)
 {
-	if (!Result.bShouldApplyAilments || Result.HitResponse == EHitResponse::Invincible)
+	FCombatAilmentRolls Rolls;
+	if (!AttackerAttributes || !Result.bShouldApplyAilments || Result.HitResponse == EHitResponse::Invincible)
 	{
-		return;
+		return Rolls;
 	}
 
-	const UHunterAttributeSet* AttackerAttributes = GetHunterAttributeSetFromActor(AttackerActor);
-	if (!AttackerAttributes || !IsValid(DefenderActor))
+	// Each typed ailment requires that damage type to have actually landed.
+	// Parry keeps per-type taken values alive precisely so these still work.
+	using CombatManagerPrivate::RollChance;
+	Rolls.bBleed = Result.PhysicalTaken > 0.f && RollChance(RandStream, AttackerAttributes->GetChanceToBleed());
+	Rolls.bIgnite = Result.FireTaken > 0.f && RollChance(RandStream, AttackerAttributes->GetChanceToIgnite());
+	Rolls.bCorruption = Result.CorruptionTaken > 0.f && RollChance(RandStream, AttackerAttributes->GetChanceToCorrupt());
+
+	// Cold damage always chills; freeze is the chance roll on top.
+	Rolls.bChill = Result.IceTaken > 0.f;
+	Rolls.bFreeze = Rolls.bChill && RollChance(RandStream, AttackerAttributes->GetChanceToFreeze());
+
+	Rolls.bShock = Result.LightningTaken > 0.f && RollChance(RandStream, AttackerAttributes->GetChanceToShock());
+	Rolls.bPetrify = Result.LightTaken > 0.f && RollChance(RandStream, AttackerAttributes->GetChanceToPetrify());
+	return Rolls;
+}
+
+float UCombatManager::RollReflectDamage(
+	const FCombatResolveResult& Result,
+	const UHunterAttributeSet* DefenderAttributes,
+	FRandomStream& RandStream)
+{
+	if (!DefenderAttributes || Result.TotalDamageTaken <= 0.f)
+	{
+		return 0.f;
+	}
+
+	using CombatManagerPrivate::RollChance;
+	float ReflectedDamage = 0.f;
+	if (Result.PhysicalTaken > 0.f && RollChance(RandStream, DefenderAttributes->GetReflectChancePhysical()))
+	{
+		ReflectedDamage += Result.PhysicalTaken * (FMath::Max(0.f, DefenderAttributes->GetReflectPhysical()) / 100.f);
+	}
+
+	const float ElementalTaken =
+		Result.FireTaken + Result.IceTaken + Result.LightningTaken + Result.LightTaken;
+	if (ElementalTaken > 0.f && RollChance(RandStream, DefenderAttributes->GetReflectChanceElemental()))
+	{
+		ReflectedDamage += ElementalTaken * (FMath::Max(0.f, DefenderAttributes->GetReflectElemental()) / 100.f);
+	}
+
+	return ReflectedDamage;
+}
+
+void UCombatManager::ApplyAilments(
+	AActor* AttackerActor,
+	AActor* DefenderActor,
+	const FCombatResolveResult& Result,
+	const FCombatAilmentRolls& Rolls,
+	const UHunterAttributeSet* AttackerAttributes) const
+{
+	if (Rolls.Num() == 0 || !AttackerAttributes || !IsValid(DefenderActor))
 	{
 		return;
 	}
@@ -335,18 +824,12 @@ void UCombatManager::ApplyAilments(
 		return;
 	}
 
-	const auto RollChance = [](const float ChancePercent) -> bool
-	{
-		return ChancePercent > 0.f && FMath::FRandRange(0.f, 100.f) < FMath::Min(ChancePercent, 100.f);
-	};
 	const auto ResolveDuration = [](const float AttributeDuration, const float DefaultDuration) -> float
 	{
 		return AttributeDuration > 0.f ? AttributeDuration : DefaultDuration;
 	};
 
-	// Each typed ailment requires that damage type to have actually landed.
-	// Parry keeps per-type taken values alive precisely so these still work.
-	if (Result.PhysicalTaken > 0.f && RollChance(AttackerAttributes->GetChanceToBleed()))
+	if (Rolls.bBleed)
 	{
 		StatusManager->ApplyBleed(
 			DefenderActor,
@@ -355,7 +838,7 @@ void UCombatManager::ApplyAilments(
 			AttackerActor);
 	}
 
-	if (Result.FireTaken > 0.f && RollChance(AttackerAttributes->GetChanceToIgnite()))
+	if (Rolls.bIgnite)
 	{
 		StatusManager->ApplyIgnite(
 			DefenderActor,
@@ -364,7 +847,7 @@ void UCombatManager::ApplyAilments(
 			AttackerActor);
 	}
 
-	if (Result.CorruptionTaken > 0.f && RollChance(AttackerAttributes->GetChanceToCorrupt()))
+	if (Rolls.bCorruption)
 	{
 		StatusManager->ApplyCorruption(
 			DefenderActor,
@@ -373,25 +856,24 @@ void UCombatManager::ApplyAilments(
 			AttackerActor);
 	}
 
-	if (Result.IceTaken > 0.f)
+	if (Rolls.bChill)
 	{
-		// Cold damage always chills; freeze is the chance roll on top.
 		StatusManager->ApplyChill(
 			DefenderActor,
 			CombatManagerPrivate::DefaultChillSlowFraction,
 			CombatManagerPrivate::DefaultChillDuration,
 			AttackerActor);
+	}
 
-		if (RollChance(AttackerAttributes->GetChanceToFreeze()))
-		{
-			StatusManager->ApplyFreeze(
-				DefenderActor,
-				ResolveDuration(AttackerAttributes->GetFreezeDuration(), CombatManagerPrivate::DefaultFreezeDuration),
-				AttackerActor);
-		}
+	if (Rolls.bFreeze)
+	{
+		StatusManager->ApplyFreeze(
+			DefenderActor,
+			ResolveDuration(AttackerAttributes->GetFreezeDuration(), CombatManagerPrivate::DefaultFreezeDuration),
+			AttackerActor);
 	}
 
-	if (Result.LightningTaken > 0.f && RollChance(AttackerAttributes->GetChanceToShock()))
+	if (Rolls.bShock)
 	{
 		StatusManager->ApplyShock(
 			DefenderActor,
@@ -400,7 +882,7 @@ void UCombatManager::ApplyAilments(
 			AttackerActor);
 	}
 
-	if (Result.LightTaken > 0.f && RollChance(AttackerAttributes->GetChanceToPetrify()))
+	if (Rolls.bPetrify)
 	{
 		StatusManager->ApplyPetrify(
 			DefenderActor,
@@ -412,38 +894,9 @@ void UCombatManager::ApplyAilments(
 void UCombatManager::ApplyReflect(
 	AActor* AttackerActor,
 	AActor* DefenderActor,
-	const FCombatResolveResult& Result) const
+	const float ReflectedDamage) const
 {
-	if (Result.TotalDamageTaken <= 0.f || !IsValid(AttackerActor) || !IsValid(DefenderActor))
-	{
-		return;
-	}
-
-	const UHunterAttributeSet* DefenderAttributes = GetHunterAttributeSetFromActor(DefenderActor);
-	if (!DefenderAttributes)
-	{
-		return;
-	}
-
-	const auto RollChance = [](const float ChancePercent) -> bool
-	{
-		return ChancePercent > 0.f && FMath::FRandRange(0.f, 100.f) < FMath::Min(ChancePercent, 100.f);
-	};
-
-	float ReflectedDamage = 0.f;
-	if (Result.PhysicalTaken > 0.f && RollChance(DefenderAttributes->GetReflectChancePhysical()))
-	{
-		ReflectedDamage += Result.PhysicalTaken * (FMath::Max(0.f, DefenderAttributes->GetReflectPhysical()) / 100.f);
-	}
-
-	const float ElementalTaken =
-		Result.FireTaken + Result.IceTaken + Result.LightningTaken + Result.LightTaken;
-	if (ElementalTaken > 0.f && RollChance(DefenderAttributes->GetReflectChanceElemental()))
-	{
-		ReflectedDamage += ElementalTaken * (FMath::Max(0.f, DefenderAttributes->GetReflectElemental()) / 100.f);
-	}
-
-	if (ReflectedDamage <= 0.f)
+	if (ReflectedDamage <= 0.f || !IsValid(AttackerActor) || !IsValid(DefenderActor))
 	{
 		return;
 	}
@@ -485,17 +938,29 @@ void UCombatManager::BroadcastDamagePopup(
 		return;
 	}
 
-	FCombatDamagePopupData PopupData;
-	PopupData.SourceActor = AttackerActor;
-	PopupData.TargetActor = DefenderActor;
-	PopupData.ResolveResult = Result;
-	PopupData.TotalDamage = Result.TotalDamageTaken;
-	PopupData.DominantDamageType = UCombatFunctionLibrary::GetDominantDamageTypeFromResolveResult(Result);
-	PopupData.DisplayColor = UCombatFunctionLibrary::GetDefaultDamageTypeColor(PopupData.DominantDamageType);
-	PopupData.WorldLocation = CombatManagerPrivate::ResolveDamagePopupWorldLocation(DefenderActor);
-	PopupData.bWasCrit = Result.bWasCrit;
-	PopupData.bWasBlocked = Result.bWasBlocked;
-	PopupData.bKilledTarget = Result.bKilledTarget;
+	OnDamagePopupRequested.Broadcast(
+		CombatManagerPrivate::MakeDamagePopupData(AttackerActor, DefenderActor, Result));
+}
+
+void UCombatManager::BroadcastDamagePopupBatch(TArray<FCombatDamagePopupData>& PopupBatch)
+{
+	if (PopupBatch.IsEmpty())
+	{
+		return;
+	}
+
+	const bool bBatchBound = OnDamagePopupBatchRequested.IsBound();
+	if (bBatchBound)
+	{
+		OnDamagePopupBatchRequested.Broadcast(PopupBatch);
+	}
 
-	OnDamagePopupRequested.Broadcast(PopupData);
+	if (OnDamagePopupRequested.IsBound())
+	{
+		for (FCombatDamagePopupData& PopupData : PopupBatch)
+		{
+			PopupData.bAlsoInBatch = bBatchBound;
+			OnDamagePopupRequested.Broadcast(PopupData);
+		}
+	}
 }
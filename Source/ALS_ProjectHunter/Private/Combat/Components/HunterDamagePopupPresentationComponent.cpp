@@ -3,6 +3,7 @@
 #include "Camera/PlayerCameraManager.h"
 #include "UI/HUD/HunterDamagePopupWidget.h"
 #include "Combat/Components/CombatManager.h"
+#include "Combat/Subsystems/HunterDamagePopupSubsystem.h"
 #include "Components/WidgetComponent.h"
 #include "Engine/World.h"
 #include "GameFramework/Pawn.h"
@@ -86,6 +87,9 @@ void UHunterDamagePopupPresentationComponent::BindToCombatManager()
 	BoundCombatManager->OnDamagePopupRequested.RemoveAll(this);
 	BoundCombatManager->OnDamagePopupRequested.AddDynamic(
 		this, &UHunterDamagePopupPresentationComponent::HandleDamagePopupRequested);
+	BoundCombatManager->OnDamagePopupBatchRequested.RemoveAll(this);
+	BoundCombatManager->OnDamagePopupBatchRequested.AddDynamic(
+		this, &UHunterDamagePopupPresentationComponent::HandleDamagePopupBatchRequested);
 }
 
 void UHunterDamagePopupPresentationComponent::UnbindFromCombatManager()
@@ -93,11 +97,23 @@ void UHunterDamagePopupPresentationComponent::UnbindFromCombatManager()
 	if (BoundCombatManager)
 	{
 		BoundCombatManager->OnDamagePopupRequested.RemoveAll(this);
+		BoundCombatManager->OnDamagePopupBatchRequested.RemoveAll(this);
 		BoundCombatManager = nullptr;
 	}
 }
 
 void UHunterDamagePopupPresentationComponent::HandleDamagePopupRequested(const FCombatDamagePopupData& PopupData)
+{
+	// Already presented through HandleDamagePopupBatchRequested.
+	if (PopupData.bAlsoInBatch)
+	{
+		return;
+	}
+
+	PresentDamagePopup(PopupData);
+}
+
+void UHunterDamagePopupPresentationComponent::PresentDamagePopup(const FCombatDamagePopupData& PopupData)
 {
 	if (bLogSpawnFailures)
 	{
@@ -108,6 +124,25 @@ void UHunterDamagePopupPresentationComponent::HandleDamagePopupRequested(const F
 			PopupData.TotalDamage);
 	}
 
+	if (bUsePopupPool)
+	{
+		UHunterDamagePopupSubsystem* PopupSubsystem = GetPopupSubsystem();
+		APlayerController* PlayerController = PopupSubsystem ? ResolvePlayerController() : nullptr;
+		if (PlayerController)
+		{
+			PopupSubsystem->RequestPopup(*this, PlayerController, PopupData);
+		}
+		else if (bLogSpawnFailures)
+		{
+			UE_LOG(LogDamagePopupPresentation, Warning,
+				TEXT("Pooled damage popup skipped on %s. Subsystem=%s PlayerController resolved=%s"),
+				*GetNameSafe(GetOwner()),
+				*GetNameSafe(PopupSubsystem),
+				PlayerController ? TEXT("true") : TEXT("false"));
+		}
+		return;
+	}
+
 	if (UHunterDamagePopupWidget* SpawnedWidget = SpawnDamagePopup(PopupData))
 	{
 		if (bLogSpawnFailures)
@@ -120,6 +155,15 @@ void UHunterDamagePopupPresentationComponent::HandleDamagePopupRequested(const F
 	}
 }
 
+void UHunterDamagePopupPresentationComponent::HandleDamagePopupBatchRequested(
+	const TArray<FCombatDamagePopupData>& PopupData)
+{
+	for (const FCombatDamagePopupData& Entry : PopupData)
+	{
+		PresentDamagePopup(Entry);
+	}
+}
+
 UHunterDamagePopupWidget* UHunterDamagePopupPresentationComponent::SpawnDamagePopup(
 	const FCombatDamagePopupData& PopupData)
 {
@@ -331,3 +375,9 @@ void UHunterDamagePopupPresentationComponent::UpdateActiveWorldWidgetFacing()
 		SetComponentTickEnabled(false);
 	}
 }
+
+UHunterDamagePopupSubsystem* UHunterDamagePopupPresentationComponent::GetPopupSubsystem() const
+{
+	UWorld* World = GetWorld();
+	return World ? World->GetSubsystem<UHunterDamagePopupSubsystem>() : nullptr;
+}
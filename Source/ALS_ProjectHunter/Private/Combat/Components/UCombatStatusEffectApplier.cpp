@@ -2,6 +2,7 @@
 #include "Core/Logging/ProjectHunterLogMacros.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemInterface.h"
+#include "Combat/Subsystems/CombatAilmentSubsystem.h"
 #include "GameplayEffect.h"
 
 DEFINE_LOG_CATEGORY(LogCombatStatusEffectApplier);
@@ -22,6 +23,13 @@ FCombatStatusApplyResult UCombatStatusEffectApplier::ApplyBleed(AActor* Target,
 		PH_LOG_WARNING(LogCombatStatusEffectApplier, "ApplyBleed failed: BleedEffectClass was not configured.");
 		return {};
 	}
+
+	FCombatStatusApplyResult SimulatedResult;
+	if (TrySimulateAilment(ECombatAilmentType::Bleed, BleedEffectClass, Target,
+		DamagePerTick, Duration, Instigator, SimulatedResult))
+	{
+		return SimulatedResult;
+	}
 	return ApplyDoTEffect(BleedEffectClass, Target,
 		DamagePerTick, CombatStatusSetByCallerTags::Bleed_DamagePerTick, Duration, Instigator);
 }
@@ -34,6 +42,13 @@ FCombatStatusApplyResult UCombatStatusEffectApplier::ApplyIgnite(AActor* Target,
 		PH_LOG_WARNING(LogCombatStatusEffectApplier, "ApplyIgnite failed: IgniteEffectClass was not configured.");
 		return {};
 	}
+
+	FCombatStatusApplyResult SimulatedResult;
+	if (TrySimulateAilment(ECombatAilmentType::Ignite, IgniteEffectClass, Target,
+		DamagePerTick, Duration, Instigator, SimulatedResult))
+	{
+		return SimulatedResult;
+	}
 	return ApplyDoTEffect(IgniteEffectClass, Target,
 		DamagePerTick, CombatStatusSetByCallerTags::Ignite_DamagePerTick, Duration, Instigator);
 }
@@ -46,6 +61,13 @@ FCombatStatusApplyResult UCombatStatusEffectApplier::ApplyPoison(AActor* Target,
 		PH_LOG_WARNING(LogCombatStatusEffectApplier, "ApplyPoison failed: PoisonEffectClass was not configured.");
 		return {};
 	}
+
+	FCombatStatusApplyResult SimulatedResult;
+	if (TrySimulateAilment(ECombatAilmentType::Poison, PoisonEffectClass, Target,
+		DamagePerTick, Duration, Instigator, SimulatedResult))
+	{
+		return SimulatedResult;
+	}
 	return ApplyDoTEffect(PoisonEffectClass, Target,
 		DamagePerTick, CombatStatusSetByCallerTags::Poison_DamagePerTick, Duration, Instigator);
 }
@@ -58,6 +80,13 @@ FCombatStatusApplyResult UCombatStatusEffectApplier::ApplyCorruption(AActor* Tar
 		PH_LOG_WARNING(LogCombatStatusEffectApplier, "ApplyCorruption failed: CorruptionEffectClass was not configured.");
 		return {};
 	}
+
+	FCombatStatusApplyResult SimulatedResult;
+	if (TrySimulateAilment(ECombatAilmentType::Corruption, CorruptionEffectClass, Target,
+		DamagePerTick, Duration, Instigator, SimulatedResult))
+	{
+		return SimulatedResult;
+	}
 	return ApplyDoTEffect(CorruptionEffectClass, Target,
 		DamagePerTick, CombatStatusSetByCallerTags::Corruption_DamagePerTick, Duration, Instigator);
 }
@@ -114,31 +143,43 @@ FCombatStatusApplyResult UCombatStatusEffectApplier::ApplyShock(AActor* Target,
 
 bool UCombatStatusEffectApplier::IsBleeding(AActor* Target) const
 {
-	return BleedEffectClass && HasActiveEffect(Target, BleedEffectClass);
+	return HasAilmentTag(Target, ECombatAilmentType::Bleed)
+		|| (BleedEffectClass && HasActiveEffect(Target, BleedEffectClass));
 }
 
 bool UCombatStatusEffectApplier::IsIgnited(AActor* Target) const
 {
-	return IgniteEffectClass && HasActiveEffect(Target, IgniteEffectClass);
+	return HasAilmentTag(Target, ECombatAilmentType::Ignite)
+		|| (IgniteEffectClass && HasActiveEffect(Target, IgniteEffectClass));
 }
 
 int32 UCombatStatusEffectApplier::GetPoisonStacks(AActor* Target) const
 {
-	if (!PoisonEffectClass)
-	{
-		return 0;
-	}
 	UAbilitySystemComponent* ASC = GetTargetASC(Target);
 	if (!ASC)
 	{
 		return 0;
 	}
-	return ASC->GetGameplayEffectCount(PoisonEffectClass, nullptr);
+
+	int32 Stacks = PoisonEffectClass ? ASC->GetGameplayEffectCount(PoisonEffectClass, nullptr) : 0;
+
+	const UWorld* World = Target->GetWorld();
+	const UCombatAilmentSubsystem* Ailments = World ? World->GetSubsystem<UCombatAilmentSubsystem>() : nullptr;
+	const int32 SimulatedStacks = Ailments ? Ailments->GetAilmentStacks(Target, ECombatAilmentType::Poison) : 0;
+	Stacks += SimulatedStacks;
+
+	// Clients only see the replicated tag, not the server's stack count.
+	if (SimulatedStacks == 0 && HasAilmentTag(Target, ECombatAilmentType::Poison))
+	{
+		Stacks = FMath::Max(Stacks, 1);
+	}
+	return Stacks;
 }
 
 bool UCombatStatusEffectApplier::IsCorrupted(AActor* Target) const
 {
-	return CorruptionEffectClass && HasActiveEffect(Target, CorruptionEffectClass);
+	return HasAilmentTag(Target, ECombatAilmentType::Corruption)
+		|| (CorruptionEffectClass && HasActiveEffect(Target, CorruptionEffectClass));
 }
 
 bool UCombatStatusEffectApplier::IsChilled(AActor* Target) const
@@ -163,6 +204,8 @@ bool UCombatStatusEffectApplier::IsShocked(AActor* Target) const
 
 void UCombatStatusEffectApplier::CureBleed(AActor* Target)
 {
+	RemoveSimulatedAilment(Target, ECombatAilmentType::Bleed);
+
 	if (BleedEffectClass)
 	{
 		RemoveEffectByClass(Target, BleedEffectClass);
@@ -171,6 +214,8 @@ void UCombatStatusEffectApplier::CureBleed(AActor* Target)
 
 void UCombatStatusEffectApplier::CureIgnite(AActor* Target)
 {
+	RemoveSimulatedAilment(Target, ECombatAilmentType::Ignite);
+
 	if (IgniteEffectClass)
 	{
 		RemoveEffectByClass(Target, IgniteEffectClass);
@@ -179,6 +224,8 @@ void UCombatStatusEffectApplier::CureIgnite(AActor* Target)
 
 void UCombatStatusEffectApplier::CurePoison(AActor* Target)
 {
+	RemoveSimulatedAilment(Target, ECombatAilmentType::Poison);
+
 	if (PoisonEffectClass)
 	{
 		RemoveEffectByClass(Target, PoisonEffectClass);
@@ -187,6 +234,8 @@ void UCombatStatusEffectApplier::CurePoison(AActor* Target)
 
 void UCombatStatusEffectApplier::CureCorruption(AActor* Target)
 {
+	RemoveSimulatedAilment(Target, ECombatAilmentType::Corruption);
+
 	if (CorruptionEffectClass)
 	{
 		RemoveEffectByClass(Target, CorruptionEffectClass);
@@ -358,3 +407,52 @@ UAbilitySystemComponent* UCombatStatusEffectApplier::GetTargetASC(AActor* Target
 	IAbilitySystemInterface* ASCInterface = Cast<IAbilitySystemInterface>(Target);
 	return ASCInterface ? ASCInterface->GetAbilitySystemComponent() : nullptr;
 }
+
+bool UCombatStatusEffectApplier::TrySimulateAilment(ECombatAilmentType Type, TSubclassOf<UGameplayEffect> EffectClass,
+	AActor* Target, float DamagePerTick, float Duration, AActor* Instigator, FCombatStatusApplyResult& OutResult) const
+{
+	if (!EffectClass || !UCombatAilmentSubsystem::IsSimulationEnabled() || !IsValid(Target) || !Target->HasAuthority())
+	{
+		return false;
+	}
+
+	UCombatAilmentSubsystem* Ailments = Target->GetWorld() ? Target->GetWorld()->GetSubsystem<UCombatAilmentSubsystem>() : nullptr;
+	if (!Ailments)
+	{
+		return false;
+	}
+
+	// The GE asset stays the design source for tick rate and default length.
+	const UGameplayEffect* EffectCDO = EffectClass->GetDefaultObject<UGameplayEffect>();
+	const float EffectPeriod = EffectCDO->Period.GetValueAtLevel(1.0f);
+	const float PeriodSeconds = EffectPeriod > 0.0f ? EffectPeriod : 1.0f;
+
+	// SetByCaller or attribute-based durations only resolve on a real spec; let the GE handle those.
+	if (Duration <= 0.0f
+		&& (!EffectCDO->DurationMagnitude.GetStaticMagnitudeIfPossible(1.0f, Duration) || Duration <= 0.0f))
+	{
+		return false;
+	}
+
+	OutResult.bApplied = Ailments->ApplyAilment(Type, Target, DamagePerTick / PeriodSeconds, Duration, Instigator);
+	return true;
+}
+
+bool UCombatStatusEffectApplier::HasAilmentTag(AActor* Target, ECombatAilmentType Type)
+{
+	const UAbilitySystemComponent* ASC = GetTargetASC(Target);
+	return ASC && ASC->HasMatchingGameplayTag(UCombatAilmentSubsystem::GetAilmentTag(Type));
+}
+
+void UCombatStatusEffectApplier::RemoveSimulatedAilment(AActor* Target, ECombatAilmentType Type)
+{
+	if (!IsValid(Target) || !Target->HasAuthority())
+	{
+		return;
+	}
+
+	if (UCombatAilmentSubsystem* Ailments = Target->GetWorld() ? Target->GetWorld()->GetSubsystem<UCombatAilmentSubsystem>() : nullptr)
+	{
+		Ailments->RemoveAilment(Target, Type);
+	}
+}
@@ -105,6 +105,19 @@ namespace CombatIncomingDamageResolverPrivate
 		}
 	}
 
+	float GetAnimationPierce(const FAnimationPiercingMulti& Piercing, const EHunterDamageType DamageType)
+	{
+		switch (DamageType)
+		{
+		case EHunterDamageType::Fire:       return Piercing.Fire;
+		case EHunterDamageType::Ice:        return Piercing.Ice;
+		case EHunterDamageType::Lightning:  return Piercing.Lightning;
+		case EHunterDamageType::Light:      return Piercing.Light;
+		case EHunterDamageType::Corruption: return Piercing.Corruption;
+		default:                            return 0.f;
+		}
+	}
+
 	void SetResultBlockedByType(FCombatResolveResult& Result, const EHunterDamageType DamageType, const float Value)
 	{
 		switch (DamageType)
@@ -152,14 +165,16 @@ FCombatResolveResult FCombatIncomingDamageResolver::MitigateDamagePacket(
 		return Result;
 	}
 
+	// OPT-COMBATSNAPSHOT: defender and attacker values come from the cached
+	// lanes on each attribute set instead of per-type getter switches.
+	const FCombatDefenseSnapshot& Defense = DefenderAttributes->GetCombatDefenseSnapshot();
+	const FCombatOffenseSnapshot* Offense = AttackerAttributes ? &AttackerAttributes->GetCombatOffenseSnapshot() : nullptr;
+
 	// Physical mitigates through armour, reduced by armour piercing.
-	const float EffectiveArmour = FMath::Max(
-		(DefenderAttributes->GetArmour() + DefenderAttributes->GetArmourFlatBonus()) *
-		(1.f + (DefenderAttributes->GetArmourPercentBonus() / 100.f)),
-		0.f);
+	const float EffectiveArmour = Defense.EffectiveArmour;
 	const float IncomingPhysical = FMath::Max(InPacket.Physical, 0.f);
 	const float ArmourPiercingPercent = FMath::Clamp(
-		(AttackerAttributes ? AttackerAttributes->GetArmourPiercing() : 0.f) +
+		(Offense ? Offense->ArmourPiercing : 0.f) +
 		DamageInfo.Piercing.ArmourPiercing,
 		0.f, 100.f);
 	const float ArmourAfterPierce = EffectiveArmour * (1.f - (ArmourPiercingPercent / 100.f));
@@ -196,12 +211,15 @@ FCombatResolveResult FCombatIncomingDamageResolver::MitigateDamagePacket(
 			return 0.f;
 		}
 
-		const float Resistance = GetResistanceValue(DamageType, DefenderAttributes)
-			- GetResistancePierceValue(DamageType, AttackerAttributes, DamageInfo);
+		const int32 Lane = GetDamageTypeLane(DamageType);
+		const float Pierce = FMath::Clamp(
+			(Offense ? Offense->ResistancePierce[Lane] : 0.f)
+			+ CombatIncomingDamageResolverPrivate::GetAnimationPierce(DamageInfo.Piercing, DamageType),
+			0.f, 100.f);
 		const float ClampedResistance = FMath::Clamp(
-			Resistance,
+			Defense.Resistance[Lane] - Pierce,
 			CombatIncomingDamageResolverPrivate::MinResistancePercent,
-			GetResistanceCap(DamageType, DefenderAttributes));
+			Defense.ResistanceCap[Lane]);
 		const float MitigatedDamage = FMath::Max(0.f, IncomingDamage * (1.f - (ClampedResistance / 100.f)));
 
 		if (bDebugLog)
@@ -232,7 +250,7 @@ FCombatResolveResult FCombatIncomingDamageResolver::MitigateDamagePacket(
 	for (const EHunterDamageType DamageType : CombatIncomingDamageResolverPrivate::AllDamageTypes)
 	{
 		const float DamageAfterBlock = CombatIncomingDamageResolverPrivate::GetResultTakenByType(Result, DamageType);
-		const float TakenMultiplier = GetDamageTakenMultiplier(DamageType, DefenderAttributes);
+		const float TakenMultiplier = Defense.DamageTakenMultiplier[GetDamageTypeLane(DamageType)];
 
 		if (bDebugLog && DamageAfterBlock > 0.f && !FMath::IsNearlyEqual(TakenMultiplier, 1.f))
 		{
@@ -272,60 +290,101 @@ FCombatResolveResult FCombatIncomingDamageResolver::MitigateDamagePacket(
 	return Result;
 }
 
-float FCombatIncomingDamageResolver::GetResistanceValue(
-	const EHunterDamageType DamageType,
-	const UHunterAttributeSet* DefenderAttributes)
+void FCombatIncomingDamageResolver::BuildDefenseSnapshot(
+	const UHunterAttributeSet* DefenderAttributes,
+	FCombatDefenseSnapshot& OutSnapshot)
 {
+	OutSnapshot = FCombatDefenseSnapshot();
 	if (!DefenderAttributes)
 	{
-		return 0.f;
+		return;
 	}
 
-	const float GlobalDefenses = DefenderAttributes->GetGlobalDefenses();
-
-	switch (DamageType)
-	{
-	case EHunterDamageType::Fire:
-		return GlobalDefenses + DefenderAttributes->GetFireResistanceFlatBonus()
-			+ DefenderAttributes->GetFireResistancePercentBonus();
-	case EHunterDamageType::Ice:
-		return GlobalDefenses + DefenderAttributes->GetIceResistanceFlatBonus()
-			+ DefenderAttributes->GetIceResistancePercentBonus();
-	case EHunterDamageType::Lightning:
-		return GlobalDefenses + DefenderAttributes->GetLightningResistanceFlatBonus()
-			+ DefenderAttributes->GetLightningResistancePercentBonus();
-	case EHunterDamageType::Light:
-		return GlobalDefenses + DefenderAttributes->GetLightResistanceFlatBonus()
-			+ DefenderAttributes->GetLightResistancePercentBonus();
-	case EHunterDamageType::Corruption:
-		return GlobalDefenses + DefenderAttributes->GetCorruptionResistanceFlatBonus()
-			+ DefenderAttributes->GetCorruptionResistancePercentBonus();
-	default:
-		return 0.f;
+	using namespace CombatIncomingDamageResolverPrivate;
+
+	const UHunterAttributeSet& D = *DefenderAttributes;
+
+	OutSnapshot.EffectiveArmour = FMath::Max(
+		(D.GetArmour() + D.GetArmourFlatBonus()) * (1.f + (D.GetArmourPercentBonus() / 100.f)),
+		0.f);
+
+	const float GlobalDefenses = D.GetGlobalDefenses();
+	const float GlobalTaken = GetNeutralMultiplier(D.GetGlobalDamageTakenMultiplier());
+	const float ElementalTaken = GetNeutralMultiplier(D.GetElementalDamageTakenMultiplier());
+
+	for (const EHunterDamageType DamageType : AllDamageTypes)
+	{
+		const int32 Lane = GetDamageTypeLane(DamageType);
+
+		float Resistance = 0.f;
+		float Cap = 0.f;
+		float TypeTaken = 0.f;
+		float BlockMultiplier = 0.f;
+
+		switch (DamageType)
+		{
+		case EHunterDamageType::Physical:
+			TypeTaken = D.GetPhysicalDamageTakenMultiplier();
+			BlockMultiplier = D.GetBlockPhysicalMultiplier();
+			break;
+		case EHunterDamageType::Fire:
+			Resistance = GlobalDefenses + D.GetFireResistanceFlatBonus() + D.GetFireResistancePercentBonus();
+			Cap = D.GetMaxFireResistance();
+			TypeTaken = D.GetFireDamageTakenMultiplier();
+			BlockMultiplier = D.GetBlockElementalMultiplier();
+			break;
+		case EHunterDamageType::Ice:
+			Resistance = GlobalDefenses + D.GetIceResistanceFlatBonus() + D.GetIceResistancePercentBonus();
+			Cap = D.GetMaxIceResistance();
+			TypeTaken = D.GetIceDamageTakenMultiplier();
+			BlockMultiplier = D.GetBlockElementalMultiplier();
+			break;
+		case EHunterDamageType::Lightning:
+			Resistance = GlobalDefenses + D.GetLightningResistanceFlatBonus() + D.GetLightningResistancePercentBonus();
+			Cap = D.GetMaxLightningResistance();
+			TypeTaken = D.GetLightningDamageTakenMultiplier();
+			BlockMultiplier = D.GetBlockElementalMultiplier();
+			break;
+		case EHunterDamageType::Light:
+			Resistance = GlobalDefenses + D.GetLightResistanceFlatBonus() + D.GetLightResistancePercentBonus();
+			Cap = D.GetMaxLightResistance();
+			TypeTaken = D.GetLightDamageTakenMultiplier();
+			BlockMultiplier = D.GetBlockElementalMultiplier();
+			break;
+		case EHunterDamageType::Corruption:
+			Resistance = GlobalDefenses + D.GetCorruptionResistanceFlatBonus() + D.GetCorruptionResistancePercentBonus();
+			Cap = D.GetMaxCorruptionResistance();
+			TypeTaken = D.GetCorruptionDamageTakenMultiplier();
+			BlockMultiplier = D.GetBlockCorruptionMultiplier();
+			break;
+		default:
+			break;
+		}
+
+		OutSnapshot.Resistance[Lane] = Resistance;
+		OutSnapshot.ResistanceCap[Lane] = Cap > 0.f ? Cap : DefaultMaxResistancePercent;
+		OutSnapshot.DamageTakenMultiplier[Lane] = FMath::Max(0.f,
+			GlobalTaken * (IsElementalDamageType(DamageType) ? ElementalTaken : 1.f) * GetNeutralMultiplier(TypeTaken));
+		OutSnapshot.BlockTypeMultiplier[Lane] = GetNeutralMultiplier(BlockMultiplier);
 	}
 }
 
-float FCombatIncomingDamageResolver::GetResistanceCap(
+float FCombatIncomingDamageResolver::GetResistanceValue(
 	const EHunterDamageType DamageType,
 	const UHunterAttributeSet* DefenderAttributes)
 {
-	if (!DefenderAttributes)
-	{
-		return CombatIncomingDamageResolverPrivate::DefaultMaxResistancePercent;
-	}
-
-	float Cap = 0.f;
-	switch (DamageType)
-	{
-	case EHunterDamageType::Fire:       Cap = DefenderAttributes->GetMaxFireResistance(); break;
-	case EHunterDamageType::Ice:        Cap = DefenderAttributes->GetMaxIceResistance(); break;
-	case EHunterDamageType::Lightning:  Cap = DefenderAttributes->GetMaxLightningResistance(); break;
-	case EHunterDamageType::Light:      Cap = DefenderAttributes->GetMaxLightResistance(); break;
-	case EHunterDamageType::Corruption: Cap = DefenderAttributes->GetMaxCorruptionResistance(); break;
-	default: break;
-	}
+	return DefenderAttributes
+		? DefenderAttributes->GetCombatDefenseSnapshot().Resistance[GetDamageTypeLane(DamageType)]
+		: 0.f;
+}
 
-	return Cap > 0.f ? Cap : CombatIncomingDamageResolverPrivate::DefaultMaxResistancePercent;
+float FCombatIncomingDamageResolver::GetResistanceCap(
+	const EHunterDamageType DamageType,
+	const UHunterAttributeSet* DefenderAttributes)
+{
+	return DefenderAttributes
+		? DefenderAttributes->GetCombatDefenseSnapshot().ResistanceCap[GetDamageTypeLane(DamageType)]
+		: CombatIncomingDamageResolverPrivate::DefaultMaxResistancePercent;
 }
 
 float FCombatIncomingDamageResolver::GetResistancePierceValue(
@@ -333,81 +392,26 @@ float FCombatIncomingDamageResolver::GetResistancePierceValue(
 	const UHunterAttributeSet* AttackerAttributes,
 	const FAnimationDamageInfo& DamageInfo)
 {
-	float AttributePierce = 0.f;
-	float AnimationPierce = 0.f;
-
-	switch (DamageType)
+	if (DamageType == EHunterDamageType::Physical)
 	{
-	case EHunterDamageType::Fire:
-		AttributePierce = AttackerAttributes ? AttackerAttributes->GetFirePiercing() : 0.f;
-		AnimationPierce = DamageInfo.Piercing.Fire;
-		break;
-	case EHunterDamageType::Ice:
-		AttributePierce = AttackerAttributes ? AttackerAttributes->GetIcePiercing() : 0.f;
-		AnimationPierce = DamageInfo.Piercing.Ice;
-		break;
-	case EHunterDamageType::Lightning:
-		AttributePierce = AttackerAttributes ? AttackerAttributes->GetLightningPiercing() : 0.f;
-		AnimationPierce = DamageInfo.Piercing.Lightning;
-		break;
-	case EHunterDamageType::Light:
-		AttributePierce = AttackerAttributes ? AttackerAttributes->GetLightPiercing() : 0.f;
-		AnimationPierce = DamageInfo.Piercing.Light;
-		break;
-	case EHunterDamageType::Corruption:
-		AttributePierce = AttackerAttributes ? AttackerAttributes->GetCorruptionPiercing() : 0.f;
-		AnimationPierce = DamageInfo.Piercing.Corruption;
-		break;
-	default:
 		return 0.f;
 	}
 
-	return FMath::Clamp(AttributePierce + AnimationPierce, 0.f, 100.f);
+	const float AttributePierce = AttackerAttributes
+		? AttackerAttributes->GetCombatOffenseSnapshot().ResistancePierce[GetDamageTypeLane(DamageType)]
+		: 0.f;
+	return FMath::Clamp(
+		AttributePierce + CombatIncomingDamageResolverPrivate::GetAnimationPierce(DamageInfo.Piercing, DamageType),
+		0.f, 100.f);
 }
 
 float FCombatIncomingDamageResolver::GetDamageTakenMultiplier(
 	const EHunterDamageType DamageType,
 	const UHunterAttributeSet* DefenderAttributes)
 {
-	if (!DefenderAttributes)
-	{
-		return 1.f;
-	}
-
-	float Multiplier = CombatIncomingDamageResolverPrivate::GetNeutralMultiplier(
-		DefenderAttributes->GetGlobalDamageTakenMultiplier());
-
-	if (CombatIncomingDamageResolverPrivate::IsElementalDamageType(DamageType))
-	{
-		Multiplier *= CombatIncomingDamageResolverPrivate::GetNeutralMultiplier(
-			DefenderAttributes->GetElementalDamageTakenMultiplier());
-	}
-
-	switch (DamageType)
-	{
-	case EHunterDamageType::Physical:
-		Multiplier *= CombatIncomingDamageResolverPrivate::GetNeutralMultiplier(DefenderAttributes->GetPhysicalDamageTakenMultiplier());
-		break;
-	case EHunterDamageType::Fire:
-		Multiplier *= CombatIncomingDamageResolverPrivate::GetNeutralMultiplier(DefenderAttributes->GetFireDamageTakenMultiplier());
-		break;
-	case EHunterDamageType::Ice:
-		Multiplier *= CombatIncomingDamageResolverPrivate::GetNeutralMultiplier(DefenderAttributes->GetIceDamageTakenMultiplier());
-		break;
-	case EHunterDamageType::Lightning:
-		Multiplier *= CombatIncomingDamageResolverPrivate::GetNeutralMultiplier(DefenderAttributes->GetLightningDamageTakenMultiplier());
-		break;
-	case EHunterDamageType::Light:
-		Multiplier *= CombatIncomingDamageResolverPrivate::GetNeutralMultiplier(DefenderAttributes->GetLightDamageTakenMultiplier());
-		break;
-	case EHunterDamageType::Corruption:
-		Multiplier *= CombatIncomingDamageResolverPrivate::GetNeutralMultiplier(DefenderAttributes->GetCorruptionDamageTakenMultiplier());
-		break;
-	default:
-		break;
-	}
-
-	return FMath::Max(0.f, Multiplier);
+	return DefenderAttributes
+		? DefenderAttributes->GetCombatDefenseSnapshot().DamageTakenMultiplier[GetDamageTypeLane(DamageType)]
+		: 1.f;
 }
 
 bool FCombatIncomingDamageResolver::IsActorBlocking(AActor* Actor)
@@ -460,25 +464,9 @@ float FCombatIncomingDamageResolver::GetBlockTypeMultiplier(
 	const EHunterDamageType DamageType,
 	const UHunterAttributeSet* DefenderAttributes)
 {
-	if (!DefenderAttributes)
-	{
-		return 1.f;
-	}
-
-	switch (DamageType)
-	{
-	case EHunterDamageType::Physical:
-		return CombatIncomingDamageResolverPrivate::GetNeutralMultiplier(DefenderAttributes->GetBlockPhysicalMultiplier());
-	case EHunterDamageType::Fire:
-	case EHunterDamageType::Ice:
-	case EHunterDamageType::Lightning:
-	case EHunterDamageType::Light:
-		return CombatIncomingDamageResolverPrivate::GetNeutralMultiplier(DefenderAttributes->GetBlockElementalMultiplier());
-	case EHunterDamageType::Corruption:
-		return CombatIncomingDamageResolverPrivate::GetNeutralMultiplier(DefenderAttributes->GetBlockCorruptionMultiplier());
-	default:
-		return 1.f;
-	}
+	return DefenderAttributes
+		? DefenderAttributes->GetCombatDefenseSnapshot().BlockTypeMultiplier[GetDamageTypeLane(DamageType)]
+		: 1.f;
 }
 
 void FCombatIncomingDamageResolver::ApplyBlockingToMitigatedResult(
@@ -0,0 +1,227 @@
+#include "Combat/Simulation/CombatSimulationHarness.h"
+
+#include "AbilitySystem/HunterAttributeSet.h"
+#include "AttributeSet.h"
+#include "Combat/Calculators/CombatOutgoingDamageCalculator.h"
+#include "Combat/Components/CombatManager.h"
+#include "Combat/Resolvers/CombatIncomingDamageResolver.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UnrealType.h"
+
+namespace CombatSimulationHarnessPrivate
+{
+	FGameplayAttributeData* GetAttributeData(FProperty* Property, UHunterAttributeSet* Attributes)
+	{
+		const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+		if (!StructProperty || !StructProperty->Struct->IsChildOf(FGameplayAttributeData::StaticStruct()))
+		{
+			return nullptr;
+		}
+
+		return StructProperty->ContainerPtrToValuePtr<FGameplayAttributeData>(Attributes);
+	}
+
+	void SetAttributeValue(FGameplayAttributeData& Data, const float Value)
+	{
+		Data.SetBaseValue(Value);
+		Data.SetCurrentValue(Value);
+	}
+
+	// Mirrors the ArcaneShield-before-Health routing MitigateDamagePacket already
+	// split, minus GAS clamping. Returns true when the hit killed the defender.
+	bool ApplyDamage(const FCombatResolveResult& Result, UHunterAttributeSet* Defender)
+	{
+		if (Result.HitResponse == EHitResponse::Invincible)
+		{
+			return false;
+		}
+
+		FGameplayAttributeData& Stamina = Defender->Stamina;
+		FGameplayAttributeData& ArcaneShield = Defender->ArcaneShield;
+		FGameplayAttributeData& Health = Defender->Health;
+
+		SetAttributeValue(Stamina, FMath::Max(0.f, Stamina.GetCurrentValue() - FMath::Max(Result.DamageToStamina, 0.f)));
+		SetAttributeValue(ArcaneShield, FMath::Max(0.f, ArcaneShield.GetCurrentValue() - FMath::Max(Result.DamageToArcaneShield, 0.f)));
+		SetAttributeValue(Health, FMath::Max(0.f, Health.GetCurrentValue() - FMath::Max(Result.DamageToHealth, 0.f)));
+
+		return Health.GetCurrentValue() <= 0.f;
+	}
+}
+
+FCombatAttributeProfile FCombatSimulationHarness::CaptureAttributeProfile(const UHunterAttributeSet* Attributes)
+{
+	FCombatAttributeProfile Profile;
+	if (!Attributes)
+	{
+		return Profile;
+	}
+
+	UHunterAttributeSet* MutableAttributes = const_cast<UHunterAttributeSet*>(Attributes);
+	for (TFieldIterator<FProperty> It(UHunterAttributeSet::StaticClass()); It; ++It)
+	{
+		const FGameplayAttributeData* Data = CombatSimulationHarnessPrivate::GetAttributeData(*It, MutableAttributes);
+		if (Data && !FMath::IsNearlyZero(Data->GetCurrentValue()))
+		{
+			Profile.Values.Add(It->GetFName(), Data->GetCurrentValue());
+		}
+	}
+
+	return Profile;
+}
+
+void FCombatSimulationHarness::ApplyAttributeProfile(const FCombatAttributeProfile& Profile, UHunterAttributeSet* Attributes)
+{
+	if (!Attributes)
+	{
+		return;
+	}
+
+	for (TFieldIterator<FProperty> It(UHunterAttributeSet::StaticClass()); It; ++It)
+	{
+		if (FGameplayAttributeData* Data = CombatSimulationHarnessPrivate::GetAttributeData(*It, Attributes))
+		{
+			const float* Value = Profile.Values.Find(It->GetFName());
+			CombatSimulationHarnessPrivate::SetAttributeValue(*Data, Value ? *Value : 0.f);
+		}
+	}
+
+	Attributes->InvalidateCombatSnapshots();
+}
+
+FCombatSimulationReport FCombatSimulationHarness::ReplayHitLog(const FCombatHitLog& HitLog, const int32 Repetitions)
+{
+	FCombatSimulationReport Report;
+	Report.Repetitions = FMath::Max(1, Repetitions);
+
+	if (HitLog.Hits.IsEmpty())
+	{
+		UE_LOG(LogCombatManager, Warning, TEXT("ReplayHitLog: log has no hits."));
+		return Report;
+	}
+
+	const int32 CombatantCount = HitLog.Combatants.Num();
+	for (const FCombatHitLogEntry& Hit : HitLog.Hits)
+	{
+		if (!HitLog.Combatants.IsValidIndex(Hit.AttackerIndex) || !HitLog.Combatants.IsValidIndex(Hit.DefenderIndex))
+		{
+			UE_LOG(LogCombatManager, Warning,
+				TEXT("ReplayHitLog: hit references combatant %d/%d but the log has %d."),
+				Hit.AttackerIndex, Hit.DefenderIndex, CombatantCount);
+			return Report;
+		}
+
+		if (Hit.bUsesBatchPacket && !HitLog.Batches.IsValidIndex(Hit.BatchIndex))
+		{
+			UE_LOG(LogCombatManager, Warning,
+				TEXT("ReplayHitLog: hit references batch %d but the log has %d."),
+				Hit.BatchIndex, HitLog.Batches.Num());
+			return Report;
+		}
+	}
+
+	for (const FCombatHitLogBatch& Batch : HitLog.Batches)
+	{
+		if (!HitLog.Combatants.IsValidIndex(Batch.AttackerIndex))
+		{
+			UE_LOG(LogCombatManager, Warning,
+				TEXT("ReplayHitLog: batch references combatant %d but the log has %d."),
+				Batch.AttackerIndex, CombatantCount);
+			return Report;
+		}
+	}
+
+	// Standalone sets with no ASC: snapshots are invalidated by hand after each profile write.
+	TArray<TStrongObjectPtr<UHunterAttributeSet>> Attributes;
+	Attributes.Reserve(CombatantCount);
+	for (int32 Index = 0; Index < CombatantCount; ++Index)
+	{
+		UHunterAttributeSet* Set = NewObject<UHunterAttributeSet>(GetTransientPackage());
+		Set->TrackCombatSnapshotsManually();
+		Attributes.Emplace(Set);
+	}
+
+	TArray<FRandomStream> Streams;
+	Streams.SetNum(CombatantCount);
+	TArray<FCombatDamagePacket> BatchPackets;
+	BatchPackets.SetNum(HitLog.Batches.Num());
+	double TotalDamage = 0.0;
+	uint32 Checksum = 0;
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	for (int32 Repetition = 0; Repetition < Report.Repetitions; ++Repetition)
+	{
+		for (int32 Index = 0; Index < CombatantCount; ++Index)
+		{
+			ApplyAttributeProfile(HitLog.Combatants[Index].Profile, Attributes[Index].Get());
+			Streams[Index].Initialize(HitLog.Combatants[Index].Seed);
+		}
+
+		int32 NextBatch = 0;
+		for (int32 HitIndex = 0; HitIndex < HitLog.Hits.Num(); ++HitIndex)
+		{
+			// Shared batch packets roll where ApplyHitBatch rolled them, ahead of the batch's hits.
+			for (; NextBatch < HitLog.Batches.Num() && HitLog.Batches[NextBatch].FirstHitIndex <= HitIndex; ++NextBatch)
+			{
+				const FCombatHitLogBatch& Batch = HitLog.Batches[NextBatch];
+				BatchPackets[NextBatch] = FCombatOutgoingDamageCalculator::BuildOutgoingDamagePacket(
+					Attributes[Batch.AttackerIndex].Get(), Batch.DamageInfo, Streams[Batch.AttackerIndex]);
+			}
+
+			const FCombatHitLogEntry& Hit = HitLog.Hits[HitIndex];
+			UHunterAttributeSet* Attacker = Attributes[Hit.AttackerIndex].Get();
+			UHunterAttributeSet* Defender = Attributes[Hit.DefenderIndex].Get();
+			FRandomStream& AttackerStream = Streams[Hit.AttackerIndex];
+			FRandomStream& DefenderStream = Streams[Hit.DefenderIndex];
+
+			const FCombatDamagePacket Packet = Hit.bUsesBatchPacket
+				? BatchPackets[Hit.BatchIndex]
+				: FCombatOutgoingDamageCalculator::BuildOutgoingDamagePacket(Attacker, Hit.DamageInfo, AttackerStream);
+			FCombatResolveResult Result = FCombatIncomingDamageResolver::MitigateDamagePacket(
+				Packet, nullptr, nullptr, Attacker, Defender, Hit.DamageInfo);
+			FCombatIncomingDamageResolver::EvaluateStagger(nullptr, Defender, Result);
+			FCombatIncomingDamageResolver::ApplyHitResponse(Hit.HitResponse, Hit.bCanApplyAilments, Result);
+
+			// Same draw order as UCombatManager::ApplyHit, ailments before reflect.
+			const FCombatAilmentRolls Rolls = UCombatManager::RollAilments(Result, Attacker, AttackerStream);
+			const float ReflectedDamage = UCombatManager::RollReflectDamage(Result, Defender, DefenderStream);
+
+			TotalDamage += Result.TotalDamageTaken;
+			Report.CritCount += Result.bWasCrit ? 1 : 0;
+			Report.AilmentCount += Rolls.Num();
+
+			if (CombatSimulationHarnessPrivate::ApplyDamage(Result, Defender))
+			{
+				++Report.KillCount;
+				ApplyAttributeProfile(HitLog.Combatants[Hit.DefenderIndex].Profile, Defender);
+			}
+
+			if (Repetition == 0)
+			{
+				Checksum = HashCombineFast(Checksum, GetTypeHash(Result.TotalDamageTaken));
+				Checksum = HashCombineFast(Checksum, GetTypeHash(ReflectedDamage));
+				Checksum = HashCombineFast(Checksum, GetTypeHash(Rolls.Num() * 2 + (Result.bWasCrit ? 1 : 0)));
+			}
+		}
+	}
+	const double WallSeconds = FPlatformTime::Seconds() - StartSeconds;
+
+	Report.HitsReplayed = HitLog.Hits.Num() * Report.Repetitions;
+	Report.DamagePerRepetition = TotalDamage / Report.Repetitions;
+	Report.FightSeconds = HitLog.Hits.Last().TimeSeconds - HitLog.Hits[0].TimeSeconds;
+	Report.DamagePerSecond = Report.FightSeconds > 0.0 ? Report.DamagePerRepetition / Report.FightSeconds : 0.0;
+	Report.WallMs = WallSeconds * 1000.0;
+	Report.HitsPerMs = Report.WallMs > 0.0 ? Report.HitsReplayed / Report.WallMs : 0.0;
+	Report.ResultChecksum = static_cast<int32>(Checksum);
+
+	UE_LOG(LogCombatManager, Log,
+		TEXT("ReplayHitLog: %d hits x %d reps | %.1f dmg/rep over %.2fs = %.1f DPS | crits=%d ailments=%d kills=%d | "
+		     "%.3fms (%.1f hits/ms) | checksum=%08x"),
+		HitLog.Hits.Num(), Report.Repetitions,
+		Report.DamagePerRepetition, Report.FightSeconds, Report.DamagePerSecond,
+		Report.CritCount, Report.AilmentCount, Report.KillCount,
+		Report.WallMs, Report.HitsPerMs, Checksum);
+
+	return Report;
+}
@@ -0,0 +1,633 @@
+#include "Combat/Subsystems/CombatAilmentSubsystem.h"
+
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemInterface.h"
+#include "AbilitySystem/HunterAttributeSet.h"
+#include "Combat/Components/CombatManager.h"
+#include "Combat/Library/FunctionLibraries/CombatFunctionLibrary.h"
+#include "GameplayEffect.h"
+#include "HAL/PlatformTime.h"
+#include "Tags/PHGameplayTags.h"
+#include "UObject/Package.h"
+
+DEFINE_LOG_CATEGORY(LogCombatAilments);
+
+DECLARE_STATS_GROUP(TEXT("CombatAilments"), STATGROUP_CombatAilments, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Step"), STAT_CombatAilments_Step, STATGROUP_CombatAilments);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Targets"), STAT_CombatAilments_Targets, STATGROUP_CombatAilments);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Instances"), STAT_CombatAilments_Instances, STATGROUP_CombatAilments);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Health Writes"), STAT_CombatAilments_HealthWrites, STATGROUP_CombatAilments);
+
+#if !UE_BUILD_SHIPPING
+static TAutoConsoleVariable<int32> CVarAilmentSimulation(
+	TEXT("Hunter.Debug.AilmentSimulation"),
+	1,
+	TEXT("Simulate bleed, ignite, poison and corruption in UCombatAilmentSubsystem, for A/B with `stat CombatAilments` and `stat Game`\n")
+	TEXT("0: One periodic GameplayEffect per applied instance\n")
+	TEXT("1: Summed per-target damage on a fixed step (default)"),
+	ECVF_Cheat
+);
+#endif
+
+namespace CombatAilmentSubsystemPrivate
+{
+	constexpr int32 NumAilmentTypes = static_cast<int32>(ECombatAilmentType::MAX);
+
+	// Damage per stack per tick in the benchmark: enough to run the full write, too little to kill.
+	constexpr float BenchmarkDamagePerTick = 0.01f;
+
+	uint8 GetTypeBit(ECombatAilmentType Type)
+	{
+		return static_cast<uint8>(1u << static_cast<uint8>(Type));
+	}
+
+	EHunterDamageType GetDamageType(ECombatAilmentType Type)
+	{
+		switch (Type)
+		{
+		case ECombatAilmentType::Ignite:
+			return EHunterDamageType::Fire;
+		case ECombatAilmentType::Poison:
+		case ECombatAilmentType::Corruption:
+			return EHunterDamageType::Corruption;
+		default:
+			return EHunterDamageType::Physical;
+		}
+	}
+
+	UAbilitySystemComponent* GetAbilitySystemComponent(AActor* Actor)
+	{
+		const IAbilitySystemInterface* ASI = Cast<IAbilitySystemInterface>(Actor);
+		return ASI ? ASI->GetAbilitySystemComponent() : nullptr;
+	}
+
+	void SetTagRaised(UAbilitySystemComponent& ASC, ECombatAilmentType Type, bool bRaised)
+	{
+		const FGameplayTag Tag = UCombatAilmentSubsystem::GetAilmentTag(Type);
+		if (bRaised)
+		{
+			ASC.AddLooseGameplayTag(Tag, 1, EGameplayTagReplicationState::TagOnly);
+		}
+		else
+		{
+			ASC.RemoveLooseGameplayTag(Tag, 1, EGameplayTagReplicationState::TagOnly);
+		}
+	}
+
+	FCombatDamagePopupData MakeTickPopup(AActor* SourceActor, AActor* TargetActor, float Damage,
+		ECombatAilmentType DominantType, bool bKilledTarget)
+	{
+		FCombatDamagePopupData PopupData;
+		PopupData.SourceActor = SourceActor;
+		PopupData.TargetActor = TargetActor;
+		PopupData.ResolveResult.TotalDamageTaken = Damage;
+		PopupData.ResolveResult.DamageToHealth = Damage;
+		PopupData.ResolveResult.bKilledTarget = bKilledTarget;
+		PopupData.TotalDamage = Damage;
+		PopupData.DominantDamageType = GetDamageType(DominantType);
+		PopupData.DisplayColor = UCombatFunctionLibrary::GetDefaultDamageTypeColor(PopupData.DominantDamageType);
+		PopupData.WorldLocation = TargetActor->GetActorLocation() +
+			FVector(0.f, 0.f, TargetActor->GetSimpleCollisionHalfHeight());
+		PopupData.bKilledTarget = bKilledTarget;
+		PopupData.bFromAilment = true;
+		return PopupData;
+	}
+}
+
+void UCombatAilmentSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Targets.Reset();
+	TargetIndices.Reset();
+	StepAccumulator = 0.0f;
+}
+
+void UCombatAilmentSubsystem::Deinitialize()
+{
+	for (int32 Index = Targets.Num() - 1; Index >= 0; --Index)
+	{
+		RemoveTargetAt(Index);
+	}
+
+	Super::Deinitialize();
+}
+
+TStatId UCombatAilmentSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCombatAilmentSubsystem, STATGROUP_Tickables);
+}
+
+bool UCombatAilmentSubsystem::IsSimulationEnabled()
+{
+#if !UE_BUILD_SHIPPING
+	return CVarAilmentSimulation.GetValueOnGameThread() != 0;
+#else
+	return true;
+#endif
+}
+
+FGameplayTag UCombatAilmentSubsystem::GetAilmentTag(ECombatAilmentType Type)
+{
+	switch (Type)
+	{
+	case ECombatAilmentType::Bleed:
+		return FPHGameplayTags::Condition_Self_Bleeding;
+	case ECombatAilmentType::Ignite:
+		return FPHGameplayTags::Condition_Self_Burned;
+	case ECombatAilmentType::Poison:
+		return FPHGameplayTags::Condition_Self_Poisoned;
+	case ECombatAilmentType::Corruption:
+		return FPHGameplayTags::Condition_Self_Corrupted;
+	default:
+		return FGameplayTag();
+	}
+}
+
+void UCombatAilmentSubsystem::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (Targets.IsEmpty())
+	{
+		StepAccumulator = 0.0f;
+		return;
+	}
+
+	StepAccumulator += DeltaSeconds;
+
+	int32 Steps = 0;
+	while (StepAccumulator >= StepIntervalSeconds && Steps < MaxStepsPerFrame)
+	{
+		StepAccumulator -= StepIntervalSeconds;
+		Step(StepIntervalSeconds);
+		++Steps;
+	}
+
+	if (Steps == MaxStepsPerFrame)
+	{
+		StepAccumulator = FMath::Min(StepAccumulator, StepIntervalSeconds);
+	}
+
+	SET_DWORD_STAT(STAT_CombatAilments_Targets, Targets.Num());
+	SET_DWORD_STAT(STAT_CombatAilments_Instances, GetActiveInstanceCount());
+}
+
+bool UCombatAilmentSubsystem::ApplyAilment(ECombatAilmentType Type, AActor* Target, float DamagePerSecond,
+	float Duration, AActor* Source)
+{
+	if (!IsValid(Target) || !Target->HasAuthority() || Type == ECombatAilmentType::MAX
+		|| DamagePerSecond <= 0.0f || Duration <= 0.0f)
+	{
+		return false;
+	}
+
+	UAbilitySystemComponent* ASC = CombatAilmentSubsystemPrivate::GetAbilitySystemComponent(Target);
+	if (!ASC)
+	{
+		UE_LOG(LogCombatAilments, Warning, TEXT("ApplyAilment: Target '%s' has no ASC"), *Target->GetName());
+		return false;
+	}
+
+	FAilmentInstance Instance;
+	Instance.Source = Source;
+	Instance.SourceCombat = IsValid(Source) ? Source->FindComponentByClass<UCombatManager>() : nullptr;
+	Instance.DamagePerSecond = DamagePerSecond;
+	Instance.RemainingSeconds = Duration;
+	Instance.Type = Type;
+
+	FAilmentTarget* Existing = FindTarget(Target);
+	if (!Existing)
+	{
+		const int32 NewIndex = Targets.AddDefaulted();
+		Existing = &Targets[NewIndex];
+		Existing->Key = Target;
+		Existing->Actor = Target;
+		Existing->ASC = ASC;
+		TargetIndices.Add(Target, NewIndex);
+	}
+
+	bool bApplied = false;
+	AddInstance(*Existing, MoveTemp(Instance), bApplied);
+	RefreshTags(*Existing);
+
+	UE_LOG(LogCombatAilments, Verbose, TEXT("ApplyAilment: %s on '%s' from '%s' (%.2f/s, %.1fs) Applied=%d"),
+		*UEnum::GetValueAsString(Type), *Target->GetName(), *GetNameSafe(Source),
+		DamagePerSecond, Duration, bApplied ? 1 : 0);
+
+	return bApplied;
+}
+
+void UCombatAilmentSubsystem::AddInstance(FAilmentTarget& Target, FAilmentInstance&& Instance, bool& bOutApplied) const
+{
+	bOutApplied = false;
+
+	if (Instance.Type == ECombatAilmentType::Poison)
+	{
+		int32 PoisonCount = 0;
+		int32 WeakestIndex = INDEX_NONE;
+		float WeakestDamage = TNumericLimits<float>::Max();
+		for (int32 Index = 0; Index < Target.Instances.Num(); ++Index)
+		{
+			const FAilmentInstance& Existing = Target.Instances[Index];
+			if (Existing.Type != ECombatAilmentType::Poison)
+			{
+				continue;
+			}
+
+			++PoisonCount;
+			const float RemainingDamage = Existing.DamagePerSecond * Existing.RemainingSeconds;
+			if (RemainingDamage < WeakestDamage)
+			{
+				WeakestDamage = RemainingDamage;
+				WeakestIndex = Index;
+			}
+		}
+
+		if (PoisonCount < MaxPoisonStacks)
+		{
+			Target.Instances.Add(MoveTemp(Instance));
+			bOutApplied = true;
+		}
+		else if (WeakestIndex != INDEX_NONE && Instance.DamagePerSecond * Instance.RemainingSeconds > WeakestDamage)
+		{
+			Target.Instances[WeakestIndex] = MoveTemp(Instance);
+			bOutApplied = true;
+		}
+		return;
+	}
+
+	for (FAilmentInstance& Existing : Target.Instances)
+	{
+		if (Existing.Type == Instance.Type)
+		{
+			if (Instance.DamagePerSecond >= Existing.DamagePerSecond)
+			{
+				Existing = MoveTemp(Instance);
+				bOutApplied = true;
+			}
+			return;
+		}
+	}
+
+	Target.Instances.Add(MoveTemp(Instance));
+	bOutApplied = true;
+}
+
+void UCombatAilmentSubsystem::RemoveAilment(AActor* Target, ECombatAilmentType Type)
+{
+	FAilmentTarget* Existing = FindTarget(Target);
+	if (!Existing)
+	{
+		return;
+	}
+
+	Existing->Instances.RemoveAllSwap([Type](const FAilmentInstance& Instance)
+	{
+		return Instance.Type == Type;
+	});
+	RefreshTags(*Existing);
+
+	if (Existing->Instances.IsEmpty() && !bIsStepping)
+	{
+		RemoveTargetAt(TargetIndices.FindChecked(Target));
+	}
+}
+
+void UCombatAilmentSubsystem::ClearAilments(AActor* Target)
+{
+	FAilmentTarget* Existing = FindTarget(Target);
+	if (!Existing)
+	{
+		return;
+	}
+
+	if (bIsStepping)
+	{
+		// Step removes emptied targets itself once the write returns.
+		Existing->Instances.Reset();
+		RefreshTags(*Existing);
+		return;
+	}
+
+	RemoveTargetAt(TargetIndices.FindChecked(Target));
+}
+
+int32 UCombatAilmentSubsystem::GetAilmentStacks(const AActor* Target, ECombatAilmentType Type) const
+{
+	const FAilmentTarget* Existing = FindTarget(Target);
+	if (!Existing)
+	{
+		return 0;
+	}
+
+	int32 Stacks = 0;
+	for (const FAilmentInstance& Instance : Existing->Instances)
+	{
+		Stacks += Instance.Type == Type ? 1 : 0;
+	}
+	return Stacks;
+}
+
+int32 UCombatAilmentSubsystem::GetActiveInstanceCount() const
+{
+	int32 Count = 0;
+	for (const FAilmentTarget& Target : Targets)
+	{
+		Count += Target.Instances.Num();
+	}
+	return Count;
+}
+
+void UCombatAilmentSubsystem::Step(float StepSeconds)
+{
+	SCOPE_CYCLE_COUNTER(STAT_CombatAilments_Step);
+	using namespace CombatAilmentSubsystemPrivate;
+
+	const FGameplayAttribute HealthAttribute = UHunterAttributeSet::GetHealthAttribute();
+
+	TMap<UCombatManager*, TArray<FCombatDamagePopupData>> PopupBatches;
+	FSourceDamageArray SourceDamage;
+	TArray<int32, TInlineAllocator<16>> FinishedTargets;
+	int32 HealthWrites = 0;
+
+	bIsStepping = true;
+	for (int32 Index = 0; Index < Targets.Num(); ++Index)
+	{
+		UAbilitySystemComponent* ASC = Targets[Index].ASC.Get();
+		AActor* TargetActor = Targets[Index].Actor.Get();
+		if (!ASC || !IsValid(TargetActor))
+		{
+			FinishedTargets.Add(Index);
+			continue;
+		}
+
+		SourceDamage.Reset();
+		const float Damage = AdvanceTarget(Targets[Index], StepSeconds, &SourceDamage);
+
+		bool bKilledTarget = false;
+		if (Damage > 0.0f)
+		{
+			// The write can run death handling, which may clear this target or
+			// start ailments elsewhere; re-read Targets[Index] after it.
+			const float HealthBefore = ASC->GetNumericAttribute(HealthAttribute);
+			ASC->ApplyModToAttribute(HealthAttribute, EGameplayModOp::Additive, -Damage);
+			++HealthWrites;
+			bKilledTarget = HealthBefore > 0.0f && ASC->GetNumericAttribute(HealthAttribute) <= 0.0f;
+		}
+
+		for (const FSourceDamage& Share : SourceDamage)
+		{
+			PopupBatches.FindOrAdd(Share.SourceCombat).Add(
+				MakeTickPopup(Share.SourceCombat->GetOwner(), TargetActor, Share.Damage, Share.DominantType, bKilledTarget));
+		}
+
+		FAilmentTarget& Target = Targets[Index];
+		if (bKilledTarget || ASC->GetNumericAttribute(HealthAttribute) <= 0.0f)
+		{
+			Target.Instances.Reset();
+		}
+
+		RefreshTags(Target);
+		if (Target.Instances.IsEmpty())
+		{
+			FinishedTargets.Add(Index);
+		}
+	}
+
+	bIsStepping = false;
+
+	// Highest index first so each swap only moves a target that is staying.
+	for (int32 FinishedIt = FinishedTargets.Num() - 1; FinishedIt >= 0; --FinishedIt)
+	{
+		const int32 Index = FinishedTargets[FinishedIt];
+		const FAilmentTarget& Target = Targets[Index];
+		if (Target.Instances.IsEmpty() || !Target.ASC.IsValid() || !Target.Actor.IsValid())
+		{
+			RemoveTargetAt(Index);
+		}
+	}
+
+	for (TPair<UCombatManager*, TArray<FCombatDamagePopupData>>& Batch : PopupBatches)
+	{
+		if (IsValid(Batch.Key))
+		{
+			Batch.Key->BroadcastDamagePopupBatch(Batch.Value);
+		}
+	}
+
+	SET_DWORD_STAT(STAT_CombatAilments_HealthWrites, HealthWrites);
+}
+
+float UCombatAilmentSubsystem::AdvanceTarget(FAilmentTarget& Target, float StepSeconds, FSourceDamageArray* OutSourceDamage)
+{
+	float TotalDamage = 0.0f;
+
+	for (int32 Index = Target.Instances.Num() - 1; Index >= 0; --Index)
+	{
+		FAilmentInstance& Instance = Target.Instances[Index];
+		const float Damage = Instance.DamagePerSecond * FMath::Min(StepSeconds, Instance.RemainingSeconds);
+		TotalDamage += Damage;
+
+		UCombatManager* SourceCombat = OutSourceDamage ? Instance.SourceCombat.Get() : nullptr;
+		if (SourceCombat && (SourceCombat->OnDamagePopupBatchRequested.IsBound() || SourceCombat->OnDamagePopupRequested.IsBound()))
+		{
+			FSourceDamage* Share = OutSourceDamage->FindByPredicate([SourceCombat](const FSourceDamage& Existing)
+			{
+				return Existing.SourceCombat == SourceCombat;
+			});
+			if (!Share)
+			{
+				Share = &OutSourceDamage->AddDefaulted_GetRef();
+				Share->SourceCombat = SourceCombat;
+			}
+
+			Share->Damage += Damage;
+			if (Damage > Share->DominantDamage)
+			{
+				Share->DominantDamage = Damage;
+				Share->DominantType = Instance.Type;
+			}
+		}
+
+		Instance.RemainingSeconds -= StepSeconds;
+		if (Instance.RemainingSeconds <= 0.0f)
+		{
+			Target.Instances.RemoveAtSwap(Index, EAllowShrinking::No);
+		}
+	}
+
+	return TotalDamage;
+}
+
+void UCombatAilmentSubsystem::RefreshTags(FAilmentTarget& Target)
+{
+	using namespace CombatAilmentSubsystemPrivate;
+
+	uint8 ActiveTypes = 0;
+	for (const FAilmentInstance& Instance : Target.Instances)
+	{
+		ActiveTypes |= GetTypeBit(Instance.Type);
+	}
+
+	const uint8 ChangedTypes = ActiveTypes ^ Target.TaggedTypes;
+	UAbilitySystemComponent* ASC = Target.ASC.Get();
+	if (ChangedTypes == 0 || !ASC)
+	{
+		Target.TaggedTypes = ActiveTypes;
+		return;
+	}
+
+	for (int32 TypeIndex = 0; TypeIndex < NumAilmentTypes; ++TypeIndex)
+	{
+		const ECombatAilmentType Type = static_cast<ECombatAilmentType>(TypeIndex);
+		if (ChangedTypes & GetTypeBit(Type))
+		{
+			SetTagRaised(*ASC, Type, (ActiveTypes & GetTypeBit(Type)) != 0);
+		}
+	}
+
+	Target.TaggedTypes = ActiveTypes;
+}
+
+void UCombatAilmentSubsystem::RemoveTargetAt(int32 Index)
+{
+	check(!bIsStepping);
+
+	FAilmentTarget& Target = Targets[Index];
+	Target.Instances.Reset();
+	RefreshTags(Target);
+
+	TargetIndices.Remove(Target.Key);
+	Targets.RemoveAtSwap(Index, EAllowShrinking::No);
+
+	if (Targets.IsValidIndex(Index))
+	{
+		TargetIndices.FindChecked(Targets[Index].Key) = Index;
+	}
+}
+
+const UCombatAilmentSubsystem::FAilmentTarget* UCombatAilmentSubsystem::FindTarget(const AActor* Actor) const
+{
+	const int32* Index = Actor ? TargetIndices.Find(Actor) : nullptr;
+	return Index ? &Targets[*Index] : nullptr;
+}
+
+UCombatAilmentSubsystem::FAilmentTarget* UCombatAilmentSubsystem::FindTarget(const AActor* Actor)
+{
+	const int32* Index = Actor ? TargetIndices.Find(Actor) : nullptr;
+	return Index ? &Targets[*Index] : nullptr;
+}
+
+FCombatAilmentBenchmarkResult UCombatAilmentSubsystem::BenchmarkDamageOverTime(const TArray<AActor*>& InTargets, int32 Stacks, int32 Ticks)
+{
+	using namespace CombatAilmentSubsystemPrivate;
+
+	FCombatAilmentBenchmarkResult Result;
+	Result.Stacks = FMath::Max(1, Stacks);
+	Result.Ticks = FMath::Max(1, Ticks);
+
+	const FGameplayAttribute HealthAttribute = UHunterAttributeSet::GetHealthAttribute();
+
+	TArray<FAilmentTarget> BenchTargets;
+	TArray<float> SavedHealth;
+	for (AActor* Actor : InTargets)
+	{
+		UAbilitySystemComponent* ASC = GetAbilitySystemComponent(Actor);
+		if (ASC && ASC->IsOwnerActorAuthoritative() && ASC->GetSet<UHunterAttributeSet>())
+		{
+			FAilmentTarget& BenchTarget = BenchTargets.AddDefaulted_GetRef();
+			BenchTarget.Actor = Actor;
+			BenchTarget.ASC = ASC;
+			SavedHealth.Add(ASC->GetNumericAttributeBase(HealthAttribute));
+		}
+	}
+
+	Result.TargetCount = BenchTargets.Num();
+	if (BenchTargets.IsEmpty())
+	{
+		UE_LOG(LogCombatAilments, Warning,
+			TEXT("BenchmarkDamageOverTime needs at least one authoritative target with a UHunterAttributeSet."));
+		return Result;
+	}
+
+	const auto RestoreHealth = [&BenchTargets, &SavedHealth, &HealthAttribute]()
+	{
+		for (int32 Index = 0; Index < BenchTargets.Num(); ++Index)
+		{
+			BenchTargets[Index].ASC->SetNumericAttributeBase(HealthAttribute, SavedHealth[Index]);
+		}
+	};
+
+	// One instant Health execution per stack is what a periodic DoT effect costs each time it fires.
+	UGameplayEffect* TickEffect = NewObject<UGameplayEffect>(GetTransientPackage(), NAME_None, RF_Transient);
+	TickEffect->DurationPolicy = EGameplayEffectDurationType::Instant;
+
+	FSetByCallerFloat SetByCaller;
+	SetByCaller.DataTag = FPHGameplayTags::Data_Damage_Health;
+
+	FGameplayModifierInfo Modifier;
+	Modifier.Attribute = HealthAttribute;
+	Modifier.ModifierOp = EGameplayModOp::Additive;
+	Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(SetByCaller);
+	TickEffect->Modifiers.Add(Modifier);
+
+	TArray<FGameplayEffectSpec> TickSpecs;
+	TArray<UAbilitySystemComponent*> TickSpecTargets;
+	TickSpecs.Reserve(Result.Stacks);
+	TickSpecTargets.Reserve(Result.Stacks);
+	for (int32 StackIndex = 0; StackIndex < Result.Stacks; ++StackIndex)
+	{
+		FAilmentTarget& BenchTarget = BenchTargets[StackIndex % BenchTargets.Num()];
+		UAbilitySystemComponent* ASC = BenchTarget.ASC.Get();
+
+		FGameplayEffectSpec& Spec = TickSpecs.Emplace_GetRef(TickEffect, ASC->MakeEffectContext(), 1.0f);
+		Spec.SetSetByCallerMagnitude(FPHGameplayTags::Data_Damage_Health, -BenchmarkDamagePerTick);
+		TickSpecTargets.Add(ASC);
+
+		FAilmentInstance& Instance = BenchTarget.Instances.AddDefaulted_GetRef();
+		Instance.Type = ECombatAilmentType::Poison;
+		Instance.DamagePerSecond = BenchmarkDamagePerTick / StepIntervalSeconds;
+		Instance.RemainingSeconds = StepIntervalSeconds * (Result.Ticks + 1);
+	}
+
+	double StartSeconds = FPlatformTime::Seconds();
+	for (int32 Tick = 0; Tick < Result.Ticks; ++Tick)
+	{
+		for (int32 StackIndex = 0; StackIndex < TickSpecs.Num(); ++StackIndex)
+		{
+			TickSpecTargets[StackIndex]->ApplyGameplayEffectSpecToSelf(TickSpecs[StackIndex]);
+		}
+	}
+	const double EffectSeconds = FPlatformTime::Seconds() - StartSeconds;
+	RestoreHealth();
+
+	StartSeconds = FPlatformTime::Seconds();
+	for (int32 Tick = 0; Tick < Result.Ticks; ++Tick)
+	{
+		for (FAilmentTarget& BenchTarget : BenchTargets)
+		{
+			const float Damage = AdvanceTarget(BenchTarget, StepIntervalSeconds, nullptr);
+			if (Damage > 0.0f)
+			{
+				BenchTarget.ASC->ApplyModToAttribute(HealthAttribute, EGameplayModOp::Additive, -Damage);
+				++Result.SubsystemPathWrites;
+			}
+		}
+	}
+	const double SubsystemSeconds = FPlatformTime::Seconds() - StartSeconds;
+	RestoreHealth();
+
+	Result.EffectPathWrites = Result.Stacks * Result.Ticks;
+	Result.EffectPathMsPerTick = EffectSeconds * 1000.0 / Result.Ticks;
+	Result.SubsystemPathMsPerTick = SubsystemSeconds * 1000.0 / Result.Ticks;
+
+	UE_LOG(LogCombatAilments, Log,
+		TEXT("BenchmarkDamageOverTime: %d stacks on %d targets, %d ticks | per-stack GE %.3fms/tick (%d writes) | "
+		     "subsystem %.3fms/tick (%d writes)"),
+		Result.Stacks, Result.TargetCount, Result.Ticks,
+		Result.EffectPathMsPerTick, Result.EffectPathWrites,
+		Result.SubsystemPathMsPerTick, Result.SubsystemPathWrites);
+
+	return Result;
+}
@@ -0,0 +1,425 @@
+#include "Combat/Subsystems/HunterDamagePopupSubsystem.h"
+
+#include "Camera/PlayerCameraManager.h"
+#include "Combat/Components/HunterDamagePopupPresentationComponent.h"
+#include "Components/WidgetComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "UI/HUD/HunterDamagePopupWidget.h"
+
+DEFINE_LOG_CATEGORY(LogDamagePopupPool);
+
+DECLARE_CYCLE_STAT(TEXT("Update Popups"), STAT_DamagePopups_Update, STATGROUP_DamagePopups);
+DECLARE_CYCLE_STAT(TEXT("Request Popup"), STAT_DamagePopups_Request, STATGROUP_DamagePopups);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Popups"), STAT_DamagePopups_Active, STATGROUP_DamagePopups);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pooled Components"), STAT_DamagePopups_Pooled, STATGROUP_DamagePopups);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Merged Popups"), STAT_DamagePopups_Merged, STATGROUP_DamagePopups);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Dropped Popups"), STAT_DamagePopups_Dropped, STATGROUP_DamagePopups);
+
+namespace HunterDamagePopupSubsystemPrivate
+{
+	/** True if A should stay on screen over B. */
+	bool OutranksSlot(int32 TierA, float DamageA, const FHunterDamagePopupSlot& B)
+	{
+		return TierA != B.PriorityTier ? TierA > B.PriorityTier : DamageA > B.PriorityDamage;
+	}
+
+	FRotator FaceCamera(const FVector& WorldLocation, const FVector& CameraLocation)
+	{
+		return (CameraLocation - WorldLocation).Rotation();
+	}
+}
+
+void UHunterDamagePopupSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PlayerPools.Reset();
+	MergedPopupCount = 0;
+	DroppedPopupCount = 0;
+}
+
+void UHunterDamagePopupSubsystem::Deinitialize()
+{
+	for (FHunterDamagePopupPlayerPool& Pool : PlayerPools)
+	{
+		for (FHunterDamagePopupSlot& Slot : Pool.Slots)
+		{
+			if (Slot.Widget)
+			{
+				Slot.Widget->OnDamagePopupFinished.Unbind();
+			}
+		}
+	}
+
+	PlayerPools.Reset();
+	Super::Deinitialize();
+}
+
+TStatId UHunterDamagePopupSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UHunterDamagePopupSubsystem, STATGROUP_Tickables);
+}
+
+int32 UHunterDamagePopupSubsystem::GetActivePopupCount() const
+{
+	int32 Active = 0;
+	for (const FHunterDamagePopupPlayerPool& Pool : PlayerPools)
+	{
+		Active += Pool.ActiveCount;
+	}
+	return Active;
+}
+
+void UHunterDamagePopupSubsystem::GetPopupPriority(const FCombatDamagePopupData& PopupData, int32& OutTier,
+	float& OutDamage)
+{
+	OutTier = PopupData.bKilledTarget ? 2 : ((PopupData.bWasCrit || PopupData.bFromAilment) ? 1 : 0);
+	OutDamage = PopupData.TotalDamage;
+}
+
+FHunterDamagePopupPlayerPool* UHunterDamagePopupSubsystem::FindOrAddPool(APlayerController* PlayerController)
+{
+	for (FHunterDamagePopupPlayerPool& Pool : PlayerPools)
+	{
+		if (Pool.PlayerController.Get() == PlayerController)
+		{
+			return &Pool;
+		}
+	}
+
+	FHunterDamagePopupPlayerPool& NewPool = PlayerPools.AddDefaulted_GetRef();
+	NewPool.PlayerController = PlayerController;
+	return &NewPool;
+}
+
+void UHunterDamagePopupSubsystem::RequestPopup(const UHunterDamagePopupPresentationComponent& Presenter,
+	APlayerController* PlayerController, const FCombatDamagePopupData& PopupData)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DamagePopups_Request);
+
+	UWorld* World = GetWorld();
+	if (!World || !PlayerController || !Presenter.PopupWidgetClass || PopupData.TotalDamage <= KINDA_SMALL_NUMBER)
+	{
+		return;
+	}
+
+	FHunterDamagePopupPlayerPool* Pool = FindOrAddPool(PlayerController);
+	const double Now = World->GetTimeSeconds();
+
+	// Merge into the number already showing on this target.
+	AActor* Target = PopupData.TargetActor.Get();
+	if (Target && Presenter.MergeWindowSeconds > 0.f)
+	{
+		for (FHunterDamagePopupSlot& Slot : Pool->Slots)
+		{
+			if (!Slot.bActive || Slot.Target.Get() != Target || Now > Slot.MergeWindowEnd
+				|| !IsValid(Slot.WidgetComponent) || !Slot.Widget)
+			{
+				continue;
+			}
+
+			FCombatDamagePopupData Merged = Slot.Widget->GetDamagePopupData();
+			if (PopupData.TotalDamage > Merged.TotalDamage)
+			{
+				Merged.DominantDamageType = PopupData.DominantDamageType;
+				Merged.DisplayColor = PopupData.DisplayColor;
+			}
+			Merged.TotalDamage += PopupData.TotalDamage;
+			Merged.bWasCrit |= PopupData.bWasCrit;
+			Merged.bWasBlocked |= PopupData.bWasBlocked;
+			Merged.bKilledTarget |= PopupData.bKilledTarget;
+			Merged.bFromAilment |= PopupData.bFromAilment;
+			Merged.ResolveResult = PopupData.ResolveResult;
+
+			// Keep the merged number where it first appeared instead of jumping.
+			Merged.WorldLocation = Slot.WidgetComponent->GetComponentLocation();
+
+			ShowInSlot(*Pool, Slot, Presenter, Merged, Now);
+			Slot.MergeWindowEnd = Now + Presenter.MergeWindowSeconds;
+
+			++MergedPopupCount;
+			INC_DWORD_STAT(STAT_DamagePopups_Merged);
+			return;
+		}
+	}
+
+	const int32 Capacity = FMath::Max(Presenter.MaxConcurrentPopups, 1);
+	int32 SlotIndex = AcquireSlot(*Pool, Presenter, Capacity);
+
+	if (SlotIndex == INDEX_NONE)
+	{
+		int32 Tier = 0;
+		float Damage = 0.f;
+		GetPopupPriority(PopupData, Tier, Damage);
+
+		int32 LowestIndex = INDEX_NONE;
+		for (int32 Index = 0; Index < Pool->Slots.Num(); ++Index)
+		{
+			const FHunterDamagePopupSlot& Slot = Pool->Slots[Index];
+			if (Slot.bActive && (LowestIndex == INDEX_NONE
+				|| HunterDamagePopupSubsystemPrivate::OutranksSlot(
+					Pool->Slots[LowestIndex].PriorityTier, Pool->Slots[LowestIndex].PriorityDamage, Slot)))
+			{
+				LowestIndex = Index;
+			}
+		}
+
+		++DroppedPopupCount;
+		INC_DWORD_STAT(STAT_DamagePopups_Dropped);
+
+		if (LowestIndex == INDEX_NONE
+			|| !HunterDamagePopupSubsystemPrivate::OutranksSlot(Tier, Damage, Pool->Slots[LowestIndex]))
+		{
+			return;
+		}
+
+		ReleaseSlot(*Pool, Pool->Slots[LowestIndex]);
+		SlotIndex = LowestIndex;
+	}
+
+	FCombatDamagePopupData AdjustedPopupData = PopupData;
+	AdjustedPopupData.WorldLocation += Presenter.AdditionalWorldOffset;
+
+	FHunterDamagePopupSlot& Slot = Pool->Slots[SlotIndex];
+	Slot.Target = Target;
+	Slot.MergeWindowEnd = Now + Presenter.MergeWindowSeconds;
+	ShowInSlot(*Pool, Slot, Presenter, AdjustedPopupData, Now);
+}
+
+int32 UHunterDamagePopupSubsystem::AcquireSlot(FHunterDamagePopupPlayerPool& Pool,
+	const UHunterDamagePopupPresentationComponent& Presenter, int32 Capacity)
+{
+	if (Pool.ActiveCount >= Capacity)
+	{
+		return INDEX_NONE;
+	}
+
+	for (int32 Index = 0; Index < Pool.Slots.Num(); ++Index)
+	{
+		FHunterDamagePopupSlot& Slot = Pool.Slots[Index];
+		if (!Slot.bActive && IsValid(Slot.WidgetComponent) && Slot.Widget
+			&& Slot.WidgetClass == Presenter.PopupWidgetClass)
+		{
+			return Index;
+		}
+	}
+
+	if (Pool.Slots.Num() >= Capacity)
+	{
+		// Under budget but no inactive slot is usable as is (lost component or
+		// another presenter's widget class); rebuild one in place.
+		for (int32 Index = 0; Index < Pool.Slots.Num(); ++Index)
+		{
+			if (!Pool.Slots[Index].bActive && CreateSlotComponent(Pool, Pool.Slots[Index], Presenter))
+			{
+				return Index;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	FHunterDamagePopupSlot NewSlot;
+	if (!CreateSlotComponent(Pool, NewSlot, Presenter))
+	{
+		return INDEX_NONE;
+	}
+
+	SET_DWORD_STAT(STAT_DamagePopups_Pooled, Pool.Slots.Num() + 1);
+	return Pool.Slots.Add(NewSlot);
+}
+
+bool UHunterDamagePopupSubsystem::CreateSlotComponent(FHunterDamagePopupPlayerPool& Pool,
+	FHunterDamagePopupSlot& Slot, const UHunterDamagePopupPresentationComponent& Presenter)
+{
+	APlayerController* PlayerController = Pool.PlayerController.Get();
+	if (!PlayerController)
+	{
+		return false;
+	}
+
+	if (Slot.Widget)
+	{
+		Slot.Widget->OnDamagePopupFinished.Unbind();
+	}
+	if (IsValid(Slot.WidgetComponent))
+	{
+		Slot.WidgetComponent->DestroyComponent();
+	}
+	Slot.WidgetComponent = nullptr;
+	Slot.Widget = nullptr;
+	Slot.WidgetClass = nullptr;
+
+	UWidgetComponent* WidgetComponent = NewObject<UWidgetComponent>(PlayerController);
+	if (!WidgetComponent)
+	{
+		return false;
+	}
+
+	PlayerController->AddInstanceComponent(WidgetComponent);
+	WidgetComponent->SetUsingAbsoluteLocation(true);
+	WidgetComponent->SetUsingAbsoluteRotation(true);
+	WidgetComponent->SetUsingAbsoluteScale(true);
+	WidgetComponent->SetWidgetClass(Presenter.PopupWidgetClass);
+	WidgetComponent->SetWidgetSpace(EWidgetSpace::World);
+	WidgetComponent->SetBlendMode(EWidgetBlendMode::Transparent);
+	WidgetComponent->SetTwoSided(Presenter.bTwoSidedWorldWidget);
+	WidgetComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	WidgetComponent->SetGenerateOverlapEvents(false);
+	WidgetComponent->SetWindowFocusable(false);
+	WidgetComponent->SetPivot(Presenter.ViewportAlignment);
+	WidgetComponent->SetDrawAtDesiredSize(Presenter.bDrawAtDesiredSize);
+	WidgetComponent->SetDrawSize(FIntPoint(
+		FMath::Max(FMath::RoundToInt(Presenter.WorldDrawSize.X), 1),
+		FMath::Max(FMath::RoundToInt(Presenter.WorldDrawSize.Y), 1)));
+	WidgetComponent->SetWorldScale3D(Presenter.WorldWidgetScale);
+	WidgetComponent->SetVisibility(false);
+	WidgetComponent->RegisterComponent();
+	WidgetComponent->InitWidget();
+	WidgetComponent->SetComponentTickEnabled(false);
+
+	UHunterDamagePopupWidget* Widget = Cast<UHunterDamagePopupWidget>(WidgetComponent->GetUserWidgetObject());
+	if (!Widget)
+	{
+		UE_LOG(LogDamagePopupPool, Warning,
+			TEXT("Damage popup pool could not create a HunterDamagePopupWidget from %s."),
+			*GetNameSafe(Presenter.PopupWidgetClass));
+		WidgetComponent->DestroyComponent();
+		return false;
+	}
+
+	Widget->SetOwningWorldWidgetComponent(WidgetComponent);
+	Widget->SetVisibility(ESlateVisibility::HitTestInvisible);
+	Widget->OnDamagePopupFinished.BindUObject(this, &UHunterDamagePopupSubsystem::HandlePopupFinished);
+
+	Slot.WidgetComponent = WidgetComponent;
+	Slot.Widget = Widget;
+	Slot.WidgetClass = Presenter.PopupWidgetClass;
+	Slot.bActive = false;
+	return true;
+}
+
+void UHunterDamagePopupSubsystem::ShowInSlot(FHunterDamagePopupPlayerPool& Pool, FHunterDamagePopupSlot& Slot,
+	const UHunterDamagePopupPresentationComponent& Presenter, const FCombatDamagePopupData& PopupData,
+	double Now)
+{
+	UWidgetComponent* WidgetComponent = Slot.WidgetComponent;
+	WidgetComponent->SetWorldLocation(PopupData.WorldLocation);
+
+	const APlayerController* PlayerController = Pool.PlayerController.Get();
+	if ((Presenter.bFaceLocalCameraOnSpawn || Presenter.bContinuouslyFaceLocalCamera)
+		&& PlayerController && PlayerController->PlayerCameraManager)
+	{
+		WidgetComponent->SetWorldRotation(HunterDamagePopupSubsystemPrivate::FaceCamera(
+			PopupData.WorldLocation, PlayerController->PlayerCameraManager->GetCameraLocation()));
+	}
+
+	if (!Slot.bActive)
+	{
+		Slot.bActive = true;
+		++Pool.ActiveCount;
+		WidgetComponent->SetVisibility(true);
+		WidgetComponent->SetComponentTickEnabled(true);
+	}
+
+	Slot.Widget->InitializeDamagePopup(PopupData);
+	WidgetComponent->RequestRedraw();
+
+	GetPopupPriority(PopupData, Slot.PriorityTier, Slot.PriorityDamage);
+	Slot.bFaceCamera = Presenter.bContinuouslyFaceLocalCamera;
+	Slot.ExpireTime = Presenter.AutoRemoveDelay > 0.f ? Now + Presenter.AutoRemoveDelay : TNumericLimits<double>::Max();
+}
+
+void UHunterDamagePopupSubsystem::ReleaseSlot(FHunterDamagePopupPlayerPool& Pool, FHunterDamagePopupSlot& Slot)
+{
+	if (!Slot.bActive)
+	{
+		return;
+	}
+
+	Slot.bActive = false;
+	Slot.Target.Reset();
+	Pool.ActiveCount = FMath::Max(Pool.ActiveCount - 1, 0);
+
+	if (IsValid(Slot.WidgetComponent))
+	{
+		Slot.WidgetComponent->SetVisibility(false);
+		Slot.WidgetComponent->SetComponentTickEnabled(false);
+	}
+}
+
+void UHunterDamagePopupSubsystem::HandlePopupFinished(UHunterDamagePopupWidget* Widget)
+{
+	for (FHunterDamagePopupPlayerPool& Pool : PlayerPools)
+	{
+		for (FHunterDamagePopupSlot& Slot : Pool.Slots)
+		{
+			if (Slot.Widget == Widget)
+			{
+				ReleaseSlot(Pool, Slot);
+				return;
+			}
+		}
+	}
+}
+
+void UHunterDamagePopupSubsystem::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	const int32 ActivePopups = GetActivePopupCount();
+	SET_DWORD_STAT(STAT_DamagePopups_Active, ActivePopups);
+
+	if (PlayerPools.IsEmpty())
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_DamagePopups_Update);
+
+	const UWorld* World = GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+
+	for (int32 PoolIndex = PlayerPools.Num() - 1; PoolIndex >= 0; --PoolIndex)
+	{
+		FHunterDamagePopupPlayerPool& Pool = PlayerPools[PoolIndex];
+		const APlayerController* PlayerController = Pool.PlayerController.Get();
+		if (!PlayerController)
+		{
+			// Components were owned by the controller and went with it.
+			PlayerPools.RemoveAtSwap(PoolIndex, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		if (Pool.ActiveCount == 0)
+		{
+			continue;
+		}
+
+		// One camera read per player for the whole batch.
+		const bool bHasCamera = PlayerController->PlayerCameraManager != nullptr;
+		const FVector CameraLocation = bHasCamera
+			? PlayerController->PlayerCameraManager->GetCameraLocation()
+			: FVector::ZeroVector;
+
+		for (FHunterDamagePopupSlot& Slot : Pool.Slots)
+		{
+			if (!Slot.bActive)
+			{
+				continue;
+			}
+
+			if (!IsValid(Slot.WidgetComponent) || Now >= Slot.ExpireTime)
+			{
+				ReleaseSlot(Pool, Slot);
+				continue;
+			}
+
+			if (Slot.bFaceCamera && bHasCamera)
+			{
+				Slot.WidgetComponent->SetWorldRotation(HunterDamagePopupSubsystemPrivate::FaceCamera(
+					Slot.WidgetComponent->GetComponentLocation(), CameraLocation));
+			}
+		}
+	}
+}
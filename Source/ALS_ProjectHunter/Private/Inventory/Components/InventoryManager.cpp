@@ -1,10 +1,11 @@
 #include "Inventory/Components/InventoryManager.h"
 
 #include "Core/Logging/ProjectHunterLogMacros.h"
-#include "Engine/ActorChannel.h"
-#include "Engine/NetConnection.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
 #include "Item/ItemInstance.h"
 #include "Net/UnrealNetwork.h"
+#include "TimerManager.h"
 #include "Inventory/Helpers/InventoryAdder.h"
 #include "Inventory/Helpers/InventoryRemover.h"
 #include "Inventory/Helpers/InventoryStackHelper.h"
@@ -15,6 +16,17 @@
 
 DEFINE_LOG_CATEGORY(LogInventoryManager);
 
+#if !UE_BUILD_SHIPPING
+static TAutoConsoleVariable<int32> CVarVerifyInventoryIndex(
+	TEXT("Hunter.Debug.InventoryIndex"),
+	UE_BUILD_DEBUG ? 1 : 0,
+	TEXT("Check the inventory aggregates and search indexes against a full scan after every change\n")
+	TEXT("0: Disabled (default outside Debug builds)\n")
+	TEXT("1: Verify, log and rebuild on mismatch"),
+	ECVF_Cheat
+);
+#endif
+
 UInventoryManager::UInventoryManager()
 {
 	PrimaryComponentTick.bCanEverTick = false;
@@ -22,6 +34,11 @@ UInventoryManager::UInventoryManager()
 	// Enable replication so the server has an accurate copy of the inventory,
 	// allowing server-side ownership checks (e.g. ServerEquipItem).
 	SetIsReplicatedByDefault(true);
+
+	// OPT-INVENTORYREP: items are registered as owner-only subobjects as they
+	// enter the replicated list instead of walked in ReplicateSubobjects.
+	bReplicateUsingRegisteredSubObjectList = true;
+	ReplicatedItems.OwnerComponent = this;
 }
 
 void UInventoryManager::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -30,29 +47,7 @@ void UInventoryManager::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Ou
 
 	// Only the owning client receives the full item list (saves bandwidth;
 	// other players only see equipment via EquipmentManager replication).
-	DOREPLIFETIME_CONDITION(UInventoryManager, Items, COND_OwnerOnly);
-}
-
-bool UInventoryManager::ReplicateSubobjects(UActorChannel* Channel, FOutBunch* Bunch, FReplicationFlags* RepFlags)
-{
-	bool bWroteSomething = Super::ReplicateSubobjects(Channel, Bunch, RepFlags);
-
-	const AActor* OwnerActor = GetOwner();
-	const UNetConnection* OwningConnection = OwnerActor ? OwnerActor->GetNetConnection() : nullptr;
-	if (!Channel || !Channel->Connection || Channel->Connection != OwningConnection)
-	{
-		return bWroteSomething;
-	}
-
-	for (UItemInstance* Item : Items)
-	{
-		if (IsValid(Item))
-		{
-			bWroteSomething |= Channel->ReplicateSubobject(Item, *Bunch, *RepFlags);
-		}
-	}
-
-	return bWroteSomething;
+	DOREPLIFETIME_CONDITION(UInventoryManager, ReplicatedItems, COND_OwnerOnly);
 }
 
 void UInventoryManager::BeginPlay()
@@ -60,6 +55,7 @@ void UInventoryManager::BeginPlay()
 	Super::BeginPlay();
 
 	Items.Reserve(MaxSlots);
+	RebuildInventoryIndex();
 
 	UE_LOG(LogInventoryManager, Log, TEXT("InventoryManager: Initialized with %d slots, %.1f max weight"),
 		MaxSlots, MaxWeight);
@@ -120,7 +116,7 @@ bool UInventoryManager::SwapItems(int32 SlotA, int32 SlotB)
 	if (!HasInventoryAuthority())
 	{
 		// UI runs on the client - forward instead of failing. The result comes
-		// back through OnRep_Items, so there is nothing meaningful to return here.
+		// back through OnInventorySlotsChanged, so there is nothing meaningful to return here.
 		ServerSwapItems(SlotA, SlotB);
 		return false;
 	}
@@ -277,12 +273,12 @@ UItemInstance* UInventoryManager::GetItemAtSlot(int32 SlotIndex) const
 
 int32 UInventoryManager::FindFirstEmptySlot() const
 {
-	return UInventoryFunctionLibrary::FindFirstEmptySlot(Items, MaxSlots);
+	return InventoryIndex.FindFirstEmptySlot(MaxSlots);
 }
 
 int32 UInventoryManager::FindSlotForItem(UItemInstance* Item) const
 {
-	return UInventoryFunctionLibrary::FindSlotForItem(Items, Item);
+	return InventoryIndex.FindSlotForItem(Item);
 }
 
 bool UInventoryManager::ContainsItem(UItemInstance* Item) const
@@ -292,27 +288,44 @@ bool UInventoryManager::ContainsItem(UItemInstance* Item) const
 
 TArray<UItemInstance*> UInventoryManager::FindItemsByBaseID(FName BaseItemID) const
 {
-	return UInventoryFunctionLibrary::FindItemsByBaseID(Items, BaseItemID);
+	return GatherIndexedItems(InventoryIndex.FindSlotsByBaseID(BaseItemID));
 }
 
 TArray<UItemInstance*> UInventoryManager::FindItemsByType(EItemType ItemType) const
 {
-	return UInventoryFunctionLibrary::FindItemsByType(Items, ItemType);
+	return GatherIndexedItems(InventoryIndex.FindSlotsByType(ItemType));
 }
 
 TArray<UItemInstance*> UInventoryManager::FindItemsByRarity(EItemRarity Rarity) const
 {
-	return UInventoryFunctionLibrary::FindItemsByRarity(Items, Rarity);
+	return GatherIndexedItems(InventoryIndex.FindSlotsByRarity(Rarity));
 }
 
 bool UInventoryManager::HasItemWithID(FGuid UniqueID) const
 {
-	return UInventoryFunctionLibrary::HasItemWithID(Items, UniqueID);
+	return InventoryIndex.HasItemWithID(UniqueID);
 }
 
 int32 UInventoryManager::GetTotalQuantityOfItem(FName BaseItemID) const
 {
-	return UInventoryFunctionLibrary::GetTotalQuantityOfItem(Items, BaseItemID);
+	return InventoryIndex.GetTotalQuantityOfItem(BaseItemID);
+}
+
+TArray<UItemInstance*> UInventoryManager::GatherIndexedItems(const TArray<int32>* SlotIndices) const
+{
+	TArray<UItemInstance*> FoundItems;
+	if (!SlotIndices)
+	{
+		return FoundItems;
+	}
+
+	FoundItems.Reserve(SlotIndices->Num());
+	for (const int32 SlotIndex : *SlotIndices)
+	{
+		FoundItems.Add(Items[SlotIndex]);
+	}
+
+	return FoundItems;
 }
 
 void UInventoryManager::SortInventory(ESortMode SortMode)
@@ -323,6 +336,7 @@ void UInventoryManager::SortInventory(ESortMode SortMode)
 	}
 
 	UInventoryFunctionLibrary::SortItems(Items, SortMode, MaxSlots);
+	RebuildInventoryIndex();
 
 	BroadcastInventoryChanged();
 
@@ -338,6 +352,7 @@ void UInventoryManager::CompactInventory()
 	}
 
 	UInventoryFunctionLibrary::CompactItems(Items, MaxSlots);
+	RebuildInventoryIndex();
 
 	BroadcastInventoryChanged();
 
@@ -353,6 +368,7 @@ void UInventoryManager::ClearAll()
 	}
 
 	Items.Empty(MaxSlots);
+	RebuildInventoryIndex();
 
 	BroadcastInventoryChanged();
 	UpdateWeight();
@@ -392,12 +408,174 @@ void UInventoryManager::UpdateWeight()
 
 void UInventoryManager::BroadcastInventoryChanged()
 {
+	// Every server-side mutation ends here, so this is the one place the
+	// replicated view is brought up to date.
+	if (HasInventoryAuthority())
+	{
+		SyncReplicatedItems();
+	}
+
+	VerifyInventoryIndex(TEXT("BroadcastInventoryChanged"));
+	OnInventoryChanged.Broadcast();
+}
+
+void UInventoryManager::SyncReplicatedItems()
+{
+	TArray<int32> ChangedSlots;
+	TArray<UItemInstance*> AddedItems;
+	TArray<UItemInstance*> RemovedItems;
+	ReplicatedItems.SyncFromSlots(Items, ChangedSlots, AddedItems, RemovedItems);
+
+	// The diff also catches quantity changes made to held items outside the
+	// inventory helpers (e.g. consumable use), so refresh those slots too.
+	for (const int32 SlotIndex : ChangedSlots)
+	{
+		InventoryIndex.SetSlot(SlotIndex, GetItemAtSlot(SlotIndex));
+	}
+
+	// Removals first: an item that only moved slots shows up in both lists.
+	for (UItemInstance* Item : RemovedItems)
+	{
+		if (!ContainsItem(Item))
+		{
+			RemoveReplicatedSubObject(Item);
+		}
+	}
+
+	for (UItemInstance* Item : AddedItems)
+	{
+		AddReplicatedSubObject(Item, COND_OwnerOnly);
+	}
+
+	if (ChangedSlots.IsEmpty())
+	{
+		return;
+	}
+
+	UE_LOG(LogInventoryManager, Verbose, TEXT("SyncReplicatedItems: %d entries dirtied (%d slots, %d entries)"),
+		ChangedSlots.Num(), Items.Num(), ReplicatedItems.Entries.Num());
+
+	OnInventorySlotsChanged.Broadcast(ChangedSlots);
+}
+
+void UInventoryManager::HandleReplicatedSlot(const int32 SlotIndex, UItemInstance* Item)
+{
+	if (SlotIndex < 0)
+	{
+		return;
+	}
+
+	SetSlotItem(SlotIndex, Item);
+	PendingReplicatedSlots.AddUnique(SlotIndex);
+}
+
+void UInventoryManager::FlushReplicatedSlots()
+{
+	if (PendingReplicatedSlots.IsEmpty())
+	{
+		return;
+	}
+
+	const TArray<int32> ChangedSlots = MoveTemp(PendingReplicatedSlots);
+	PendingReplicatedSlots.Reset();
+
+	OnInventorySlotsChanged.Broadcast(ChangedSlots);
 	OnInventoryChanged.Broadcast();
+	UpdateWeight();
+
+	// An item's own properties (quantity, weight) replicate through its
+	// subobject and can land after this list's callbacks, so re-read the
+	// touched slots once the whole update has been applied.
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateWeakLambda(this, [this, ChangedSlots]()
+		{
+			const float WeightBefore = GetTotalWeight();
+			for (const int32 SlotIndex : ChangedSlots)
+			{
+				InventoryIndex.SetSlot(SlotIndex, GetItemAtSlot(SlotIndex));
+			}
+
+			VerifyInventoryIndex(TEXT("FlushReplicatedSlots"));
+			if (!FMath::IsNearlyEqual(WeightBefore, GetTotalWeight()))
+			{
+				UpdateWeight();
+			}
+		}));
+	}
+
+	UE_LOG(LogInventoryManager, Verbose, TEXT("FlushReplicatedSlots: %d slots synced (%d slots occupied)"),
+		ChangedSlots.Num(), GetItemCount());
 }
 
 UItemInstance* UInventoryManager::FindStackableItem(UItemInstance* Item) const
 {
-	return UInventoryFunctionLibrary::FindStackableItem(Items, Item);
+	if (!Item || !Item->IsStackable())
+	{
+		return nullptr;
+	}
+
+	// Stack partners share a base item row, so only that bucket can match.
+	const TArray<int32>* Candidates = InventoryIndex.FindSlotsByBaseID(Item->BaseItemHandle.RowName);
+	if (!Candidates)
+	{
+		return nullptr;
+	}
+
+	for (const int32 SlotIndex : *Candidates)
+	{
+		UItemInstance* ExistingItem = Items[SlotIndex];
+		if (ExistingItem && ExistingItem->CanStackWith(Item) && ExistingItem->GetRemainingStackSpace() > 0)
+		{
+			return ExistingItem;
+		}
+	}
+
+	return nullptr;
+}
+
+void UInventoryManager::SetSlotItem(const int32 SlotIndex, UItemInstance* Item)
+{
+	if (SlotIndex < 0)
+	{
+		return;
+	}
+
+	if (Items.Num() <= SlotIndex)
+	{
+		Items.SetNum(SlotIndex + 1);
+	}
+
+	Items[SlotIndex] = Item;
+	InventoryIndex.SetSlot(SlotIndex, Item);
+}
+
+void UInventoryManager::RefreshItemIndex(UItemInstance* Item)
+{
+	InventoryIndex.RefreshItem(Item);
+}
+
+void UInventoryManager::RebuildInventoryIndex()
+{
+	InventoryIndex.Rebuild(Items, MaxSlots);
+}
+
+void UInventoryManager::VerifyInventoryIndex(const TCHAR* Context)
+{
+#if !UE_BUILD_SHIPPING
+	if (CVarVerifyInventoryIndex.GetValueOnGameThread() == 0)
+	{
+		return;
+	}
+
+	FString Error;
+	if (!InventoryIndex.Verify(Items, MaxSlots, Error))
+	{
+		ensureMsgf(false, TEXT("%s: inventory index out of date on %s: %s"),
+			Context, *GetNameSafe(GetOwner()), *Error);
+		RebuildInventoryIndex();
+	}
+#endif
 }
 
 bool UInventoryManager::HasInventoryAuthority() const
@@ -432,12 +610,3 @@ bool UInventoryManager::HasInventoryWriteAuthority(const TCHAR* FunctionName) co
 		*GetNameSafe(OwnerActor));
 	return false;
 }
-
-void UInventoryManager::OnRep_Items()
-{
-	BroadcastInventoryChanged();
-	UpdateWeight();
-
-	UE_LOG(LogInventoryManager, Verbose, TEXT("OnRep_Items: inventory synced (%d slots occupied)"),
-		GetItemCount());
-}
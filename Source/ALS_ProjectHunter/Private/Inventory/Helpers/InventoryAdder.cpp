@@ -59,12 +59,7 @@ bool FInventoryAdder::AddItemToSlot(UInventoryManager& Manager, UItemInstance* I
 		return false;
 	}
 
-	while (Manager.Items.Num() <= SlotIndex)
-	{
-		Manager.Items.Add(nullptr);
-	}
-
-	if (Manager.Items[SlotIndex] != nullptr)
+	if (Manager.GetItemAtSlot(SlotIndex) != nullptr)
 	{
 		PH_LOG_WARNING(LogInventoryManager, "AddItemToSlot failed: SlotIndex=%d is already occupied.", SlotIndex);
 		return false;
@@ -78,7 +73,7 @@ bool FInventoryAdder::AddItemToSlot(UInventoryManager& Manager, UItemInstance* I
 		}
 	}
 
-	Manager.Items[SlotIndex] = Item;
+	Manager.SetSlotItem(SlotIndex, Item);
 
 	Manager.OnItemAdded.Broadcast(Item);
 	Manager.BroadcastInventoryChanged();
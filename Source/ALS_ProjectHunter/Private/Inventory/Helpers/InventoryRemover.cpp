@@ -35,7 +35,7 @@ UItemInstance* FInventoryRemover::RemoveItemAtSlot(UInventoryManager& Manager, i
 		return nullptr;
 	}
 
-	Manager.Items[SlotIndex] = nullptr;
+	Manager.SetSlotItem(SlotIndex, nullptr);
 
 	Manager.OnItemRemoved.Broadcast(Item);
 	Manager.BroadcastInventoryChanged();
@@ -61,6 +61,7 @@ bool FInventoryRemover::RemoveQuantity(UInventoryManager& Manager, UItemInstance
 	}
 	else
 	{
+		Manager.RefreshItemIndex(Item);
 		Manager.BroadcastInventoryChanged();
 		Manager.UpdateWeight();
 	}
@@ -28,6 +28,7 @@ bool FInventoryStackHelper::TryStackItem(UInventoryManager& Manager, UItemInstan
 	}
 
 	const int32 Overflow = StackTarget->AddToStack(Item->Quantity);
+	Manager.RefreshItemIndex(StackTarget);
 	if (Overflow > 0)
 	{
 		Item->Quantity = Overflow;
@@ -51,10 +52,12 @@ bool FInventoryStackHelper::StackItems(UInventoryManager& Manager, UItemInstance
 	}
 
 	const int32 Overflow = TargetItem->AddToStack(SourceItem->Quantity);
+	Manager.RefreshItemIndex(TargetItem);
 	if (Overflow > 0)
 	{
 		SourceItem->Quantity = Overflow;
 		SourceItem->UpdateTotalWeight();
+		Manager.RefreshItemIndex(SourceItem);
 	}
 	else
 	{
@@ -78,10 +81,12 @@ UItemInstance* FInventoryStackHelper::SplitStack(UInventoryManager& Manager, UIt
 	{
 		return nullptr;
 	}
+	Manager.RefreshItemIndex(Item);
 
 	if (!Manager.AddItem(NewItem))
 	{
 		Item->AddToStack(NewItem->Quantity);
+		Manager.RefreshItemIndex(Item);
 		return nullptr;
 	}
 
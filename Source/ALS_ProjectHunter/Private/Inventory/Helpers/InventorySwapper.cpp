@@ -12,7 +12,7 @@ bool FInventorySwapper::SwapItems(UInventoryManager& Manager, int32 SlotA, int32
 	}
 
 	// Bound against MaxSlots, not Items.Num(). Items grows lazily (see
-	// FInventoryAdder::AddItemToSlot), so with 3 items held it has 3 entries
+	// UInventoryManager::SetSlotItem), so with 3 items held it has 3 entries
 	// while the menu shows MaxSlots cells - an IsValidIndex check here made
 	// every drag onto an empty slot past the last occupied one fail silently.
 	if (SlotA < 0 || SlotA >= Manager.MaxSlots || SlotB < 0 || SlotB >= Manager.MaxSlots)
@@ -22,21 +22,16 @@ bool FInventorySwapper::SwapItems(UInventoryManager& Manager, int32 SlotA, int32
 		return false;
 	}
 
-	const int32 HighestSlot = FMath::Max(SlotA, SlotB);
-	while (Manager.Items.Num() <= HighestSlot)
-	{
-		Manager.Items.Add(nullptr);
-	}
-
-	if (!Manager.Items[SlotA] && !Manager.Items[SlotB])
+	UItemInstance* ItemA = Manager.GetItemAtSlot(SlotA);
+	UItemInstance* ItemB = Manager.GetItemAtSlot(SlotB);
+	if (!ItemA && !ItemB)
 	{
 		// Two empty slots - nothing to move, and broadcasting would churn the UI.
 		return false;
 	}
 
-	UItemInstance* Temp = Manager.Items[SlotA];
-	Manager.Items[SlotA] = Manager.Items[SlotB];
-	Manager.Items[SlotB] = Temp;
+	Manager.SetSlotItem(SlotA, ItemB);
+	Manager.SetSlotItem(SlotB, ItemA);
 
 	Manager.BroadcastInventoryChanged();
 
@@ -3,7 +3,6 @@
 #include "Item/ItemInstance.h"
 #include "Inventory/Components/InventoryManager.h"
 #include "Inventory/Helpers/InventoryWeightCalculator.h"
-#include "Inventory/Library/FunctionLibraries/InventoryFunctionLibrary.h"
 
 bool FInventoryValidator::IsFull(const UInventoryManager& Manager)
 {
@@ -29,7 +28,7 @@ bool FInventoryValidator::CanAddItem(const UInventoryManager& Manager, UItemInst
 
 	if (Manager.bAutoStack && Item->IsStackable())
 	{
-		if (UInventoryFunctionLibrary::FindStackableItem(Manager.Items, Item))
+		if (Manager.FindStackableItem(Item))
 		{
 			return true;
 		}
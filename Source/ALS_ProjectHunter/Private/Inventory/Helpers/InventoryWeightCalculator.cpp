@@ -6,16 +6,7 @@
 
 int32 FInventoryWeightCalculator::GetItemCount(const UInventoryManager& Manager)
 {
-	int32 Count = 0;
-	for (UItemInstance* Item : Manager.Items)
-	{
-		if (Item)
-		{
-			++Count;
-		}
-	}
-
-	return Count;
+	return Manager.InventoryIndex.GetItemCount();
 }
 
 int32 FInventoryWeightCalculator::GetAvailableSlots(const UInventoryManager& Manager)
@@ -25,16 +16,7 @@ int32 FInventoryWeightCalculator::GetAvailableSlots(const UInventoryManager& Man
 
 float FInventoryWeightCalculator::GetTotalWeight(const UInventoryManager& Manager)
 {
-	float TotalWeight = 0.0f;
-	for (UItemInstance* Item : Manager.Items)
-	{
-		if (Item)
-		{
-			TotalWeight += Item->GetTotalWeight();
-		}
-	}
-
-	return TotalWeight;
+	return Manager.InventoryIndex.GetTotalWeight();
 }
 
 float FInventoryWeightCalculator::GetRemainingWeight(const UInventoryManager& Manager)
@@ -0,0 +1,277 @@
+#include "Inventory/Library/Structs/InventoryIndex.h"
+
+#include "Algo/BinarySearch.h"
+#include "Item/ItemInstance.h"
+
+namespace InventoryIndexPrivate
+{
+	template<typename KeyType>
+	void AddSortedSlot(TMap<KeyType, TArray<int32>>& Buckets, const KeyType& Key, const int32 SlotIndex)
+	{
+		TArray<int32>& Slots = Buckets.FindOrAdd(Key);
+		Slots.Insert(SlotIndex, Algo::LowerBound(Slots, SlotIndex));
+	}
+
+	template<typename KeyType>
+	void RemoveSortedSlot(TMap<KeyType, TArray<int32>>& Buckets, const KeyType& Key, const int32 SlotIndex)
+	{
+		TArray<int32>* Slots = Buckets.Find(Key);
+		if (!Slots)
+		{
+			return;
+		}
+
+		const int32 Position = Algo::BinarySearch(*Slots, SlotIndex);
+		if (Position != INDEX_NONE)
+		{
+			Slots->RemoveAt(Position, EAllowShrinking::No);
+		}
+
+		if (Slots->IsEmpty())
+		{
+			Buckets.Remove(Key);
+		}
+	}
+
+	template<typename KeyType>
+	bool BucketMatches(const TMap<KeyType, TArray<int32>>& Buckets, const KeyType& Key, const TArray<int32>& Expected)
+	{
+		const TArray<int32>* Slots = Buckets.Find(Key);
+		return Slots ? *Slots == Expected : Expected.IsEmpty();
+	}
+}
+
+void FInventoryIndex::Reset(const int32 SlotCount)
+{
+	Records.Reset();
+	Records.SetNum(SlotCount);
+	OccupiedSlots.Init(false, SlotCount);
+	SlotByItem.Reset();
+	UniqueIDCounts.Reset();
+	SlotsByBaseID.Reset();
+	SlotsByType.Reset();
+	SlotsByRarity.Reset();
+	ItemCount = 0;
+	TotalWeight = 0.0;
+}
+
+void FInventoryIndex::Rebuild(const TArray<UItemInstance*>& Slots, const int32 MaxSlots)
+{
+	Reset(FMath::Max(MaxSlots, Slots.Num()));
+
+	for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+	{
+		if (Slots[SlotIndex])
+		{
+			AddRecord(SlotIndex, Slots[SlotIndex]);
+		}
+	}
+}
+
+void FInventoryIndex::SetSlot(const int32 SlotIndex, UItemInstance* Item)
+{
+	if (SlotIndex < 0)
+	{
+		return;
+	}
+
+	if (Records.Num() <= SlotIndex)
+	{
+		Records.SetNum(SlotIndex + 1);
+		OccupiedSlots.SetNum(SlotIndex + 1, false);
+	}
+
+	if (OccupiedSlots[SlotIndex])
+	{
+		RemoveRecord(SlotIndex);
+	}
+
+	if (Item)
+	{
+		AddRecord(SlotIndex, Item);
+	}
+}
+
+void FInventoryIndex::RefreshItem(UItemInstance* Item)
+{
+	if (const int32* SlotIndex = SlotByItem.Find(Item))
+	{
+		SetSlot(*SlotIndex, Item);
+	}
+}
+
+void FInventoryIndex::AddRecord(const int32 SlotIndex, UItemInstance* Item)
+{
+	FSlotRecord& Record = Records[SlotIndex];
+	Record.Item = Item;
+	Record.Weight = Item->GetTotalWeight();
+	Record.Quantity = Item->Quantity;
+	Record.BaseItemID = Item->BaseItemHandle.RowName;
+	Record.ItemType = Item->GetItemType();
+	Record.Rarity = Item->Rarity;
+	Record.UniqueID = Item->UniqueID;
+
+	OccupiedSlots[SlotIndex] = true;
+	SlotByItem.Add(Item, SlotIndex);
+	if (Record.UniqueID.IsValid())
+	{
+		++UniqueIDCounts.FindOrAdd(Record.UniqueID);
+	}
+
+	InventoryIndexPrivate::AddSortedSlot(SlotsByBaseID, Record.BaseItemID, SlotIndex);
+	InventoryIndexPrivate::AddSortedSlot(SlotsByType, Record.ItemType, SlotIndex);
+	InventoryIndexPrivate::AddSortedSlot(SlotsByRarity, Record.Rarity, SlotIndex);
+
+	++ItemCount;
+	TotalWeight += Record.Weight;
+}
+
+void FInventoryIndex::RemoveRecord(const int32 SlotIndex)
+{
+	FSlotRecord& Record = Records[SlotIndex];
+
+	OccupiedSlots[SlotIndex] = false;
+
+	// An item only maps to the slot it was last recorded in.
+	const int32* MappedSlot = SlotByItem.Find(Record.Item);
+	if (MappedSlot && *MappedSlot == SlotIndex)
+	{
+		SlotByItem.Remove(Record.Item);
+	}
+
+	if (Record.UniqueID.IsValid())
+	{
+		int32& Count = UniqueIDCounts.FindChecked(Record.UniqueID);
+		if (--Count <= 0)
+		{
+			UniqueIDCounts.Remove(Record.UniqueID);
+		}
+	}
+
+	InventoryIndexPrivate::RemoveSortedSlot(SlotsByBaseID, Record.BaseItemID, SlotIndex);
+	InventoryIndexPrivate::RemoveSortedSlot(SlotsByType, Record.ItemType, SlotIndex);
+	InventoryIndexPrivate::RemoveSortedSlot(SlotsByRarity, Record.Rarity, SlotIndex);
+
+	--ItemCount;
+	TotalWeight -= Record.Weight;
+	Record = FSlotRecord{};
+}
+
+int32 FInventoryIndex::FindFirstEmptySlot(const int32 MaxSlots) const
+{
+	const int32 FirstFree = OccupiedSlots.Find(false);
+	if (FirstFree != INDEX_NONE)
+	{
+		return FirstFree < MaxSlots ? FirstFree : INDEX_NONE;
+	}
+
+	// Every tracked slot is full; the slot array grows lazily, so the next one is free.
+	return OccupiedSlots.Num() < MaxSlots ? OccupiedSlots.Num() : INDEX_NONE;
+}
+
+int32 FInventoryIndex::FindSlotForItem(const UItemInstance* Item) const
+{
+	const int32* SlotIndex = Item ? SlotByItem.Find(Item) : nullptr;
+	return SlotIndex ? *SlotIndex : INDEX_NONE;
+}
+
+int32 FInventoryIndex::GetTotalQuantityOfItem(const FName BaseItemID) const
+{
+	const TArray<int32>* Slots = FindSlotsByBaseID(BaseItemID);
+	if (!Slots)
+	{
+		return 0;
+	}
+
+	int32 TotalQuantity = 0;
+	for (const int32 SlotIndex : *Slots)
+	{
+		TotalQuantity += Records[SlotIndex].Quantity;
+	}
+
+	return TotalQuantity;
+}
+
+bool FInventoryIndex::Verify(const TArray<UItemInstance*>& Slots, const int32 MaxSlots, FString& OutError) const
+{
+	FInventoryIndex Expected;
+	Expected.Rebuild(Slots, MaxSlots);
+
+	if (Expected.ItemCount != ItemCount)
+	{
+		OutError = FString::Printf(TEXT("ItemCount %d, expected %d"), ItemCount, Expected.ItemCount);
+		return false;
+	}
+
+	if (!FMath::IsNearlyEqual(Expected.TotalWeight, TotalWeight, 0.01))
+	{
+		OutError = FString::Printf(TEXT("TotalWeight %.3f, expected %.3f"), TotalWeight, Expected.TotalWeight);
+		return false;
+	}
+
+	if (Expected.FindFirstEmptySlot(MaxSlots) != FindFirstEmptySlot(MaxSlots))
+	{
+		OutError = FString::Printf(TEXT("FirstEmptySlot %d, expected %d"),
+			FindFirstEmptySlot(MaxSlots), Expected.FindFirstEmptySlot(MaxSlots));
+		return false;
+	}
+
+	for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+	{
+		UItemInstance* Item = Slots[SlotIndex];
+		const bool bOccupied = OccupiedSlots.IsValidIndex(SlotIndex) && OccupiedSlots[SlotIndex];
+		if (bOccupied != (Item != nullptr) || (Item && Records[SlotIndex].Item != Item))
+		{
+			OutError = FString::Printf(TEXT("Slot %d holds %s but the index has %s"),
+				SlotIndex, *GetNameSafe(Item), bOccupied ? *GetNameSafe(Records[SlotIndex].Item) : TEXT("nothing"));
+			return false;
+		}
+
+		if (Item && Records[SlotIndex].Quantity != Item->Quantity)
+		{
+			OutError = FString::Printf(TEXT("Slot %d quantity %d, expected %d"),
+				SlotIndex, Records[SlotIndex].Quantity, Item->Quantity);
+			return false;
+		}
+	}
+
+	for (const TPair<FName, TArray<int32>>& Bucket : Expected.SlotsByBaseID)
+	{
+		if (!InventoryIndexPrivate::BucketMatches(SlotsByBaseID, Bucket.Key, Bucket.Value))
+		{
+			OutError = FString::Printf(TEXT("BaseID bucket %s is out of date"), *Bucket.Key.ToString());
+			return false;
+		}
+	}
+
+	for (const TPair<EItemType, TArray<int32>>& Bucket : Expected.SlotsByType)
+	{
+		if (!InventoryIndexPrivate::BucketMatches(SlotsByType, Bucket.Key, Bucket.Value))
+		{
+			OutError = FString::Printf(TEXT("Type bucket %s is out of date"), *UEnum::GetValueAsString(Bucket.Key));
+			return false;
+		}
+	}
+
+	for (const TPair<EItemRarity, TArray<int32>>& Bucket : Expected.SlotsByRarity)
+	{
+		if (!InventoryIndexPrivate::BucketMatches(SlotsByRarity, Bucket.Key, Bucket.Value))
+		{
+			OutError = FString::Printf(TEXT("Rarity bucket %s is out of date"), *UEnum::GetValueAsString(Bucket.Key));
+			return false;
+		}
+	}
+
+	// Same bucket count on both sides means no stale extra buckets survived.
+	if (Expected.SlotsByBaseID.Num() != SlotsByBaseID.Num()
+		|| Expected.SlotsByType.Num() != SlotsByType.Num()
+		|| Expected.SlotsByRarity.Num() != SlotsByRarity.Num()
+		|| Expected.SlotByItem.Num() != SlotByItem.Num()
+		|| Expected.UniqueIDCounts.Num() != UniqueIDCounts.Num())
+	{
+		OutError = TEXT("Index holds stale buckets");
+		return false;
+	}
+
+	return true;
+}
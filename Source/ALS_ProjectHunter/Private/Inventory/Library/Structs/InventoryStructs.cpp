@@ -0,0 +1,100 @@
+#include "Inventory/Library/Structs/InventoryStructs.h"
+
+#include "Inventory/Components/InventoryManager.h"
+#include "Item/ItemInstance.h"
+
+void FInventoryItemEntry::PreReplicatedRemove(const FInventoryItemList& InArraySerializer)
+{
+	if (InArraySerializer.OwnerComponent)
+	{
+		InArraySerializer.OwnerComponent->HandleReplicatedSlot(SlotIndex, nullptr);
+	}
+}
+
+void FInventoryItemEntry::PostReplicatedAdd(const FInventoryItemList& InArraySerializer)
+{
+	if (InArraySerializer.OwnerComponent)
+	{
+		InArraySerializer.OwnerComponent->HandleReplicatedSlot(SlotIndex, Item);
+	}
+}
+
+void FInventoryItemEntry::PostReplicatedChange(const FInventoryItemList& InArraySerializer)
+{
+	// Also fires when an item reference that arrived before its subobject resolves.
+	if (InArraySerializer.OwnerComponent)
+	{
+		InArraySerializer.OwnerComponent->HandleReplicatedSlot(SlotIndex, Item);
+	}
+}
+
+void FInventoryItemList::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+	if (OwnerComponent)
+	{
+		OwnerComponent->FlushReplicatedSlots();
+	}
+}
+
+void FInventoryItemList::SyncFromSlots(
+	const TArray<UItemInstance*>& Slots,
+	TArray<int32>& OutChangedSlots,
+	TArray<UItemInstance*>& OutAddedItems,
+	TArray<UItemInstance*>& OutRemovedItems)
+{
+	TBitArray<> SlotHasEntry(false, Slots.Num());
+
+	for (int32 EntryIndex = Entries.Num() - 1; EntryIndex >= 0; --EntryIndex)
+	{
+		FInventoryItemEntry& Entry = Entries[EntryIndex];
+		UItemInstance* SlotItem = Slots.IsValidIndex(Entry.SlotIndex) ? Slots[Entry.SlotIndex] : nullptr;
+
+		if (!SlotItem)
+		{
+			OutChangedSlots.Add(Entry.SlotIndex);
+			if (Entry.Item)
+			{
+				OutRemovedItems.Add(Entry.Item);
+			}
+			Entries.RemoveAtSwap(EntryIndex, EAllowShrinking::No);
+			MarkArrayDirty();
+			continue;
+		}
+
+		SlotHasEntry[Entry.SlotIndex] = true;
+		if (Entry.Item == SlotItem && Entry.Quantity == SlotItem->Quantity)
+		{
+			continue;
+		}
+
+		if (Entry.Item != SlotItem)
+		{
+			if (Entry.Item)
+			{
+				OutRemovedItems.Add(Entry.Item);
+			}
+			OutAddedItems.Add(SlotItem);
+			Entry.Item = SlotItem;
+		}
+		Entry.Quantity = SlotItem->Quantity;
+		OutChangedSlots.Add(Entry.SlotIndex);
+		MarkItemDirty(Entry);
+	}
+
+	for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+	{
+		UItemInstance* SlotItem = Slots[SlotIndex];
+		if (!SlotItem || SlotHasEntry[SlotIndex])
+		{
+			continue;
+		}
+
+		FInventoryItemEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.SlotIndex = SlotIndex;
+		Entry.Item = SlotItem;
+		Entry.Quantity = SlotItem->Quantity;
+		OutChangedSlots.Add(SlotIndex);
+		OutAddedItems.Add(SlotItem);
+		MarkItemDirty(Entry);
+	}
+}
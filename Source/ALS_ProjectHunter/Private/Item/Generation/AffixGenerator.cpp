@@ -1,5 +1,6 @@
 #include "Item/Generation/AffixGenerator.h"
 #include "Engine/DataTable.h"
+#include "Item/Generation/AffixSampler.h"
 #include "Item/Library/FunctionLibraries/ItemAffixSelectionFunctionLibrary.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogAffixGenerator, Log, All);
@@ -93,37 +94,12 @@ FPHItemStats FAffixGenerator::GenerateAffixes(
 
 	bool bHasRolledCorrupted = false;
 
-	TArray<FPHAttributeData*> PrefixSource;
-	if (BaseItem.PrefixAffixTable)
-	{
-		PrefixSource = ResolveConfiguredAffixTable(
-			BaseItem.PrefixAffixTable, EAffixes::AF_Prefix, BaseItem.ItemID);
-	}
-	else
-	{
-		LoadPrefixDataTable();
-		PrefixSource = CachedPrefixRows;
-	}
-
-	TArray<FPHAttributeData*> SuffixSource;
-	if (BaseItem.SuffixAffixTable)
-	{
-		SuffixSource = ResolveConfiguredAffixTable(
-			BaseItem.SuffixAffixTable, EAffixes::AF_Suffix, BaseItem.ItemID);
-	}
-	else
-	{
-		LoadSuffixDataTable();
-		SuffixSource = CachedSuffixRows;
-	}
-
 	Stats.Prefixes = RollAffixesWithCorruption(
-		PrefixSource,
+		BaseItem,
+		BaseItem.PrefixAffixTable,
 		EAffixes::AF_Prefix,
 		NumPrefixes,
 		ItemLevel,
-		BaseItem.ItemType,
-		BaseItem.ItemSubType,
 		CorruptionChance,
 		bForceOneCorrupted && !bHasRolledCorrupted,
 		bHasRolledCorrupted,
@@ -131,12 +107,11 @@ FPHItemStats FAffixGenerator::GenerateAffixes(
 	);
 
 	Stats.Suffixes = RollAffixesWithCorruption(
-		SuffixSource,
+		BaseItem,
+		BaseItem.SuffixAffixTable,
 		EAffixes::AF_Suffix,
 		NumSuffixes,
 		ItemLevel,
-		BaseItem.ItemType,
-		BaseItem.ItemSubType,
 		CorruptionChance,
 		bForceOneCorrupted && !bHasRolledCorrupted,
 		bHasRolledCorrupted,
@@ -167,6 +142,14 @@ UDataTable* FAffixGenerator::GetAffixDataTable(EAffixes AffixType) const
 	}
 }
 
+void FAffixGenerator::PreloadDefaultTables() const
+{
+	check(IsInGameThread());
+
+	LoadPrefixDataTable();
+	LoadSuffixDataTable();
+}
+
 UDataTable* FAffixGenerator::LoadEnchantDataTable() const
 {
 	if (CachedEnchantTable && IsValid(CachedEnchantTable))
@@ -205,37 +188,10 @@ bool FAffixGenerator::ApplyEnchant(
 	int32 Seed,
 	FPHItemStats& OutStats) const
 {
-	TArray<FPHAttributeData*> EnchantSource;
-	if (BaseItem.EnchantAffixTable)
-	{
-		EnchantSource = ResolveConfiguredAffixTable(
-			BaseItem.EnchantAffixTable, EAffixes::AF_Enchant, BaseItem.ItemID);
-	}
-	else
-	{
-		LoadEnchantDataTable();
-		EnchantSource = CachedEnchantRows;
-	}
+	const TSharedRef<const FAffixSampler> Sampler = FindAffixSampler(
+		BaseItem, BaseItem.EnchantAffixTable, EAffixes::AF_Enchant, ItemLevel, false);
 
-	if (EnchantSource.Num() == 0)
-	{
-		UE_LOG(LogAffixGenerator, Warning,
-			TEXT("AffixGenerator::ApplyEnchant: No enchant candidates configured or loaded."));
-		return false;
-	}
-
-	const TSet<FName> EmptyExcludedAffixes;
-	const TSet<FName> EmptyExcludedGroups;
-	TArray<FPHAttributeData*> Pool = UItemAffixSelectionFunctionLibrary::BuildAffixPoolByCorruption(
-		EnchantSource,
-		BaseItem.ItemType,
-		BaseItem.ItemSubType,
-		ItemLevel,
-		false,
-		EmptyExcludedAffixes,
-		EmptyExcludedGroups);
-
-	if (Pool.Num() == 0)
+	if (Sampler->IsEmpty())
 	{
 		UE_LOG(LogAffixGenerator, Warning,
 			TEXT("AffixGenerator::ApplyEnchant: No valid enchants for item type %d at level %d."),
@@ -243,8 +199,10 @@ bool FAffixGenerator::ApplyEnchant(
 		return false;
 	}
 
+	const TSet<FName> EmptyExcludedAffixes;
+	const TSet<FName> EmptyExcludedGroups;
 	FRandomStream RandStream(Seed);
-	const FPHAttributeData* Selected = UItemAffixSelectionFunctionLibrary::SelectWeightedAffix(Pool, RandStream);
+	const FPHAttributeData* Selected = Sampler->Select(RollVersion, RandStream, EmptyExcludedAffixes, EmptyExcludedGroups);
 	if (!Selected)
 	{
 		return false;
@@ -326,12 +284,11 @@ UDataTable* FAffixGenerator::LoadSuffixDataTable() const
 }
 
 TArray<FPHAttributeData> FAffixGenerator::RollAffixesWithCorruption(
-	const TArray<FPHAttributeData*>& SourceAffixes,
+	const FItemBase& BaseItem,
+	UDataTable* ConfiguredTable,
 	EAffixes AffixType,
 	int32 Count,
 	int32 ItemLevel,
-	EItemType ItemType,
-	EItemSubType ItemSubType,
 	float CorruptionChance,
 	bool bMustRollOneCorrupted,
 	bool& bOutHasRolledCorrupted,
@@ -347,37 +304,39 @@ TArray<FPHAttributeData> FAffixGenerator::RollAffixesWithCorruption(
 
 	RolledAffixes.Reserve(Count);
 
+	// Pools are filtered once per (table, type, subtype, level, corruption) and
+	// shared; exclusions for affixes already rolled are applied at pick time.
+	TSharedPtr<const FAffixSampler> NormalSampler;
+	TSharedPtr<const FAffixSampler> CorruptedSampler;
+
 	for (int32 i = 0; i < Count; ++i)
 	{
 		const bool bShouldBeCorrupted = bMustRollOneCorrupted
 			|| (CorruptionChance > 0.0f && RandStream.FRand() < CorruptionChance);
 
-		TArray<FPHAttributeData*> AvailableAffixes = UItemAffixSelectionFunctionLibrary::BuildAffixPoolByCorruption(
-			SourceAffixes, ItemType, ItemSubType, ItemLevel,
-			bShouldBeCorrupted, ExcludedAffixes, ExcludedGroups
-		);
-
-		if (AvailableAffixes.Num() == 0)
+		const FPHAttributeData* SelectedAffix = nullptr;
+		if (bShouldBeCorrupted)
 		{
-			if (bShouldBeCorrupted)
+			if (!CorruptedSampler.IsValid())
 			{
-				AvailableAffixes = UItemAffixSelectionFunctionLibrary::BuildAffixPoolByCorruption(
-					SourceAffixes, ItemType, ItemSubType, ItemLevel,
-					false, ExcludedAffixes, ExcludedGroups
-				);
+				CorruptedSampler = FindAffixSampler(BaseItem, ConfiguredTable, AffixType, ItemLevel, true);
 			}
+			SelectedAffix = CorruptedSampler->Select(RollVersion, RandStream, ExcludedAffixes, ExcludedGroups);
+		}
 
-			if (AvailableAffixes.Num() == 0)
+		if (!SelectedAffix)
+		{
+			if (!NormalSampler.IsValid())
 			{
-				UE_LOG(LogAffixGenerator, Warning, TEXT("AffixGenerator: No available affixes for type %d at level %d"),
-					static_cast<int32>(AffixType), ItemLevel);
-				continue;
+				NormalSampler = FindAffixSampler(BaseItem, ConfiguredTable, AffixType, ItemLevel, false);
 			}
+			SelectedAffix = NormalSampler->Select(RollVersion, RandStream, ExcludedAffixes, ExcludedGroups);
 		}
 
-		const FPHAttributeData* SelectedAffix = UItemAffixSelectionFunctionLibrary::SelectWeightedAffix(AvailableAffixes, RandStream);
 		if (!SelectedAffix)
 		{
+			UE_LOG(LogAffixGenerator, Warning, TEXT("AffixGenerator: No available affixes for type %d at level %d"),
+				static_cast<int32>(AffixType), ItemLevel);
 			continue;
 		}
 
@@ -399,6 +358,50 @@ TArray<FPHAttributeData> FAffixGenerator::RollAffixesWithCorruption(
 	return RolledAffixes;
 }
 
+TSharedRef<const FAffixSampler> FAffixGenerator::FindAffixSampler(
+	const FItemBase& BaseItem,
+	UDataTable* ConfiguredTable,
+	EAffixes AffixType,
+	int32 ItemLevel,
+	bool bCorrupted) const
+{
+	FAffixSamplerCache::FKey Key;
+	Key.PoolType = AffixType;
+	Key.ItemType = BaseItem.ItemType;
+	Key.ItemSubType = BaseItem.ItemSubType;
+	Key.ItemLevel = ItemLevel;
+	Key.bCorrupted = bCorrupted;
+
+	if (ConfiguredTable)
+	{
+		Key.Table = ConfiguredTable;
+		Key.bPoolTypeChecked = true;
+		return FAffixSamplerCache::FindOrBuild(Key, [ConfiguredTable, AffixType, &BaseItem]()
+		{
+			return ResolveConfiguredAffixTable(ConfiguredTable, AffixType, BaseItem.ItemID);
+		});
+	}
+
+	Key.Table = GetAffixDataTable(AffixType);
+	return FAffixSamplerCache::FindOrBuild(Key, [this, AffixType]()
+	{
+		switch (AffixType)
+		{
+			case EAffixes::AF_Prefix:
+				return CachedPrefixRows;
+
+			case EAffixes::AF_Suffix:
+				return CachedSuffixRows;
+
+			case EAffixes::AF_Enchant:
+				return CachedEnchantRows;
+
+			default:
+				return TArray<FPHAttributeData*>();
+		}
+	});
+}
+
 void FAffixGenerator::GetAffixCountByRarity(
 	EItemRarity Rarity,
 	int32& OutMinPrefixes,
@@ -0,0 +1,249 @@
+#include "Item/Generation/AffixSampler.h"
+#include "Async/Async.h"
+#include "Engine/DataTable.h"
+#include "Item/Library/FunctionLibraries/ItemAffixSelectionFunctionLibrary.h"
+#include "Item/Library/Structs/ItemAttributeStructs.h"
+#include "Misc/ScopeRWLock.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAffixSampler, Log, All);
+
+namespace AffixSamplerPrivate
+{
+	// Alias rejections before falling back to a masked scan. Exclusions only
+	// cover the handful of affixes already on the item, so this rarely trips.
+	constexpr int32 MaxRejections = 8;
+
+	FRWLock CacheLock;
+	TMap<FAffixSamplerCache::FKey, TSharedRef<const FAffixSampler>> Samplers;
+	TSet<TObjectKey<UDataTable>> WatchedTables;
+}
+
+void FAffixSampler::Build(TArray<FPHAttributeData*>&& InPool)
+{
+	Pool = MoveTemp(InPool);
+
+	const int32 Count = Pool.Num();
+	Probability.SetNumUninitialized(Count);
+	Alias.SetNumUninitialized(Count);
+
+	TotalWeight = 0;
+	for (const FPHAttributeData* Affix : Pool)
+	{
+		TotalWeight += FMath::Max(Affix->GetWeight(), 0);
+	}
+
+	if (Count == 0)
+	{
+		return;
+	}
+
+	// Zero total weight degrades to a uniform pick, matching SelectWeightedAffix.
+	if (TotalWeight <= 0)
+	{
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			Probability[Index] = 1.0f;
+			Alias[Index] = Index;
+		}
+		return;
+	}
+
+	// Vose: scale weights so the mean is 1, then pair each under-full column
+	// with an over-full one.
+	TArray<double> Scaled;
+	Scaled.SetNumUninitialized(Count);
+	TArray<int32> Small;
+	TArray<int32> Large;
+	Small.Reserve(Count);
+	Large.Reserve(Count);
+
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		Scaled[Index] = static_cast<double>(FMath::Max(Pool[Index]->GetWeight(), 0)) * Count / TotalWeight;
+		(Scaled[Index] < 1.0 ? Small : Large).Add(Index);
+	}
+
+	while (!Small.IsEmpty() && !Large.IsEmpty())
+	{
+		const int32 Less = Small.Pop(EAllowShrinking::No);
+		const int32 More = Large.Pop(EAllowShrinking::No);
+
+		Probability[Less] = static_cast<float>(Scaled[Less]);
+		Alias[Less] = More;
+
+		Scaled[More] = (Scaled[More] + Scaled[Less]) - 1.0;
+		(Scaled[More] < 1.0 ? Small : Large).Add(More);
+	}
+
+	// Leftovers are full columns (floating-point drift can leave either list).
+	for (const int32 Index : Large)
+	{
+		Probability[Index] = 1.0f;
+		Alias[Index] = Index;
+	}
+	for (const int32 Index : Small)
+	{
+		Probability[Index] = 1.0f;
+		Alias[Index] = Index;
+	}
+}
+
+const FPHAttributeData* FAffixSampler::Select(
+	const EAffixRollVersion Version,
+	FRandomStream& RandStream,
+	const TSet<FName>& ExcludeAffixes,
+	const TSet<FName>& ExcludeGroups) const
+{
+	if (Pool.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	if (Version == EAffixRollVersion::ARV_Cumulative)
+	{
+		// Same draws as the original per-roll rebuild + linear scan, so items
+		// rolled before the alias table existed regenerate identically.
+		return SelectFromMaskedPool(RandStream, ExcludeAffixes, ExcludeGroups);
+	}
+
+	const bool bHasExclusions = !ExcludeAffixes.IsEmpty() || !ExcludeGroups.IsEmpty();
+	for (int32 Attempt = 0; Attempt < AffixSamplerPrivate::MaxRejections; ++Attempt)
+	{
+		const int32 Column = RandStream.RandRange(0, Pool.Num() - 1);
+		const int32 Index = RandStream.FRand() < Probability[Column] ? Column : Alias[Column];
+		const FPHAttributeData* Candidate = Pool[Index];
+
+		if (!bHasExclusions || !IsExcluded(*Candidate, ExcludeAffixes, ExcludeGroups))
+		{
+			return Candidate;
+		}
+	}
+
+	return SelectFromMaskedPool(RandStream, ExcludeAffixes, ExcludeGroups);
+}
+
+bool FAffixSampler::IsExcluded(const FPHAttributeData& Affix, const TSet<FName>& ExcludeAffixes, const TSet<FName>& ExcludeGroups)
+{
+	if (ExcludeAffixes.Contains(Affix.AttributeName))
+	{
+		return true;
+	}
+
+	return Affix.AffixGroup != NAME_None && ExcludeGroups.Contains(Affix.AffixGroup);
+}
+
+const FPHAttributeData* FAffixSampler::SelectFromMaskedPool(
+	FRandomStream& RandStream,
+	const TSet<FName>& ExcludeAffixes,
+	const TSet<FName>& ExcludeGroups) const
+{
+	if (ExcludeAffixes.IsEmpty() && ExcludeGroups.IsEmpty())
+	{
+		return UItemAffixSelectionFunctionLibrary::SelectWeightedAffix(Pool, RandStream);
+	}
+
+	TArray<FPHAttributeData*> Masked;
+	Masked.Reserve(Pool.Num());
+	for (FPHAttributeData* Affix : Pool)
+	{
+		if (!IsExcluded(*Affix, ExcludeAffixes, ExcludeGroups))
+		{
+			Masked.Add(Affix);
+		}
+	}
+
+	return UItemAffixSelectionFunctionLibrary::SelectWeightedAffix(Masked, RandStream);
+}
+
+TSharedRef<const FAffixSampler> FAffixSamplerCache::FindOrBuild(
+	const FKey& Key,
+	TFunctionRef<TArray<FPHAttributeData*>()> GetSourceRows)
+{
+	using namespace AffixSamplerPrivate;
+
+	{
+		FReadScopeLock ReadLock(CacheLock);
+		if (const TSharedRef<const FAffixSampler>* Found = Samplers.Find(Key))
+		{
+			return *Found;
+		}
+	}
+
+	// Build outside the lock; if another thread raced us the first entry wins.
+	const TSet<FName> NoExclusions;
+	TArray<FPHAttributeData*> Filtered = UItemAffixSelectionFunctionLibrary::BuildAffixPoolByCorruption(
+		GetSourceRows(),
+		Key.ItemType,
+		Key.ItemSubType,
+		Key.ItemLevel,
+		Key.bCorrupted,
+		NoExclusions,
+		NoExclusions);
+
+	TSharedRef<FAffixSampler> NewSampler = MakeShared<FAffixSampler>();
+	NewSampler->Build(MoveTemp(Filtered));
+
+	UDataTable* Table = Key.Table.ResolveObjectPtr();
+	bool bWatchTable = false;
+
+	TSharedRef<const FAffixSampler> Result = NewSampler;
+	{
+		FWriteScopeLock WriteLock(CacheLock);
+		if (const TSharedRef<const FAffixSampler>* Found = Samplers.Find(Key))
+		{
+			return *Found;
+		}
+
+		Samplers.Add(Key, Result);
+
+		if (Table && !WatchedTables.Contains(Key.Table))
+		{
+			WatchedTables.Add(Key.Table);
+			bWatchTable = true;
+		}
+	}
+
+	// Samplers hold raw row pointers, so any table edit or reimport must drop them.
+	// Batched loot builds on ParallelFor workers; the delegate is game-thread only.
+	// Edits also happen on the game thread, so the marshalled bind lands before any.
+	if (bWatchTable)
+	{
+		if (IsInGameThread())
+		{
+			Table->OnDataTableChanged().AddStatic(&FAffixSamplerCache::Reset);
+		}
+		else
+		{
+			AsyncTask(ENamedThreads::GameThread, [WeakTable = TWeakObjectPtr<UDataTable>(Table)]()
+			{
+				if (UDataTable* WatchedTable = WeakTable.Get())
+				{
+					WatchedTable->OnDataTableChanged().AddStatic(&FAffixSamplerCache::Reset);
+				}
+			});
+		}
+	}
+
+	UE_LOG(LogAffixSampler, Verbose,
+		TEXT("AffixSampler: Built pool for table '%s' type %d subtype %d level %d corrupted %d (%d affixes)"),
+		*GetNameSafe(Table), static_cast<int32>(Key.ItemType), static_cast<int32>(Key.ItemSubType),
+		Key.ItemLevel, Key.bCorrupted ? 1 : 0, Result->Pool.Num());
+
+	return Result;
+}
+
+void FAffixSamplerCache::Reset()
+{
+	using namespace AffixSamplerPrivate;
+
+	FWriteScopeLock WriteLock(CacheLock);
+	Samplers.Reset();
+}
+
+int32 FAffixSamplerCache::Num()
+{
+	using namespace AffixSamplerPrivate;
+
+	FReadScopeLock ReadLock(CacheLock);
+	return Samplers.Num();
+}
@@ -4,6 +4,7 @@
 #include "Item/Generation/AffixGenerator.h"
 #include "Item/ItemInstance.h"
 #include "Item/Helpers/ItemStackingHelper.h"
+#include "Item/Library/Structs/CompactItemRecord.h"
 #include "Item/Library/ItemLog.h"
 
 bool FItemInitializationHelper::MigrateToCurrentVersion(UItemInstance& Item)
@@ -58,13 +59,40 @@ void FItemInitializationHelper::Initialize(UItemInstance& Item, FDataTableRowHan
 		false);
 }
 
-void FItemInitializationHelper::InitializeWithCorruption(UItemInstance& Item, FDataTableRowHandle InBaseItemHandle, int32 InItemLevel, EItemRarity InRarity, bool bGenerateAffixes, float CorruptionChance, bool bForceCorrupted)
+void FItemInitializationHelper::InitializeWithCorruption(UItemInstance& Item, FDataTableRowHandle InBaseItemHandle, int32 InItemLevel, EItemRarity InRarity, bool bGenerateAffixes, float CorruptionChance, bool bForceCorrupted, const FPHItemStats* PreRolledAffixes)
+{
+	InitializeForRollVersion(Item, InBaseItemHandle, InItemLevel, InRarity, bGenerateAffixes, CorruptionChance, bForceCorrupted,
+		FAffixGenerator::LatestRollVersion, PreRolledAffixes);
+}
+
+void FItemInitializationHelper::InitializeFromCompactRecord(UItemInstance& Item, const FCompactItemRecord& Record, const FPHItemStats* PreRolledAffixes)
+{
+	// Version 1 is the only layout so far. A later version that changes what
+	// these fields mean gets its own branch here; old records keep this one.
+	Item.UniqueID = Record.UniqueID;
+	Item.Seed = Record.Seed;
+
+	InitializeForRollVersion(Item, Record.BaseItemHandle, Record.ItemLevel, Record.Rarity, Record.bGenerateAffixes,
+		Record.CorruptionChance, Record.bForceCorrupted, Record.AffixRollVersion, PreRolledAffixes);
+
+	if (Record.Quantity > 1 && Item.IsStackable())
+	{
+		Item.Quantity = Record.Quantity;
+		FItemStackingHelper::UpdateTotalWeight(Item);
+	}
+}
+
+void FItemInitializationHelper::InitializeForRollVersion(UItemInstance& Item, FDataTableRowHandle InBaseItemHandle, int32 InItemLevel, EItemRarity InRarity, bool bGenerateAffixes, float CorruptionChance, bool bForceCorrupted, EAffixRollVersion RollVersion, const FPHItemStats* PreRolledAffixes)
 {
 	Item.BaseItemHandle = InBaseItemHandle;
 	Item.ItemLevel = FMath::Clamp(InItemLevel, 1, 100);
 	Item.Rarity = InRarity;
 	CorruptionChance = FMath::Clamp(CorruptionChance, 0.0f, 1.0f);
 
+	Item.GenerationCorruptionChance = CorruptionChance;
+	Item.bGenerationRolledAffixes = bGenerateAffixes;
+	Item.bGenerationForcedCorrupted = bForceCorrupted;
+
 	// Honor the SetSeed contract ("0 = generate random"): items initialized
 	// without an explicit seed (e.g. direct Blueprint Initialize calls) get a
 	// real random seed HERE so the stored value reproduces this exact item.
@@ -103,14 +131,24 @@ void FItemInitializationHelper::InitializeWithCorruption(UItemInstance& Item, FD
 
 			if (bGenerateAffixes && Item.Rarity > EItemRarity::IR_GradeF)
 			{
-				FAffixGenerator Generator;
-				Item.Stats = Generator.GenerateAffixes(
-					*Base,
-					Item.ItemLevel,
-					Item.Rarity,
-					Item.Seed,
-					CorruptionChance,
-					bForceCorrupted);
+				if (PreRolledAffixes && PreRolledAffixes->bAffixesGenerated)
+				{
+					Item.AffixRollVersion = RollVersion;
+					Item.Stats = *PreRolledAffixes;
+				}
+				else
+				{
+					FAffixGenerator Generator;
+					Generator.RollVersion = RollVersion;
+					Item.AffixRollVersion = Generator.RollVersion;
+					Item.Stats = Generator.GenerateAffixes(
+						*Base,
+						Item.ItemLevel,
+						Item.Rarity,
+						Item.Seed,
+						CorruptionChance,
+						bForceCorrupted);
+				}
 
 				CalculateCorruptionState(Item);
 			}
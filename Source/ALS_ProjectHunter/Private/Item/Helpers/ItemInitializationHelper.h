@@ -3,9 +3,12 @@
 #include "CoreMinimal.h"
 
 class UItemInstance;
+enum class EAffixRollVersion : uint8;
 enum class EItemRarity : uint8;
+struct FCompactItemRecord;
 struct FDataTableRowHandle;
 struct FPHAttributeData;
+struct FPHItemStats;
 
 class ALS_PROJECTHUNTER_API FItemInitializationHelper
 {
@@ -13,9 +16,13 @@ public:
 	static bool MigrateToCurrentVersion(UItemInstance& Item);
 	static void PostLoadInit(UItemInstance& Item);
 	static void Initialize(UItemInstance& Item, FDataTableRowHandle InBaseItemHandle, int32 InItemLevel, EItemRarity InRarity, bool bGenerateAffixes);
-	static void InitializeWithCorruption(UItemInstance& Item, FDataTableRowHandle InBaseItemHandle, int32 InItemLevel, EItemRarity InRarity, bool bGenerateAffixes, float CorruptionChance, bool bForceCorrupted);
+	static void InitializeWithCorruption(UItemInstance& Item, FDataTableRowHandle InBaseItemHandle, int32 InItemLevel, EItemRarity InRarity, bool bGenerateAffixes, float CorruptionChance, bool bForceCorrupted, const FPHItemStats* PreRolledAffixes = nullptr);
+	static void InitializeFromCompactRecord(UItemInstance& Item, const FCompactItemRecord& Record, const FPHItemStats* PreRolledAffixes);
 	static void CalculateCorruptionState(UItemInstance& Item);
 	static TArray<FPHAttributeData> GetCorruptedAffixes(const UItemInstance& Item);
 	static void PrepareForSave(UItemInstance& Item);
 	static void PostLoadInitialize(UItemInstance& Item);
+
+private:
+	static void InitializeForRollVersion(UItemInstance& Item, FDataTableRowHandle InBaseItemHandle, int32 InItemLevel, EItemRarity InRarity, bool bGenerateAffixes, float CorruptionChance, bool bForceCorrupted, EAffixRollVersion RollVersion, const FPHItemStats* PreRolledAffixes);
 };
@@ -2,6 +2,7 @@
 
 #include "Engine/Texture2D.h"
 #include "Item/Helpers/ItemInitializationHelper.h"
+#include "Item/Library/Structs/CompactItemRecord.h"
 #include "Item/ItemNameBuilder.h"
 #include "Item/Helpers/ItemStackingHelper.h"
 #include "Item/Helpers/ItemUsageHelper.h"
@@ -50,14 +51,28 @@ void UItemInstance::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLif
 	DOREPLIFETIME(UItemInstance, ValueModifier);
 }
 
+void UItemInstance::PostRepNotifies()
+{
+	Super::PostRepNotifies();
+
+	// Replicated fields land without going through the mutators below.
+	BumpRevision();
+}
+
 bool UItemInstance::MigrateToCurrentVersion()
 {
-	return FItemInitializationHelper::MigrateToCurrentVersion(*this);
+	const bool bMigrated = FItemInitializationHelper::MigrateToCurrentVersion(*this);
+	if (bMigrated)
+	{
+		BumpRevision();
+	}
+	return bMigrated;
 }
 
 void UItemInstance::PostLoadInit()
 {
 	FItemInitializationHelper::PostLoadInit(*this);
+	BumpRevision();
 }
 
 float UItemInstance::GetReinforcementMultiplier() const
@@ -68,16 +83,36 @@ float UItemInstance::GetReinforcementMultiplier() const
 void UItemInstance::Initialize(FDataTableRowHandle InBaseItemHandle, int32 InItemLevel, EItemRarity InRarity, bool bGenerateAffixes)
 {
 	FItemInitializationHelper::Initialize(*this, InBaseItemHandle, InItemLevel, InRarity, bGenerateAffixes);
+	BumpRevision();
+	GenerationRevision = Revision;
 }
 
 void UItemInstance::InitializeWithCorruption(FDataTableRowHandle InBaseItemHandle, int32 InItemLevel, EItemRarity InRarity, bool bGenerateAffixes, float CorruptionChance, bool bForceCorrupted)
 {
 	FItemInitializationHelper::InitializeWithCorruption(*this, InBaseItemHandle, InItemLevel, InRarity, bGenerateAffixes, CorruptionChance, bForceCorrupted);
+	BumpRevision();
+	GenerationRevision = Revision;
+}
+
+void UItemInstance::InitializeWithPreRolledAffixes(FDataTableRowHandle InBaseItemHandle, int32 InItemLevel, EItemRarity InRarity, const FPHItemStats& PreRolledAffixes)
+{
+	// The roll inputs behind PreRolledAffixes are unknown here, so the item stays unfoldable.
+	FItemInitializationHelper::InitializeWithCorruption(*this, InBaseItemHandle, InItemLevel, InRarity, true, 0.0f, false, &PreRolledAffixes);
+	BumpRevision();
+	GenerationRevision = INDEX_NONE;
+}
+
+void UItemInstance::InitializeFromCompactRecord(const FCompactItemRecord& Record, const FPHItemStats* PreRolledAffixes)
+{
+	FItemInitializationHelper::InitializeFromCompactRecord(*this, Record, PreRolledAffixes);
+	BumpRevision();
+	GenerationRevision = Revision;
 }
 
 void UItemInstance::CalculateCorruptionState()
 {
 	FItemInitializationHelper::CalculateCorruptionState(*this);
+	BumpRevision();
 }
 
 TArray<FPHAttributeData> UItemInstance::GetCorruptedAffixes() const
@@ -93,6 +128,7 @@ FText UItemInstance::GetDisplayName()
 void UItemInstance::RegenerateDisplayName()
 {
 	FItemNameBuilder::RegenerateDisplayName(*this);
+	BumpRevision();
 }
 
 FText UItemInstance::GenerateRareName() const
@@ -178,6 +214,7 @@ bool UItemInstance::bIsTwoHanded() const
 void UItemInstance::UpdateTotalWeight()
 {
 	FItemStackingHelper::UpdateTotalWeight(*this);
+	BumpRevision();
 }
 
 void UItemInstance::ApplyAffixesToCharacter(UAbilitySystemComponent* ASC)
@@ -192,7 +229,9 @@ void UItemInstance::RemoveAffixesFromCharacter(UAbilitySystemComponent* ASC)
 
 bool UItemInstance::UseConsumable(AActor* Target)
 {
-	return FItemUsageHelper::UseConsumable(*this, Target);
+	const bool bUsed = FItemUsageHelper::UseConsumable(*this, Target);
+	BumpRevision();
+	return bUsed;
 }
 
 bool UItemInstance::CanUseConsumable() const
@@ -207,7 +246,9 @@ float UItemInstance::GetCooldownProgress() const
 
 bool UItemInstance::ReduceUses(int32 Amount)
 {
-	return FItemUsageHelper::ReduceUses(*this, Amount);
+	const bool bConsumed = FItemUsageHelper::ReduceUses(*this, Amount);
+	BumpRevision();
+	return bConsumed;
 }
 
 bool UItemInstance::ApplyConsumableEffects(AActor* Target)
@@ -269,6 +310,7 @@ void UItemInstance::RefreshIdentificationState()
 	}
 
 	bIdentified = !HasUnidentifiedAffixes();
+	BumpRevision();
 }
 
 bool UItemInstance::IsIdentified() const
@@ -336,17 +378,23 @@ bool UItemInstance::IsConsumed() const
 
 int32 UItemInstance::AddToStack(int32 Amount)
 {
-	return FItemStackingHelper::AddToStack(*this, Amount);
+	const int32 Overflow = FItemStackingHelper::AddToStack(*this, Amount);
+	BumpRevision();
+	return Overflow;
 }
 
 int32 UItemInstance::RemoveFromStack(int32 Amount)
 {
-	return FItemStackingHelper::RemoveFromStack(*this, Amount);
+	const int32 Removed = FItemStackingHelper::RemoveFromStack(*this, Amount);
+	BumpRevision();
+	return Removed;
 }
 
 UItemInstance* UItemInstance::SplitStack(int32 Amount)
 {
-	return FItemStackingHelper::SplitStack(*this, Amount);
+	UItemInstance* NewInstance = FItemStackingHelper::SplitStack(*this, Amount);
+	BumpRevision();
+	return NewInstance;
 }
 
 int32 UItemInstance::GetRemainingStackSpace() const
@@ -402,6 +450,7 @@ void UItemInstance::InvalidateBaseCache()
 {
 	bCacheDirty = true;
 	CachedBaseData = nullptr;
+	BumpRevision();
 }
 
 void UItemInstance::PrepareForSave()
@@ -412,4 +461,5 @@ void UItemInstance::PrepareForSave()
 void UItemInstance::PostLoadInitialize()
 {
 	FItemInitializationHelper::PostLoadInitialize(*this);
+	BumpRevision();
 }
@@ -0,0 +1,77 @@
+#include "Item/Library/Structs/CompactItemRecord.h"
+
+#include "Item/Generation/AffixGenerator.h"
+#include "Item/ItemInstance.h"
+#include "Item/Library/ItemLog.h"
+#include "Item/Library/Structs/ItemStructs.h"
+
+FCompactItemRecord FCompactItemRecord::Make(const FDataTableRowHandle& InBaseItemHandle, int32 InItemLevel,
+	EItemRarity InRarity, int32 InSeed, bool bInGenerateAffixes, float InCorruptionChance, bool bInForceCorrupted,
+	int32 InQuantity)
+{
+	FCompactItemRecord Record;
+	Record.BaseItemHandle = InBaseItemHandle;
+	Record.UniqueID = FGuid::NewGuid();
+	Record.Seed = InSeed != 0 ? InSeed : FMath::RandRange(1, MAX_int32 - 1);
+	Record.CorruptionChance = FMath::Clamp(InCorruptionChance, 0.0f, 1.0f);
+	Record.Quantity = FMath::Max(1, InQuantity);
+	Record.ItemLevel = static_cast<uint8>(FMath::Clamp(InItemLevel, 1, 100));
+	Record.Rarity = InRarity;
+	Record.AffixRollVersion = FAffixGenerator::LatestRollVersion;
+	Record.RecordVersion = CurrentVersion;
+	Record.bGenerateAffixes = bInGenerateAffixes;
+	Record.bForceCorrupted = bInForceCorrupted;
+	return Record;
+}
+
+bool FCompactItemRecord::TryMakeFromItem(const UItemInstance& Item, FCompactItemRecord& OutRecord)
+{
+	// Subclasses may carry state the record cannot express.
+	if (Item.GetClass() != UItemInstance::StaticClass() || !Item.IsUnmodifiedSinceGeneration())
+	{
+		return false;
+	}
+
+	OutRecord.BaseItemHandle = Item.BaseItemHandle;
+	OutRecord.UniqueID = Item.UniqueID;
+	OutRecord.Seed = Item.Seed;
+	OutRecord.CorruptionChance = Item.GenerationCorruptionChance;
+	OutRecord.Quantity = Item.Quantity;
+	OutRecord.ItemLevel = static_cast<uint8>(FMath::Clamp(Item.ItemLevel, 1, 100));
+	OutRecord.Rarity = Item.Rarity;
+	OutRecord.AffixRollVersion = Item.AffixRollVersion;
+	OutRecord.RecordVersion = CurrentVersion;
+	OutRecord.bGenerateAffixes = Item.bGenerationRolledAffixes;
+	OutRecord.bForceCorrupted = Item.bGenerationForcedCorrupted;
+	return OutRecord.IsValid();
+}
+
+const FItemBase* FCompactItemRecord::GetBaseData() const
+{
+	return BaseItemHandle.GetRow<FItemBase>(TEXT("FCompactItemRecord::GetBaseData"));
+}
+
+UItemInstance* FCompactItemRecord::Materialize(UObject* Outer, const FPHItemStats* PreRolledAffixes) const
+{
+	if (!IsValid())
+	{
+		return nullptr;
+	}
+
+	if (RecordVersion > CurrentVersion)
+	{
+		UE_LOG(LogItemInstance, Warning,
+			TEXT("FCompactItemRecord::Materialize: Record '%s' has version %d, newer than %d - skipping"),
+			*UniqueID.ToString(), RecordVersion, CurrentVersion);
+		return nullptr;
+	}
+
+	UItemInstance* Item = NewObject<UItemInstance>(Outer);
+	if (!Item)
+	{
+		return nullptr;
+	}
+
+	Item->InitializeFromCompactRecord(*this, PreRolledAffixes);
+	return Item;
+}
@@ -89,7 +89,31 @@ bool UItemTooltipFunctionLibrary::BuildItemTooltipData(UItemInstance* Item, FIte
 
 FItemTooltipData UItemTooltipFunctionLibrary::GetItemTooltipData(UItemInstance* Item)
 {
-	FItemTooltipData TooltipData;
-	BuildItemTooltipData(Item, TooltipData);
+	const TSharedPtr<const FItemTooltipData> CachedData = GetCachedItemTooltipData(Item);
+	return CachedData.IsValid() ? *CachedData : FItemTooltipData();
+}
+
+TSharedPtr<const FItemTooltipData> UItemTooltipFunctionLibrary::GetCachedItemTooltipData(UItemInstance* Item)
+{
+	if (!Item)
+	{
+		return nullptr;
+	}
+
+	if (Item->CachedTooltipData.IsValid() && Item->CachedTooltipRevision == Item->GetRevision())
+	{
+		return Item->CachedTooltipData;
+	}
+
+	TSharedRef<FItemTooltipData> TooltipData = MakeShared<FItemTooltipData>();
+	if (!BuildItemTooltipData(Item, TooltipData.Get()))
+	{
+		Item->CachedTooltipData.Reset();
+		Item->CachedTooltipRevision = INDEX_NONE;
+		return nullptr;
+	}
+
+	Item->CachedTooltipData = TooltipData;
+	Item->CachedTooltipRevision = Item->GetRevision();
 	return TooltipData;
 }
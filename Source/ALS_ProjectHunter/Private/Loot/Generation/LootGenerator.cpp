@@ -2,6 +2,7 @@
 #include "Loot/Library/FunctionLibraries/LootRarityFunctionLibrary.h"
 #include "Loot/Library/FunctionLibraries/LootSelectionFunctionLibrary.h"
 #include "Item/ItemInstance.h"
+#include "Item/Generation/AffixGenerator.h"
 #include "Engine/DataTable.h"
 
 DEFINE_LOG_CATEGORY(LogLootGenerator);
@@ -12,23 +13,43 @@ FLootResultBatch FLootGenerator::GenerateLoot(
 	int32 Seed,
 	UObject* Outer) const
 {
-	FLootResultBatch Batch;
+	FLootRollBatch Rolls;
+	RollLoot(LootTable, Settings, Seed, Rolls);
+
+	FLootResultBatch Batch = CreateItemsFromRolls(Rolls, Outer);
+
+	UE_LOG(LogLootGenerator, Verbose, TEXT("GenerateLoot: Generated %d items from %d entries (seed: %d)"),
+		Batch.Results.Num(), Rolls.Entries.Num(), Batch.Seed);
+
+	return Batch;
+}
+
+void FLootGenerator::RollLoot(
+	const FLootTable& LootTable,
+	const FLootDropSettings& Settings,
+	int32 Seed,
+	FLootRollBatch& OutRolls) const
+{
+	OutRolls.Entries.Reset();
+	OutRolls.Rolls.Reset();
+	OutRolls.Seed = 0;
 
 	if (LootTable.Entries.Num() == 0)
 	{
 		UE_LOG(LogLootGenerator, Warning, TEXT("GenerateLoot: Empty loot table"));
-		return Batch;
+		return;
 	}
 
 	FRandomStream RandStream(Seed != 0 ? Seed : FMath::Rand());
-	Batch.Seed = RandStream.GetCurrentSeed();
+	OutRolls.Seed = RandStream.GetCurrentSeed();
 
-	const TArray<FLootEntry> FilteredEntries = ULootSelectionFunctionLibrary::FilterEntries(LootTable.Entries, Settings);
+	OutRolls.Entries = ULootSelectionFunctionLibrary::FilterEntries(LootTable.Entries, Settings);
+	const TArray<FLootEntry>& FilteredEntries = OutRolls.Entries;
 
 	if (FilteredEntries.Num() == 0)
 	{
 		UE_LOG(LogLootGenerator, Warning, TEXT("GenerateLoot: No valid entries after filtering"));
-		return Batch;
+		return;
 	}
 
 	const int32 DropCount = ULootSelectionFunctionLibrary::CalculateDropCount(LootTable, Settings, RandStream);
@@ -58,11 +79,78 @@ FLootResultBatch FLootGenerator::GenerateLoot(
 			break;
 	}
 
+	OutRolls.Rolls.Reserve(SelectedIndices.Num());
+
 	for (int32 Index : SelectedIndices)
 	{
-		if (FilteredEntries.IsValidIndex(Index))
+		if (FilteredEntries.IsValidIndex(Index) && FilteredEntries[Index].IsValid())
+		{
+			FLootItemRoll& Roll = OutRolls.Rolls.Add_GetRef(RollItem(FilteredEntries[Index], Settings, RandStream));
+			Roll.EntryIndex = Index;
+		}
+	}
+}
+
+void FLootGenerator::PreRollAffixes(FLootRollBatch& Rolls, const FAffixGenerator& AffixGenerator) const
+{
+	for (FLootItemRoll& Roll : Rolls.Rolls)
+	{
+		if (!Rolls.Entries.IsValidIndex(Roll.EntryIndex))
+		{
+			continue;
+		}
+
+		// Mirrors the affix branch of item initialization. Anything skipped here is
+		// simply rolled there instead, from the same seed.
+		const FLootEntry& Entry = Rolls.Entries[Roll.EntryIndex];
+		if (!Entry.bGenerateAffixes || !Entry.ItemRowHandle.DataTable || Roll.ItemSeed == 0)
+		{
+			continue;
+		}
+
+		const FItemBase* Base = Entry.ItemRowHandle.GetRow<FItemBase>(TEXT("FLootGenerator::PreRollAffixes"));
+		if (!Base)
+		{
+			continue;
+		}
+
+		const EItemRarity Rarity = Roll.Rarity == EItemRarity::IR_None ? Base->ItemRarity : Roll.Rarity;
+		if (Rarity <= EItemRarity::IR_GradeF)
 		{
-			FLootResult Result = CreateItemFromEntry(FilteredEntries[Index], Settings, RandStream, Outer);
+			continue;
+		}
+
+		switch (Base->ItemType)
+		{
+		case EItemType::IT_Weapon:
+		case EItemType::IT_Armor:
+		case EItemType::IT_Accessory:
+			Roll.PreRolledAffixes = AffixGenerator.GenerateAffixes(
+				*Base,
+				FMath::Clamp(Roll.ItemLevel, 1, 100),
+				Rarity,
+				Roll.ItemSeed,
+				FMath::Clamp(Roll.CorruptionChance, 0.0f, 1.0f),
+				Roll.bForceCorrupted);
+			break;
+
+		default:
+			break;
+		}
+	}
+}
+
+FLootResultBatch FLootGenerator::CreateItemsFromRolls(const FLootRollBatch& Rolls, UObject* Outer) const
+{
+	FLootResultBatch Batch;
+	Batch.Seed = Rolls.Seed;
+	Batch.Results.Reserve(Rolls.Rolls.Num());
+
+	for (const FLootItemRoll& Roll : Rolls.Rolls)
+	{
+		if (Rolls.Entries.IsValidIndex(Roll.EntryIndex))
+		{
+			FLootResult Result = CreateItemFromRoll(Rolls.Entries[Roll.EntryIndex], Roll, Outer);
 			if (Result.IsValid())
 			{
 				Batch.AddResult(Result);
@@ -70,9 +158,6 @@ FLootResultBatch FLootGenerator::GenerateLoot(
 		}
 	}
 
-	UE_LOG(LogLootGenerator, Verbose, TEXT("GenerateLoot: Generated %d items from %d entries (seed: %d)"),
-		Batch.Results.Num(), FilteredEntries.Num(), Batch.Seed);
-
 	return Batch;
 }
 
@@ -124,53 +209,120 @@ FLootResult FLootGenerator::CreateItemFromEntry(
 	FRandomStream& RandStream,
 	UObject* Outer) const
 {
-	FLootResult Result;
-
 	if (!Entry.IsValid())
 	{
-		return Result;
+		return FLootResult();
 	}
 
-	const int32 Quantity = RollQuantity(Entry, Settings, RandStream);
-	const int32 ItemLevel = RollItemLevel(Entry, Settings, RandStream);
-	const EItemRarity Rarity = DetermineRarity(Entry, Settings, RandStream);
-	const int32 ItemSeed = RandStream.RandHelper(INT32_MAX);
+	return CreateItemFromRoll(Entry, RollItem(Entry, Settings, RandStream), Outer);
+}
 
-	float FinalCorruptionChance = 0.0f;
-	bool bForceCorrupted = false;
+FLootItemRoll FLootGenerator::RollItem(
+	const FLootEntry& Entry,
+	const FLootDropSettings& Settings,
+	FRandomStream& RandStream) const
+{
+	FLootItemRoll Roll;
+	Roll.Quantity = RollQuantity(Entry, Settings, RandStream);
+	Roll.ItemLevel = RollItemLevel(Entry, Settings, RandStream);
+	Roll.Rarity = DetermineRarity(Entry, Settings, RandStream);
+	Roll.ItemSeed = RandStream.RandHelper(INT32_MAX);
 
 	if (Entry.bCanBeCorrupted)
 	{
-		FinalCorruptionChance = Entry.CorruptionChancePerAffix;
-		FinalCorruptionChance *= Settings.CorruptionChanceMultiplier;
-		bForceCorrupted = Entry.bForceOneCorruptedAffix || Settings.bForceCorruptedDrops;
+		Roll.CorruptionChance = Entry.CorruptionChancePerAffix;
+		Roll.CorruptionChance *= Settings.CorruptionChanceMultiplier;
+		Roll.bForceCorrupted = Entry.bForceOneCorruptedAffix || Settings.bForceCorruptedDrops;
 	}
 
-	UItemInstance* Item = CreateItemInstance(
-		Entry,
-		ItemLevel,
-		Rarity,
-		FinalCorruptionChance,
-		bForceCorrupted,
-		ItemSeed,
-		Outer
-	);
-
-	if (Item)
+	return Roll;
+}
+
+FLootResult FLootGenerator::CreateItemFromRoll(
+	const FLootEntry& Entry,
+	const FLootItemRoll& Roll,
+	UObject* Outer) const
+{
+	FLootResult Result;
+
+	UItemInstance* Item = nullptr;
+
+	if (Entry.ItemRowHandle.DataTable)
 	{
-		Result.Item = Item;
-		Result.Quantity = Quantity;
-		Result.bWasCorrupted = Item->IsCorrupted();
+		// Same path a deferred drop takes when it is picked up, so both give the same item.
+		const FPHItemStats* PreRolledAffixes = Roll.PreRolledAffixes.bAffixesGenerated ? &Roll.PreRolledAffixes : nullptr;
+		Item = MakeRecordFromRoll(Entry, Roll).Materialize(Outer, PreRolledAffixes);
+	}
+	else
+	{
+		if (Entry.ItemClass.Get())
+		{
+			UE_LOG(LogLootGenerator, Warning, TEXT("Class-based item creation not yet implemented"));
+		}
 
-		if (Quantity > 1 && Item->IsStackable())
+		Item = NewObject<UItemInstance>(Outer);
+		if (Item)
 		{
-			Item->SetQuantity(Quantity);
+			Item->SetSeed(Roll.ItemSeed);
 		}
 	}
 
+	if (!Item)
+	{
+		UE_LOG(LogLootGenerator, Error, TEXT("Failed to create ItemInstance"));
+		return Result;
+	}
+
+	Result.Item = Item;
+	Result.Quantity = Roll.Quantity;
+	Result.bWasCorrupted = Item->IsCorrupted();
+
 	return Result;
 }
 
+FLootResultBatch FLootGenerator::CreateRecordsFromRolls(const FLootRollBatch& Rolls, UObject* Outer) const
+{
+	FLootResultBatch Batch;
+	Batch.Seed = Rolls.Seed;
+	Batch.Results.Reserve(Rolls.Rolls.Num());
+
+	for (const FLootItemRoll& Roll : Rolls.Rolls)
+	{
+		if (!Rolls.Entries.IsValidIndex(Roll.EntryIndex))
+		{
+			continue;
+		}
+
+		const FLootEntry& Entry = Rolls.Entries[Roll.EntryIndex];
+		if (!Entry.ItemRowHandle.DataTable)
+		{
+			Batch.AddResult(CreateItemFromRoll(Entry, Roll, Outer));
+			continue;
+		}
+
+		FLootResult Result;
+		Result.Record = MakeRecordFromRoll(Entry, Roll);
+		Result.Quantity = Roll.Quantity;
+		Result.bWasCorrupted = Roll.bForceCorrupted;
+		Batch.AddResult(Result);
+	}
+
+	return Batch;
+}
+
+FCompactItemRecord FLootGenerator::MakeRecordFromRoll(const FLootEntry& Entry, const FLootItemRoll& Roll)
+{
+	return FCompactItemRecord::Make(
+		Entry.ItemRowHandle,
+		Roll.ItemLevel,
+		Roll.Rarity,
+		Roll.ItemSeed,
+		Entry.bGenerateAffixes,
+		Roll.CorruptionChance,
+		Roll.bForceCorrupted,
+		Roll.Quantity);
+}
+
 int32 FLootGenerator::RollQuantity(
 	const FLootEntry& Entry,
 	const FLootDropSettings& Settings,
@@ -249,41 +401,3 @@ EItemRarity FLootGenerator::DetermineRarity(
 
 	return BaseRarity;
 }
-
-UItemInstance* FLootGenerator::CreateItemInstance(
-	const FLootEntry& Entry,
-	int32 ItemLevel,
-	EItemRarity Rarity,
-	float CorruptionChance,
-	bool bForceCorrupted,
-	int32 Seed,
-	UObject* Outer) const
-{
-	UItemInstance* Item = NewObject<UItemInstance>(Outer);
-
-	if (!Item)
-	{
-		UE_LOG(LogLootGenerator, Error, TEXT("Failed to create ItemInstance"));
-		return nullptr;
-	}
-
-	Item->SetSeed(Seed);
-
-	if (Entry.ItemRowHandle.DataTable)
-	{
-		Item->InitializeWithCorruption(
-			Entry.ItemRowHandle,
-			ItemLevel,
-			Rarity,
-			Entry.bGenerateAffixes,
-			CorruptionChance,
-			bForceCorrupted
-		);
-	}
-	else if (Entry.ItemClass.Get())
-	{
-		UE_LOG(LogLootGenerator, Warning, TEXT("Class-based item creation not yet implemented"));
-	}
-
-	return Item;
-}
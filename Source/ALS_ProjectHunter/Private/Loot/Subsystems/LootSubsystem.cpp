@@ -4,9 +4,12 @@
 #include "Loot/Library/FunctionLibraries/LootSpawnFunctionLibrary.h"
 #include "Tower/Subsystems/GroundItemSubsystem.h"
 #include "Item/ItemInstance.h"
+#include "Item/Generation/AffixGenerator.h"
+#include "Async/ParallelFor.h"
 #include "Engine/AssetManager.h"
 #include "Engine/DataTable.h"
 #include "Engine/World.h"
+#include "Serialization/ArchiveCountMem.h"
 
 DEFINE_LOG_CATEGORY(LogLootSubsystem);
 
@@ -72,19 +75,8 @@ FLootResultBatch ULootSubsystem::GenerateLoot(const FLootRequest& Request)
 		return Batch;
 	}
 
-	FLootDropSettings FinalSettings = ULootSettingsFunctionLibrary::BuildSettingsFromRequest(Source, Request);
-	FinalSettings = ULootSettingsFunctionLibrary::ApplyGlobalDropChanceMultiplier(FinalSettings, GlobalDropChanceMultiplier);
-	FinalSettings = ULootSettingsFunctionLibrary::ApplyPlayerDropModifiers(FinalSettings, Request.PlayerLuck, Request.PlayerMagicFind);
-
-	int32 Seed = Request.Seed;
-	if (Seed == 0)
-	{
-		Seed = GetTypeHash(Request.SourceID) ^ FDateTime::Now().GetTicks();
-		if (Seed == 0)
-		{
-			Seed = 1;
-		}
-	}
+	const FLootDropSettings FinalSettings = BuildFinalSettings(Source, Request);
+	const int32 Seed = ResolveRequestSeed(Request);
 
 	Batch = LootGenerator.GenerateLoot(*LootTable, FinalSettings, Seed, this);
 	Batch.SourceID = Request.SourceID;
@@ -97,6 +89,236 @@ FLootResultBatch ULootSubsystem::GenerateLoot(const FLootRequest& Request)
 	return Batch;
 }
 
+TArray<FLootResultBatch> ULootSubsystem::GenerateLootBatch(const TArray<FLootRequest>& Requests, FLootBatchStats& OutStats)
+{
+	return GenerateLootBatchInternal(Requests, nullptr, OutStats);
+}
+
+TArray<FLootResultBatch> ULootSubsystem::GenerateAndSpawnLootBatch(
+	const TArray<FLootRequest>& Requests,
+	const TArray<FLootSpawnSettings>& SpawnSettings,
+	FLootBatchStats& OutStats)
+{
+	if (SpawnSettings.Num() != 1 && SpawnSettings.Num() != Requests.Num())
+	{
+		PH_LOG_WARNING(LogLootSubsystem, "GenerateAndSpawnLootBatch got %d spawn settings for %d requests; loot will be generated but not spawned.",
+			SpawnSettings.Num(), Requests.Num());
+		return GenerateLootBatchInternal(Requests, nullptr, OutStats);
+	}
+
+	return GenerateLootBatchInternal(Requests, &SpawnSettings, OutStats);
+}
+
+TArray<FLootResultBatch> ULootSubsystem::GenerateLootBatchInternal(
+	const TArray<FLootRequest>& Requests,
+	const TArray<FLootSpawnSettings>* SpawnSettings,
+	FLootBatchStats& OutStats)
+{
+	OutStats = FLootBatchStats();
+	OutStats.RequestCount = Requests.Num();
+
+	TArray<FLootResultBatch> Results;
+	Results.SetNum(Requests.Num());
+
+	if (Requests.Num() == 0)
+	{
+		return Results;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Stage 1 (game thread): resolve each distinct source once. Table rows are
+	// owned by cached DataTables and stay valid for the rest of the call.
+	struct FBatchJob
+	{
+		int32 RequestIndex = INDEX_NONE;
+		const FLootTable* LootTable = nullptr;
+		FLootDropSettings Settings;
+		int32 Seed = 0;
+		FLootRollBatch Rolls;
+	};
+
+	struct FResolvedSource
+	{
+		FLootSourceEntry Source;
+		const FLootTable* LootTable = nullptr;
+	};
+
+	TMap<FName, FResolvedSource> ResolvedSources;
+	TArray<FBatchJob> Jobs;
+	Jobs.Reserve(Requests.Num());
+
+	for (int32 RequestIndex = 0; RequestIndex < Requests.Num(); ++RequestIndex)
+	{
+		const FLootRequest& Request = Requests[RequestIndex];
+		Results[RequestIndex].SourceID = Request.SourceID;
+
+		const FResolvedSource* Resolved = ResolvedSources.Find(Request.SourceID);
+		if (!Resolved)
+		{
+			FResolvedSource& NewSource = ResolvedSources.Add(Request.SourceID);
+
+			if (!GetSourceEntry(Request.SourceID, NewSource.Source))
+			{
+				PH_LOG_WARNING(LogLootSubsystem, "GenerateLootBatch failed: SourceID=%s was not found in the registry.", *Request.SourceID.ToString());
+			}
+			else if (!NewSource.Source.IsValid())
+			{
+				PH_LOG_WARNING(LogLootSubsystem, "GenerateLootBatch rejected SourceID=%s because the source entry was disabled or invalid.", *Request.SourceID.ToString());
+			}
+			else
+			{
+				NewSource.LootTable = GetLootTableFromSource(NewSource.Source, NewSource.Source.LootTableRowName);
+				if (!NewSource.LootTable)
+				{
+					PH_LOG_WARNING(LogLootSubsystem, "GenerateLootBatch failed: Could not load the loot table for SourceID=%s.", *Request.SourceID.ToString());
+				}
+			}
+
+			Resolved = &NewSource;
+		}
+
+		if (!Resolved->LootTable)
+		{
+			continue;
+		}
+
+		FBatchJob& Job = Jobs.AddDefaulted_GetRef();
+		Job.RequestIndex = RequestIndex;
+		Job.LootTable = Resolved->LootTable;
+		Job.Settings = BuildFinalSettings(Resolved->Source, Request);
+		Job.Seed = ResolveRequestSeed(Request, static_cast<uint32>(RequestIndex));
+	}
+
+	OutStats.SourceCount = ResolvedSources.Num();
+
+	// Affix tables must be resolved here; the workers below may not load assets.
+	FAffixGenerator AffixGenerator;
+	AffixGenerator.PreloadDefaultTables();
+
+	const double ResolveEndTime = FPlatformTime::Seconds();
+	OutStats.ResolveMs = static_cast<float>((ResolveEndTime - StartTime) * 1000.0);
+
+	// Stage 2 (workers): every roll is pure data driven by the request seed, so the
+	// outcome matches GenerateLoot for the same seed regardless of scheduling.
+	// Deferred drops roll their affixes when they are materialized, not here.
+	const bool bDeferItems = SpawnSettings && bDeferBatchItemCreation;
+
+	ParallelFor(Jobs.Num(), [this, &Jobs, &AffixGenerator, bDeferItems](int32 JobIndex)
+	{
+		FBatchJob& Job = Jobs[JobIndex];
+		LootGenerator.RollLoot(*Job.LootTable, Job.Settings, Job.Seed, Job.Rolls);
+		if (!bDeferItems)
+		{
+			LootGenerator.PreRollAffixes(Job.Rolls, AffixGenerator);
+		}
+	}, Jobs.Num() < BatchParallelThreshold ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	const double RollEndTime = FPlatformTime::Seconds();
+	OutStats.RollMs = static_cast<float>((RollEndTime - ResolveEndTime) * 1000.0);
+
+	// Stage 3 (game thread): UObject creation, or compact records for deferred drops.
+	for (FBatchJob& Job : Jobs)
+	{
+		const FLootRequest& Request = Requests[Job.RequestIndex];
+		FLootResultBatch& Batch = Results[Job.RequestIndex];
+
+		Batch = bDeferItems
+			? LootGenerator.CreateRecordsFromRolls(Job.Rolls, this)
+			: LootGenerator.CreateItemsFromRolls(Job.Rolls, this);
+		Batch.SourceID = Request.SourceID;
+		OutStats.ItemCount += Batch.Results.Num();
+
+		OnLootGenerated.Broadcast(Batch, Request.SourceID);
+	}
+
+	const double CreateEndTime = FPlatformTime::Seconds();
+	OutStats.CreateMs = static_cast<float>((CreateEndTime - RollEndTime) * 1000.0);
+
+	// Stage 4 (game thread): one ground item commit for the whole batch.
+	if (SpawnSettings && OutStats.ItemCount > 0)
+	{
+		if (!EnsureGroundItemSubsystem())
+		{
+			PH_LOG_ERROR(LogLootSubsystem, "GenerateAndSpawnLootBatch failed to spawn: GroundItemSubsystem was unavailable.");
+		}
+		else
+		{
+			TArray<UItemInstance*> SpawnItems;
+			TArray<FVector> SpawnLocations;
+			TArray<FCompactItemRecord> SpawnRecords;
+			TArray<FVector> SpawnRecordLocations;
+			SpawnItems.Reserve(bDeferItems ? 0 : OutStats.ItemCount);
+			SpawnLocations.Reserve(bDeferItems ? 0 : OutStats.ItemCount);
+			SpawnRecords.Reserve(bDeferItems ? OutStats.ItemCount : 0);
+			SpawnRecordLocations.Reserve(bDeferItems ? OutStats.ItemCount : 0);
+
+			for (const FBatchJob& Job : Jobs)
+			{
+				const FLootSpawnSettings& Settings = SpawnSettings->Num() == 1 ? (*SpawnSettings)[0] : (*SpawnSettings)[Job.RequestIndex];
+				// Mix in the request so requests sharing one settings entry don't stack their drops.
+				FRandomStream SpreadRandom(HashCombineFast(GetTypeHash(Settings.SpawnLocation),
+					HashCombineFast(GetTypeHash(Job.Seed), GetTypeHash(Job.RequestIndex))));
+
+				for (const FLootResult& Result : Results[Job.RequestIndex].Results)
+				{
+					if (!Result.IsValid())
+					{
+						continue;
+					}
+
+					const FVector SpawnLocation = ULootSpawnFunctionLibrary::GetSpawnLocationFromSettings(Settings, SpreadRandom);
+					if (Result.Item)
+					{
+						SpawnItems.Add(Result.Item);
+						SpawnLocations.Add(SpawnLocation);
+					}
+					else
+					{
+						SpawnRecords.Add(Result.Record);
+						SpawnRecordLocations.Add(SpawnLocation);
+					}
+				}
+			}
+
+			TArray<int32> GroundItemIDs;
+			OutStats.SpawnedCount = CachedGroundItemSubsystem->AddItemsToGround(SpawnItems, SpawnLocations, GroundItemIDs);
+
+			for (int32 Index = 0; Index < SpawnItems.Num(); ++Index)
+			{
+				if (GroundItemIDs[Index] != INDEX_NONE)
+				{
+					OnLootSpawned.Broadcast(SpawnItems[Index], SpawnLocations[Index], GroundItemIDs[Index]);
+				}
+			}
+
+			if (SpawnRecords.Num() > 0)
+			{
+				OutStats.SpawnedCount += CachedGroundItemSubsystem->AddRecordsToGround(SpawnRecords, SpawnRecordLocations, GroundItemIDs);
+
+				for (int32 Index = 0; Index < SpawnRecords.Num(); ++Index)
+				{
+					if (GroundItemIDs[Index] != INDEX_NONE)
+					{
+						OnLootSpawned.Broadcast(nullptr, SpawnRecordLocations[Index], GroundItemIDs[Index]);
+					}
+				}
+			}
+		}
+	}
+
+	const double EndTime = FPlatformTime::Seconds();
+	OutStats.SpawnMs = static_cast<float>((EndTime - CreateEndTime) * 1000.0);
+	OutStats.TotalMs = static_cast<float>((EndTime - StartTime) * 1000.0);
+
+	UE_LOG(LogLootSubsystem, Verbose,
+		TEXT("GenerateLootBatch: %d requests, %d sources, %d items, %d spawned | resolve %.2fms roll %.2fms create %.2fms spawn %.2fms total %.2fms"),
+		OutStats.RequestCount, OutStats.SourceCount, OutStats.ItemCount, OutStats.SpawnedCount,
+		OutStats.ResolveMs, OutStats.RollMs, OutStats.CreateMs, OutStats.SpawnMs, OutStats.TotalMs);
+
+	return Results;
+}
+
 bool ULootSubsystem::SpawnLootAtLocation(const FLootResultBatch& Batch, FVector Location, float SpreadRadius)
 {
 	if (!EnsureGroundItemSubsystem())
@@ -121,7 +343,9 @@ bool ULootSubsystem::SpawnLootAtLocation(const FLootResultBatch& Batch, FVector
 
 		const FVector SpawnLocation = ULootSpawnFunctionLibrary::GetCircularScatterLocation(Location, SpreadRadius, SpreadRandom);
 
-		int32 GroundItemID = CachedGroundItemSubsystem->AddItemToGround(Result.Item, SpawnLocation);
+		const int32 GroundItemID = Result.Item
+			? CachedGroundItemSubsystem->AddItemToGround(Result.Item, SpawnLocation)
+			: CachedGroundItemSubsystem->AddRecordToGround(Result.Record, SpawnLocation);
 
 		if (GroundItemID != INDEX_NONE)
 		{
@@ -156,7 +380,9 @@ bool ULootSubsystem::SpawnLootWithSettings(const FLootResultBatch& Batch, const
 
 		const FVector SpawnLocation = ULootSpawnFunctionLibrary::GetSpawnLocationFromSettings(SpawnSettings, SpreadRandom);
 
-		const int32 GroundItemID = CachedGroundItemSubsystem->AddItemToGround(Result.Item, SpawnLocation);
+		const int32 GroundItemID = Result.Item
+			? CachedGroundItemSubsystem->AddItemToGround(Result.Item, SpawnLocation)
+			: CachedGroundItemSubsystem->AddRecordToGround(Result.Record, SpawnLocation);
 		if (GroundItemID != INDEX_NONE)
 		{
 			OnLootSpawned.Broadcast(Result.Item, SpawnLocation, GroundItemID);
@@ -178,6 +404,108 @@ FLootResultBatch ULootSubsystem::GenerateAndSpawnLoot(const FLootRequest& Reques
 	return Batch;
 }
 
+FCompactItemMemoryBenchmarkResult ULootSubsystem::BenchmarkCompactItemMemory(FDataTableRowHandle BaseItemHandle,
+	int32 ItemCount, EItemRarity Rarity)
+{
+	FCompactItemMemoryBenchmarkResult Result;
+	Result.ItemCount = FMath::Max(1, ItemCount);
+
+	constexpr float CorruptionChance = 0.1f;
+
+	// Fixed seeds so runs are comparable across builds.
+	double StartSeconds = FPlatformTime::Seconds();
+	TArray<UItemInstance*> Items;
+	Items.Reserve(Result.ItemCount);
+	for (int32 Index = 0; Index < Result.ItemCount; ++Index)
+	{
+		UItemInstance* Item = NewObject<UItemInstance>(GetTransientPackage());
+		Item->SetSeed(0xC0A7 + Index);
+		Item->InitializeWithCorruption(BaseItemHandle, 1 + Index % 100, Rarity, true, CorruptionChance, false);
+		Items.Add(Item);
+	}
+	Result.CreateItemsMilliseconds = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+
+	for (UItemInstance* Item : Items)
+	{
+		FArchiveCountMem Counter(Item);
+		Result.ItemInstanceBytes += static_cast<int64>(Counter.GetMax());
+	}
+
+	// What a deferred loot batch pays instead of the loop above.
+	StartSeconds = FPlatformTime::Seconds();
+	TArray<FCompactItemRecord> RolledRecords;
+	RolledRecords.Reserve(Result.ItemCount);
+	for (int32 Index = 0; Index < Result.ItemCount; ++Index)
+	{
+		RolledRecords.Add(FCompactItemRecord::Make(BaseItemHandle, 1 + Index % 100, Rarity, 0xC0A7 + Index, true, CorruptionChance, false));
+	}
+	Result.CreateRecordsMilliseconds = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+
+	TArray<FCompactItemRecord> Records;
+	Records.Reserve(Result.ItemCount);
+	for (const UItemInstance* Item : Items)
+	{
+		FCompactItemRecord Record;
+		if (FCompactItemRecord::TryMakeFromItem(*Item, Record))
+		{
+			Records.Add(Record);
+		}
+	}
+	Result.RecordCount = Records.Num();
+	Result.CompactRecordBytes = static_cast<int64>(Records.GetAllocatedSize());
+	Result.bResultsMatch = Result.RecordCount == Result.ItemCount;
+
+	StartSeconds = FPlatformTime::Seconds();
+	TArray<UItemInstance*> Materialized;
+	Materialized.Reserve(Records.Num());
+	for (const FCompactItemRecord& Record : Records)
+	{
+		Materialized.Add(Record.Materialize(GetTransientPackage()));
+	}
+	Result.MaterializeMilliseconds = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+
+	// Affix UIDs are fresh per instance, so compare what the rolls decided.
+	const auto AffixesMatch = [](const TArray<FPHAttributeData>& A, const TArray<FPHAttributeData>& B)
+	{
+		if (A.Num() != B.Num())
+		{
+			return false;
+		}
+		for (int32 Index = 0; Index < A.Num(); ++Index)
+		{
+			if (A[Index].AttributeName != B[Index].AttributeName || A[Index].RolledStatValue != B[Index].RolledStatValue)
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+
+	for (int32 Index = 0; Result.bResultsMatch && Index < Materialized.Num(); ++Index)
+	{
+		const UItemInstance* Original = Items[Index];
+		const UItemInstance* Restored = Materialized[Index];
+		Result.bResultsMatch = Restored
+			&& Restored->UniqueID == Original->UniqueID
+			&& Restored->Rarity == Original->Rarity
+			&& Restored->TotalCorruptionPoints == Original->TotalCorruptionPoints
+			&& AffixesMatch(Restored->Stats.Implicits, Original->Stats.Implicits)
+			&& AffixesMatch(Restored->Stats.Prefixes, Original->Stats.Prefixes)
+			&& AffixesMatch(Restored->Stats.Suffixes, Original->Stats.Suffixes);
+	}
+
+	UE_LOG(LogLootSubsystem, Log,
+		TEXT("BenchmarkCompactItemMemory: %d items (%d as records) | bytes objects %lld (%.0f/item) records %lld (%.0f/item) | "
+		     "create items %.2fms records %.2fms | materialize %.2fms | match=%s"),
+		Result.ItemCount, Result.RecordCount,
+		Result.ItemInstanceBytes, static_cast<double>(Result.ItemInstanceBytes) / Result.ItemCount,
+		Result.CompactRecordBytes, static_cast<double>(Result.CompactRecordBytes) / FMath::Max(1, Result.RecordCount),
+		Result.CreateItemsMilliseconds, Result.CreateRecordsMilliseconds, Result.MaterializeMilliseconds,
+		Result.bResultsMatch ? TEXT("true") : TEXT("false"));
+
+	return Result;
+}
+
 void ULootSubsystem::LoadRegistry()
 {
 	if (LootSourceRegistryPath.IsNull())
@@ -407,6 +735,32 @@ void ULootSubsystem::ClearLootTableCache()
 	UE_LOG(LogLootSubsystem, Log, TEXT("Loot table cache cleared"));
 }
 
+int32 ULootSubsystem::ResolveRequestSeed(const FLootRequest& Request, uint32 Salt)
+{
+	if (Request.Seed != 0)
+	{
+		return Request.Seed;
+	}
+
+	// Requests in one batch share a timestamp, so the salt keeps identical sources
+	// from rolling identical loot.
+	int32 Seed = (GetTypeHash(Request.SourceID) + Salt * 2654435761u) ^ FDateTime::Now().GetTicks();
+	if (Seed == 0)
+	{
+		Seed = 1;
+	}
+
+	return Seed;
+}
+
+FLootDropSettings ULootSubsystem::BuildFinalSettings(const FLootSourceEntry& Source, const FLootRequest& Request) const
+{
+	FLootDropSettings FinalSettings = ULootSettingsFunctionLibrary::BuildSettingsFromRequest(Source, Request);
+	FinalSettings = ULootSettingsFunctionLibrary::ApplyGlobalDropChanceMultiplier(FinalSettings, GlobalDropChanceMultiplier);
+	FinalSettings = ULootSettingsFunctionLibrary::ApplyPlayerDropModifiers(FinalSettings, Request.PlayerLuck, Request.PlayerMagicFind);
+	return FinalSettings;
+}
+
 bool ULootSubsystem::EnsureGroundItemSubsystem()
 {
 	if (CachedGroundItemSubsystem && IsValid(CachedGroundItemSubsystem))
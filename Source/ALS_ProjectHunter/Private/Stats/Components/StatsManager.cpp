@@ -1,5 +1,6 @@
 #include "Stats/Components/StatsManager.h"
 #include "Core/Logging/ProjectHunterLogMacros.h"
+#include "AbilitySystem/HunterAttributeRegistry.h"
 #include "AbilitySystem/HunterAttributeSet.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemInterface.h"
@@ -91,6 +92,16 @@ void UStatsManager::LogWarningOnce(const FString& Key, const FString& Message) c
 	PH_LOG_WARNING(LogStatsManager, "%s", *Message);
 }
 
+void UStatsManager::LogWarningOnce(FName Context, const UClass* Class, FName Name, TFunctionRef<FString()> MakeMessage) const
+{
+	bool bAlreadyEmitted = false;
+	EmittedWarningIds.Add(MakeTuple(Context, TObjectKey<UClass>(Class), Name), &bAlreadyEmitted);
+	if (!bAlreadyEmitted)
+	{
+		PH_LOG_WARNING(LogStatsManager, "%s", *MakeMessage());
+	}
+}
+
 void UStatsManager::LogAbilitySystemState(const TCHAR* Context, UAbilitySystemComponent* ASC, const UAttributeSet* LiveAttributeSet) const
 {
 	PH_LOG(LogStatsManager, Log,
@@ -146,12 +157,7 @@ void UStatsManager::HandleEquipmentChanged(EEquipmentSlot Slot, UItemInstance* N
 
 bool UStatsManager::HasEquipmentStatsApplied(UItemInstance* Item) const
 {
-	if (!Item)
-	{
-		return false;
-	}
-
-	return ActiveEquipmentEffects.Contains(Item->UniqueID);
+	return FEquipmentStatsApplier::HasEquipmentStatsApplied(*this, Item);
 }
 
 bool UStatsManager::ApplyGameplayEffectToSelf(TSubclassOf<UGameplayEffect> EffectClass, float Level)
@@ -289,6 +295,11 @@ void UStatsManager::GatherStatDefinitions(TArray<FStatInitializationEntry>& OutD
 	FStatsAttributeResolver::GatherStatDefinitions(*this, OutDefinitions);
 }
 
+FStatsAttributeResolveBenchmarkResult UStatsManager::BenchmarkAttributeResolve(int32 Iterations, int32 DefinitionIterations) const
+{
+	return FStatsAttributeResolver::BenchmarkResolve(*this, Iterations, DefinitionIterations);
+}
+
 bool UStatsManager::TryGetStatValueForInitialization(const UBaseStatsData* InStatsData, const TMap<FName, float>& StatsMap, FName StatName, float& OutValue) const
 {
 	return FStatsInitializer::TryGetStatValueForInitialization(*this, InStatsData, StatsMap, StatName, OutValue);
@@ -455,238 +466,18 @@ float UStatsManager::GetAttributeByType(EHunterAttribute AttributeType) const
 		return 0.f;
 	}
 
-	switch (AttributeType)
+	// EHunterAttribute mirrors the attribute property names; the registry maps it
+	// to the attribute once, so this is an index and an offset read.
+	const FGameplayAttribute& Attribute = FHunterAttributeRegistry::Get().GetAttribute(AttributeType);
+	if (!Attribute.IsValid())
 	{
-	case EHunterAttribute::Strength:             return Attrs->GetStrength();
-	case EHunterAttribute::Intelligence:         return Attrs->GetIntelligence();
-	case EHunterAttribute::Dexterity:            return Attrs->GetDexterity();
-	case EHunterAttribute::Endurance:            return Attrs->GetEndurance();
-	case EHunterAttribute::Affliction:           return Attrs->GetAffliction();
-	case EHunterAttribute::Luck:                 return Attrs->GetLuck();
-	case EHunterAttribute::Covenant:             return Attrs->GetCovenant();
-	case EHunterAttribute::PlayerLevel:          return Attrs->GetPlayerLevel();
-	case EHunterAttribute::GlobalXPGain:         return Attrs->GetGlobalXPGain();
-	case EHunterAttribute::LocalXPGain:          return Attrs->GetLocalXPGain();
-	case EHunterAttribute::XPGainMultiplier:     return Attrs->GetXPGainMultiplier();
-	case EHunterAttribute::XPPenalty:            return Attrs->GetXPPenalty();
-	case EHunterAttribute::Health:                      return Attrs->GetHealth();
-	case EHunterAttribute::MaxHealth:                   return Attrs->GetMaxHealth();
-	case EHunterAttribute::MaxEffectiveHealth:          return Attrs->GetMaxEffectiveHealth();
-	case EHunterAttribute::HealthRegenRate:             return Attrs->GetHealthRegenRate();
-	case EHunterAttribute::MaxHealthRegenRate:          return Attrs->GetMaxHealthRegenRate();
-	case EHunterAttribute::HealthRegenAmount:           return Attrs->GetHealthRegenAmount();
-	case EHunterAttribute::MaxHealthRegenAmount:        return Attrs->GetMaxHealthRegenAmount();
-	case EHunterAttribute::ReservedHealth:              return Attrs->GetReservedHealth();
-	case EHunterAttribute::MaxReservedHealth:           return Attrs->GetMaxReservedHealth();
-	case EHunterAttribute::FlatReservedHealth:          return Attrs->GetFlatReservedHealth();
-	case EHunterAttribute::PercentageReservedHealth:    return Attrs->GetPercentageReservedHealth();
-	case EHunterAttribute::Stamina:                     return Attrs->GetStamina();
-	case EHunterAttribute::MaxStamina:                  return Attrs->GetMaxStamina();
-	case EHunterAttribute::MaxEffectiveStamina:         return Attrs->GetMaxEffectiveStamina();
-	case EHunterAttribute::StaminaRegenRate:            return Attrs->GetStaminaRegenRate();
-	case EHunterAttribute::StaminaDegenRate:            return Attrs->GetStaminaDegenRate();
-	case EHunterAttribute::MaxStaminaRegenRate:         return Attrs->GetMaxStaminaRegenRate();
-	case EHunterAttribute::StaminaRegenAmount:          return Attrs->GetStaminaRegenAmount();
-	case EHunterAttribute::StaminaDegenAmount:          return Attrs->GetStaminaDegenAmount();
-	case EHunterAttribute::MaxStaminaRegenAmount:       return Attrs->GetMaxStaminaRegenAmount();
-	case EHunterAttribute::ReservedStamina:             return Attrs->GetReservedStamina();
-	case EHunterAttribute::MaxReservedStamina:          return Attrs->GetMaxReservedStamina();
-	case EHunterAttribute::FlatReservedStamina:         return Attrs->GetFlatReservedStamina();
-	case EHunterAttribute::PercentageReservedStamina:   return Attrs->GetPercentageReservedStamina();
-	case EHunterAttribute::Mana:                        return Attrs->GetMana();
-	case EHunterAttribute::MaxMana:                     return Attrs->GetMaxMana();
-	case EHunterAttribute::MaxEffectiveMana:            return Attrs->GetMaxEffectiveMana();
-	case EHunterAttribute::ManaRegenRate:               return Attrs->GetManaRegenRate();
-	case EHunterAttribute::MaxManaRegenRate:            return Attrs->GetMaxManaRegenRate();
-	case EHunterAttribute::ManaRegenAmount:             return Attrs->GetManaRegenAmount();
-	case EHunterAttribute::MaxManaRegenAmount:          return Attrs->GetMaxManaRegenAmount();
-	case EHunterAttribute::ReservedMana:                return Attrs->GetReservedMana();
-	case EHunterAttribute::MaxReservedMana:             return Attrs->GetMaxReservedMana();
-	case EHunterAttribute::FlatReservedMana:            return Attrs->GetFlatReservedMana();
-	case EHunterAttribute::PercentageReservedMana:      return Attrs->GetPercentageReservedMana();
-	case EHunterAttribute::ArcaneShield:                    return Attrs->GetArcaneShield();
-	case EHunterAttribute::MaxArcaneShield:                 return Attrs->GetMaxArcaneShield();
-	case EHunterAttribute::MaxEffectiveArcaneShield:        return Attrs->GetMaxEffectiveArcaneShield();
-	case EHunterAttribute::ArcaneShieldRegenRate:           return Attrs->GetArcaneShieldRegenRate();
-	case EHunterAttribute::MaxArcaneShieldRegenRate:        return Attrs->GetMaxArcaneShieldRegenRate();
-	case EHunterAttribute::ArcaneShieldRegenAmount:         return Attrs->GetArcaneShieldRegenAmount();
-	case EHunterAttribute::MaxArcaneShieldRegenAmount:      return Attrs->GetMaxArcaneShieldRegenAmount();
-	case EHunterAttribute::ReservedArcaneShield:            return Attrs->GetReservedArcaneShield();
-	case EHunterAttribute::MaxReservedArcaneShield:         return Attrs->GetMaxReservedArcaneShield();
-	case EHunterAttribute::FlatReservedArcaneShield:        return Attrs->GetFlatReservedArcaneShield();
-	case EHunterAttribute::PercentageReservedArcaneShield:  return Attrs->GetPercentageReservedArcaneShield();
-	case EHunterAttribute::GlobalDamages:           return Attrs->GetGlobalDamages();
-	case EHunterAttribute::GlobalMoreDamage:        return Attrs->GetGlobalMoreDamage();
-	case EHunterAttribute::DamageBonusWhileAtFullHP: return Attrs->GetDamageBonusWhileAtFullHP();
-	case EHunterAttribute::DamageBonusWhileAtLowHP:  return Attrs->GetDamageBonusWhileAtLowHP();
-	case EHunterAttribute::MinPhysicalDamage:       return Attrs->GetMinPhysicalDamage();
-	case EHunterAttribute::MaxPhysicalDamage:       return Attrs->GetMaxPhysicalDamage();
-	case EHunterAttribute::PhysicalFlatDamage:      return Attrs->GetPhysicalFlatDamage();
-	case EHunterAttribute::PhysicalPercentDamage:   return Attrs->GetPhysicalPercentDamage();
-	case EHunterAttribute::PhysicalMoreDamage:      return Attrs->GetPhysicalMoreDamage();
-	case EHunterAttribute::MinFireDamage:           return Attrs->GetMinFireDamage();
-	case EHunterAttribute::MaxFireDamage:           return Attrs->GetMaxFireDamage();
-	case EHunterAttribute::FireFlatDamage:          return Attrs->GetFireFlatDamage();
-	case EHunterAttribute::FirePercentDamage:       return Attrs->GetFirePercentDamage();
-	case EHunterAttribute::FireMoreDamage:          return Attrs->GetFireMoreDamage();
-	case EHunterAttribute::MinIceDamage:            return Attrs->GetMinIceDamage();
-	case EHunterAttribute::MaxIceDamage:            return Attrs->GetMaxIceDamage();
-	case EHunterAttribute::IceFlatDamage:           return Attrs->GetIceFlatDamage();
-	case EHunterAttribute::IcePercentDamage:        return Attrs->GetIcePercentDamage();
-	case EHunterAttribute::IceMoreDamage:           return Attrs->GetIceMoreDamage();
-	case EHunterAttribute::MinLightningDamage:      return Attrs->GetMinLightningDamage();
-	case EHunterAttribute::MaxLightningDamage:      return Attrs->GetMaxLightningDamage();
-	case EHunterAttribute::LightningFlatDamage:     return Attrs->GetLightningFlatDamage();
-	case EHunterAttribute::LightningPercentDamage:  return Attrs->GetLightningPercentDamage();
-	case EHunterAttribute::LightningMoreDamage:     return Attrs->GetLightningMoreDamage();
-	case EHunterAttribute::MinLightDamage:          return Attrs->GetMinLightDamage();
-	case EHunterAttribute::MaxLightDamage:          return Attrs->GetMaxLightDamage();
-	case EHunterAttribute::LightFlatDamage:         return Attrs->GetLightFlatDamage();
-	case EHunterAttribute::LightPercentDamage:      return Attrs->GetLightPercentDamage();
-	case EHunterAttribute::LightMoreDamage:         return Attrs->GetLightMoreDamage();
-	case EHunterAttribute::MinCorruptionDamage:     return Attrs->GetMinCorruptionDamage();
-	case EHunterAttribute::MaxCorruptionDamage:     return Attrs->GetMaxCorruptionDamage();
-	case EHunterAttribute::CorruptionFlatDamage:    return Attrs->GetCorruptionFlatDamage();
-	case EHunterAttribute::CorruptionPercentDamage: return Attrs->GetCorruptionPercentDamage();
-	case EHunterAttribute::CorruptionMoreDamage:    return Attrs->GetCorruptionMoreDamage();
-	case EHunterAttribute::ElementalMoreDamage:     return Attrs->GetElementalMoreDamage();
-	case EHunterAttribute::ElementalDamage:         return Attrs->GetElementalDamage();
-	case EHunterAttribute::AreaDamage:              return Attrs->GetAreaDamage();
-	case EHunterAttribute::AreaOfEffect:            return Attrs->GetAreaOfEffect();
-	case EHunterAttribute::AttackRange:             return Attrs->GetAttackRange();
-	case EHunterAttribute::AttackSpeed:             return Attrs->GetAttackSpeed();
-	case EHunterAttribute::CastSpeed:               return Attrs->GetCastSpeed();
-	case EHunterAttribute::CritChance:              return Attrs->GetCritChance();
-	case EHunterAttribute::CritMultiplier:          return Attrs->GetCritMultiplier();
-	case EHunterAttribute::DamageOverTime:          return Attrs->GetDamageOverTime();
-	case EHunterAttribute::MeleeDamage:             return Attrs->GetMeleeDamage();
-	case EHunterAttribute::SpellDamage:             return Attrs->GetSpellDamage();
-	case EHunterAttribute::ProjectileCount:         return Attrs->GetProjectileCount();
-	case EHunterAttribute::ProjectileSpeed:         return Attrs->GetProjectileSpeed();
-	case EHunterAttribute::RangedDamage:            return Attrs->GetRangedDamage();
-	case EHunterAttribute::SpellsCritChance:        return Attrs->GetSpellsCritChance();
-	case EHunterAttribute::SpellsCritMultiplier:    return Attrs->GetSpellsCritMultiplier();
-	case EHunterAttribute::ChainCount:              return Attrs->GetChainCount();
-	case EHunterAttribute::ForkCount:               return Attrs->GetForkCount();
-	case EHunterAttribute::ChainDamage:             return Attrs->GetChainDamage();
-	case EHunterAttribute::PhysicalToFire:          return Attrs->GetPhysicalToFire();
-	case EHunterAttribute::PhysicalToIce:           return Attrs->GetPhysicalToIce();
-	case EHunterAttribute::PhysicalToLightning:     return Attrs->GetPhysicalToLightning();
-	case EHunterAttribute::PhysicalToLight:         return Attrs->GetPhysicalToLight();
-	case EHunterAttribute::PhysicalToCorruption:    return Attrs->GetPhysicalToCorruption();
-	case EHunterAttribute::FireToPhysical:          return Attrs->GetFireToPhysical();
-	case EHunterAttribute::FireToIce:               return Attrs->GetFireToIce();
-	case EHunterAttribute::FireToLightning:         return Attrs->GetFireToLightning();
-	case EHunterAttribute::FireToLight:             return Attrs->GetFireToLight();
-	case EHunterAttribute::FireToCorruption:        return Attrs->GetFireToCorruption();
-	case EHunterAttribute::IceToPhysical:           return Attrs->GetIceToPhysical();
-	case EHunterAttribute::IceToFire:               return Attrs->GetIceToFire();
-	case EHunterAttribute::IceToLightning:          return Attrs->GetIceToLightning();
-	case EHunterAttribute::IceToLight:              return Attrs->GetIceToLight();
-	case EHunterAttribute::IceToCorruption:         return Attrs->GetIceToCorruption();
-	case EHunterAttribute::LightningToPhysical:     return Attrs->GetLightningToPhysical();
-	case EHunterAttribute::LightningToFire:         return Attrs->GetLightningToFire();
-	case EHunterAttribute::LightningToIce:          return Attrs->GetLightningToIce();
-	case EHunterAttribute::LightningToLight:        return Attrs->GetLightningToLight();
-	case EHunterAttribute::LightningToCorruption:   return Attrs->GetLightningToCorruption();
-	case EHunterAttribute::LightToPhysical:         return Attrs->GetLightToPhysical();
-	case EHunterAttribute::LightToFire:             return Attrs->GetLightToFire();
-	case EHunterAttribute::LightToIce:              return Attrs->GetLightToIce();
-	case EHunterAttribute::LightToLightning:        return Attrs->GetLightToLightning();
-	case EHunterAttribute::LightToCorruption:       return Attrs->GetLightToCorruption();
-	case EHunterAttribute::CorruptionToPhysical:    return Attrs->GetCorruptionToPhysical();
-	case EHunterAttribute::CorruptionToFire:        return Attrs->GetCorruptionToFire();
-	case EHunterAttribute::CorruptionToIce:         return Attrs->GetCorruptionToIce();
-	case EHunterAttribute::CorruptionToLightning:   return Attrs->GetCorruptionToLightning();
-	case EHunterAttribute::CorruptionToLight:       return Attrs->GetCorruptionToLight();
-	case EHunterAttribute::ChanceToBleed:           return Attrs->GetChanceToBleed();
-	case EHunterAttribute::ChanceToCorrupt:         return Attrs->GetChanceToCorrupt();
-	case EHunterAttribute::ChanceToFreeze:          return Attrs->GetChanceToFreeze();
-	case EHunterAttribute::ChanceToPurify:          return Attrs->GetChanceToPurify();
-	case EHunterAttribute::ChanceToIgnite:          return Attrs->GetChanceToIgnite();
-	case EHunterAttribute::ChanceToKnockBack:       return Attrs->GetChanceToKnockBack();
-	case EHunterAttribute::ChanceToPetrify:         return Attrs->GetChanceToPetrify();
-	case EHunterAttribute::ChanceToShock:           return Attrs->GetChanceToShock();
-	case EHunterAttribute::ChanceToStun:            return Attrs->GetChanceToStun();
-	case EHunterAttribute::BurnDuration:            return Attrs->GetBurnDuration();
-	case EHunterAttribute::BleedDuration:           return Attrs->GetBleedDuration();
-	case EHunterAttribute::FreezeDuration:          return Attrs->GetFreezeDuration();
-	case EHunterAttribute::CorruptionDuration:      return Attrs->GetCorruptionDuration();
-	case EHunterAttribute::ShockDuration:           return Attrs->GetShockDuration();
-	case EHunterAttribute::PetrifyBuildUpDuration:  return Attrs->GetPetrifyBuildUpDuration();
-	case EHunterAttribute::PurifyDuration:          return Attrs->GetPurifyDuration();
-	case EHunterAttribute::GlobalDefenses:              return Attrs->GetGlobalDefenses();
-	case EHunterAttribute::Armour:                      return Attrs->GetArmour();
-	case EHunterAttribute::ArmourFlatBonus:             return Attrs->GetArmourFlatBonus();
-	case EHunterAttribute::ArmourPercentBonus:          return Attrs->GetArmourPercentBonus();
-	case EHunterAttribute::BlockStrength:               return Attrs->GetBlockStrength();
-	case EHunterAttribute::FlatBlockAmount:             return Attrs->GetFlatBlockAmount();
-	case EHunterAttribute::ChipDamageWhileBlocking:     return Attrs->GetChipDamageWhileBlocking();
-	case EHunterAttribute::BlockStaminaCostMultiplier:  return Attrs->GetBlockStaminaCostMultiplier();
-	case EHunterAttribute::GuardBreakThreshold:         return Attrs->GetGuardBreakThreshold();
-	case EHunterAttribute::BlockAngle:                  return Attrs->GetBlockAngle();
-	case EHunterAttribute::BlockPhysicalMultiplier:     return Attrs->GetBlockPhysicalMultiplier();
-	case EHunterAttribute::BlockElementalMultiplier:    return Attrs->GetBlockElementalMultiplier();
-	case EHunterAttribute::BlockCorruptionMultiplier:   return Attrs->GetBlockCorruptionMultiplier();
-	case EHunterAttribute::FireResistanceFlatBonus:         return Attrs->GetFireResistanceFlatBonus();
-	case EHunterAttribute::FireResistancePercentBonus:      return Attrs->GetFireResistancePercentBonus();
-	case EHunterAttribute::MaxFireResistance:               return Attrs->GetMaxFireResistance();
-	case EHunterAttribute::IceResistanceFlatBonus:          return Attrs->GetIceResistanceFlatBonus();
-	case EHunterAttribute::IceResistancePercentBonus:       return Attrs->GetIceResistancePercentBonus();
-	case EHunterAttribute::MaxIceResistance:                return Attrs->GetMaxIceResistance();
-	case EHunterAttribute::LightningResistanceFlatBonus:    return Attrs->GetLightningResistanceFlatBonus();
-	case EHunterAttribute::LightningResistancePercentBonus: return Attrs->GetLightningResistancePercentBonus();
-	case EHunterAttribute::MaxLightningResistance:          return Attrs->GetMaxLightningResistance();
-	case EHunterAttribute::LightResistanceFlatBonus:        return Attrs->GetLightResistanceFlatBonus();
-	case EHunterAttribute::LightResistancePercentBonus:     return Attrs->GetLightResistancePercentBonus();
-	case EHunterAttribute::MaxLightResistance:              return Attrs->GetMaxLightResistance();
-	case EHunterAttribute::CorruptionResistanceFlatBonus:   return Attrs->GetCorruptionResistanceFlatBonus();
-	case EHunterAttribute::CorruptionResistancePercentBonus: return Attrs->GetCorruptionResistancePercentBonus();
-	case EHunterAttribute::MaxCorruptionResistance:         return Attrs->GetMaxCorruptionResistance();
-	case EHunterAttribute::GlobalDamageTakenMultiplier:     return Attrs->GetGlobalDamageTakenMultiplier();
-	case EHunterAttribute::PhysicalDamageTakenMultiplier:   return Attrs->GetPhysicalDamageTakenMultiplier();
-	case EHunterAttribute::ElementalDamageTakenMultiplier:  return Attrs->GetElementalDamageTakenMultiplier();
-	case EHunterAttribute::FireDamageTakenMultiplier:       return Attrs->GetFireDamageTakenMultiplier();
-	case EHunterAttribute::IceDamageTakenMultiplier:        return Attrs->GetIceDamageTakenMultiplier();
-	case EHunterAttribute::LightningDamageTakenMultiplier:  return Attrs->GetLightningDamageTakenMultiplier();
-	case EHunterAttribute::LightDamageTakenMultiplier:      return Attrs->GetLightDamageTakenMultiplier();
-	case EHunterAttribute::CorruptionDamageTakenMultiplier: return Attrs->GetCorruptionDamageTakenMultiplier();
-	case EHunterAttribute::ReflectPhysical:         return Attrs->GetReflectPhysical();
-	case EHunterAttribute::ReflectElemental:        return Attrs->GetReflectElemental();
-	case EHunterAttribute::ReflectChancePhysical:   return Attrs->GetReflectChancePhysical();
-	case EHunterAttribute::ReflectChanceElemental:  return Attrs->GetReflectChanceElemental();
-	case EHunterAttribute::ArmourPiercing:          return Attrs->GetArmourPiercing();
-	case EHunterAttribute::FirePiercing:            return Attrs->GetFirePiercing();
-	case EHunterAttribute::IcePiercing:             return Attrs->GetIcePiercing();
-	case EHunterAttribute::LightningPiercing:       return Attrs->GetLightningPiercing();
-	case EHunterAttribute::LightPiercing:           return Attrs->GetLightPiercing();
-	case EHunterAttribute::CorruptionPiercing:      return Attrs->GetCorruptionPiercing();
-	case EHunterAttribute::ComboCounter:            return Attrs->GetComboCounter();
-	case EHunterAttribute::Cooldown:                return Attrs->GetCooldown();
-	case EHunterAttribute::Gems:                    return Attrs->GetGems();
-	case EHunterAttribute::LifeLeech:               return Attrs->GetLifeLeech();
-	case EHunterAttribute::ManaLeech:               return Attrs->GetManaLeech();
-	case EHunterAttribute::StaminaLeechPercent:     return Attrs->GetStaminaLeechPercent();
-	case EHunterAttribute::MovementSpeed:           return Attrs->GetMovementSpeed();
-	case EHunterAttribute::Poise:                   return Attrs->GetPoise();
-	case EHunterAttribute::Weight:                  return Attrs->GetWeight();
-	case EHunterAttribute::PoiseResistance:         return Attrs->GetPoiseResistance();
-	case EHunterAttribute::StunRecovery:            return Attrs->GetStunRecovery();
-	case EHunterAttribute::ManaCostChanges:         return Attrs->GetManaCostChanges();
-	case EHunterAttribute::HealthCostChanges:       return Attrs->GetHealthCostChanges();
-	case EHunterAttribute::StaminaCostChanges:      return Attrs->GetStaminaCostChanges();
-	case EHunterAttribute::LifeOnHit:               return Attrs->GetLifeOnHit();
-	case EHunterAttribute::ManaOnHit:               return Attrs->GetManaOnHit();
-	case EHunterAttribute::StaminaOnHit:            return Attrs->GetStaminaOnHit();
-	case EHunterAttribute::AuraEffect:              return Attrs->GetAuraEffect();
-	case EHunterAttribute::AuraRadius:              return Attrs->GetAuraRadius();
-
-	default:
 		PH_LOG_WARNING(LogStatsManager,
 			"GetAttributeByType: Unhandled EHunterAttribute value (%d) on %s.",
 			static_cast<int32>(AttributeType), *GetNameSafe(GetOwner()));
 		return 0.f;
 	}
+
+	return Attribute.GetNumericValue(Attrs);
 }
 
 bool UStatsManager::MeetsStatRequirements(const TMap<FName, float>& Requirements) const
@@ -3,6 +3,7 @@
 #include "AbilitySystemComponent.h"
 #include "AbilitySystem/HunterAttributeSet.h"
 #include "Core/Logging/ProjectHunterLogMacros.h"
+#include "Engine/Engine.h"
 #include "GameplayEffect.h"
 #include "Item/ItemInstance.h"
 #include "Item/Library/Enums/AffixEnums.h"
@@ -11,6 +12,26 @@
 #include "Stats/Components/StatsManager.h"
 #include "Stats/Library/FunctionLibraries/StatsAttributeResolver.h"
 #include "Stats/Library/FunctionLibraries/StatsModifierMath.h"
+#include "Stats/Subsystems/EquipmentEffectTemplateSubsystem.h"
+#include "Tags/PHGameplayTags.h"
+
+DECLARE_STATS_GROUP(TEXT("EquipmentStats"), STATGROUP_EquipmentStats, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Equipment Change"), STAT_EquipmentStats_Change, STATGROUP_EquipmentStats);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Effects Applied"), STAT_EquipmentStats_Applied, STATGROUP_EquipmentStats);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Effects Updated"), STAT_EquipmentStats_Updated, STATGROUP_EquipmentStats);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Effects Removed"), STAT_EquipmentStats_Removed, STATGROUP_EquipmentStats);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GE Objects Created"), STAT_EquipmentStats_EffectObjects, STATGROUP_EquipmentStats);
+
+#if !UE_BUILD_SHIPPING
+static TAutoConsoleVariable<int32> CVarEquipmentPerItemEffects(
+	TEXT("Hunter.Debug.EquipmentPerItemEffects"),
+	0,
+	TEXT("How equipment stats reach the ability system, for A/B with `stat EquipmentStats` and the per-change log\n")
+	TEXT("0: Summed per-attribute modifier layer on shared GE templates (default)\n")
+	TEXT("1: One new UGameplayEffect per equipped item (applies to items equipped afterwards)"),
+	ECVF_Cheat
+);
+#endif
 
 namespace EquipmentStatsApplierPrivate
 {
@@ -144,13 +165,12 @@ namespace EquipmentStatsApplierPrivate
 		}
 	}
 
-	void AddFlatModifier(UGameplayEffect* Effect, const FGameplayAttribute& Attribute, const float Magnitude)
+	void AddFlatModifier(TArray<FEquipmentAttributeModifier>& OutModifiers, const FGameplayAttribute& Attribute, const float Magnitude)
 	{
-		FGameplayModifierInfo Modifier;
+		FEquipmentAttributeModifier& Modifier = OutModifiers.AddDefaulted_GetRef();
 		Modifier.Attribute = Attribute;
-		Modifier.ModifierOp = EGameplayModOp::Additive;
-		Modifier.ModifierMagnitude = FScalableFloat(Magnitude);
-		Effect->Modifiers.Add(Modifier);
+		Modifier.ModOp = EGameplayModOp::Additive;
+		Modifier.Magnitude = Magnitude;
 	}
 
 	bool HasBaseEquipmentContribution(const FItemBase& Base)
@@ -179,68 +199,140 @@ namespace EquipmentStatsApplierPrivate
 
 		return false;
 	}
-}
 
-void FEquipmentStatsApplier::ApplyEquipmentStats(UStatsManager& Manager, UItemInstance* Item)
-{
-	if (!Item)
+	bool UsePerItemEffects()
 	{
-		PH_LOG_WARNING(LogStatsManager, "ApplyEquipmentStats failed: Item was invalid.");
-		return;
+#if !UE_BUILD_SHIPPING
+		return CVarEquipmentPerItemEffects.GetValueOnGameThread() != 0;
+#else
+		return false;
+#endif
 	}
 
-	UAbilitySystemComponent* ASC = FStatsAttributeResolver::GetAbilitySystemComponent(Manager);
-	if (!ASC)
+	UAbilitySystemComponent* GetAuthoritativeASC(UStatsManager& Manager, const TCHAR* Context)
 	{
-		PH_LOG_ERROR(LogStatsManager, "ApplyEquipmentStats failed: AbilitySystemComponent was unavailable.");
-		return;
+		UAbilitySystemComponent* ASC = FStatsAttributeResolver::GetAbilitySystemComponent(Manager);
+		if (!ASC)
+		{
+			PH_LOG_ERROR(LogStatsManager, "%s failed: AbilitySystemComponent was unavailable.", Context);
+			return nullptr;
+		}
+
+		AActor* Owner = Manager.GetOwner();
+		if (!Owner || !Owner->HasAuthority())
+		{
+			PH_LOG_WARNING(LogStatsManager, "%s failed: Must be called on the server.", Context);
+			return nullptr;
+		}
+
+		return ASC;
 	}
 
-	AActor* Owner = Manager.GetOwner();
-	if (!Owner || !Owner->HasAuthority())
+	void AddContribution(FEquipmentModifierChannel& Channel, const FEquipmentAttributeModifier& Modifier,
+		const FGuid& ItemID, const double Sign)
 	{
-		PH_LOG_WARNING(LogStatsManager, "ApplyEquipmentStats failed: Must be called on the server.");
-		return;
+		switch (Modifier.ModOp)
+		{
+		case EGameplayModOp::Multiplicitive:
+			Channel.Total += Sign * (static_cast<double>(Modifier.Magnitude) - 1.0);
+			break;
+
+		case EGameplayModOp::Override:
+			if (Sign > 0.0)
+			{
+				Channel.Overrides.Emplace(ItemID, Modifier.Magnitude);
+			}
+			else
+			{
+				const int32 Index = Channel.Overrides.IndexOfByPredicate([&ItemID](const TPair<FGuid, float>& Entry)
+				{
+					return Entry.Key == ItemID;
+				});
+				if (Index != INDEX_NONE)
+				{
+					Channel.Overrides.RemoveAt(Index);
+				}
+			}
+			break;
+
+		default:
+			Channel.Total += Sign * static_cast<double>(Modifier.Magnitude);
+			break;
+		}
 	}
 
-	if (Manager.ActiveEquipmentEffects.Contains(Item->UniqueID))
+	// Times one public entry point and publishes what it did as the manager's last report.
+	struct FScopedChangeReport
 	{
-		PH_LOG_WARNING(LogStatsManager, "ApplyEquipmentStats skipped: Equipment stats were already active for Item=%s.", *Item->GetName());
-		return;
-	}
+		FScopedChangeReport(UStatsManager& InManager, const FName Operation, const UItemInstance* InItem)
+			: Manager(InManager)
+			, Item(InItem)
+			, StartCycles(FPlatformTime::Cycles64())
+		{
+			Report.Operation = Operation;
+			Report.bPerItemEffects = UsePerItemEffects();
+			TemplateSubsystem = GEngine ? GEngine->GetEngineSubsystem<UEquipmentEffectTemplateSubsystem>() : nullptr;
+			TemplatesBefore = TemplateSubsystem ? TemplateSubsystem->GetTemplateCount() : 0;
+		}
 
-	TArray<FPHAttributeData> AllStats = Item->Stats.GetAllStats();
+		~FScopedChangeReport()
+		{
+			Report.Milliseconds = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+			if (TemplateSubsystem)
+			{
+				Report.EffectObjectsCreated += TemplateSubsystem->GetTemplateCount() - TemplatesBefore;
+			}
 
-	const FItemBase* BaseData = Item->GetBaseData();
-	const bool bHasBaseContribution = BaseData
-		&& EquipmentStatsApplierPrivate::HasBaseEquipmentContribution(*BaseData);
+			INC_DWORD_STAT_BY(STAT_EquipmentStats_Applied, Report.EffectsApplied);
+			INC_DWORD_STAT_BY(STAT_EquipmentStats_Updated, Report.EffectsUpdated);
+			INC_DWORD_STAT_BY(STAT_EquipmentStats_Removed, Report.EffectsRemoved);
+			INC_DWORD_STAT_BY(STAT_EquipmentStats_EffectObjects, Report.EffectObjectsCreated);
+
+			UE_LOG(LogStatsManager, Log,
+				TEXT("StatsManager: %s %s in %.3f ms - %d modifiers, effects %d applied / %d updated / %d removed, %d GE objects created (%s)"),
+				*Report.Operation.ToString(), Item ? *Item->GetName() : TEXT("all equipment"), Report.Milliseconds,
+				Report.Modifiers, Report.EffectsApplied, Report.EffectsUpdated, Report.EffectsRemoved,
+				Report.EffectObjectsCreated, Report.bPerItemEffects ? TEXT("per-item effects") : TEXT("modifier layer"));
+
+			Manager.LastEquipmentStatsReport = Report;
+		}
+
+		UStatsManager& Manager;
+		const UItemInstance* Item;
+		FEquipmentStatsChangeReport Report;
+		UEquipmentEffectTemplateSubsystem* TemplateSubsystem = nullptr;
+		uint64 StartCycles;
+		int32 TemplatesBefore = 0;
+	};
+}
 
-	if (AllStats.Num() == 0 && !bHasBaseContribution)
+
+void FEquipmentStatsApplier::ApplyEquipmentStats(UStatsManager& Manager, UItemInstance* Item)
+{
+	if (!Item)
 	{
-		UE_LOG(LogStatsManager, Verbose, TEXT("StatsManager: Item %s has no stats to apply"), *Item->GetName());
+		PH_LOG_WARNING(LogStatsManager, "ApplyEquipmentStats failed: Item was invalid.");
 		return;
 	}
 
-	FGameplayEffectSpecHandle EffectSpec = CreateEquipmentEffect(Manager, Item, AllStats);
-	if (!EffectSpec.IsValid())
+	UAbilitySystemComponent* ASC = EquipmentStatsApplierPrivate::GetAuthoritativeASC(Manager, TEXT("ApplyEquipmentStats"));
+	if (!ASC)
 	{
-		PH_LOG_WARNING(LogStatsManager, "ApplyEquipmentStats: No applicable modifiers (or spec creation failed) for Item=%s.", *Item->GetName());
 		return;
 	}
 
-	const FActiveGameplayEffectHandle EffectHandle = ASC->ApplyGameplayEffectSpecToSelf(*EffectSpec.Data.Get());
-	if (EffectHandle.IsValid())
+	if (HasEquipmentStatsApplied(Manager, Item))
 	{
-		Manager.ActiveEquipmentEffects.Add(Item->UniqueID, EffectHandle);
-		Manager.ActiveEquipmentItems.Add(Item->UniqueID, Item);
-
-		UE_LOG(LogStatsManager, Log, TEXT("StatsManager: Applied %d stats from %s (GUID: %s)"),
-			AllStats.Num(), *Item->GetName(), *Item->UniqueID.ToString());
-	}
-	else
-	{
-		PH_LOG_ERROR(LogStatsManager, "ApplyEquipmentStats failed: Could not apply the equipment effect for Item=%s.", *Item->GetName());
+		PH_LOG_WARNING(LogStatsManager, "ApplyEquipmentStats skipped: Equipment stats were already active for Item=%s.", *Item->GetName());
+		return;
 	}
+
+	SCOPE_CYCLE_COUNTER(STAT_EquipmentStats_Change);
+	EquipmentStatsApplierPrivate::FScopedChangeReport Scope(Manager, TEXT("Equip"), Item);
+
+	TSet<FEquipmentModifierChannelKey> DirtyChannels;
+	AddItem(Manager, *ASC, *Item, DirtyChannels, Scope.Report);
+	FlushModifierLayer(Manager, *ASC, DirtyChannels, false, Scope.Report);
 }
 
 void FEquipmentStatsApplier::RemoveEquipmentStats(UStatsManager& Manager, UItemInstance* Item)
@@ -251,33 +343,24 @@ void FEquipmentStatsApplier::RemoveEquipmentStats(UStatsManager& Manager, UItemI
 		return;
 	}
 
-	UAbilitySystemComponent* ASC = FStatsAttributeResolver::GetAbilitySystemComponent(Manager);
+	UAbilitySystemComponent* ASC = EquipmentStatsApplierPrivate::GetAuthoritativeASC(Manager, TEXT("RemoveEquipmentStats"));
 	if (!ASC)
 	{
-		PH_LOG_ERROR(LogStatsManager, "RemoveEquipmentStats failed: AbilitySystemComponent was unavailable.");
-		return;
-	}
-
-	AActor* Owner = Manager.GetOwner();
-	if (!Owner || !Owner->HasAuthority())
-	{
-		PH_LOG_WARNING(LogStatsManager, "RemoveEquipmentStats failed: Must be called on the server.");
 		return;
 	}
 
-	FActiveGameplayEffectHandle* EffectHandle = Manager.ActiveEquipmentEffects.Find(Item->UniqueID);
-	if (!EffectHandle || !EffectHandle->IsValid())
+	if (!HasEquipmentStatsApplied(Manager, Item))
 	{
 		PH_LOG_WARNING(LogStatsManager, "RemoveEquipmentStats skipped: No active equipment effect was found for Item=%s.", *Item->GetName());
 		return;
 	}
 
-	ASC->RemoveActiveGameplayEffect(*EffectHandle);
-	Manager.ActiveEquipmentEffects.Remove(Item->UniqueID);
-	Manager.ActiveEquipmentItems.Remove(Item->UniqueID);
+	SCOPE_CYCLE_COUNTER(STAT_EquipmentStats_Change);
+	EquipmentStatsApplierPrivate::FScopedChangeReport Scope(Manager, TEXT("Unequip"), Item);
 
-	UE_LOG(LogStatsManager, Log, TEXT("StatsManager: Removed equipment stats for %s (GUID: %s)"),
-		*Item->GetName(), *Item->UniqueID.ToString());
+	TSet<FEquipmentModifierChannelKey> DirtyChannels;
+	RemoveItem(Manager, *ASC, *Item, DirtyChannels, Scope.Report);
+	FlushModifierLayer(Manager, *ASC, DirtyChannels, false, Scope.Report);
 }
 
 void FEquipmentStatsApplier::RefreshEquipmentStats(UStatsManager& Manager)
@@ -305,29 +388,44 @@ void FEquipmentStatsApplier::RefreshEquipmentStats(UStatsManager& Manager)
 		Manager.ActiveEquipmentItems.GenerateValueArray(ItemsToReapply);
 	}
 
-	const int32 NumEffects = Manager.ActiveEquipmentEffects.Num();
+	SCOPE_CYCLE_COUNTER(STAT_EquipmentStats_Change);
+	EquipmentStatsApplierPrivate::FScopedChangeReport Scope(Manager, TEXT("Refresh"), nullptr);
+
 	for (const TPair<FGuid, FActiveGameplayEffectHandle>& Pair : Manager.ActiveEquipmentEffects)
 	{
-		if (Pair.Value.IsValid())
+		if (Pair.Value.IsValid() && ASC->RemoveActiveGameplayEffect(Pair.Value))
 		{
-			ASC->RemoveActiveGameplayEffect(Pair.Value);
+			++Scope.Report.EffectsRemoved;
 		}
 	}
 
+	// Rebuild the layer totals from scratch; channels that come out unchanged
+	// keep their active effect untouched and the rest are updated or dropped.
+	TSet<FEquipmentModifierChannelKey> DirtyChannels;
+	for (TPair<FEquipmentModifierChannelKey, FEquipmentModifierChannel>& Pair : Manager.EquipmentChannels)
+	{
+		Pair.Value.Total = 0.0;
+		Pair.Value.Overrides.Reset();
+		DirtyChannels.Add(Pair.Key);
+	}
+
 	Manager.ActiveEquipmentEffects.Empty();
 	Manager.ActiveEquipmentItems.Empty();
+	Manager.EquipmentModifiers.Empty();
 
 	int32 Reapplied = 0;
 	for (UItemInstance* Item : ItemsToReapply)
 	{
-		if (IsValid(Item))
+		if (IsValid(Item) && !HasEquipmentStatsApplied(Manager, Item))
 		{
-			ApplyEquipmentStats(Manager, Item);
+			AddItem(Manager, *ASC, *Item, DirtyChannels, Scope.Report);
 			++Reapplied;
 		}
 	}
 
-	UE_LOG(LogStatsManager, Log, TEXT("StatsManager: Refreshed equipment stats (removed %d, reapplied %d)"), NumEffects, Reapplied);
+	FlushModifierLayer(Manager, *ASC, DirtyChannels, true, Scope.Report);
+
+	UE_LOG(LogStatsManager, Log, TEXT("StatsManager: Refreshed equipment stats (reapplied %d items)"), Reapplied);
 }
 
 void FEquipmentStatsApplier::HandleEquipmentChanged(UStatsManager& Manager, UItemInstance* NewItem, UItemInstance* OldItem)
@@ -337,14 +435,192 @@ void FEquipmentStatsApplier::HandleEquipmentChanged(UStatsManager& Manager, UIte
 		return;
 	}
 
-	if (OldItem && OldItem != NewItem)
+	const bool bRemoveOld = OldItem && OldItem != NewItem && HasEquipmentStatsApplied(Manager, OldItem);
+	const bool bApplyNew = NewItem && NewItem != OldItem && !HasEquipmentStatsApplied(Manager, NewItem);
+	if (!bRemoveOld && !bApplyNew)
+	{
+		return;
+	}
+
+	UAbilitySystemComponent* ASC = EquipmentStatsApplierPrivate::GetAuthoritativeASC(Manager, TEXT("HandleEquipmentChanged"));
+	if (!ASC)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_EquipmentStats_Change);
+	EquipmentStatsApplierPrivate::FScopedChangeReport Scope(Manager,
+		bRemoveOld && bApplyNew ? TEXT("Swap") : (bApplyNew ? TEXT("Equip") : TEXT("Unequip")),
+		bApplyNew ? NewItem : OldItem);
+
+	// A swap is one flush: channels both items touch are updated once, not removed and re-added.
+	TSet<FEquipmentModifierChannelKey> DirtyChannels;
+	if (bRemoveOld)
+	{
+		RemoveItem(Manager, *ASC, *OldItem, DirtyChannels, Scope.Report);
+	}
+	if (bApplyNew)
 	{
-		RemoveEquipmentStats(Manager, OldItem);
+		AddItem(Manager, *ASC, *NewItem, DirtyChannels, Scope.Report);
 	}
+	FlushModifierLayer(Manager, *ASC, DirtyChannels, false, Scope.Report);
+}
+
+bool FEquipmentStatsApplier::HasEquipmentStatsApplied(const UStatsManager& Manager, const UItemInstance* Item)
+{
+	return Item
+		&& (Manager.ActiveEquipmentEffects.Contains(Item->UniqueID)
+			|| Manager.EquipmentModifiers.Contains(Item->UniqueID));
+}
 
-	if (NewItem && NewItem != OldItem)
+bool FEquipmentStatsApplier::AddItem(UStatsManager& Manager, UAbilitySystemComponent& ASC, UItemInstance& Item,
+	TSet<FEquipmentModifierChannelKey>& DirtyChannels, FEquipmentStatsChangeReport& Report)
+{
+	TArray<FEquipmentAttributeModifier> Modifiers;
+	if (!BuildEquipmentModifiers(Manager, &Item, Item.Stats.GetAllStats(), Modifiers))
 	{
-		ApplyEquipmentStats(Manager, NewItem);
+		UE_LOG(LogStatsManager, Verbose, TEXT("StatsManager: Item %s has no stats to apply"), *Item.GetName());
+		return false;
+	}
+
+	Report.Modifiers += Modifiers.Num();
+
+	if (EquipmentStatsApplierPrivate::UsePerItemEffects())
+	{
+		const FGameplayEffectSpecHandle EffectSpec = MakePerItemEffectSpec(ASC, Item, Modifiers);
+		const FActiveGameplayEffectHandle EffectHandle = EffectSpec.IsValid()
+			? ASC.ApplyGameplayEffectSpecToSelf(*EffectSpec.Data.Get())
+			: FActiveGameplayEffectHandle();
+		++Report.EffectObjectsCreated;
+
+		if (!EffectHandle.IsValid())
+		{
+			PH_LOG_ERROR(LogStatsManager, "ApplyEquipmentStats failed: Could not apply the equipment effect for Item=%s.", *Item.GetName());
+			return false;
+		}
+
+		++Report.EffectsApplied;
+		Manager.ActiveEquipmentEffects.Add(Item.UniqueID, EffectHandle);
+		Manager.ActiveEquipmentItems.Add(Item.UniqueID, &Item);
+		return true;
+	}
+
+	for (const FEquipmentAttributeModifier& Modifier : Modifiers)
+	{
+		const FEquipmentModifierChannelKey Key{Modifier.Attribute, Modifier.ModOp};
+		EquipmentStatsApplierPrivate::AddContribution(Manager.EquipmentChannels.FindOrAdd(Key), Modifier, Item.UniqueID, 1.0);
+		DirtyChannels.Add(Key);
+	}
+
+	Manager.EquipmentModifiers.Add(Item.UniqueID, MoveTemp(Modifiers));
+	Manager.ActiveEquipmentItems.Add(Item.UniqueID, &Item);
+	return true;
+}
+
+void FEquipmentStatsApplier::RemoveItem(UStatsManager& Manager, UAbilitySystemComponent& ASC, const UItemInstance& Item,
+	TSet<FEquipmentModifierChannelKey>& DirtyChannels, FEquipmentStatsChangeReport& Report)
+{
+	if (const FActiveGameplayEffectHandle* EffectHandle = Manager.ActiveEquipmentEffects.Find(Item.UniqueID))
+	{
+		if (EffectHandle->IsValid() && ASC.RemoveActiveGameplayEffect(*EffectHandle))
+		{
+			++Report.EffectsRemoved;
+		}
+		Manager.ActiveEquipmentEffects.Remove(Item.UniqueID);
+	}
+
+	if (const TArray<FEquipmentAttributeModifier>* Modifiers = Manager.EquipmentModifiers.Find(Item.UniqueID))
+	{
+		Report.Modifiers += Modifiers->Num();
+		for (const FEquipmentAttributeModifier& Modifier : *Modifiers)
+		{
+			const FEquipmentModifierChannelKey Key{Modifier.Attribute, Modifier.ModOp};
+			if (FEquipmentModifierChannel* Channel = Manager.EquipmentChannels.Find(Key))
+			{
+				EquipmentStatsApplierPrivate::AddContribution(*Channel, Modifier, Item.UniqueID, -1.0);
+				DirtyChannels.Add(Key);
+			}
+		}
+		Manager.EquipmentModifiers.Remove(Item.UniqueID);
+	}
+
+	Manager.ActiveEquipmentItems.Remove(Item.UniqueID);
+}
+
+void FEquipmentStatsApplier::FlushModifierLayer(UStatsManager& Manager, UAbilitySystemComponent& ASC,
+	const TSet<FEquipmentModifierChannelKey>& DirtyChannels, const bool bDropNeutral, FEquipmentStatsChangeReport& Report)
+{
+	if (DirtyChannels.IsEmpty())
+	{
+		return;
+	}
+
+	UEquipmentEffectTemplateSubsystem* Templates = GEngine
+		? GEngine->GetEngineSubsystem<UEquipmentEffectTemplateSubsystem>()
+		: nullptr;
+	const FGameplayTag MagnitudeTag = FPHGameplayTags::Data_Equipment_Magnitude;
+
+	for (const FEquipmentModifierChannelKey& Key : DirtyChannels)
+	{
+		FEquipmentModifierChannel* Channel = Manager.EquipmentChannels.Find(Key);
+		if (!Channel)
+		{
+			continue;
+		}
+
+		// Effects can be cleared behind our back (death, ASC reset); treat those as never applied.
+		const bool bActive = Channel->Handle.IsValid() && ASC.GetActiveGameplayEffect(Channel->Handle) != nullptr;
+		const bool bNeutral = Channel->IsNeutral(Key.ModOp);
+
+		// A neutral additive/multiplicative channel is kept by default: the next
+		// item on the same attribute is then an in-place update, not a new effect.
+		if (bNeutral && (bDropNeutral || Key.ModOp == EGameplayModOp::Override))
+		{
+			if (bActive && ASC.RemoveActiveGameplayEffect(Channel->Handle))
+			{
+				++Report.EffectsRemoved;
+			}
+			Manager.EquipmentChannels.Remove(Key);
+			continue;
+		}
+
+		const float Magnitude = Channel->GetMagnitude(Key.ModOp);
+		if (bActive)
+		{
+			if (!FMath::IsNearlyEqual(Magnitude, Channel->AppliedMagnitude))
+			{
+				ASC.UpdateActiveGameplayEffectSetByCallerMagnitude(Channel->Handle, MagnitudeTag, Magnitude);
+				Channel->AppliedMagnitude = Magnitude;
+				++Report.EffectsUpdated;
+			}
+			continue;
+		}
+
+		Channel->Handle.Invalidate();
+		if (bNeutral)
+		{
+			continue;
+		}
+
+		const UGameplayEffect* Template = Templates ? Templates->GetModifierTemplate(Key) : nullptr;
+		if (!Template)
+		{
+			PH_LOG_ERROR(LogStatsManager, "FlushModifierLayer failed: No equipment effect template for Attribute=%s.", *Key.Attribute.GetName());
+			continue;
+		}
+
+		FGameplayEffectSpec Spec(Template, ASC.MakeEffectContext(), 1.0f);
+		Spec.SetSetByCallerMagnitude(MagnitudeTag, Magnitude);
+		Channel->Handle = ASC.ApplyGameplayEffectSpecToSelf(Spec);
+		Channel->AppliedMagnitude = Magnitude;
+		if (Channel->Handle.IsValid())
+		{
+			++Report.EffectsApplied;
+		}
+		else
+		{
+			PH_LOG_ERROR(LogStatsManager, "FlushModifierLayer failed: Could not apply the equipment modifier for Attribute=%s.", *Key.Attribute.GetName());
+		}
 	}
 }
 
@@ -356,12 +632,60 @@ FGameplayEffectSpecHandle FEquipmentStatsApplier::CreateEquipmentEffect(UStatsMa
 		return FGameplayEffectSpecHandle();
 	}
 
-	UGameplayEffect* Effect = NewObject<UGameplayEffect>(Manager.GetOwner());
+	TArray<FEquipmentAttributeModifier> Modifiers;
+	if (!BuildEquipmentModifiers(Manager, Item, Stats, Modifiers))
+	{
+		UE_LOG(LogStatsManager, Verbose, TEXT("CreateEquipmentEffect: No valid modifiers were found for Item=%s."), *Item->GetName());
+		return FGameplayEffectSpecHandle();
+	}
+
+	return MakePerItemEffectSpec(*ASC, *Item, Modifiers);
+}
+
+FGameplayEffectSpecHandle FEquipmentStatsApplier::MakePerItemEffectSpec(UAbilitySystemComponent& ASC, UItemInstance& Item,
+	const TArray<FEquipmentAttributeModifier>& Modifiers)
+{
+	UGameplayEffect* Effect = NewObject<UGameplayEffect>(ASC.GetOwner());
 	Effect->DurationPolicy = EGameplayEffectDurationType::Infinite;
 
+	for (const FEquipmentAttributeModifier& Modifier : Modifiers)
+	{
+		FGameplayModifierInfo ModifierInfo;
+		ModifierInfo.Attribute = Modifier.Attribute;
+		ModifierInfo.ModifierOp = Modifier.ModOp;
+		ModifierInfo.ModifierMagnitude = FScalableFloat(Modifier.Magnitude);
+		Effect->Modifiers.Add(ModifierInfo);
+	}
+
+	FGameplayEffectContextHandle EffectContext = ASC.MakeEffectContext();
+	EffectContext.AddSourceObject(&Item);
+
+	FGameplayEffectSpecHandle SpecHandle;
+	SpecHandle.Data = MakeShared<FGameplayEffectSpec>(Effect, EffectContext, 1.0f);
+
+	UE_LOG(LogStatsManager, Verbose, TEXT("StatsManager: Created equipment effect for item '%s' with %d modifiers"),
+		*Item.GetName(), Modifiers.Num());
+
+	return SpecHandle;
+}
+
+bool FEquipmentStatsApplier::BuildEquipmentModifiers(UStatsManager& Manager, UItemInstance* Item,
+	const TArray<FPHAttributeData>& Stats, TArray<FEquipmentAttributeModifier>& OutModifiers)
+{
+	OutModifiers.Reset();
+	if (!Item)
+	{
+		return false;
+	}
+
 	using namespace EquipmentStatsApplierPrivate;
 
 	const FItemBase* BaseData = Item->GetBaseData();
+	if (Stats.Num() == 0 && !(BaseData && HasBaseEquipmentContribution(*BaseData)))
+	{
+		return false;
+	}
+
 	const bool bIsWeapon = BaseData && BaseData->IsWeapon();
 
 	FWeaponDamageAccumulator WeaponAccum;
@@ -370,7 +694,7 @@ FGameplayEffectSpecHandle FEquipmentStatsApplier::CreateEquipmentEffect(UStatsMa
 		SeedWeaponBase(BaseData->WeaponStats, WeaponAccum);
 
 		UE_LOG(LogStatsManager, Log,
-			TEXT("CreateEquipmentEffect: %s weapon base Phys %.1f-%.1f Fire %.1f-%.1f Ice %.1f-%.1f Lightning %.1f-%.1f Light %.1f-%.1f Corruption %.1f-%.1f"),
+			TEXT("BuildEquipmentModifiers: %s weapon base Phys %.1f-%.1f Fire %.1f-%.1f Ice %.1f-%.1f Lightning %.1f-%.1f Light %.1f-%.1f Corruption %.1f-%.1f"),
 			*Item->GetName(),
 			BaseData->WeaponStats.MinPhysicalDamage, BaseData->WeaponStats.MaxPhysicalDamage,
 			BaseData->WeaponStats.MinFireDamage, BaseData->WeaponStats.MaxFireDamage,
@@ -380,7 +704,6 @@ FGameplayEffectSpecHandle FEquipmentStatsApplier::CreateEquipmentEffect(UStatsMa
 			BaseData->WeaponStats.MinCorruptionDamage, BaseData->WeaponStats.MaxCorruptionDamage);
 	}
 
-	int32 ModifiersAdded = 0;
 	for (const FPHAttributeData& Stat : Stats)
 	{
 		FGameplayAttribute Attribute = Stat.ModifiedAttribute;
@@ -391,7 +714,7 @@ FGameplayEffectSpecHandle FEquipmentStatsApplier::CreateEquipmentEffect(UStatsMa
 
 		if (!Attribute.IsValid())
 		{
-			PH_LOG_WARNING(LogStatsManager, "CreateEquipmentEffect skipped Stat=%s because it could not resolve to a valid attribute.", *Stat.AttributeName.ToString());
+			PH_LOG_WARNING(LogStatsManager, "BuildEquipmentModifiers skipped Stat=%s because it could not resolve to a valid attribute.", *Stat.AttributeName.ToString());
 			continue;
 		}
 
@@ -413,13 +736,14 @@ FGameplayEffectSpecHandle FEquipmentStatsApplier::CreateEquipmentEffect(UStatsMa
 			}
 
 			PH_LOG_WARNING(LogStatsManager,
-				"CreateEquipmentEffect: LOCAL affix '%s' on Item=%s targets %s, which has no local fold path. Applying globally.",
+				"BuildEquipmentModifiers: LOCAL affix '%s' on Item=%s targets %s, which has no local fold path. Applying globally.",
 				*Stat.AttributeName.ToString(), *Item->GetName(), *Attribute.GetName());
 		}
 
-		if (ApplyStatModifier(Effect, Stat, Attribute))
+		FEquipmentAttributeModifier Modifier;
+		if (ResolveStatModifier(Stat, Attribute, Modifier))
 		{
-			++ModifiersAdded;
+			OutModifiers.Add(Modifier);
 		}
 	}
 
@@ -433,13 +757,11 @@ FGameplayEffectSpecHandle FEquipmentStatsApplier::CreateEquipmentEffect(UStatsMa
 
 			if (WeaponAccum.Max[TypeIndex].HasContribution())
 			{
-				AddFlatModifier(Effect, MaxAttr, WeaponAccum.Max[TypeIndex].Resolve());
-				++ModifiersAdded;
+				AddFlatModifier(OutModifiers, MaxAttr, WeaponAccum.Max[TypeIndex].Resolve());
 			}
 			if (WeaponAccum.Min[TypeIndex].HasContribution())
 			{
-				AddFlatModifier(Effect, MinAttr, WeaponAccum.Min[TypeIndex].Resolve());
-				++ModifiersAdded;
+				AddFlatModifier(OutModifiers, MinAttr, WeaponAccum.Min[TypeIndex].Resolve());
 			}
 		}
 	}
@@ -450,57 +772,37 @@ FGameplayEffectSpecHandle FEquipmentStatsApplier::CreateEquipmentEffect(UStatsMa
 
 		if (!FMath::IsNearlyZero(Armor.Armor))
 		{
-			AddFlatModifier(Effect, UHunterAttributeSet::GetArmourAttribute(), Armor.Armor);
-			++ModifiersAdded;
+			AddFlatModifier(OutModifiers, UHunterAttributeSet::GetArmourAttribute(), Armor.Armor);
 		}
 		if (!FMath::IsNearlyZero(Armor.FireResistance))
 		{
-			AddFlatModifier(Effect, UHunterAttributeSet::GetFireResistanceFlatBonusAttribute(), Armor.FireResistance);
-			++ModifiersAdded;
+			AddFlatModifier(OutModifiers, UHunterAttributeSet::GetFireResistanceFlatBonusAttribute(), Armor.FireResistance);
 		}
 		if (!FMath::IsNearlyZero(Armor.IceResistance))
 		{
-			AddFlatModifier(Effect, UHunterAttributeSet::GetIceResistanceFlatBonusAttribute(), Armor.IceResistance);
-			++ModifiersAdded;
+			AddFlatModifier(OutModifiers, UHunterAttributeSet::GetIceResistanceFlatBonusAttribute(), Armor.IceResistance);
 		}
 		if (!FMath::IsNearlyZero(Armor.LightningResistance))
 		{
-			AddFlatModifier(Effect, UHunterAttributeSet::GetLightningResistanceFlatBonusAttribute(), Armor.LightningResistance);
-			++ModifiersAdded;
+			AddFlatModifier(OutModifiers, UHunterAttributeSet::GetLightningResistanceFlatBonusAttribute(), Armor.LightningResistance);
 		}
 		if (!FMath::IsNearlyZero(Armor.LightResistance))
 		{
-			AddFlatModifier(Effect, UHunterAttributeSet::GetLightResistanceFlatBonusAttribute(), Armor.LightResistance);
-			++ModifiersAdded;
+			AddFlatModifier(OutModifiers, UHunterAttributeSet::GetLightResistanceFlatBonusAttribute(), Armor.LightResistance);
 		}
 		if (!FMath::IsNearlyZero(Armor.CorruptionResistance))
 		{
-			AddFlatModifier(Effect, UHunterAttributeSet::GetCorruptionResistanceFlatBonusAttribute(), Armor.CorruptionResistance);
-			++ModifiersAdded;
+			AddFlatModifier(OutModifiers, UHunterAttributeSet::GetCorruptionResistanceFlatBonusAttribute(), Armor.CorruptionResistance);
 		}
 	}
 
-	if (ModifiersAdded == 0)
-	{
-		UE_LOG(LogStatsManager, Verbose, TEXT("CreateEquipmentEffect: No valid modifiers were found for Item=%s."), *Item->GetName());
-		return FGameplayEffectSpecHandle();
-	}
-
-	FGameplayEffectContextHandle EffectContext = ASC->MakeEffectContext();
-	EffectContext.AddSourceObject(Item);
-
-	FGameplayEffectSpecHandle SpecHandle;
-	SpecHandle.Data = MakeShared<FGameplayEffectSpec>(Effect, EffectContext, 1.0f);
-
-	UE_LOG(LogStatsManager, Verbose, TEXT("StatsManager: Created equipment effect for item '%s' with %d modifiers"),
-		*Item->GetName(), ModifiersAdded);
-
-	return SpecHandle;
+	return OutModifiers.Num() > 0;
 }
 
-bool FEquipmentStatsApplier::ApplyStatModifier(UGameplayEffect* Effect, const FPHAttributeData& Stat, const FGameplayAttribute& Attribute)
+bool FEquipmentStatsApplier::ResolveStatModifier(const FPHAttributeData& Stat, const FGameplayAttribute& Attribute,
+	FEquipmentAttributeModifier& OutModifier)
 {
-	if (!Effect || !Attribute.IsValid())
+	if (!Attribute.IsValid())
 	{
 		return false;
 	}
@@ -513,14 +815,28 @@ bool FEquipmentStatsApplier::ApplyStatModifier(UGameplayEffect* Effect, const FP
 		return false;
 	}
 
-	FGameplayModifierInfo Modifier;
-	Modifier.Attribute = Attribute;
-	Modifier.ModifierOp = ResolvedModifier.ModOp;
-	Modifier.ModifierMagnitude = FScalableFloat(ResolvedModifier.Magnitude);
-	Effect->Modifiers.Add(Modifier);
+	OutModifier.Attribute = Attribute;
+	OutModifier.ModOp = ResolvedModifier.ModOp;
+	OutModifier.Magnitude = ResolvedModifier.Magnitude;
 
 	UE_LOG(LogStatsManager, VeryVerbose, TEXT("StatsManager: Added modifier: %s (%s) = %.2f [Op: %d]"),
 		*Attribute.GetName(), *Stat.AttributeName.ToString(), ResolvedModifier.Magnitude, static_cast<int32>(ResolvedModifier.ModOp));
 
 	return true;
 }
+
+bool FEquipmentStatsApplier::ApplyStatModifier(UGameplayEffect* Effect, const FPHAttributeData& Stat, const FGameplayAttribute& Attribute)
+{
+	FEquipmentAttributeModifier Resolved;
+	if (!Effect || !ResolveStatModifier(Stat, Attribute, Resolved))
+	{
+		return false;
+	}
+
+	FGameplayModifierInfo Modifier;
+	Modifier.Attribute = Resolved.Attribute;
+	Modifier.ModifierOp = Resolved.ModOp;
+	Modifier.ModifierMagnitude = FScalableFloat(Resolved.Magnitude);
+	Effect->Modifiers.Add(Modifier);
+	return true;
+}
@@ -1,11 +1,38 @@
 #include "Stats/Library/FunctionLibraries/StatsAttributeResolver.h"
 
+#include "AbilitySystem/HunterAttributeRegistry.h"
 #include "AbilitySystem/HunterAttributeSet.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemInterface.h"
 #include "Stats/Data/BaseStatsData.h"
 #include "Stats/Components/StatsManager.h"
 
+namespace StatsAttributeResolverPrivate
+{
+	// The pre-registry FindAttributeByName, kept as the benchmark baseline and the
+	// reference the registry is checked against.
+	FGameplayAttribute FindAttributeByNameReflected(FName AttributeName)
+	{
+		for (TFieldIterator<FProperty> PropIt(UHunterAttributeSet::StaticClass()); PropIt; ++PropIt)
+		{
+			FProperty* Property = *PropIt;
+
+			const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+			if (StructProperty && StructProperty->Struct == FGameplayAttributeData::StaticStruct() && Property->GetFName() == AttributeName)
+			{
+				return FGameplayAttribute(Property);
+			}
+		}
+
+		return FGameplayAttribute();
+	}
+
+	double ToPerSecond(int32 Count, double Seconds)
+	{
+		return Seconds > 0.0 ? static_cast<double>(Count) / Seconds : 0.0;
+	}
+}
+
 UHunterAttributeSet* FStatsAttributeResolver::GetAttributeSet(const UStatsManager& Manager)
 {
 	UAbilitySystemComponent* ASC = GetAbilitySystemComponent(Manager);
@@ -168,49 +195,68 @@ bool FStatsAttributeResolver::ResolveAttributeByName(const UStatsManager& Manage
 		*OutDefinition = FStatInitializationEntry();
 	}
 
+	// Failed resolves repeat every stat read; warnings are keyed without formatting
+	// and the message is only built the first time.
+	static const FName MissingSourceClassWarning(TEXT("ResolveMissingSourceClass"));
+	static const FName UnsupportedSourceClassWarning(TEXT("ResolveUnsupportedSourceClass"));
+	static const FName ResolveFailedWarning(TEXT("ResolveFailed"));
+
 	const TSubclassOf<UAttributeSet> AttributeSetClass = GetSourceAttributeSetClass(Manager);
 	if (!AttributeSetClass)
 	{
-		Manager.LogWarningOnce(
-			FString::Printf(TEXT("ResolveMissingSourceClass:%s"), *AttributeName.ToString()),
-			FString::Printf(
+		Manager.LogWarningOnce(MissingSourceClassWarning, nullptr, AttributeName, [&Manager, AttributeName]()
+		{
+			return FString::Printf(
 				TEXT("ResolveAttributeByName: Missing SourceAttributeSetClass for actor=%s while resolving attribute=%s"),
 				*GetNameSafe(Manager.GetOwner()),
-				*AttributeName.ToString()));
+				*AttributeName.ToString());
+		});
 		return false;
 	}
 
+	const FHunterAttributeRegistry& Registry = FHunterAttributeRegistry::Get();
+	int32 AttributeIndex = INDEX_NONE;
 	if (AttributeSetClass->IsChildOf(UHunterAttributeSet::StaticClass()))
 	{
-		OutAttribute = UHunterAttributeSet::FindAttributeByName(AttributeName);
+		AttributeIndex = Registry.FindIndex(AttributeName);
+		OutAttribute = Registry.GetAttribute(AttributeIndex);
 	}
 	else
 	{
-		Manager.LogWarningOnce(
-			FString::Printf(TEXT("ResolveUnsupportedSourceClass:%s:%s"), *GetNameSafe(AttributeSetClass), *AttributeName.ToString()),
-			FString::Printf(
+		Manager.LogWarningOnce(UnsupportedSourceClassWarning, AttributeSetClass, AttributeName, [&Manager, &AttributeSetClass, AttributeName]()
+		{
+			return FString::Printf(
 				TEXT("ResolveAttributeByName: SourceAttributeSetClass=%s is not supported by UHunterAttributeSet::FindAttributeByName for actor=%s attribute=%s"),
 				*GetNameSafe(AttributeSetClass),
 				*GetNameSafe(Manager.GetOwner()),
-				*AttributeName.ToString()));
+				*AttributeName.ToString());
+		});
 	}
 
 	if (!OutAttribute.IsValid())
 	{
-		Manager.LogWarningOnce(
-			FString::Printf(TEXT("ResolveFailed:%s:%s"), *GetNameSafe(AttributeSetClass), *AttributeName.ToString()),
-			FString::Printf(
+		Manager.LogWarningOnce(ResolveFailedWarning, AttributeSetClass, AttributeName, [&Manager, &AttributeSetClass, AttributeName]()
+		{
+			return FString::Printf(
 				TEXT("ResolveAttributeByName: Failed to resolve attribute=%s for actor=%s SourceAttributeSetClass=%s"),
 				*AttributeName.ToString(),
 				*GetNameSafe(Manager.GetOwner()),
-				*GetNameSafe(AttributeSetClass)));
+				*GetNameSafe(AttributeSetClass));
+		});
 		return false;
 	}
 
 	if (OutDefinition && Manager.StatsData)
 	{
+		// BaseAttributes is rebuilt in reflected order, so the registry's definition
+		// index finds the authored row directly unless the asset is stale.
 		const TArray<FStatInitializationEntry>& Definitions = Manager.StatsData->GetBaseAttributes();
-		if (const FStatInitializationEntry* Found = Definitions.FindByPredicate([&](const FStatInitializationEntry& Entry)
+		const int32 HintIndex = Registry.GetDefinitionIndex(AttributeIndex);
+		if (Definitions.IsValidIndex(HintIndex) && Definitions[HintIndex].StatName == AttributeName)
+		{
+			*OutDefinition = Definitions[HintIndex];
+		}
+		else if (const FStatInitializationEntry* Found = Definitions.FindByPredicate([&](const FStatInitializationEntry& Entry)
 		{
 			return Entry.StatName == AttributeName;
 		}))
@@ -221,12 +267,9 @@ bool FStatsAttributeResolver::ResolveAttributeByName(const UStatsManager& Manage
 
 	if (OutDefinition && !OutDefinition->IsValid())
 	{
-		TArray<FStatInitializationEntry> ReflectedDefinitions;
-		UBaseStatsData::GatherStatDefinitionsFromAttributeSet(AttributeSetClass, ReflectedDefinitions);
-		if (const FStatInitializationEntry* Found = ReflectedDefinitions.FindByPredicate([&AttributeName](const FStatInitializationEntry& Entry)
-		{
-			return Entry.StatName == AttributeName;
-		}))
+		// The attribute is declared on UHunterAttributeSet, so its reflected definition
+		// is the same for any subclass the source class might be.
+		if (const FStatInitializationEntry* Found = Registry.GetDefinition(AttributeIndex))
 		{
 			*OutDefinition = *Found;
 		}
@@ -261,17 +304,22 @@ float FStatsAttributeResolver::GetAttributeValue(const UStatsManager& Manager, c
 
 bool FStatsAttributeResolver::HasLiveAttribute(const UStatsManager& Manager, const FGameplayAttribute& Attribute)
 {
-	const FString AttributeName = Attribute.IsValid() ? Attribute.GetName() : TEXT("Invalid");
+	// Names are only formatted the first time a warning is emitted; this runs for every stat read.
+	static const FName MissingASCWarning(TEXT("HasLiveAttributeMissingASC"));
+	static const FName MissingLiveSetWarning(TEXT("HasLiveAttributeMissingLiveSet"));
+
+	const FName AttributeFName = Attribute.GetUProperty() ? Attribute.GetUProperty()->GetFName() : NAME_None;
 	UAbilitySystemComponent* ASC = GetAbilitySystemComponent(Manager);
 	if (!ASC)
 	{
-		Manager.LogWarningOnce(
-			FString::Printf(TEXT("HasLiveAttributeMissingASC:%s"), *AttributeName),
-			FString::Printf(
+		Manager.LogWarningOnce(MissingASCWarning, nullptr, AttributeFName, [&Manager, &Attribute]()
+		{
+			return FString::Printf(
 				TEXT("HasLiveAttribute: No ASC for actor=%s while checking attribute=%s SourceAttributeSetClass=%s"),
 				*GetNameSafe(Manager.GetOwner()),
-				*AttributeName,
-				*GetNameSafe(GetSourceAttributeSetClass(Manager))));
+				Attribute.IsValid() ? *Attribute.GetName() : TEXT("Invalid"),
+				*GetNameSafe(GetSourceAttributeSetClass(Manager)));
+		});
 		return false;
 	}
 
@@ -289,20 +337,21 @@ bool FStatsAttributeResolver::HasLiveAttribute(const UStatsManager& Manager, con
 		ASC,
 		AttributeSetClass ? AttributeSetClass : GetSourceAttributeSetClass(Manager).Get(),
 		true,
-		FName(*AttributeName));
+		AttributeFName);
 	const bool bHasLiveAttribute = LiveAttributeSet && ASC->HasAttributeSetForAttribute(Attribute);
 	if (!bHasLiveAttribute)
 	{
-		Manager.LogWarningOnce(
-			FString::Printf(TEXT("HasLiveAttributeMissingLiveSet:%s"), *AttributeName),
-			FString::Printf(
+		Manager.LogWarningOnce(MissingLiveSetWarning, AttributeSetClass, AttributeFName, [&]()
+		{
+			return FString::Printf(
 				TEXT("HasLiveAttribute: Attribute=%s has no live backing set. Actor=%s ASC=%s SourceAttributeSetClass=%s AttributeSetClass=%s LiveAttributeSet=%s"),
-				*AttributeName,
+				*Attribute.GetName(),
 				*GetNameSafe(Manager.GetOwner()),
 				*GetNameSafe(ASC),
 				*GetNameSafe(GetSourceAttributeSetClass(Manager)),
 				*GetNameSafe(AttributeSetClass),
-				*GetNameSafe(LiveAttributeSet)));
+				*GetNameSafe(LiveAttributeSet));
+		});
 	}
 	else
 	{
@@ -310,7 +359,7 @@ bool FStatsAttributeResolver::HasLiveAttribute(const UStatsManager& Manager, con
 			LogStatsManager,
 			VeryVerbose,
 			TEXT("HasLiveAttribute: Attribute=%s is live for actor=%s ASC=%s LiveAttributeSet=%s"),
-			*AttributeName,
+			*Attribute.GetName(),
 			*GetNameSafe(Manager.GetOwner()),
 			*GetNameSafe(ASC),
 			*GetNameSafe(LiveAttributeSet));
@@ -344,5 +393,113 @@ void FStatsAttributeResolver::GatherStatDefinitions(const UStatsManager& Manager
 		return;
 	}
 
-	UBaseStatsData::GatherStatDefinitionsFromAttributeSet(GetSourceAttributeSetClass(Manager), OutDefinitions);
+	const TSubclassOf<UAttributeSet> AttributeSetClass = GetSourceAttributeSetClass(Manager);
+	if (AttributeSetClass == UHunterAttributeSet::StaticClass())
+	{
+		OutDefinitions = FHunterAttributeRegistry::Get().GetDefinitions();
+		return;
+	}
+
+	UBaseStatsData::GatherStatDefinitionsFromAttributeSet(AttributeSetClass, OutDefinitions);
+}
+
+FStatsAttributeResolveBenchmarkResult FStatsAttributeResolver::BenchmarkResolve(const UStatsManager& Manager, int32 Iterations, int32 DefinitionIterations)
+{
+	using namespace StatsAttributeResolverPrivate;
+
+	const FHunterAttributeRegistry& Registry = FHunterAttributeRegistry::Get();
+
+	FStatsAttributeResolveBenchmarkResult Result;
+	Result.Iterations = FMath::Max(1, Iterations);
+	Result.DefinitionIterations = FMath::Max(1, DefinitionIterations);
+	Result.AttributeCount = Registry.Num();
+	if (Result.AttributeCount == 0)
+	{
+		return Result;
+	}
+
+	const UEnum* AttributeEnum = StaticEnum<EHunterAttribute>();
+	const int32 EnumCount = static_cast<int32>(EHunterAttribute::MAX);
+
+	for (int32 Index = 0; Index < Result.AttributeCount; ++Index)
+	{
+		const FName AttributeName = Registry.GetAttributeName(Index);
+		if (FindAttributeByNameReflected(AttributeName) != Registry.FindAttribute(AttributeName))
+		{
+			++Result.Mismatches;
+		}
+	}
+
+	for (int32 EnumValue = 0; AttributeEnum && EnumValue < EnumCount; ++EnumValue)
+	{
+		const EHunterAttribute AttributeType = static_cast<EHunterAttribute>(EnumValue);
+		const FName EnumName(*AttributeEnum->GetNameStringByValue(EnumValue));
+		if (FindAttributeByNameReflected(EnumName) != Registry.GetAttribute(AttributeType))
+		{
+			++Result.Mismatches;
+		}
+	}
+
+	// Every timed loop counts its hits so the lookups cannot be optimized away.
+	int32 Resolved = 0;
+
+	double StartSeconds = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Result.Iterations; ++Iteration)
+	{
+		Resolved += FindAttributeByNameReflected(Registry.GetAttributeName(Iteration % Result.AttributeCount)).IsValid() ? 1 : 0;
+	}
+	Result.ReflectedResolvesPerSecond = ToPerSecond(Result.Iterations, FPlatformTime::Seconds() - StartSeconds);
+
+	StartSeconds = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Result.Iterations; ++Iteration)
+	{
+		Resolved += Registry.FindAttribute(Registry.GetAttributeName(Iteration % Result.AttributeCount)).IsValid() ? 1 : 0;
+	}
+	Result.RegistryResolvesPerSecond = ToPerSecond(Result.Iterations, FPlatformTime::Seconds() - StartSeconds);
+
+	StartSeconds = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Result.Iterations; ++Iteration)
+	{
+		Resolved += Registry.GetAttribute(static_cast<EHunterAttribute>(Iteration % EnumCount)).IsValid() ? 1 : 0;
+	}
+	Result.EnumResolvesPerSecond = ToPerSecond(Result.Iterations, FPlatformTime::Seconds() - StartSeconds);
+
+	TArray<FStatInitializationEntry> ReflectedDefinitions;
+	StartSeconds = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Result.DefinitionIterations; ++Iteration)
+	{
+		const FName AttributeName = Registry.GetAttributeName(Iteration % Result.AttributeCount);
+		UBaseStatsData::GatherStatDefinitionsFromAttributeSet(UHunterAttributeSet::StaticClass(), ReflectedDefinitions);
+		Resolved += ReflectedDefinitions.ContainsByPredicate([AttributeName](const FStatInitializationEntry& Entry)
+		{
+			return Entry.StatName == AttributeName;
+		}) ? 1 : 0;
+	}
+	Result.ReflectedDefinitionResolvesPerSecond = ToPerSecond(Result.DefinitionIterations, FPlatformTime::Seconds() - StartSeconds);
+
+	StartSeconds = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Result.Iterations; ++Iteration)
+	{
+		Resolved += Registry.FindDefinition(Registry.GetAttributeName(Iteration % Result.AttributeCount)) ? 1 : 0;
+	}
+	Result.RegistryDefinitionResolvesPerSecond = ToPerSecond(Result.Iterations, FPlatformTime::Seconds() - StartSeconds);
+
+	FGameplayAttribute Attribute;
+	FStatInitializationEntry Definition;
+	StartSeconds = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Result.Iterations; ++Iteration)
+	{
+		Resolved += ResolveAttributeByName(Manager, Registry.GetAttributeName(Iteration % Result.AttributeCount), Attribute, &Definition) ? 1 : 0;
+	}
+	Result.ResolverResolvesPerSecond = ToPerSecond(Result.Iterations, FPlatformTime::Seconds() - StartSeconds);
+
+	UE_LOG(LogStatsManager, Log,
+		TEXT("BenchmarkResolve: %d attributes, %d mismatches (%d hits) | by name: reflected %.0f/s, registry %.0f/s, enum %.0f/s | "
+		     "definitions: reflected %.0f/s, registry %.0f/s | resolver %.0f/s"),
+		Result.AttributeCount, Result.Mismatches, Resolved,
+		Result.ReflectedResolvesPerSecond, Result.RegistryResolvesPerSecond, Result.EnumResolvesPerSecond,
+		Result.ReflectedDefinitionResolvesPerSecond, Result.RegistryDefinitionResolvesPerSecond,
+		Result.ResolverResolvesPerSecond);
+
+	return Result;
 }
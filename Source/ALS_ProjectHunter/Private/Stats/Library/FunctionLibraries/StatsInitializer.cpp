@@ -1,5 +1,6 @@
 #include "Stats/Library/FunctionLibraries/StatsInitializer.h"
 
+#include "AbilitySystem/HunterAttributeRegistry.h"
 #include "AbilitySystem/HunterAttributeSet.h"
 #include "AbilitySystemComponent.h"
 #include "Core/Logging/ProjectHunterLogMacros.h"
@@ -211,8 +212,14 @@ void FStatsInitializer::InitializeFromDataAsset(UStatsManager& Manager, UBaseSta
 
 	const TMap<FName, float> StatsMap = InStatsData->GetAllStatsAsMap();
 
-	TArray<FStatInitializationEntry> ReflectedDefinitions;
-	UBaseStatsData::GatherStatDefinitionsFromAttributeSet(SourceClass, ReflectedDefinitions);
+	// Only counted for the summary log; the registry already holds UHunterAttributeSet's rows.
+	int32 ReflectedDefinitionCount = FHunterAttributeRegistry::Get().GetDefinitions().Num();
+	if (SourceClass != UHunterAttributeSet::StaticClass())
+	{
+		TArray<FStatInitializationEntry> ReflectedDefinitions;
+		UBaseStatsData::GatherStatDefinitionsFromAttributeSet(SourceClass, ReflectedDefinitions);
+		ReflectedDefinitionCount = ReflectedDefinitions.Num();
+	}
 
 	AttributeSet->SetIsInitializingStats(true);
 
@@ -344,7 +351,7 @@ void FStatsInitializer::InitializeFromDataAsset(UStatsManager& Manager, UBaseSta
 		TEXT("Stats initialized from %s using AttributeSet %s. Reflected=%d Authored=%d Applied=%d Skipped=%d InitEffectsApplied=%d InitEffectsSkipped=%d"),
 		*InStatsData->GetName(),
 		*GetNameSafe(SourceClass),
-		ReflectedDefinitions.Num(),
+		ReflectedDefinitionCount,
 		StatsMap.Num(),
 		AppliedCount,
 		SkippedCount,
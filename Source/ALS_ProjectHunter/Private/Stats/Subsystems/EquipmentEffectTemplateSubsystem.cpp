@@ -0,0 +1,43 @@
+#include "Stats/Subsystems/EquipmentEffectTemplateSubsystem.h"
+
+#include "GameplayEffect.h"
+#include "Tags/PHGameplayTags.h"
+
+void UEquipmentEffectTemplateSubsystem::Deinitialize()
+{
+	Templates.Reset();
+	AllTemplates.Reset();
+	Super::Deinitialize();
+}
+
+const UGameplayEffect* UEquipmentEffectTemplateSubsystem::GetModifierTemplate(const FEquipmentModifierChannelKey& Key)
+{
+	if (const TObjectPtr<UGameplayEffect>* Existing = Templates.Find(Key))
+	{
+		return *Existing;
+	}
+
+	if (!Key.Attribute.IsValid())
+	{
+		return nullptr;
+	}
+
+	const FName TemplateName = MakeUniqueObjectName(this, UGameplayEffect::StaticClass(),
+		*FString::Printf(TEXT("GE_Equipment_%s_%s"), *Key.Attribute.GetName(), *EGameplayModOpToString(Key.ModOp)));
+
+	UGameplayEffect* Template = NewObject<UGameplayEffect>(this, TemplateName, RF_Transient);
+	Template->DurationPolicy = EGameplayEffectDurationType::Infinite;
+
+	FSetByCallerFloat SetByCaller;
+	SetByCaller.DataTag = FPHGameplayTags::Data_Equipment_Magnitude;
+
+	FGameplayModifierInfo Modifier;
+	Modifier.Attribute = Key.Attribute;
+	Modifier.ModifierOp = Key.ModOp;
+	Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(SetByCaller);
+	Template->Modifiers.Add(Modifier);
+
+	Templates.Add(Key, Template);
+	AllTemplates.Add(Template);
+	return Template;
+}
@@ -4,18 +4,36 @@
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemInterface.h"
 #include "Character/PHBaseCharacter.h"
+#include "Character/Components/PHCharacterMovementComponent.h"
+#include "Engine/World.h"
 #include "GameFramework/Character.h"
+#include "HAL/IConsoleManager.h"
 #include "Tags/PHGameplayTags.h"
 #include "Tags/Debug/TagDebugManager.h"
+#include "Tags/Subsystems/TagConditionSubsystem.h"
 
 DEFINE_LOG_CATEGORY(LogTagManager);
 
+DECLARE_CYCLE_STAT(TEXT("Legacy Poll (component tick)"), STAT_TagManager_LegacyPoll, STATGROUP_TagConditions);
+
+#if !UE_BUILD_SHIPPING
+static TAutoConsoleVariable<int32> CVarTagManagerLegacyPolling(
+	TEXT("Hunter.Debug.TagManagerLegacyPolling"),
+	0,
+	TEXT("Restore the old ticking condition poll on TagManagers initialized afterwards, for A/B with `stat TagConditions`\n")
+	TEXT("0: Event-driven refresh through UTagConditionSubsystem (default)\n")
+	TEXT("1: Tick every TagManager and poll movement/combat conditions every 0.1s"),
+	ECVF_Cheat
+);
+#endif
+
 namespace TagManagerPrivate
 {
 	constexpr float LowResourceThreshold = 0.35f;
-	constexpr float MovementStartSpeedThresholdSq = 400.0f;
-	constexpr float MovementStopSpeedThresholdSq = 25.0f;
-	constexpr float ConditionRefreshInterval = 0.1f;
+
+#if !UE_BUILD_SHIPPING
+	constexpr float LegacyConditionRefreshInterval = 0.1f;
+#endif
 
 	float GetEffectiveMaxValue(const float EffectiveMaxValue, const float RawMaxValue)
 	{
@@ -53,7 +71,13 @@ namespace TagManagerPrivate
 
 UTagManager::UTagManager()
 {
+	// OPT-TAGEVENTS: Conditions refresh through UTagConditionSubsystem. The
+	// tick only draws debug (or runs the legacy poll) and never exists in shipping.
+#if UE_BUILD_SHIPPING
+	PrimaryComponentTick.bCanEverTick = false;
+#else
 	PrimaryComponentTick.bCanEverTick = true;
+#endif
 	PrimaryComponentTick.bStartWithTickEnabled = false;
 	SetIsReplicatedByDefault(false);
 }
@@ -104,7 +128,19 @@ void UTagManager::BeginPlay()
 
 void UTagManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	UnbindConditionEventDelegates();
 	UnbindAttributeChangeDelegates();
+
+	if (bRegisteredWithConditionSubsystem)
+	{
+		if (UTagConditionSubsystem* Subsystem = GetConditionSubsystem())
+		{
+			Subsystem->UnregisterManager(this);
+		}
+		bRegisteredWithConditionSubsystem = false;
+	}
+
+	bQueuedForConditionFlush = false;
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -117,13 +153,14 @@ void UTagManager::TickComponent(float DeltaTime, ELevelTick TickType, FActorComp
 	{
 		DebugManager.DrawDebug(this, this);
 	}
-#endif
 
-	if (!ASC)
+	if (!bLegacyConditionPolling || !ASC)
 	{
 		return;
 	}
 
+	SCOPE_CYCLE_COUNTER(STAT_TagManager_LegacyPoll);
+
 	if (bBaseConditionsDirty)
 	{
 		bBaseConditionsDirty = false;
@@ -131,11 +168,12 @@ void UTagManager::TickComponent(float DeltaTime, ELevelTick TickType, FActorComp
 	}
 
 	ConditionRefreshAccumulator += DeltaTime;
-	if (ConditionRefreshAccumulator >= TagManagerPrivate::ConditionRefreshInterval)
+	if (ConditionRefreshAccumulator >= TagManagerPrivate::LegacyConditionRefreshInterval)
 	{
 		ConditionRefreshAccumulator = 0.0f;
 		RefreshMovementConditionTags();
 	}
+#endif
 }
 
 void UTagManager::Initialize(UAbilitySystemComponent* InASC)
@@ -147,21 +185,31 @@ void UTagManager::Initialize(UAbilitySystemComponent* InASC)
 
 	if (ASC)
 	{
+		UnbindConditionEventDelegates();
 		UnbindAttributeChangeDelegates();
 	}
 
 	ASC = InASC;
 
-#if UE_BUILD_SHIPPING
-	SetComponentTickEnabled(ASC != nullptr);
-#else
-	SetComponentTickEnabled(ASC != nullptr || DebugManager.bEnableDebug);
+#if !UE_BUILD_SHIPPING
+	bLegacyConditionPolling = CVarTagManagerLegacyPolling.GetValueOnGameThread() != 0;
+	SetComponentTickEnabled(bLegacyConditionPolling || DebugManager.bEnableDebug);
 #endif
 
+	if (!bRegisteredWithConditionSubsystem)
+	{
+		if (UTagConditionSubsystem* Subsystem = GetConditionSubsystem())
+		{
+			Subsystem->RegisterManager(this);
+			bRegisteredWithConditionSubsystem = true;
+		}
+	}
+
 	UE_LOG(LogTagManager, Verbose, TEXT("Initialized TagManager for owner %s with ASC %s."), *GetNameSafe(GetOwner()), *GetNameSafe(ASC));
 
 	ApplyPendingStates();
 	BindAttributeChangeDelegates();
+	BindConditionEventDelegates();
 	RefreshBaseConditionTags();
 }
 
@@ -393,12 +441,22 @@ bool UTagManager::ComputeMovementConditionState(const ACharacter* CharacterOwner
 		return false;
 	}
 
+	if (!bLegacyConditionPolling)
+	{
+		if (const UPHCharacterMovementComponent* Movement = GetPHMovementComponent())
+		{
+			bHasMovementConditionState = true;
+			bLastMovementConditionMoving = Movement->IsMovingForConditions();
+			return bLastMovementConditionMoving;
+		}
+	}
+
 	const float SpeedSq = CharacterOwner->GetVelocity().SizeSquared2D();
 	const bool bMoving = !bHasMovementConditionState
-		? SpeedSq > TagManagerPrivate::MovementStartSpeedThresholdSq
+		? SpeedSq > UPHCharacterMovementComponent::MovementConditionStartSpeedSq
 		: (bLastMovementConditionMoving
-			? SpeedSq > TagManagerPrivate::MovementStopSpeedThresholdSq
-			: SpeedSq > TagManagerPrivate::MovementStartSpeedThresholdSq);
+			? SpeedSq > UPHCharacterMovementComponent::MovementConditionStopSpeedSq
+			: SpeedSq > UPHCharacterMovementComponent::MovementConditionStartSpeedSq);
 
 	bHasMovementConditionState = true;
 	bLastMovementConditionMoving = bMoving;
@@ -429,7 +487,7 @@ void UTagManager::SetTagDebugEnabled(bool bEnable)
 	const bool bWasEnabled = DebugManager.bEnableDebug;
 	DebugManager.bEnableDebug = bEnable;
 
-	SetComponentTickEnabled(bEnable || ASC != nullptr);
+	SetComponentTickEnabled(bEnable || bLegacyConditionPolling);
 
 	if (bWasEnabled && !DebugManager.bEnableDebug)
 	{
@@ -489,7 +547,7 @@ void UTagManager::BindAttributeChangeDelegates()
 	auto OnResourceChanged = [this](const FOnAttributeChangeData& Data)
 	{
 		(void)Data;
-		bBaseConditionsDirty = true;
+		MarkConditionsDirty(true, false);
 	};
 
 	if (!GetHunterAttributeSet())
@@ -537,3 +595,131 @@ void UTagManager::UnbindAttributeChangeDelegates()
 
 	AttributeDelegateBindings.Reset();
 }
+
+void UTagManager::BindConditionEventDelegates()
+{
+	UnbindConditionEventDelegates();
+
+	if (UPHCharacterMovementComponent* Movement = GetPHMovementComponent())
+	{
+		MovementConditionHandle = Movement->OnMovementConditionChanged.AddUObject(
+			this, &UTagManager::HandleMovementConditionChanged);
+	}
+
+	if (!ASC)
+	{
+		return;
+	}
+
+	// InCombat is derived from these; their add/remove replaces the old poll.
+	const FPHGameplayTags& Tags = FPHGameplayTags::Get();
+	const FGameplayTag CombatSourceTags[] =
+	{
+		Tags.Condition_TakingDamage,
+		Tags.Condition_DealingDamage,
+		Tags.Condition_RecentlyHit,
+		Tags.Condition_RecentlyUsedSkill
+	};
+
+	for (const FGameplayTag& Tag : CombatSourceTags)
+	{
+		FDelegateHandle Handle = ASC->RegisterGameplayTagEvent(Tag, EGameplayTagEventType::NewOrRemoved)
+			.AddUObject(this, &UTagManager::HandleCombatTagChanged);
+		CombatTagEventBindings.Add({ Tag, Handle });
+	}
+}
+
+void UTagManager::UnbindConditionEventDelegates()
+{
+	if (MovementConditionHandle.IsValid())
+	{
+		if (UPHCharacterMovementComponent* Movement = GetPHMovementComponent())
+		{
+			Movement->OnMovementConditionChanged.Remove(MovementConditionHandle);
+		}
+		MovementConditionHandle.Reset();
+	}
+
+	if (ASC)
+	{
+		for (const FTagEventDelegateBinding& Binding : CombatTagEventBindings)
+		{
+			ASC->UnregisterGameplayTagEvent(Binding.Handle, Binding.Tag, EGameplayTagEventType::NewOrRemoved);
+		}
+	}
+
+	CombatTagEventBindings.Reset();
+}
+
+void UTagManager::MarkConditionsDirty(const bool bBaseConditions, const bool bMovementConditions)
+{
+	bBaseConditionsDirty |= bBaseConditions;
+	bMovementConditionsDirty |= bMovementConditions;
+
+	// The legacy poll picks the flags up from TickComponent.
+	if (bQueuedForConditionFlush || bLegacyConditionPolling || !ASC)
+	{
+		return;
+	}
+
+	if (UTagConditionSubsystem* Subsystem = GetConditionSubsystem())
+	{
+		bQueuedForConditionFlush = true;
+		Subsystem->EnqueueDirtyManager(this);
+		return;
+	}
+
+	// No world subsystem (editor preview worlds); refresh inline.
+	FlushDirtyConditions();
+}
+
+void UTagManager::FlushDirtyConditions()
+{
+	const bool bBaseDirty = bBaseConditionsDirty;
+	const bool bMovementDirty = bMovementConditionsDirty;
+	bQueuedForConditionFlush = false;
+	bBaseConditionsDirty = false;
+	bMovementConditionsDirty = false;
+
+	if (!ASC)
+	{
+		return;
+	}
+
+	if (bBaseDirty)
+	{
+		RefreshBaseConditionTags();
+	}
+
+	// The base refresh keeps an existing InCombat tag; only the movement pass
+	// clears it once its source tags are gone.
+	if (bMovementDirty)
+	{
+		RefreshMovementConditionTags();
+	}
+}
+
+void UTagManager::HandleMovementConditionChanged(const bool bMoving)
+{
+	(void)bMoving;
+	MarkConditionsDirty(false, true);
+}
+
+void UTagManager::HandleCombatTagChanged(const FGameplayTag Tag, const int32 NewCount)
+{
+	(void)Tag;
+	(void)NewCount;
+	MarkConditionsDirty(false, true);
+}
+
+UTagConditionSubsystem* UTagManager::GetConditionSubsystem() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetSubsystem<UTagConditionSubsystem>() : nullptr;
+}
+
+UPHCharacterMovementComponent* UTagManager::GetPHMovementComponent() const
+{
+	const ACharacter* CharacterOwner = Cast<ACharacter>(GetOwner());
+	return CharacterOwner ? Cast<UPHCharacterMovementComponent>(CharacterOwner->GetCharacterMovement()) : nullptr;
+}
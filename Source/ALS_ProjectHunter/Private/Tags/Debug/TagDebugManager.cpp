@@ -257,6 +257,7 @@ void FTagDebugManager::BuildDisplayLines(UTagManager* TagManager,
         T.Condition_Self_Shocked,
         T.Condition_Self_Burned,
         T.Condition_Self_Corrupted,
+        T.Condition_Self_Poisoned,
         T.Condition_Self_Purified,
         T.Condition_Self_Petrified,
         T.Condition_Self_CannotRegenHP,
@@ -293,6 +293,7 @@ DEFINE_GAMEPLAY_TAG(Condition_Self_Frozen)
 DEFINE_GAMEPLAY_TAG(Condition_Self_Shocked)
 DEFINE_GAMEPLAY_TAG(Condition_Self_Burned)
 DEFINE_GAMEPLAY_TAG(Condition_Self_Corrupted)
+DEFINE_GAMEPLAY_TAG(Condition_Self_Poisoned)
 DEFINE_GAMEPLAY_TAG(Condition_Self_Purified)
 DEFINE_GAMEPLAY_TAG(Condition_Self_Petrified)
 DEFINE_GAMEPLAY_TAG(Condition_Self_CannotRegenHP)
@@ -346,6 +347,7 @@ DEFINE_GAMEPLAY_TAG(Data_DoT_Poison_DamagePerTick)
 DEFINE_GAMEPLAY_TAG(Data_DoT_Corruption_DamagePerTick)
 DEFINE_GAMEPLAY_TAG(Data_DoT_Chill_Magnitude)
 DEFINE_GAMEPLAY_TAG(Data_DoT_Shock_Magnitude)
+DEFINE_GAMEPLAY_TAG(Data_Equipment_Magnitude)
 
 DEFINE_GAMEPLAY_TAG(Condition_Self_IsParrying)
 DEFINE_GAMEPLAY_TAG(Condition_Self_RecentlyParried)
@@ -712,6 +714,7 @@ void FPHGameplayTags::RegisterConditions()
 	Condition_Self_Shocked                    = T.AddNativeGameplayTag("Condition.Self.Shocked",                    TEXT("Self shocked."));
 	Condition_Self_Burned                     = T.AddNativeGameplayTag("Condition.Self.Burned",                     TEXT("Self burned."));
 	Condition_Self_Corrupted                  = T.AddNativeGameplayTag("Condition.Self.Corrupted",                  TEXT("Self corrupted."));
+	Condition_Self_Poisoned                   = T.AddNativeGameplayTag("Condition.Self.Poisoned",                   TEXT("Self poisoned."));
 	Condition_Self_Purified                   = T.AddNativeGameplayTag("Condition.Self.Purified",                   TEXT("Self purified."));
 	Condition_Self_Petrified                  = T.AddNativeGameplayTag("Condition.Self.Petrified",                  TEXT("Self petrified."));
 	Condition_Self_CannotRegenHP              = T.AddNativeGameplayTag("Condition.Self.CannotRegenHP",              TEXT("Cannot regen HP."));
@@ -887,6 +890,8 @@ void FPHGameplayTags::RegisterSetByCallerDamageTags()
 	Data_DoT_Chill_Magnitude          = T.AddNativeGameplayTag("DoT.Chill.Magnitude",          TEXT("SetByCaller key: chill slow fraction."));
 	Data_DoT_Shock_Magnitude          = T.AddNativeGameplayTag("DoT.Shock.Magnitude",          TEXT("SetByCaller key: shock damage-amp fraction."));
 
+	Data_Equipment_Magnitude = T.AddNativeGameplayTag("Data.Equipment.Magnitude", TEXT("SetByCaller key: summed equipment modifier on one attribute."));
+
 	Condition_Self_IsParrying      = T.AddNativeGameplayTag("Condition.Self.IsParrying",      TEXT("Character is in the active parry window. CombatManager routes EHitResponse::Parry when this is present."));
 	Condition_Self_RecentlyParried = T.AddNativeGameplayTag("Condition.Self.RecentlyParried", TEXT("Character successfully parried within the last few seconds. Enables 'after parrying' conditional modifiers."));
 	Condition_Self_IsStaggered     = T.AddNativeGameplayTag("Condition.Self.IsStaggered",     TEXT("Character is in a stagger state. Set when bShouldStagger fires; cleared on stagger recovery."));
@@ -0,0 +1,92 @@
+#include "Tags/Subsystems/TagConditionSubsystem.h"
+
+#include "Tags/Components/TagManager.h"
+
+DEFINE_LOG_CATEGORY(LogTagConditions);
+
+DECLARE_CYCLE_STAT(TEXT("Flush Dirty Conditions"), STAT_TagConditions_Flush, STATGROUP_TagConditions);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Registered Managers"), STAT_TagConditions_Registered, STATGROUP_TagConditions);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Managers Flushed"), STAT_TagConditions_Flushed, STATGROUP_TagConditions);
+
+void UTagConditionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	DirtyManagers.Reset();
+	RegisteredManagerCount = 0;
+	LastFrameFlushCount = 0;
+	LastFrameFlushMs = 0.0f;
+}
+
+void UTagConditionSubsystem::Deinitialize()
+{
+	DirtyManagers.Reset();
+	RegisteredManagerCount = 0;
+	Super::Deinitialize();
+}
+
+TStatId UTagConditionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UTagConditionSubsystem, STATGROUP_Tickables);
+}
+
+void UTagConditionSubsystem::RegisterManager(UTagManager* Manager)
+{
+	if (IsValid(Manager))
+	{
+		++RegisteredManagerCount;
+	}
+}
+
+void UTagConditionSubsystem::UnregisterManager(UTagManager* Manager)
+{
+	if (Manager)
+	{
+		RegisteredManagerCount = FMath::Max(RegisteredManagerCount - 1, 0);
+	}
+}
+
+void UTagConditionSubsystem::EnqueueDirtyManager(UTagManager* Manager)
+{
+	if (IsValid(Manager))
+	{
+		DirtyManagers.Add(Manager);
+	}
+}
+
+void UTagConditionSubsystem::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	SET_DWORD_STAT(STAT_TagConditions_Registered, RegisteredManagerCount);
+
+	LastFrameFlushCount = 0;
+	LastFrameFlushMs = 0.0f;
+
+	if (DirtyManagers.IsEmpty())
+	{
+		SET_DWORD_STAT(STAT_TagConditions_Flushed, 0);
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_TagConditions_Flush);
+
+	// Refreshing a manager changes loose tags, which can fire tag events that
+	// dirty it (or another manager) again; those land in the next frame.
+	TArray<TWeakObjectPtr<UTagManager>> Pending = MoveTemp(DirtyManagers);
+	DirtyManagers.Reset();
+
+	const double StartSeconds = FPlatformTime::Seconds();
+
+	for (const TWeakObjectPtr<UTagManager>& WeakManager : Pending)
+	{
+		if (UTagManager* Manager = WeakManager.Get())
+		{
+			Manager->FlushDirtyConditions();
+			++LastFrameFlushCount;
+		}
+	}
+
+	LastFrameFlushMs = static_cast<float>((FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+	SET_DWORD_STAT(STAT_TagConditions_Flushed, LastFrameFlushCount);
+}
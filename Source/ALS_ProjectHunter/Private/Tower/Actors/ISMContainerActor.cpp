@@ -1,9 +1,12 @@
 #include "Tower/Actors/ISMContainerActor.h"
+#include "Async/ParallelFor.h"
 #include "Components/SceneComponent.h"
 #include "Components/InstancedStaticMeshComponent.h"
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
 
+DECLARE_CYCLE_STAT(TEXT("Ground Item Animation Tick"), STAT_GroundItemAnimationTick, STATGROUP_Game);
+
 AISMContainerActor::AISMContainerActor()
 {
 	PrimaryActorTick.bCanEverTick = true;
@@ -27,12 +30,15 @@ void AISMContainerActor::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
-	if (AnimationStates.IsEmpty() || GetNetMode() == NM_DedicatedServer)
+	if (AnimationHandles.IsEmpty() || GetNetMode() == NM_DedicatedServer)
 	{
 		RefreshAnimationTickState();
 		return;
 	}
 
+	SCOPE_CYCLE_COUNTER(STAT_GroundItemAnimationTick);
+	const double StartSeconds = FPlatformTime::Seconds();
+
 	AnimationTime += DeltaTime;
 
 	TArray<FVector, TInlineAllocator<4>> LocalViewLocations;
@@ -57,66 +63,118 @@ void AISMContainerActor::Tick(float DeltaTime)
 	}
 
 	const float RenderCullEndDistanceSq = FMath::Square(RenderCullEndDistance);
-	TSet<UInstancedStaticMeshComponent*> DirtyISMs;
+	const bool bDistanceCull = RenderCullEndDistance > 0.0f && !LocalViewLocations.IsEmpty();
 
-	for (auto& Pair : AnimationStates)
+	for (FGroundItemAnimBatch& Batch : AnimationBatches)
 	{
-		FGroundItemAnimState& State = Pair.Value;
-		if (!State.IsValid())
+		UInstancedStaticMeshComponent* ISM = Batch.ISMComponent;
+		if (!ISM || !IsValid(ISM))
 		{
 			continue;
 		}
 
-		if (bSkipRecentlyUnrenderedMeshes &&
-			!State.ISMComponent->WasRecentlyRendered(RecentlyRenderedTolerance))
+		const int32 Count = FMath::Min(Batch.Num(), ISM->GetInstanceCount());
+		if (Count == 0)
 		{
 			continue;
 		}
 
-		if (RenderCullEndDistance > 0.0f && !LocalViewLocations.IsEmpty())
+		if (bSkipRecentlyUnrenderedMeshes && !ISM->WasRecentlyRendered(RecentlyRenderedTolerance))
 		{
-			bool bWithinAnimationDistance = false;
-			for (const FVector& ViewLocation : LocalViewLocations)
+			continue;
+		}
+
+		// The batch is uploaded as one contiguous range, so distance culling only
+		// trims the ends. Out-of-range instances inside the span are animated too;
+		// the renderer already hides them.
+		int32 FirstIndex = 0;
+		int32 LastIndex = Count - 1;
+		if (bDistanceCull)
+		{
+			auto IsWithinAnimationDistance = [&](int32 Index)
 			{
-				if (FVector::DistSquared(ViewLocation, State.BaseLocation) <= RenderCullEndDistanceSq)
+				for (const FVector& ViewLocation : LocalViewLocations)
 				{
-					bWithinAnimationDistance = true;
-					break;
+					if (FVector::DistSquared(ViewLocation, Batch.BaseLocations[Index]) <= RenderCullEndDistanceSq)
+					{
+						return true;
+					}
 				}
+				return false;
+			};
+
+			while (FirstIndex <= LastIndex && !IsWithinAnimationDistance(FirstIndex))
+			{
+				++FirstIndex;
+			}
+			while (LastIndex > FirstIndex && !IsWithinAnimationDistance(LastIndex))
+			{
+				--LastIndex;
 			}
 
-			if (!bWithinAnimationDistance)
+			if (FirstIndex > LastIndex)
 			{
 				continue;
 			}
 		}
 
-		const float T = AnimationTime;
-		const float Phase = State.PhaseOffset;
+		ComputeBatchTransforms(Batch, FirstIndex, LastIndex - FirstIndex + 1);
+
+		ISM->BatchUpdateInstancesTransforms(
+			FirstIndex,
+			Batch.ScratchTransforms,
+			/*bWorldSpace=*/true,
+			/*bMarkRenderStateDirty=*/true,
+			/*bTeleport=*/true);
+	}
 
-		const float BobZ = BobAmplitudeCm * FMath::Sin(T * BobFrequencyHz * TWO_PI + Phase);
-		FVector AnimLocation = State.BaseLocation;
-		AnimLocation.Z += BobZ;
+	LastAnimationUpdateMs = static_cast<float>((FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+}
 
-		const float YawDeg = FMath::Fmod(T * SpinDegreesPerSecond + FMath::RadiansToDegrees(Phase), 360.0f);
+void AISMContainerActor::ComputeBatchTransforms(FGroundItemAnimBatch& Batch, int32 FirstIndex, int32 Count) const
+{
+	Batch.ScratchTransforms.SetNumUninitialized(Count, EAllowShrinking::No);
+
+	const float Time = AnimationTime;
+	const float BobPhase = Time * BobFrequencyHz * TWO_PI;
+	const float SpinYaw = FMath::Fmod(Time * SpinDegreesPerSecond, 360.0f);
+	const float Amplitude = BobAmplitudeCm;
+
+	const FVector* BaseLocations = Batch.BaseLocations.GetData() + FirstIndex;
+	const float* BasePitches = Batch.BasePitches.GetData() + FirstIndex;
+	const float* BaseRolls = Batch.BaseRolls.GetData() + FirstIndex;
+	const float* PhaseOffsets = Batch.PhaseOffsets.GetData() + FirstIndex;
+	FTransform* OutTransforms = Batch.ScratchTransforms.GetData();
+
+	// Straight-line loop over packed arrays with no per-item branches so the
+	// compiler can keep it tight; large groups are split across workers.
+	auto ComputeRange = [=](int32 Begin, int32 End)
+	{
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			const float Phase = PhaseOffsets[Index];
 
-		FRotator AnimRotation(State.BasePitch, YawDeg, State.BaseRoll);
-		FTransform AnimTransform(AnimRotation, AnimLocation, FVector::OneVector);
+			FVector Location = BaseLocations[Index];
+			Location.Z += Amplitude * FMath::Sin(BobPhase + Phase);
 
-		State.ISMComponent->UpdateInstanceTransform(
-			State.InstanceIndex,
-			AnimTransform,
-			/*bWorldSpace=*/true,
-			/*bMarkRenderStateDirty=*/false,
-			/*bTeleport=*/true);
+			const FRotator Rotation(BasePitches[Index], SpinYaw + FMath::RadiansToDegrees(Phase), BaseRolls[Index]);
+			OutTransforms[Index] = FTransform(Rotation.Quaternion(), Location, FVector::OneVector);
+		}
+	};
 
-		DirtyISMs.Add(State.ISMComponent);
+	if (Count < ParallelAnimationThreshold)
+	{
+		ComputeRange(0, Count);
+		return;
 	}
 
-	for (UInstancedStaticMeshComponent* ISM : DirtyISMs)
+	constexpr int32 ChunkSize = 512;
+	const int32 NumChunks = FMath::DivideAndRoundUp(Count, ChunkSize);
+	ParallelFor(NumChunks, [&ComputeRange, Count](int32 ChunkIndex)
 	{
-		ISM->MarkRenderStateDirty();
-	}
+		const int32 Begin = ChunkIndex * ChunkSize;
+		ComputeRange(Begin, FMath::Min(Begin + ChunkSize, Count));
+	});
 }
 
 void AISMContainerActor::RegisterItemForAnimation(
@@ -136,26 +194,68 @@ void AISMContainerActor::RegisterItemForAnimation(
 		return;
 	}
 
-	FGroundItemAnimState State;
-	State.ISMComponent  = ISM;
-	State.InstanceIndex = InstanceIndex;
-	State.BaseLocation  = BaseLocation;
-	State.BasePitch     = BaseRotation.Pitch;
-	State.BaseRoll      = BaseRotation.Roll;
+	if (AnimationHandles.Contains(ItemID))
+	{
+		UnregisterItemFromAnimation(ItemID);
+	}
+
+	int32 BatchIndex = INDEX_NONE;
+	if (const int32* FoundBatch = ISMToBatchIndex.Find(ISM))
+	{
+		BatchIndex = *FoundBatch;
+	}
+	else
+	{
+		BatchIndex = AnimationBatches.AddDefaulted();
+		AnimationBatches[BatchIndex].ISMComponent = ISM;
+		ISMToBatchIndex.Add(ISM, BatchIndex);
+	}
+
+	// Slot N mirrors ISM instance N; the subsystem appends instances, so this
+	// normally grows by exactly one.
+	FGroundItemAnimBatch& Batch = AnimationBatches[BatchIndex];
+	if (Batch.Num() <= InstanceIndex)
+	{
+		Batch.SetNum(InstanceIndex + 1);
+	}
+
+	Batch.ItemIDs[InstanceIndex] = ItemID;
+	Batch.BaseLocations[InstanceIndex] = BaseLocation;
+	Batch.BasePitches[InstanceIndex] = BaseRotation.Pitch;
+	Batch.BaseRolls[InstanceIndex] = BaseRotation.Roll;
 
 	// Distribute phases using the golden angle (about 137.5 deg) so N items are
 	// evenly spread without clustering even at small N.
 	const float GoldenAngleRad = 2.399963f; // 137.508 deg in radians
-	State.PhaseOffset = FMath::Fmod(static_cast<float>(ItemID) * GoldenAngleRad, TWO_PI);
+	Batch.PhaseOffsets[InstanceIndex] = FMath::Fmod(static_cast<float>(ItemID) * GoldenAngleRad, TWO_PI);
 
-	AnimationStates.Add(ItemID, State);
+	FGroundItemAnimHandle Handle;
+	Handle.BatchIndex = BatchIndex;
+	Handle.InstanceIndex = InstanceIndex;
+	AnimationHandles.Add(ItemID, Handle);
 	RefreshAnimationTickState();
 }
 
 void AISMContainerActor::UnregisterItemFromAnimation(int32 ItemID)
 {
-	AnimationStates.Remove(ItemID);
-	if (AnimationStates.IsEmpty())
+	FGroundItemAnimHandle Handle;
+	if (AnimationHandles.RemoveAndCopyValue(ItemID, Handle))
+	{
+		// Mirror the ISM swap-removal: the last slot moves into the freed one.
+		FGroundItemAnimBatch& Batch = AnimationBatches[Handle.BatchIndex];
+		const int32 LastIndex = Batch.Num() - 1;
+		Batch.RemoveAtSwap(Handle.InstanceIndex);
+
+		if (Handle.InstanceIndex != LastIndex)
+		{
+			if (FGroundItemAnimHandle* MovedHandle = AnimationHandles.Find(Batch.ItemIDs[Handle.InstanceIndex]))
+			{
+				MovedHandle->InstanceIndex = Handle.InstanceIndex;
+			}
+		}
+	}
+
+	if (AnimationHandles.IsEmpty())
 	{
 		AnimationTime = 0.0f;
 	}
@@ -164,15 +264,34 @@ void AISMContainerActor::UnregisterItemFromAnimation(int32 ItemID)
 
 void AISMContainerActor::UpdateItemAnimationIndex(int32 ItemID, int32 NewInstanceIndex)
 {
-	if (FGroundItemAnimState* State = AnimationStates.Find(ItemID))
+	FGroundItemAnimHandle* Handle = AnimationHandles.Find(ItemID);
+	if (!Handle || Handle->InstanceIndex == NewInstanceIndex)
+	{
+		return;
+	}
+
+	FGroundItemAnimBatch& Batch = AnimationBatches[Handle->BatchIndex];
+	if (!Batch.ItemIDs.IsValidIndex(NewInstanceIndex))
+	{
+		return;
+	}
+
+	const int32 OldInstanceIndex = Handle->InstanceIndex;
+	const int32 DisplacedItemID = Batch.ItemIDs[NewInstanceIndex];
+	Batch.Swap(OldInstanceIndex, NewInstanceIndex);
+	Handle->InstanceIndex = NewInstanceIndex;
+
+	if (FGroundItemAnimHandle* DisplacedHandle = AnimationHandles.Find(DisplacedItemID))
 	{
-		State->InstanceIndex = NewInstanceIndex;
+		DisplacedHandle->InstanceIndex = OldInstanceIndex;
 	}
 }
 
 void AISMContainerActor::ClearAllAnimationState()
 {
-	AnimationStates.Empty();
+	AnimationBatches.Empty();
+	ISMToBatchIndex.Empty();
+	AnimationHandles.Empty();
 	AnimationTime = 0.0f;
 	RefreshAnimationTickState();
 }
@@ -195,6 +314,6 @@ void AISMContainerActor::RefreshAnimationTickState()
 {
 	const bool bShouldTick =
 		GetNetMode() != NM_DedicatedServer &&
-		!AnimationStates.IsEmpty();
+		!AnimationHandles.IsEmpty();
 	SetActorTickEnabled(bShouldTick);
 }
@@ -0,0 +1,292 @@
+#include "Tower/Library/Structs/GroundItemSpatialGrid.h"
+
+FGroundItemSpatialGrid::FGroundItemSpatialGrid(float InCellSize)
+{
+	CellSize = FMath::Max(InCellSize, 1.0f);
+	InvCellSize = 1.0f / CellSize;
+}
+
+void FGroundItemSpatialGrid::SetCellSize(float InCellSize)
+{
+	const float NewCellSize = FMath::Max(InCellSize, 1.0f);
+	if (FMath::IsNearlyEqual(NewCellSize, CellSize))
+	{
+		return;
+	}
+
+	TArray<FEntry> AllEntries;
+	AllEntries.Reserve(ItemToCell.Num());
+	for (const TPair<FIntPoint, TArray<FEntry>>& Pair : Cells)
+	{
+		AllEntries.Append(Pair.Value);
+	}
+
+	Reset();
+	CellSize = NewCellSize;
+	InvCellSize = 1.0f / CellSize;
+
+	for (const FEntry& Entry : AllEntries)
+	{
+		Add(Entry.ItemID, Entry.Location);
+	}
+}
+
+FIntPoint FGroundItemSpatialGrid::ToCell(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt32(Location.X * InvCellSize),
+		FMath::FloorToInt32(Location.Y * InvCellSize));
+}
+
+void FGroundItemSpatialGrid::AddToCell(const FIntPoint& Cell, int32 ItemID, const FVector& Location)
+{
+	FEntry& Entry = Cells.FindOrAdd(Cell).AddDefaulted_GetRef();
+	Entry.ItemID = ItemID;
+	Entry.Location = Location;
+	ItemToCell.Add(ItemID, Cell);
+
+	MinCell.X = FMath::Min(MinCell.X, Cell.X);
+	MinCell.Y = FMath::Min(MinCell.Y, Cell.Y);
+	MaxCell.X = FMath::Max(MaxCell.X, Cell.X);
+	MaxCell.Y = FMath::Max(MaxCell.Y, Cell.Y);
+}
+
+void FGroundItemSpatialGrid::RemoveFromCell(const FIntPoint& Cell, int32 ItemID)
+{
+	TArray<FEntry>* Bucket = Cells.Find(Cell);
+	if (!Bucket)
+	{
+		return;
+	}
+
+	const int32 Index = Bucket->IndexOfByPredicate([ItemID](const FEntry& Entry)
+	{
+		return Entry.ItemID == ItemID;
+	});
+	if (Index != INDEX_NONE)
+	{
+		Bucket->RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	}
+
+	if (Bucket->IsEmpty())
+	{
+		Cells.Remove(Cell);
+	}
+}
+
+void FGroundItemSpatialGrid::Add(int32 ItemID, const FVector& Location)
+{
+	if (ItemToCell.Contains(ItemID))
+	{
+		Update(ItemID, Location);
+		return;
+	}
+
+	AddToCell(ToCell(Location), ItemID, Location);
+}
+
+bool FGroundItemSpatialGrid::Remove(int32 ItemID)
+{
+	FIntPoint Cell;
+	if (!ItemToCell.RemoveAndCopyValue(ItemID, Cell))
+	{
+		return false;
+	}
+
+	RemoveFromCell(Cell, ItemID);
+	return true;
+}
+
+void FGroundItemSpatialGrid::Update(int32 ItemID, const FVector& NewLocation)
+{
+	const FIntPoint* OldCell = ItemToCell.Find(ItemID);
+	if (!OldCell)
+	{
+		AddToCell(ToCell(NewLocation), ItemID, NewLocation);
+		return;
+	}
+
+	const FIntPoint NewCell = ToCell(NewLocation);
+	if (NewCell == *OldCell)
+	{
+		if (TArray<FEntry>* Bucket = Cells.Find(NewCell))
+		{
+			for (FEntry& Entry : *Bucket)
+			{
+				if (Entry.ItemID == ItemID)
+				{
+					Entry.Location = NewLocation;
+					return;
+				}
+			}
+		}
+	}
+
+	RemoveFromCell(*OldCell, ItemID);
+	AddToCell(NewCell, ItemID, NewLocation);
+}
+
+void FGroundItemSpatialGrid::Reset()
+{
+	Cells.Reset();
+	ItemToCell.Reset();
+	MinCell = FIntPoint(MAX_int32, MAX_int32);
+	MaxCell = FIntPoint(MIN_int32, MIN_int32);
+}
+
+int32 FGroundItemSpatialGrid::QueryRadius(const FVector& Center, float Radius, TArray<int32>& OutItemIDs) const
+{
+	if (Cells.IsEmpty() || Radius < 0.0f)
+	{
+		return 0;
+	}
+
+	const int32 StartNum = OutItemIDs.Num();
+	const float RadiusSq = Radius * Radius;
+
+	const FIntPoint LowCell(
+		FMath::Max(FMath::FloorToInt32((Center.X - Radius) * InvCellSize), MinCell.X),
+		FMath::Max(FMath::FloorToInt32((Center.Y - Radius) * InvCellSize), MinCell.Y));
+	const FIntPoint HighCell(
+		FMath::Min(FMath::FloorToInt32((Center.X + Radius) * InvCellSize), MaxCell.X),
+		FMath::Min(FMath::FloorToInt32((Center.Y + Radius) * InvCellSize), MaxCell.Y));
+
+	if (LowCell.X > HighCell.X || LowCell.Y > HighCell.Y)
+	{
+		return 0;
+	}
+
+	auto GatherBucket = [&OutItemIDs, &Center, RadiusSq](const TArray<FEntry>& Bucket)
+	{
+		for (const FEntry& Entry : Bucket)
+		{
+			if (FVector::DistSquared(Center, Entry.Location) <= RadiusSq)
+			{
+				OutItemIDs.Add(Entry.ItemID);
+			}
+		}
+	};
+
+	// A huge radius over a sparse grid would probe mostly empty cells; walking
+	// the occupied buckets directly is cheaper at that point.
+	const int64 CellsInRange = int64(HighCell.X - LowCell.X + 1) * int64(HighCell.Y - LowCell.Y + 1);
+	if (CellsInRange > Cells.Num())
+	{
+		for (const TPair<FIntPoint, TArray<FEntry>>& Pair : Cells)
+		{
+			GatherBucket(Pair.Value);
+		}
+		return OutItemIDs.Num() - StartNum;
+	}
+
+	for (int32 X = LowCell.X; X <= HighCell.X; ++X)
+	{
+		for (int32 Y = LowCell.Y; Y <= HighCell.Y; ++Y)
+		{
+			if (const TArray<FEntry>* Bucket = Cells.Find(FIntPoint(X, Y)))
+			{
+				GatherBucket(*Bucket);
+			}
+		}
+	}
+
+	return OutItemIDs.Num() - StartNum;
+}
+
+int32 FGroundItemSpatialGrid::FindNearest(const FVector& Center, float MaxDistance, float* OutDistSq) const
+{
+	if (Cells.IsEmpty() || MaxDistance <= 0.0f)
+	{
+		return INDEX_NONE;
+	}
+
+	int32 BestID = INDEX_NONE;
+	float BestDistSq = MaxDistance * MaxDistance;
+
+	auto ScanBucket = [&BestID, &BestDistSq, &Center](const TArray<FEntry>& Bucket)
+	{
+		for (const FEntry& Entry : Bucket)
+		{
+			const float DistSq = FVector::DistSquared(Center, Entry.Location);
+			if (DistSq < BestDistSq)
+			{
+				BestDistSq = DistSq;
+				BestID = Entry.ItemID;
+			}
+		}
+	};
+
+	const FIntPoint CenterCell = ToCell(Center);
+	const int64 BoundsRing = FMath::Max(
+		FMath::Max(FMath::Abs(int64(CenterCell.X) - MinCell.X), FMath::Abs(int64(MaxCell.X) - CenterCell.X)),
+		FMath::Max(FMath::Abs(int64(CenterCell.Y) - MinCell.Y), FMath::Abs(int64(MaxCell.Y) - CenterCell.Y)));
+	const int64 DistanceRing = int64(FMath::Min(FMath::CeilToDouble(double(MaxDistance) * InvCellSize), double(MAX_int32)));
+	const int32 MaxRing = int32(FMath::Min(BoundsRing, DistanceRing));
+
+	auto ProbeCell = [this, &ScanBucket](const FIntPoint& Cell)
+	{
+		if (const TArray<FEntry>* Bucket = Cells.Find(Cell))
+		{
+			ScanBucket(*Bucket);
+		}
+	};
+
+	// Rings are cheap while items are close. When the nearest item is far away
+	// in a sparse grid, the walk would probe mostly empty cells, so once it has
+	// probed more cells than are occupied, finish with a scan of the occupied
+	// buckets instead. Re-scanning visited buckets cannot change the minimum.
+	int64 ProbedCells = 0;
+	bool bFinishWithBucketScan = false;
+
+	for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+	{
+		// Every cell in this ring is at least (Ring - 1) cells of XY distance away.
+		if (Ring > 1 && BestID != INDEX_NONE)
+		{
+			const float RingMinDist = float(Ring - 1) * CellSize;
+			if (BestDistSq <= RingMinDist * RingMinDist)
+			{
+				break;
+			}
+		}
+
+		if (ProbedCells > Cells.Num())
+		{
+			bFinishWithBucketScan = true;
+			break;
+		}
+
+		if (Ring == 0)
+		{
+			ProbeCell(CenterCell);
+			++ProbedCells;
+			continue;
+		}
+
+		for (int32 X = CenterCell.X - Ring; X <= CenterCell.X + Ring; ++X)
+		{
+			ProbeCell(FIntPoint(X, CenterCell.Y - Ring));
+			ProbeCell(FIntPoint(X, CenterCell.Y + Ring));
+		}
+		for (int32 Y = CenterCell.Y - Ring + 1; Y <= CenterCell.Y + Ring - 1; ++Y)
+		{
+			ProbeCell(FIntPoint(CenterCell.X - Ring, Y));
+			ProbeCell(FIntPoint(CenterCell.X + Ring, Y));
+		}
+		ProbedCells += int64(Ring) * 8;
+	}
+
+	if (bFinishWithBucketScan)
+	{
+		for (const TPair<FIntPoint, TArray<FEntry>>& Pair : Cells)
+		{
+			ScanBucket(Pair.Value);
+		}
+	}
+
+	if (OutDistSq && BestID != INDEX_NONE)
+	{
+		*OutDistSq = BestDistSq;
+	}
+	return BestID;
+}
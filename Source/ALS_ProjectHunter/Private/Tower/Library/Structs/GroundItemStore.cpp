@@ -0,0 +1,219 @@
+#include "Tower/Library/Structs/GroundItemStore.h"
+
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Item/ItemInstance.h"
+
+int32 FGroundItemStore::Add(UItemInstance* Item, const FVector& Location,
+	UInstancedStaticMeshComponent* ISMComponent, int32 InstanceIndex, UStaticMesh* Mesh)
+{
+	return AddInternal(Item, FCompactItemRecord(), Location, ISMComponent, InstanceIndex, Mesh);
+}
+
+int32 FGroundItemStore::AddRecord(const FCompactItemRecord& Record, const FVector& Location,
+	UInstancedStaticMeshComponent* ISMComponent, int32 InstanceIndex, UStaticMesh* Mesh)
+{
+	return AddInternal(nullptr, Record, Location, ISMComponent, InstanceIndex, Mesh);
+}
+
+int32 FGroundItemStore::AddInternal(UItemInstance* Item, const FCompactItemRecord& Record, const FVector& Location,
+	UInstancedStaticMeshComponent* ISMComponent, int32 InstanceIndex, UStaticMesh* Mesh)
+{
+	int32 SlotIndex = INDEX_NONE;
+	if (FreeSlots.Num() > 0)
+	{
+		SlotIndex = FreeSlots.Pop(EAllowShrinking::No);
+	}
+	else if (Slots.Num() < MaxSlots)
+	{
+		SlotIndex = Slots.AddDefaulted();
+	}
+	else
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 DenseIndex = Items.Add(Item);
+	Records.Add(Record);
+	ISMComponents.Add(ISMComponent);
+	Meshes.Add(Mesh);
+	Locations.Add(Location);
+	InstanceIndices.Add(InstanceIndex);
+
+	FSlot& Slot = Slots[SlotIndex];
+	Slot.DenseIndex = DenseIndex;
+
+	const int32 ItemID = MakeItemID(SlotIndex, Slot.Generation);
+	DenseItemIDs.Add(ItemID);
+
+	if (ISMComponent && InstanceIndex != INDEX_NONE)
+	{
+		// Pad with INDEX_NONE, not 0: MakeItemID(0, 0) is a live ID.
+		TArray<int32>& Owners = InstanceOwners.FindOrAdd(ISMComponent);
+		while (Owners.Num() <= InstanceIndex)
+		{
+			Owners.Add(INDEX_NONE);
+		}
+		Owners[InstanceIndex] = ItemID;
+	}
+
+	return ItemID;
+}
+
+bool FGroundItemStore::Remove(int32 ItemID)
+{
+	const int32 DenseIndex = FindDenseIndex(ItemID);
+	if (DenseIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	// Leave the ISM instance unowned rather than pointing at a freed slot.
+	if (TArray<int32>* Owners = InstanceOwners.Find(ISMComponents[DenseIndex].Get()))
+	{
+		const int32 OwnedInstance = InstanceIndices[DenseIndex];
+		if (Owners->IsValidIndex(OwnedInstance) && (*Owners)[OwnedInstance] == ItemID)
+		{
+			(*Owners)[OwnedInstance] = INDEX_NONE;
+		}
+	}
+
+	const int32 SlotIndex = ItemID & (MaxSlots - 1);
+	const int32 LastDense = Items.Num() - 1;
+
+	if (DenseIndex != LastDense)
+	{
+		const int32 MovedItemID = DenseItemIDs[LastDense];
+		Slots[MovedItemID & (MaxSlots - 1)].DenseIndex = DenseIndex;
+	}
+
+	Items.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	Records.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	ISMComponents.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	Meshes.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	Locations.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	InstanceIndices.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	DenseItemIDs.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+
+	FSlot& Slot = Slots[SlotIndex];
+	Slot.DenseIndex = INDEX_NONE;
+	Slot.Generation = static_cast<uint16>((Slot.Generation + 1) & ((1 << GenerationBits) - 1));
+	FreeSlots.Add(SlotIndex);
+
+	return true;
+}
+
+void FGroundItemStore::Reset()
+{
+	Items.Reset();
+	Records.Reset();
+	ISMComponents.Reset();
+	Meshes.Reset();
+	Locations.Reset();
+	InstanceIndices.Reset();
+	DenseItemIDs.Reset();
+	InstanceOwners.Reset();
+
+	// Keep slots and bump every generation so IDs handed out before the reset
+	// stay invalid instead of aliasing new items.
+	FreeSlots.Reset(Slots.Num());
+	for (int32 SlotIndex = Slots.Num() - 1; SlotIndex >= 0; --SlotIndex)
+	{
+		FSlot& Slot = Slots[SlotIndex];
+		if (Slot.DenseIndex != INDEX_NONE)
+		{
+			Slot.DenseIndex = INDEX_NONE;
+			Slot.Generation = static_cast<uint16>((Slot.Generation + 1) & ((1 << GenerationBits) - 1));
+		}
+		FreeSlots.Add(SlotIndex);
+	}
+}
+
+int32 FGroundItemStore::FindDenseIndex(int32 ItemID) const
+{
+	if (ItemID < 0)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 SlotIndex = ItemID & (MaxSlots - 1);
+	if (!Slots.IsValidIndex(SlotIndex))
+	{
+		return INDEX_NONE;
+	}
+
+	const FSlot& Slot = Slots[SlotIndex];
+	const uint16 Generation = static_cast<uint16>(ItemID >> SlotBits);
+	return Slot.Generation == Generation ? Slot.DenseIndex : INDEX_NONE;
+}
+
+UItemInstance* FGroundItemStore::FindItem(int32 ItemID) const
+{
+	const int32 DenseIndex = FindDenseIndex(ItemID);
+	return DenseIndex != INDEX_NONE ? Items[DenseIndex].Get() : nullptr;
+}
+
+const FVector* FGroundItemStore::FindLocation(int32 ItemID) const
+{
+	const int32 DenseIndex = FindDenseIndex(ItemID);
+	return DenseIndex != INDEX_NONE ? &Locations[DenseIndex] : nullptr;
+}
+
+bool FGroundItemStore::SetLocation(int32 ItemID, const FVector& NewLocation)
+{
+	const int32 DenseIndex = FindDenseIndex(ItemID);
+	if (DenseIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	Locations[DenseIndex] = NewLocation;
+	return true;
+}
+
+int32 FGroundItemStore::FindByISMInstance(const UInstancedStaticMeshComponent* ISMComponent, int32 InstanceIndex) const
+{
+	const TArray<int32>* Owners = InstanceOwners.Find(ISMComponent);
+	if (!Owners || !Owners->IsValidIndex(InstanceIndex))
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 ItemID = (*Owners)[InstanceIndex];
+	return ItemID != INDEX_NONE && Contains(ItemID) ? ItemID : INDEX_NONE;
+}
+
+int32 FGroundItemStore::HandleISMSwapRemove(const UInstancedStaticMeshComponent* ISMComponent,
+	int32 RemovedIndex, int32 LastIndex)
+{
+	TArray<int32>* Owners = InstanceOwners.Find(ISMComponent);
+	if (!Owners || !Owners->IsValidIndex(LastIndex) || !Owners->IsValidIndex(RemovedIndex))
+	{
+		return INDEX_NONE;
+	}
+
+	int32 MovedItemID = INDEX_NONE;
+	if (RemovedIndex != LastIndex)
+	{
+		MovedItemID = (*Owners)[LastIndex];
+		(*Owners)[RemovedIndex] = MovedItemID;
+
+		const int32 MovedDense = MovedItemID != INDEX_NONE ? FindDenseIndex(MovedItemID) : INDEX_NONE;
+		if (MovedDense != INDEX_NONE)
+		{
+			InstanceIndices[MovedDense] = RemovedIndex;
+		}
+		else
+		{
+			MovedItemID = INDEX_NONE;
+		}
+	}
+
+	Owners->RemoveAt(LastIndex, 1, EAllowShrinking::No);
+	return MovedItemID;
+}
+
+void FGroundItemStore::ResetISMInstances(const UInstancedStaticMeshComponent* ISMComponent)
+{
+	InstanceOwners.Remove(ISMComponent);
+}
@@ -0,0 +1,547 @@
+#include "Tower/Library/Structs/StashItemRecord.h"
+#include "Tower/Subsystems/StashSubsystem.h"
+#include "Item/ItemInstance.h"
+#include "Item/Library/Structs/CompactItemRecord.h"
+#include "Engine/DataTable.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+
+namespace StashItemRecordPrivate
+{
+	enum ECompactFlags : uint8
+	{
+		CompactFlag_GenerateAffixes		= 1 << 0,
+		CompactFlag_ForceCorrupted		= 1 << 1
+	};
+
+	enum EFlags : uint16
+	{
+		Flag_Identified					= 1 << 0,
+		Flag_ForceAllAffixesIdentified	= 1 << 1,
+		Flag_HasNameBeenGenerated		= 1 << 2,
+		Flag_CanBeModified				= 1 << 3,
+		Flag_IsKeyItem					= 1 << 4,
+		Flag_IsTradeable				= 1 << 5,
+		Flag_IsSoulbound				= 1 << 6,
+		Flag_AffixesGenerated			= 1 << 7
+	};
+
+	/** Item and rune values are small non-negative ints; pack them. */
+	void SerializePackedInt(FArchive& Ar, int32& Value)
+	{
+		uint32 Packed = static_cast<uint32>(FMath::Max(Value, 0));
+		Ar.SerializeIntPacked(Packed);
+		Value = static_cast<int32>(Packed);
+	}
+
+	FName GetTablePathName(const UDataTable* Table)
+	{
+		return Table ? FName(*Table->GetPathName()) : NAME_None;
+	}
+}
+
+FStashItemRecordWriter::FAffixRowKey::FAffixRowKey(const FPHAttributeData& Affix)
+	: AttributeName(Affix.AttributeName)
+	, AffixGroup(Affix.AffixGroup)
+	, RankPoints(Affix.RankPoints)
+	, MinValue(Affix.MinValue)
+	, MaxValue(Affix.MaxValue)
+{
+}
+
+FStashItemRecordWriter::FStashItemRecordWriter(TArray<FName>& InNames)
+	: Names(InNames)
+{
+	NameLookup.Reserve(Names.Num());
+	for (int32 Index = 0; Index < Names.Num(); ++Index)
+	{
+		NameLookup.Add(Names[Index], static_cast<uint32>(Index));
+	}
+}
+
+uint32 FStashItemRecordWriter::AddName(FName Name)
+{
+	if (const uint32* Existing = NameLookup.Find(Name))
+	{
+		return *Existing;
+	}
+
+	const uint32 Index = static_cast<uint32>(Names.Add(Name));
+	NameLookup.Add(Name, Index);
+	return Index;
+}
+
+bool FStashItemRecordWriter::Write(const UItemInstance& Item, TArray<uint8>& OutBytes)
+{
+	using namespace StashItemRecordPrivate;
+
+	const FItemBase* Base = Item.GetBaseData();
+	if (!Base || !Item.BaseItemHandle.DataTable)
+	{
+		return false;
+	}
+
+	OutBytes.Reset();
+	FMemoryWriter Ar(OutBytes);
+
+	uint8 Version = StashItemRecordVersion;
+	Ar << Version;
+
+	FGuid UniqueID = Item.UniqueID;
+	Ar << UniqueID;
+
+	uint32 BaseTableIndex = AddName(GetTablePathName(Item.BaseItemHandle.DataTable));
+	uint32 BaseRowIndex = AddName(Item.BaseItemHandle.RowName);
+	Ar.SerializeIntPacked(BaseTableIndex);
+	Ar.SerializeIntPacked(BaseRowIndex);
+
+	int32 Seed = Item.Seed;
+	Ar << Seed;
+
+	uint8 RollVersion = static_cast<uint8>(Item.AffixRollVersion);
+	uint8 ItemLevel = static_cast<uint8>(FMath::Clamp(Item.ItemLevel, 1, 100));
+	uint8 Rarity = static_cast<uint8>(Item.Rarity);
+	Ar << RollVersion << ItemLevel << Rarity;
+
+	int32 Quantity = Item.Quantity;
+	int32 RemainingUses = Item.RemainingUses;
+	int32 Quality = Item.Quality;
+	SerializePackedInt(Ar, Quantity);
+	SerializePackedInt(Ar, RemainingUses);
+	SerializePackedInt(Ar, Quality);
+
+	float CurrentDurability = Item.Durability.CurrentDurability;
+	float MaxDurability = Item.Durability.MaxDurability;
+	float ValueModifier = Item.ValueModifier;
+	float LastUseTime = Item.LastUseTime;
+	Ar << CurrentDurability << MaxDurability << ValueModifier << LastUseTime;
+
+	uint16 Flags = 0;
+	Flags |= Item.bIdentified ? Flag_Identified : 0;
+	Flags |= Item.bForceAllAffixesIdentified ? Flag_ForceAllAffixesIdentified : 0;
+	Flags |= Item.bHasNameBeenGenerated ? Flag_HasNameBeenGenerated : 0;
+	Flags |= Item.bCanBeModified ? Flag_CanBeModified : 0;
+	Flags |= Item.bIsKeyItem ? Flag_IsKeyItem : 0;
+	Flags |= Item.bIsTradeable ? Flag_IsTradeable : 0;
+	Flags |= Item.bIsSoulbound ? Flag_IsSoulbound : 0;
+	Flags |= Item.Stats.bAffixesGenerated ? Flag_AffixesGenerated : 0;
+	Ar << Flags;
+
+	uint32 QuestIndex = AddName(Item.QuestID);
+	Ar.SerializeIntPacked(QuestIndex);
+
+	const FRuneCraftingData& Runes = Item.RuneCraftingData;
+	uint32 SocketCount = static_cast<uint32>(Runes.RuneSockets.Num());
+	Ar.SerializeIntPacked(SocketCount);
+	for (const FRuneSocket& Socket : Runes.RuneSockets)
+	{
+		uint8 bSocketed = Socket.bIsSocketed ? 1 : 0;
+		uint32 RuneIndex = AddName(Socket.RuneID);
+		int32 RuneLevel = Socket.RuneLevel;
+		Ar << bSocketed;
+		Ar.SerializeIntPacked(RuneIndex);
+		SerializePackedInt(Ar, RuneLevel);
+	}
+
+	int32 EnhancementLevel = Runes.EnhancementLevel;
+	int32 MaxEnhancementLevel = Runes.MaxEnhancementLevel;
+	SerializePackedInt(Ar, EnhancementLevel);
+	SerializePackedInt(Ar, MaxEnhancementLevel);
+
+	return WriteAffixList(Ar, Item.Stats.Implicits, *Base)
+		&& WriteAffixList(Ar, Item.Stats.Prefixes, *Base)
+		&& WriteAffixList(Ar, Item.Stats.Suffixes, *Base)
+		&& WriteAffixList(Ar, Item.Stats.Crafted, *Base)
+		&& WriteAffixList(Ar, Item.Stats.Enchants, *Base);
+}
+
+void FStashItemRecordWriter::WriteCompact(const FCompactItemRecord& Record, TArray<uint8>& OutBytes)
+{
+	using namespace StashItemRecordPrivate;
+
+	OutBytes.Reset();
+	FMemoryWriter Ar(OutBytes);
+
+	uint8 Tag = StashCompactRecordTag;
+	uint8 RecordVersion = Record.RecordVersion;
+	Ar << Tag << RecordVersion;
+
+	FGuid UniqueID = Record.UniqueID;
+	Ar << UniqueID;
+
+	uint32 BaseTableIndex = AddName(GetTablePathName(Record.BaseItemHandle.DataTable));
+	uint32 BaseRowIndex = AddName(Record.BaseItemHandle.RowName);
+	Ar.SerializeIntPacked(BaseTableIndex);
+	Ar.SerializeIntPacked(BaseRowIndex);
+
+	int32 Seed = Record.Seed;
+	float CorruptionChance = Record.CorruptionChance;
+	Ar << Seed << CorruptionChance;
+
+	uint8 RollVersion = static_cast<uint8>(Record.AffixRollVersion);
+	uint8 ItemLevel = Record.ItemLevel;
+	uint8 Rarity = static_cast<uint8>(Record.Rarity);
+	uint8 Flags = 0;
+	Flags |= Record.bGenerateAffixes ? CompactFlag_GenerateAffixes : 0;
+	Flags |= Record.bForceCorrupted ? CompactFlag_ForceCorrupted : 0;
+	Ar << RollVersion << ItemLevel << Rarity << Flags;
+
+	int32 Quantity = Record.Quantity;
+	SerializePackedInt(Ar, Quantity);
+}
+
+bool FStashItemRecordWriter::WriteAffixList(FArchive& Ar, const TArray<FPHAttributeData>& Affixes, const FItemBase& Base)
+{
+	uint32 Count = static_cast<uint32>(Affixes.Num());
+	Ar.SerializeIntPacked(Count);
+
+	for (const FPHAttributeData& Affix : Affixes)
+	{
+		EStashAffixSource Source = EStashAffixSource::TableRow;
+		uint32 A = 0;
+		uint32 B = 0;
+		if (!ResolveAffixSource(Affix, Base, Source, A, B))
+		{
+			return false;
+		}
+
+		uint8 SourceByte = static_cast<uint8>(Source);
+		uint8 AffixType = static_cast<uint8>(Affix.AffixType);
+		FGuid UID = Affix.AttributeUID;
+		float RolledValue = Affix.RolledStatValue;
+		uint8 bAffixIdentified = Affix.bIsIdentified ? 1 : 0;
+
+		Ar << SourceByte;
+		Ar.SerializeIntPacked(A);
+		if (Source == EStashAffixSource::TableRow)
+		{
+			Ar.SerializeIntPacked(B);
+		}
+		Ar << AffixType << UID << RolledValue << bAffixIdentified;
+	}
+
+	return true;
+}
+
+bool FStashItemRecordWriter::ResolveAffixSource(const FPHAttributeData& Affix, const FItemBase& Base,
+	EStashAffixSource& OutSource, uint32& OutA, uint32& OutB)
+{
+	const FAffixRowKey Key(Affix);
+
+	const auto FindInBaseArray = [&Key](const TArray<FPHAttributeData>& Definitions) -> int32
+	{
+		return Definitions.IndexOfByPredicate([&Key](const FPHAttributeData& Definition)
+		{
+			return FAffixRowKey(Definition) == Key;
+		});
+	};
+
+	if (Affix.AffixType == EAffixes::AF_Implicit)
+	{
+		const int32 Index = FindInBaseArray(Base.ImplicitMods);
+		if (Index != INDEX_NONE)
+		{
+			OutSource = EStashAffixSource::BaseImplicit;
+			OutA = static_cast<uint32>(Index);
+			return true;
+		}
+	}
+
+	if (Base.bIsUnique || Base.UniqueAffixes.Num() > 0)
+	{
+		const int32 Index = FindInBaseArray(Base.UniqueAffixes);
+		if (Index != INDEX_NONE)
+		{
+			OutSource = EStashAffixSource::BaseUnique;
+			OutA = static_cast<uint32>(Index);
+			return true;
+		}
+	}
+
+	// Per-item overrides first, then the generator's shared tables, in the
+	// order the affix is most likely to have rolled from.
+	const UDataTable* Candidates[] =
+	{
+		Base.PrefixAffixTable ? Base.PrefixAffixTable.Get() : Generator.GetAffixDataTable(EAffixes::AF_Prefix),
+		Base.SuffixAffixTable ? Base.SuffixAffixTable.Get() : Generator.GetAffixDataTable(EAffixes::AF_Suffix),
+		Base.EnchantAffixTable ? Base.EnchantAffixTable.Get() : Generator.GetAffixDataTable(EAffixes::AF_Enchant)
+	};
+
+	for (const UDataTable* Table : Candidates)
+	{
+		if (const FName* RowName = FindAffixRow(Table, Affix))
+		{
+			OutSource = EStashAffixSource::TableRow;
+			OutA = AddName(StashItemRecordPrivate::GetTablePathName(Table));
+			OutB = AddName(*RowName);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+const FName* FStashItemRecordWriter::FindAffixRow(const UDataTable* Table, const FPHAttributeData& Affix)
+{
+	if (!Table)
+	{
+		return nullptr;
+	}
+
+	TMap<FAffixRowKey, FName>* Index = RowIndex.Find(Table);
+	if (!Index)
+	{
+		Index = &RowIndex.Add(Table);
+		Table->ForeachRow<FPHAttributeData>(TEXT("FStashItemRecordWriter::FindAffixRow"),
+			[Index](const FName& RowName, const FPHAttributeData& Row)
+			{
+				Index->FindOrAdd(FAffixRowKey(Row), RowName);
+			});
+	}
+
+	return Index->Find(FAffixRowKey(Affix));
+}
+
+FStashItemRecordReader::FStashItemRecordReader(const TArray<FName>& InNames)
+	: Names(InNames)
+{
+}
+
+FName FStashItemRecordReader::GetName(uint32 Index) const
+{
+	return Names.IsValidIndex(static_cast<int32>(Index)) ? Names[Index] : NAME_None;
+}
+
+UDataTable* FStashItemRecordReader::ResolveTable(FName TablePath)
+{
+	if (UDataTable** Cached = Tables.Find(TablePath))
+	{
+		return *Cached;
+	}
+
+	UDataTable* Table = TablePath.IsNone()
+		? nullptr
+		: Cast<UDataTable>(FSoftObjectPath(TablePath.ToString()).TryLoad());
+	Tables.Add(TablePath, Table);
+	return Table;
+}
+
+bool FStashItemRecordReader::Read(UItemInstance& Item, const TArray<uint8>& Bytes)
+{
+	using namespace StashItemRecordPrivate;
+
+	FMemoryReader Ar(Bytes);
+
+	uint8 Version = 0;
+	Ar << Version;
+	if (Version == 0 || Version > StashItemRecordVersion)
+	{
+		UE_LOG(LogStashSubsystem, Warning,
+			TEXT("FStashItemRecordReader: Unsupported record version %d"), Version);
+		return false;
+	}
+
+	Ar << Item.UniqueID;
+
+	uint32 BaseTableIndex = 0;
+	uint32 BaseRowIndex = 0;
+	Ar.SerializeIntPacked(BaseTableIndex);
+	Ar.SerializeIntPacked(BaseRowIndex);
+	Item.BaseItemHandle.DataTable = ResolveTable(GetName(BaseTableIndex));
+	Item.BaseItemHandle.RowName = GetName(BaseRowIndex);
+	Item.InvalidateBaseCache();
+
+	const FItemBase* Base = Item.GetBaseData();
+	if (!Base)
+	{
+		UE_LOG(LogStashSubsystem, Warning,
+			TEXT("FStashItemRecordReader: Base item '%s' no longer exists"),
+			*Item.BaseItemHandle.RowName.ToString());
+		return false;
+	}
+
+	Ar << Item.Seed;
+
+	uint8 RollVersion = 0;
+	uint8 ItemLevel = 1;
+	uint8 Rarity = 0;
+	Ar << RollVersion << ItemLevel << Rarity;
+	Item.AffixRollVersion = static_cast<EAffixRollVersion>(RollVersion);
+	Item.ItemLevel = ItemLevel;
+	Item.Rarity = static_cast<EItemRarity>(Rarity);
+
+	SerializePackedInt(Ar, Item.Quantity);
+	SerializePackedInt(Ar, Item.RemainingUses);
+	SerializePackedInt(Ar, Item.Quality);
+
+	Ar << Item.Durability.CurrentDurability << Item.Durability.MaxDurability
+		<< Item.ValueModifier << Item.LastUseTime;
+
+	uint16 Flags = 0;
+	Ar << Flags;
+	Item.bIdentified = (Flags & Flag_Identified) != 0;
+	Item.bForceAllAffixesIdentified = (Flags & Flag_ForceAllAffixesIdentified) != 0;
+	Item.bHasNameBeenGenerated = (Flags & Flag_HasNameBeenGenerated) != 0;
+	Item.bCanBeModified = (Flags & Flag_CanBeModified) != 0;
+	Item.bIsKeyItem = (Flags & Flag_IsKeyItem) != 0;
+	Item.bIsTradeable = (Flags & Flag_IsTradeable) != 0;
+	Item.bIsSoulbound = (Flags & Flag_IsSoulbound) != 0;
+	Item.Stats.bAffixesGenerated = (Flags & Flag_AffixesGenerated) != 0;
+
+	uint32 QuestIndex = 0;
+	Ar.SerializeIntPacked(QuestIndex);
+	Item.QuestID = GetName(QuestIndex);
+
+	uint32 SocketCount = 0;
+	Ar.SerializeIntPacked(SocketCount);
+	if (Ar.IsError() || SocketCount > 64)
+	{
+		return false;
+	}
+
+	FRuneCraftingData& Runes = Item.RuneCraftingData;
+	Runes.RuneSockets.SetNum(SocketCount);
+	for (FRuneSocket& Socket : Runes.RuneSockets)
+	{
+		uint8 bSocketed = 0;
+		uint32 RuneIndex = 0;
+		Ar << bSocketed;
+		Ar.SerializeIntPacked(RuneIndex);
+		SerializePackedInt(Ar, Socket.RuneLevel);
+		Socket.bIsSocketed = bSocketed != 0;
+		Socket.RuneID = GetName(RuneIndex);
+	}
+	SerializePackedInt(Ar, Runes.EnhancementLevel);
+	SerializePackedInt(Ar, Runes.MaxEnhancementLevel);
+
+	const bool bAffixesRead = ReadAffixList(Ar, Item.Stats.Implicits, *Base)
+		&& ReadAffixList(Ar, Item.Stats.Prefixes, *Base)
+		&& ReadAffixList(Ar, Item.Stats.Suffixes, *Base)
+		&& ReadAffixList(Ar, Item.Stats.Crafted, *Base)
+		&& ReadAffixList(Ar, Item.Stats.Enchants, *Base);
+	if (!bAffixesRead || Ar.IsError())
+	{
+		return false;
+	}
+
+	// Derived state the record does not carry; cheaper to recompute than store.
+	Item.CalculateCorruptionState();
+	Item.RefreshIdentificationState();
+	Item.UpdateTotalWeight();
+	if (Item.bHasNameBeenGenerated)
+	{
+		Item.RegenerateDisplayName();
+	}
+
+	return true;
+}
+
+bool FStashItemRecordReader::ReadCompact(const TArray<uint8>& Bytes, FCompactItemRecord& OutRecord)
+{
+	using namespace StashItemRecordPrivate;
+
+	if (Bytes.Num() == 0 || Bytes[0] != StashCompactRecordTag)
+	{
+		return false;
+	}
+
+	FMemoryReader Ar(Bytes);
+
+	uint8 Tag = 0;
+	Ar << Tag << OutRecord.RecordVersion << OutRecord.UniqueID;
+
+	uint32 BaseTableIndex = 0;
+	uint32 BaseRowIndex = 0;
+	Ar.SerializeIntPacked(BaseTableIndex);
+	Ar.SerializeIntPacked(BaseRowIndex);
+	OutRecord.BaseItemHandle.DataTable = ResolveTable(GetName(BaseTableIndex));
+	OutRecord.BaseItemHandle.RowName = GetName(BaseRowIndex);
+
+	Ar << OutRecord.Seed << OutRecord.CorruptionChance;
+
+	uint8 RollVersion = 0;
+	uint8 Rarity = 0;
+	uint8 Flags = 0;
+	Ar << RollVersion << OutRecord.ItemLevel << Rarity << Flags;
+	OutRecord.AffixRollVersion = static_cast<EAffixRollVersion>(RollVersion);
+	OutRecord.Rarity = static_cast<EItemRarity>(Rarity);
+	OutRecord.bGenerateAffixes = (Flags & CompactFlag_GenerateAffixes) != 0;
+	OutRecord.bForceCorrupted = (Flags & CompactFlag_ForceCorrupted) != 0;
+
+	SerializePackedInt(Ar, OutRecord.Quantity);
+
+	if (Ar.IsError() || !OutRecord.IsValid() || !OutRecord.GetBaseData())
+	{
+		UE_LOG(LogStashSubsystem, Warning,
+			TEXT("FStashItemRecordReader: Compact record for base item '%s' could not be read"),
+			*OutRecord.BaseItemHandle.RowName.ToString());
+		return false;
+	}
+
+	return true;
+}
+
+bool FStashItemRecordReader::ReadAffixList(FArchive& Ar, TArray<FPHAttributeData>& OutAffixes, const FItemBase& Base)
+{
+	uint32 Count = 0;
+	Ar.SerializeIntPacked(Count);
+	if (Ar.IsError() || Count > 64)
+	{
+		return false;
+	}
+
+	OutAffixes.Reset(Count);
+	for (uint32 Index = 0; Index < Count; ++Index)
+	{
+		uint8 SourceByte = 0;
+		uint32 A = 0;
+		uint32 B = 0;
+		Ar << SourceByte;
+		Ar.SerializeIntPacked(A);
+
+		const FPHAttributeData* Definition = nullptr;
+		switch (static_cast<EStashAffixSource>(SourceByte))
+		{
+			case EStashAffixSource::BaseImplicit:
+				Definition = Base.ImplicitMods.IsValidIndex(A) ? &Base.ImplicitMods[A] : nullptr;
+				break;
+
+			case EStashAffixSource::BaseUnique:
+				Definition = Base.UniqueAffixes.IsValidIndex(A) ? &Base.UniqueAffixes[A] : nullptr;
+				break;
+
+			case EStashAffixSource::TableRow:
+				Ar.SerializeIntPacked(B);
+				if (const UDataTable* Table = ResolveTable(GetName(A)))
+				{
+					Definition = Table->FindRow<FPHAttributeData>(GetName(B),
+						TEXT("FStashItemRecordReader::ReadAffixList"), false);
+				}
+				break;
+
+			default:
+				return false;
+		}
+
+		if (!Definition)
+		{
+			UE_LOG(LogStashSubsystem, Warning,
+				TEXT("FStashItemRecordReader: Affix definition %d/%s no longer exists - dropping it"),
+				SourceByte, *GetName(B).ToString());
+		}
+
+		FPHAttributeData Affix = Definition ? *Definition : FPHAttributeData();
+		uint8 AffixType = 0;
+		uint8 bAffixIdentified = 0;
+		Ar << AffixType << Affix.AttributeUID << Affix.RolledStatValue << bAffixIdentified;
+		Affix.AffixType = static_cast<EAffixes>(AffixType);
+		Affix.bIsIdentified = bAffixIdentified != 0;
+
+		if (Definition)
+		{
+			OutAffixes.Add(MoveTemp(Affix));
+		}
+	}
+
+	return !Ar.IsError();
+}
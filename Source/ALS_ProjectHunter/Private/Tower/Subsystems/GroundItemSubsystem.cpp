@@ -9,11 +9,34 @@
 
 DEFINE_LOG_CATEGORY(LogGroundItemSubsystem);
 
+namespace GroundItemSubsystemPrivate
+{
+	FRotator GetGroundRotation(const FItemBase& BaseData, FRotator Rotation)
+	{
+		if (BaseData.bFlipGroundMeshRotation)
+		{
+			Rotation.Pitch += 180.0f;
+		}
+		return Rotation + BaseData.GroundMeshRotationOffset;
+	}
+
+	/** Log name without materializing a compact record. */
+	FString DescribeItem(UItemInstance* Item, const FCompactItemRecord* Record)
+	{
+		if (Item)
+		{
+			return Item->GetDisplayName().ToString();
+		}
+		return Record ? Record->BaseItemHandle.RowName.ToString() : FString();
+	}
+}
+
 void UGroundItemSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 	
 	bIsProcessingRemoval = false;
+	SpatialGrid.SetCellSize(SpatialGridCellSize);
 	
 	UE_LOG(LogGroundItemSubsystem, Log, TEXT("GroundItemSubsystem: Initialized"));
 }
@@ -120,32 +143,46 @@ UInstancedStaticMeshComponent* UGroundItemSubsystem::GetOrCreateISMComponent(USt
 void UGroundItemSubsystem::UpdateIndexAfterSwap(UInstancedStaticMeshComponent* ISMComponent,
                                                 int32 RemovedIndex, int32 LastIndex)
 {
-	if (RemovedIndex == LastIndex)
+	const int32 MovedItemID = Store.HandleISMSwapRemove(ISMComponent, RemovedIndex, LastIndex);
+	if (MovedItemID == INDEX_NONE)
 	{
 		return;
 	}
-	
-	for (TPair<int32, FGroundItemISMData>& Pair : ItemISMData)
+
+	if (ISMContainerActor.IsValid())
 	{
-		FGroundItemISMData& Data = Pair.Value;
-		if (Data.ISMComponent == ISMComponent && Data.InstanceIndex == LastIndex)
-		{
-			Data.InstanceIndex = RemovedIndex;
+		ISMContainerActor->UpdateItemAnimationIndex(MovedItemID, RemovedIndex);
+	}
 
-			if (ISMContainerActor.IsValid())
-			{
-				ISMContainerActor->UpdateItemAnimationIndex(Pair.Key, RemovedIndex);
-			}
+	UE_LOG(LogGroundItemSubsystem, Verbose,
+		TEXT("UpdateIndexAfterSwap: Item %d moved from ISM index %d to %d after swap removal"),
+		MovedItemID, LastIndex, RemovedIndex);
+}
 
-			UE_LOG(LogGroundItemSubsystem, Verbose,
-				TEXT("UpdateIndexAfterSwap: Item %d moved from ISM index %d to %d after swap removal"),
-				Pair.Key, LastIndex, RemovedIndex);
-			return;
-		}
+int32 UGroundItemSubsystem::AddItemToGround(UItemInstance* Item, FVector Location, FRotator Rotation)
+{
+	if (!Item || !Item->HasValidBaseData())
+	{
+		PH_LOG_WARNING(LogGroundItemSubsystem, "AddItemToGround failed: Item was invalid.");
+		return -1;
+	}
+
+	return AddToGroundInternal(Item, nullptr, Location, Rotation);
+}
+
+int32 UGroundItemSubsystem::AddRecordToGround(const FCompactItemRecord& Record, FVector Location, FRotator Rotation)
+{
+	if (!Record.IsValid() || !Record.GetBaseData())
+	{
+		PH_LOG_WARNING(LogGroundItemSubsystem, "AddRecordToGround failed: Record was invalid.");
+		return -1;
 	}
+
+	return AddToGroundInternal(nullptr, &Record, Location, Rotation);
 }
 
-int32 UGroundItemSubsystem::AddItemToGround(UItemInstance* Item, FVector Location, FRotator Rotation)
+int32 UGroundItemSubsystem::AddToGroundInternal(UItemInstance* Item, const FCompactItemRecord* Record,
+	const FVector& Location, FRotator Rotation)
 {
 	EnsureISMContainerExists();
 
@@ -155,16 +192,13 @@ int32 UGroundItemSubsystem::AddItemToGround(UItemInstance* Item, FVector Locatio
 		return -1;
 	}
 
-	if (!Item || !Item->HasValidBaseData())
-	{
-		PH_LOG_WARNING(LogGroundItemSubsystem, "AddItemToGround failed: Item was invalid.");
-		return -1;
-	}
+	const FItemBase* BaseData = Item ? Item->GetBaseData() : Record->GetBaseData();
+	const FString ItemName = GroundItemSubsystemPrivate::DescribeItem(Item, Record);
 
-	UStaticMesh* Mesh = Item->GetGroundMesh();
+	UStaticMesh* Mesh = BaseData ? BaseData->StaticMesh.Get() : nullptr;
 	if (!Mesh)
 	{
-		PH_LOG_WARNING(LogGroundItemSubsystem, "AddItemToGround failed: Item=%s had no ground mesh.", *Item->GetDisplayName().ToString());
+		PH_LOG_WARNING(LogGroundItemSubsystem, "AddItemToGround failed: Item=%s had no ground mesh.", *ItemName);
 		return -1;
 	}
 
@@ -175,33 +209,33 @@ int32 UGroundItemSubsystem::AddItemToGround(UItemInstance* Item, FVector Locatio
 		return -1;
 	}
 
-	FRotator FinalRotation = Rotation;
-	if (const FItemBase* BaseData = Item->GetBaseData())
-	{
-		if (BaseData->bFlipGroundMeshRotation)
-		{
-			FinalRotation.Pitch += 180.0f;
-		}
-		FinalRotation += BaseData->GroundMeshRotationOffset;
-	}
+	const FRotator FinalRotation = GroundItemSubsystemPrivate::GetGroundRotation(*BaseData, Rotation);
 
 	FTransform Transform(FinalRotation, Location, FVector::OneVector);
 	int32 ISMInstanceIndex = ISM->AddInstance(Transform);
 
 	if (ISMInstanceIndex == INDEX_NONE)
 	{
-		PH_LOG_ERROR(LogGroundItemSubsystem, "AddItemToGround failed: Could not add an instance to the ISM for Item=%s.", *Item->GetDisplayName().ToString());
+		PH_LOG_ERROR(LogGroundItemSubsystem, "AddItemToGround failed: Could not add an instance to the ISM for Item=%s.", *ItemName);
 		return -1;
 	}
 
-	int32 ItemID = NextItemID++;
-
-	GroundItems.Add(ItemID, Item);
-	InstanceLocations.Add(ItemID, Location);
-	ItemISMData.Add(ItemID, FGroundItemISMData(ISM, ISMInstanceIndex, Mesh));
-
+	const int32 ItemID = Item
+		? Store.Add(Item, Location, ISM, ISMInstanceIndex, Mesh)
+		: Store.AddRecord(*Record, Location, ISM, ISMInstanceIndex, Mesh);
+	if (ItemID == INDEX_NONE)
+	{
+		PH_LOG_ERROR(LogGroundItemSubsystem, "AddItemToGround failed: The ground item store is full (%d items).", Store.Num());
+		ISM->RemoveInstance(ISMInstanceIndex);
+		return -1;
+	}
 
-	InstanceToIDMap.Add(Item, ItemID);
+	SpatialGrid.Add(ItemID, Location);
+	if (Item)
+	{
+		InstanceToIDMap.Add(Item, ItemID);
+	}
+	++ContentVersion;
 
 	if (ISMContainerActor.IsValid())
 	{
@@ -209,11 +243,192 @@ int32 UGroundItemSubsystem::AddItemToGround(UItemInstance* Item, FVector Locatio
 	}
 
 	UE_LOG(LogGroundItemSubsystem, Log, TEXT("AddItemToGround: Added item '%s' (ID: %d, ISMIndex: %d) at %s"),
-		*Item->GetDisplayName().ToString(), ItemID, ISMInstanceIndex, *Location.ToString());
+		*ItemName, ItemID, ISMInstanceIndex, *Location.ToString());
 
 	return ItemID;
 }
 
+int32 UGroundItemSubsystem::AddItemsToGround(TConstArrayView<UItemInstance*> Items, TConstArrayView<FVector> Locations, TArray<int32>& OutItemIDs)
+{
+	return AddManyToGroundInternal(Items, TConstArrayView<FCompactItemRecord>(), Locations, OutItemIDs);
+}
+
+int32 UGroundItemSubsystem::AddRecordsToGround(TConstArrayView<FCompactItemRecord> Records, TConstArrayView<FVector> Locations, TArray<int32>& OutItemIDs)
+{
+	return AddManyToGroundInternal(TConstArrayView<UItemInstance*>(), Records, Locations, OutItemIDs);
+}
+
+int32 UGroundItemSubsystem::AddManyToGroundInternal(TConstArrayView<UItemInstance*> Items, TConstArrayView<FCompactItemRecord> Records,
+	TConstArrayView<FVector> Locations, TArray<int32>& OutItemIDs)
+{
+	const bool bRecords = Records.Num() > 0;
+	const int32 EntryCount = bRecords ? Records.Num() : Items.Num();
+	OutItemIDs.Init(INDEX_NONE, EntryCount);
+
+	if (EntryCount != Locations.Num())
+	{
+		PH_LOG_ERROR(LogGroundItemSubsystem, "AddItemsToGround failed: Got %d items but %d locations.", EntryCount, Locations.Num());
+		return 0;
+	}
+
+	EnsureISMContainerExists();
+
+	if (!ISMContainerActor.IsValid())
+	{
+		PH_LOG_ERROR(LogGroundItemSubsystem, "AddItemsToGround failed: The ISM container actor was unavailable.");
+		return 0;
+	}
+
+	struct FMeshGroup
+	{
+		UInstancedStaticMeshComponent* ISM = nullptr;
+		UStaticMesh* Mesh = nullptr;
+		TArray<int32> ItemIndices;
+		TArray<FTransform> Transforms;
+	};
+
+	TArray<FMeshGroup> Groups;
+	TMap<UStaticMesh*, int32> MeshToGroup;
+
+	// Every instance is added before the store sees it, so trim the batch to the
+	// remaining slot capacity up front rather than unwinding ISM indices later.
+	int32 RemainingCapacity = FGroundItemStore::MaxSlots - Store.Num();
+
+	for (int32 Index = 0; Index < EntryCount; ++Index)
+	{
+		if (RemainingCapacity <= 0)
+		{
+			PH_LOG_ERROR(LogGroundItemSubsystem, "AddItemsToGround failed: The ground item store is full (%d items); dropped %d entries.",
+				Store.Num(), EntryCount - Index);
+			break;
+		}
+
+		UItemInstance* Item = bRecords ? nullptr : Items[Index];
+		const FCompactItemRecord* Record = bRecords ? &Records[Index] : nullptr;
+		const FItemBase* BaseData = nullptr;
+		if (Item)
+		{
+			BaseData = Item->HasValidBaseData() ? Item->GetBaseData() : nullptr;
+		}
+		else if (Record && Record->IsValid())
+		{
+			BaseData = Record->GetBaseData();
+		}
+
+		if (!BaseData)
+		{
+			PH_LOG_WARNING(LogGroundItemSubsystem, "AddItemsToGround skipped entry %d: Item was invalid.", Index);
+			continue;
+		}
+
+		UStaticMesh* Mesh = BaseData->StaticMesh.Get();
+		if (!Mesh)
+		{
+			PH_LOG_WARNING(LogGroundItemSubsystem, "AddItemsToGround skipped entry %d: Item=%s had no ground mesh.",
+				Index, *GroundItemSubsystemPrivate::DescribeItem(Item, Record));
+			continue;
+		}
+
+		int32 GroupIndex = INDEX_NONE;
+		if (const int32* Found = MeshToGroup.Find(Mesh))
+		{
+			GroupIndex = *Found;
+		}
+		else
+		{
+			UInstancedStaticMeshComponent* ISM = GetOrCreateISMComponent(Mesh);
+			if (!ISM)
+			{
+				PH_LOG_ERROR(LogGroundItemSubsystem, "AddItemsToGround failed: Could not get or create an ISM component for Mesh=%s.", *GetNameSafe(Mesh));
+				MeshToGroup.Add(Mesh, INDEX_NONE);
+				continue;
+			}
+
+			GroupIndex = Groups.AddDefaulted();
+			Groups[GroupIndex].ISM = ISM;
+			Groups[GroupIndex].Mesh = Mesh;
+			MeshToGroup.Add(Mesh, GroupIndex);
+		}
+
+		if (GroupIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		const FRotator FinalRotation = GroundItemSubsystemPrivate::GetGroundRotation(*BaseData, FRotator::ZeroRotator);
+
+		FMeshGroup& Group = Groups[GroupIndex];
+		Group.ItemIndices.Add(Index);
+		Group.Transforms.Emplace(FinalRotation, Locations[Index], FVector::OneVector);
+		--RemainingCapacity;
+	}
+
+	int32 AddedCount = 0;
+
+	for (FMeshGroup& Group : Groups)
+	{
+		const TArray<int32> InstanceIndices = Group.ISM->AddInstances(Group.Transforms, /*bShouldReturnIndices=*/true);
+		if (InstanceIndices.Num() != Group.ItemIndices.Num())
+		{
+			PH_LOG_ERROR(LogGroundItemSubsystem, "AddItemsToGround failed: ISM for Mesh=%s returned %d of %d instances.",
+				*GetNameSafe(Group.Mesh), InstanceIndices.Num(), Group.ItemIndices.Num());
+
+			// Nothing in the store points at these yet. They were appended at the
+			// tail, so removing them leaves every existing item's index intact.
+			TArray<int32> OrphanedIndices;
+			OrphanedIndices.Reserve(InstanceIndices.Num());
+			for (const int32 InstanceIndex : InstanceIndices)
+			{
+				if (InstanceIndex != INDEX_NONE)
+				{
+					OrphanedIndices.Add(InstanceIndex);
+				}
+			}
+			if (!OrphanedIndices.IsEmpty())
+			{
+				Group.ISM->RemoveInstances(OrphanedIndices);
+			}
+			continue;
+		}
+
+		for (int32 GroupSlot = 0; GroupSlot < Group.ItemIndices.Num(); ++GroupSlot)
+		{
+			const int32 ItemIndex = Group.ItemIndices[GroupSlot];
+			const FVector& Location = Locations[ItemIndex];
+
+			// Capacity was reserved while grouping, so the store cannot run out here.
+			UItemInstance* Item = bRecords ? nullptr : Items[ItemIndex];
+			const int32 ItemID = Item
+				? Store.Add(Item, Location, Group.ISM, InstanceIndices[GroupSlot], Group.Mesh)
+				: Store.AddRecord(Records[ItemIndex], Location, Group.ISM, InstanceIndices[GroupSlot], Group.Mesh);
+			if (!ensure(ItemID != INDEX_NONE))
+			{
+				continue;
+			}
+
+			SpatialGrid.Add(ItemID, Location);
+			if (Item)
+			{
+				InstanceToIDMap.Add(Item, ItemID);
+			}
+			OutItemIDs[ItemIndex] = ItemID;
+			++AddedCount;
+
+			ISMContainerActor->RegisterItemForAnimation(ItemID, Group.ISM, InstanceIndices[GroupSlot], Location, Group.Transforms[GroupSlot].Rotator());
+		}
+	}
+
+	if (AddedCount > 0)
+	{
+		++ContentVersion;
+	}
+
+	UE_LOG(LogGroundItemSubsystem, Verbose, TEXT("AddItemsToGround: Added %d of %d %s across %d mesh groups"),
+		AddedCount, EntryCount, bRecords ? TEXT("records") : TEXT("items"), Groups.Num());
+
+	return AddedCount;
+}
+
 UItemInstance* UGroundItemSubsystem::RemoveItemFromGround(int32 ItemID)
 {
 	if (bIsProcessingRemoval)
@@ -246,20 +461,27 @@ UItemInstance* UGroundItemSubsystem::RemoveItemFromGround(int32 ItemID)
 
 UItemInstance* UGroundItemSubsystem::RemoveItemFromGroundInternal(int32 ItemID)
 {
-	UItemInstance** FoundItem = GroundItems.Find(ItemID);
-	if (!FoundItem)
+	const int32 DenseIndex = Store.FindDenseIndex(ItemID);
+	if (DenseIndex == INDEX_NONE)
 	{
 		PH_LOG_WARNING(LogGroundItemSubsystem, "RemoveItemFromGround failed: ItemID=%d was not found.", ItemID);
 		return nullptr;
 	}
 
-	UItemInstance* Item = *FoundItem;
+	// Whoever removes an item from the ground takes it, so compact drops are built here.
+	UItemInstance* Item = ResolveItemAt(DenseIndex);
+	UInstancedStaticMeshComponent* ISM = Store.GetISMAt(DenseIndex);
+	const int32 InstanceIndex = Store.GetInstanceIndexAt(DenseIndex);
+
+	// Unregister before touching the ISM: the animation batch swap-removes in
+	// the same way, so both stay aligned by instance index.
+	if (ISMContainerActor.IsValid())
+	{
+		ISMContainerActor->UnregisterItemFromAnimation(ItemID);
+	}
 
-	FGroundItemISMData* ISMData = ItemISMData.Find(ItemID);
-	if (ISMData && ISMData->IsValid())
+	if (ISM && IsValid(ISM) && InstanceIndex != INDEX_NONE)
 	{
-		UInstancedStaticMeshComponent* ISM = ISMData->ISMComponent;
-		int32 InstanceIndex = ISMData->InstanceIndex;
 		const int32 LastIndex = ISM->GetInstanceCount() - 1;
 
 		if (InstanceIndex >= 0 && InstanceIndex <= LastIndex)
@@ -297,14 +519,9 @@ UItemInstance* UGroundItemSubsystem::RemoveItemFromGroundInternal(int32 ItemID)
 		InstanceToIDMap.Remove(Item);
 	}
 
-	if (ISMContainerActor.IsValid())
-	{
-		ISMContainerActor->UnregisterItemFromAnimation(ItemID);
-	}
-
-	GroundItems.Remove(ItemID);
-	InstanceLocations.Remove(ItemID);
-	ItemISMData.Remove(ItemID);
+	Store.Remove(ItemID);
+	SpatialGrid.Remove(ItemID);
+	++ContentVersion;
 
 	return Item;
 }
@@ -325,12 +542,13 @@ TArray<UItemInstance*> UGroundItemSubsystem::RemoveMultipleItemsFromGround(const
 	TArray<TPair<int32, int32>> SortedItems;
 	for (int32 ItemID : ItemIDs)
 	{
-		if (FGroundItemISMData* Data = ItemISMData.Find(ItemID))
+		const int32 DenseIndex = Store.FindDenseIndex(ItemID);
+		if (DenseIndex != INDEX_NONE)
 		{
-			SortedItems.Add(TPair<int32, int32>(ItemID, Data->InstanceIndex));
-			if (Data->ISMComponent)
+			SortedItems.Add(TPair<int32, int32>(ItemID, Store.GetInstanceIndexAt(DenseIndex)));
+			if (UInstancedStaticMeshComponent* ISM = Store.GetISMAt(DenseIndex))
 			{
-				AffectedISMs.Add(Data->ISMComponent);
+				AffectedISMs.Add(ISM);
 			}
 		}
 	}
@@ -362,70 +580,78 @@ TArray<UItemInstance*> UGroundItemSubsystem::RemoveMultipleItemsFromGround(const
 	return RemovedItems;
 }
 
-UItemInstance* UGroundItemSubsystem::GetItemByID(int32 ItemID) const
+UItemInstance* UGroundItemSubsystem::GetItemByID(int32 ItemID)
 {
-	UItemInstance* const* FoundItem = GroundItems.Find(ItemID);
-	return FoundItem ? *FoundItem : nullptr;
+	const int32 DenseIndex = Store.FindDenseIndex(ItemID);
+	return DenseIndex != INDEX_NONE ? ResolveItemAt(DenseIndex) : nullptr;
 }
 
-UItemInstance* UGroundItemSubsystem::GetNearestItem(FVector Location, float MaxDistance, int32& OutItemID)
+const FCompactItemRecord* UGroundItemSubsystem::FindItemRecord(int32 ItemID) const
 {
-	OutItemID = -1;
-	float ClosestDistSq = MaxDistance * MaxDistance;
-	UItemInstance* ClosestItem = nullptr;
-
-	for (const TPair<int32, FVector>& Pair : InstanceLocations)
+	const int32 DenseIndex = Store.FindDenseIndex(ItemID);
+	if (DenseIndex == INDEX_NONE || Store.GetItemAt(DenseIndex))
 	{
-		float DistSq = FVector::DistSquared(Location, Pair.Value);
-		
-		if (DistSq < ClosestDistSq)
-		{
-			ClosestDistSq = DistSq;
-			OutItemID = Pair.Key;
-			
-			if (UItemInstance* const* Item = GroundItems.Find(Pair.Key))
-			{
-				ClosestItem = *Item;
-			}
-		}
+		return nullptr;
 	}
 
-	return ClosestItem;
+	const FCompactItemRecord& Record = Store.GetRecordAt(DenseIndex);
+	return Record.IsValid() ? &Record : nullptr;
 }
 
-int32 UGroundItemSubsystem::GetItemsInRadius(FVector Location, float Radius, TArray<int32>& OutItemIDs)
+UItemInstance* UGroundItemSubsystem::ResolveItemAt(int32 DenseIndex)
 {
-	OutItemIDs.Reset();
-	float RadiusSq = Radius * Radius;
+	if (UItemInstance* Item = Store.GetItemAt(DenseIndex))
+	{
+		return Item;
+	}
 
-	for (const TPair<int32, FVector>& Pair : InstanceLocations)
+	UItemInstance* Item = Store.GetRecordAt(DenseIndex).Materialize(this);
+	if (!Item)
 	{
-		float DistSq = FVector::DistSquared(Location, Pair.Value);
-		
-		if (DistSq <= RadiusSq)
-		{
-			OutItemIDs.Add(Pair.Key);
-		}
+		PH_LOG_WARNING(LogGroundItemSubsystem, "ResolveItemAt failed: ItemID=%d could not be built from its record.",
+			Store.GetItemIDAt(DenseIndex));
+		return nullptr;
+	}
+
+	Store.SetItemAt(DenseIndex, Item);
+	InstanceToIDMap.Add(Item, Store.GetItemIDAt(DenseIndex));
+
+	UE_LOG(LogGroundItemSubsystem, Verbose, TEXT("ResolveItemAt: Materialized item '%s' (ID: %d)"),
+		*Item->GetDisplayName().ToString(), Store.GetItemIDAt(DenseIndex));
+
+	return Item;
+}
+
+UItemInstance* UGroundItemSubsystem::GetNearestItem(FVector Location, float MaxDistance, int32& OutItemID)
+{
+	OutItemID = SpatialGrid.FindNearest(Location, MaxDistance);
+	if (OutItemID == INDEX_NONE)
+	{
+		OutItemID = -1;
+		return nullptr;
 	}
 
-	return OutItemIDs.Num();
+	return GetItemByID(OutItemID);
+}
+
+int32 UGroundItemSubsystem::GetItemsInRadius(FVector Location, float Radius, TArray<int32>& OutItemIDs)
+{
+	OutItemIDs.Reset();
+	return SpatialGrid.QueryRadius(Location, Radius, OutItemIDs);
 }
 
 TArray<UItemInstance*> UGroundItemSubsystem::GetItemInstancesInRadius(FVector Location, float Radius)
 {
-	TArray<UItemInstance*> ItemsInRange;
-	float RadiusSq = Radius * Radius;
+	TArray<int32> QueryIDs;
+	SpatialGrid.QueryRadius(Location, Radius, QueryIDs);
 
-	for (const TPair<int32, FVector>& Pair : InstanceLocations)
+	TArray<UItemInstance*> ItemsInRange;
+	ItemsInRange.Reserve(QueryIDs.Num());
+	for (const int32 ItemID : QueryIDs)
 	{
-		float DistSq = FVector::DistSquared(Location, Pair.Value);
-		
-		if (DistSq <= RadiusSq)
+		if (UItemInstance* Item = GetItemByID(ItemID))
 		{
-			if (UItemInstance* const* Found = GroundItems.Find(Pair.Key))
-			{
-				ItemsInRange.Add(*Found);
-			}
+			ItemsInRange.Add(Item);
 		}
 	}
 
@@ -455,30 +681,20 @@ int32 UGroundItemSubsystem::FindItemByISMInstance(UInstancedStaticMeshComponent*
 		return INDEX_NONE;
 	}
 
-
-	for (const TPair<int32, FGroundItemISMData>& Pair : ItemISMData)
-	{
-		if (Pair.Value.ISMComponent == ISMComponent && Pair.Value.InstanceIndex == InstanceIndex)
-		{
-			return Pair.Key;
-		}
-	}
-
-	return INDEX_NONE;
+	return Store.FindByISMInstance(ISMComponent, InstanceIndex);
 }
 
 void UGroundItemSubsystem::UpdateItemLocation(int32 ItemID, FVector NewLocation)
 {
-	FGroundItemISMData* ISMData = ItemISMData.Find(ItemID);
-	if (!ISMData || !ISMData->IsValid())
+	const int32 DenseIndex = Store.FindDenseIndex(ItemID);
+	UInstancedStaticMeshComponent* ISM = DenseIndex != INDEX_NONE ? Store.GetISMAt(DenseIndex) : nullptr;
+	const int32 InstanceIndex = DenseIndex != INDEX_NONE ? Store.GetInstanceIndexAt(DenseIndex) : INDEX_NONE;
+	if (!ISM || !IsValid(ISM) || InstanceIndex == INDEX_NONE)
 	{
 		PH_LOG_WARNING(LogGroundItemSubsystem, "UpdateItemLocation failed: No valid ISM data was found for ItemID=%d.", ItemID);
 		return;
 	}
 
-	UInstancedStaticMeshComponent* ISM = ISMData->ISMComponent;
-	int32 InstanceIndex = ISMData->InstanceIndex;
-
 	FTransform CurrentTransform;
 	ISM->GetInstanceTransform(InstanceIndex, CurrentTransform, true);
 
@@ -487,7 +703,9 @@ void UGroundItemSubsystem::UpdateItemLocation(int32 ItemID, FVector NewLocation)
 
 	ISM->UpdateInstanceTransform(InstanceIndex, NewTransform, true);
 
-	InstanceLocations.Add(ItemID, NewLocation);
+	Store.SetLocation(ItemID, NewLocation);
+	SpatialGrid.Update(ItemID, NewLocation);
+	++ContentVersion;
 }
 
 void UGroundItemSubsystem::ClearAllItems()
@@ -505,15 +723,122 @@ void UGroundItemSubsystem::ClearAllItems()
 		}
 	}
 
-	GroundItems.Empty();
-	InstanceLocations.Empty();
-	ItemISMData.Empty();
+	Store.Reset();
+	SpatialGrid.Reset();
 	InstanceToIDMap.Empty();
+	++ContentVersion;
 	PendingRemovals.Empty();
 
 	UE_LOG(LogGroundItemSubsystem, Log, TEXT("ClearAllItems: All ground items cleared"));
 }
 
+FGroundItemQueryBenchmarkResult UGroundItemSubsystem::BenchmarkSpatialQueries(
+	int32 ItemCount, int32 QueryCount, float QueryRadius, float AreaExtent) const
+{
+	FGroundItemQueryBenchmarkResult Result;
+	Result.ItemCount = FMath::Max(1, ItemCount);
+	Result.QueryCount = FMath::Max(1, QueryCount);
+
+	// Fixed seed so runs are comparable across builds.
+	FRandomStream Stream(0x6A11);
+
+	TMap<int32, FVector> LinearLocations;
+	LinearLocations.Reserve(Result.ItemCount);
+	FGroundItemSpatialGrid Grid(SpatialGridCellSize);
+
+	for (int32 ItemID = 0; ItemID < Result.ItemCount; ++ItemID)
+	{
+		const FVector Location(
+			Stream.FRandRange(-AreaExtent, AreaExtent),
+			Stream.FRandRange(-AreaExtent, AreaExtent),
+			Stream.FRandRange(0.0f, 50.0f));
+		LinearLocations.Add(ItemID, Location);
+		Grid.Add(ItemID, Location);
+	}
+
+	TArray<FVector> QueryPoints;
+	QueryPoints.Reserve(Result.QueryCount);
+	for (int32 Index = 0; Index < Result.QueryCount; ++Index)
+	{
+		QueryPoints.Emplace(
+			Stream.FRandRange(-AreaExtent, AreaExtent),
+			Stream.FRandRange(-AreaExtent, AreaExtent),
+			25.0f);
+	}
+
+	const float RadiusSq = QueryRadius * QueryRadius;
+	TArray<int32> LinearIDs;
+	TArray<int32> GridIDs;
+	int64 LinearHits = 0;
+	int64 GridHits = 0;
+
+	double StartSeconds = FPlatformTime::Seconds();
+	for (const FVector& Point : QueryPoints)
+	{
+		LinearIDs.Reset();
+		for (const TPair<int32, FVector>& Pair : LinearLocations)
+		{
+			if (FVector::DistSquared(Point, Pair.Value) <= RadiusSq)
+			{
+				LinearIDs.Add(Pair.Key);
+			}
+		}
+		LinearHits += LinearIDs.Num();
+	}
+	Result.LinearRadiusQueryMicroseconds = (FPlatformTime::Seconds() - StartSeconds) * 1.0e6 / Result.QueryCount;
+
+	StartSeconds = FPlatformTime::Seconds();
+	for (const FVector& Point : QueryPoints)
+	{
+		GridIDs.Reset();
+		GridHits += Grid.QueryRadius(Point, QueryRadius, GridIDs);
+	}
+	Result.GridRadiusQueryMicroseconds = (FPlatformTime::Seconds() - StartSeconds) * 1.0e6 / Result.QueryCount;
+	Result.bResultsMatch &= (LinearHits == GridHits);
+
+	TArray<float> LinearNearestDistSq;
+	LinearNearestDistSq.Reserve(Result.QueryCount);
+
+	StartSeconds = FPlatformTime::Seconds();
+	for (const FVector& Point : QueryPoints)
+	{
+		float BestDistSq = RadiusSq;
+		for (const TPair<int32, FVector>& Pair : LinearLocations)
+		{
+			BestDistSq = FMath::Min(BestDistSq, static_cast<float>(FVector::DistSquared(Point, Pair.Value)));
+		}
+		LinearNearestDistSq.Add(BestDistSq);
+	}
+	Result.LinearNearestQueryMicroseconds = (FPlatformTime::Seconds() - StartSeconds) * 1.0e6 / Result.QueryCount;
+
+	TArray<float> GridNearestDistSq;
+	GridNearestDistSq.Reserve(Result.QueryCount);
+
+	StartSeconds = FPlatformTime::Seconds();
+	for (const FVector& Point : QueryPoints)
+	{
+		float BestDistSq = RadiusSq;
+		Grid.FindNearest(Point, QueryRadius, &BestDistSq);
+		GridNearestDistSq.Add(BestDistSq);
+	}
+	Result.GridNearestQueryMicroseconds = (FPlatformTime::Seconds() - StartSeconds) * 1.0e6 / Result.QueryCount;
+
+	for (int32 Index = 0; Index < Result.QueryCount; ++Index)
+	{
+		Result.bResultsMatch &= FMath::IsNearlyEqual(LinearNearestDistSq[Index], GridNearestDistSq[Index], 0.01f);
+	}
+
+	UE_LOG(LogGroundItemSubsystem, Log,
+		TEXT("BenchmarkSpatialQueries: %d items, %d queries, radius %.0f, cell %.0f | "
+		     "radius linear %.2fus grid %.2fus | nearest linear %.2fus grid %.2fus | match=%s"),
+		Result.ItemCount, Result.QueryCount, QueryRadius, SpatialGridCellSize,
+		Result.LinearRadiusQueryMicroseconds, Result.GridRadiusQueryMicroseconds,
+		Result.LinearNearestQueryMicroseconds, Result.GridNearestQueryMicroseconds,
+		Result.bResultsMatch ? TEXT("yes") : TEXT("NO"));
+
+	return Result;
+}
+
 #if WITH_EDITOR
 void UGroundItemSubsystem::DebugDrawAllItems(float Duration)
 {
@@ -523,17 +848,21 @@ void UGroundItemSubsystem::DebugDrawAllItems(float Duration)
 		return;
 	}
 
-	for (const TPair<int32, FVector>& Pair : InstanceLocations)
+	for (int32 DenseIndex = 0; DenseIndex < Store.Num(); ++DenseIndex)
 	{
-		DrawDebugSphere(World, Pair.Value, 25.0f, 8, FColor::Yellow, false, Duration);
+		const FVector& Location = Store.GetLocationAt(DenseIndex);
+		DrawDebugSphere(World, Location, 25.0f, 8, FColor::Yellow, false, Duration);
 		
-		if (UItemInstance* const* Found = GroundItems.Find(Pair.Key))
+		UItemInstance* Item = Store.GetItemAt(DenseIndex);
+		const FCompactItemRecord& Record = Store.GetRecordAt(DenseIndex);
+		if (Item || Record.IsValid())
 		{
-			FString DebugText = FString::Printf(TEXT("[%d] %s"), Pair.Key, *(*Found)->GetDisplayName().ToString());
-			DrawDebugString(World, Pair.Value + FVector(0, 0, 50), DebugText, nullptr, FColor::White, Duration);
+			FString DebugText = FString::Printf(TEXT("[%d] %s%s"), Store.GetItemIDAt(DenseIndex),
+				*GroundItemSubsystemPrivate::DescribeItem(Item, &Record), Item ? TEXT("") : TEXT(" (record)"));
+			DrawDebugString(World, Location + FVector(0, 0, 50), DebugText, nullptr, FColor::White, Duration);
 		}
 	}
 	
-	UE_LOG(LogGroundItemSubsystem, Log, TEXT("DebugDrawAllItems: Drew %d items for %.1fs"), InstanceLocations.Num(), Duration);
+	UE_LOG(LogGroundItemSubsystem, Log, TEXT("DebugDrawAllItems: Drew %d items for %.1fs"), Store.Num(), Duration);
 }
 #endif
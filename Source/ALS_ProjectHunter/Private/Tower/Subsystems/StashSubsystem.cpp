@@ -1,13 +1,43 @@
 #include "Tower/Subsystems/StashSubsystem.h"
 #include "Tower/Subsystems/StashSaveGame.h"
+#include "Tower/Library/Structs/StashItemRecord.h"
 #include "Item/ItemInstance.h"
+#include "Item/Library/Structs/CompactItemRecord.h"
 #include "Kismet/GameplayStatics.h"
+#include "Async/TaskGraphInterfaces.h"
 #include "Serialization/MemoryWriter.h"
 #include "Serialization/MemoryReader.h"
 #include "Serialization/ObjectAndNameAsStringProxyArchive.h"
 
 DEFINE_LOG_CATEGORY(LogStashSubsystem);
 
+DECLARE_STATS_GROUP(TEXT("Stash"), STATGROUP_Stash, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Build Tab Save"), STAT_StashBuildTabSave, STATGROUP_Stash);
+DECLARE_CYCLE_STAT(TEXT("Materialize Items"), STAT_StashMaterializeItems, STATGROUP_Stash);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Saves In Flight"), STAT_StashSavesInFlight, STATGROUP_Stash);
+
+namespace StashSubsystemPrivate
+{
+	/** Shutdown waits this long for async saves before writing synchronously anyway. */
+	constexpr double PendingSaveTimeoutSeconds = 5.0;
+
+	void WriteItemBytes(UItemInstance& Item, TArray<uint8>& OutBytes)
+	{
+		FMemoryWriter MemWriter(OutBytes, true);
+		FObjectAndNameAsStringProxyArchive Ar(MemWriter, false);
+		Ar.ArIsSaveGame = true;
+		Item.Serialize(Ar);
+	}
+
+	void ReadItemBytes(UItemInstance& Item, const TArray<uint8>& Bytes)
+	{
+		FMemoryReader MemReader(Bytes, true);
+		FObjectAndNameAsStringProxyArchive Ar(MemReader, true);
+		Ar.ArIsSaveGame = true;
+		Item.Serialize(Ar);
+	}
+}
+
 
 void UStashSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -16,7 +46,18 @@ void UStashSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void UStashSubsystem::Deinitialize()
 {
-	FlushDirtyTabs();
+	bDeinitializing = true;
+
+	if (MaterializeTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(MaterializeTickerHandle);
+		MaterializeTickerHandle.Reset();
+	}
+
+	// An async save finishing after a blocking one would write older data over it.
+	WaitForPendingSaves();
+	FlushDirtyTabsInternal(true);
+
 	Super::Deinitialize();
 }
 
@@ -25,6 +66,9 @@ void UStashSubsystem::LoadStashHandles(const FString& CharacterSlotName)
 	ActiveSlotName = CharacterSlotName;
 	TabHandles.Empty();
 	LoadedTabs.Empty();
+	PendingTabLoads.Empty();
+	TabsAwaitingFile.Empty();
+	++SlotGeneration;
 
 	const FString HandleSlot = CharacterSlotName + TEXT("_StashHandles");
 
@@ -67,34 +111,40 @@ bool UStashSubsystem::RequestTabData(int32 TabIndex)
 		return false;
 	}
 
-	FStashTabHandle& Handle = TabHandles[TabIndex];
-
+	const FStashTabHandle& Handle = TabHandles[TabIndex];
 	if (Handle.bIsLoaded)
 	{
 		return true;
 	}
 
-	const bool bLoaded = LoadTab(TabIndex);
-	if (bLoaded)
+	if (IsTabLoading(TabIndex))
 	{
-		Handle.bIsLoaded = true;
-		OnStashTabLoaded.Broadcast(Handle.TabID);
-		UE_LOG(LogStashSubsystem, Log,
-			TEXT("RequestTabData: Tab '%s' loaded (%d items)"),
-			*Handle.TabID.ToString(),
-			LoadedTabs.Contains(Handle.TabID) ? LoadedTabs[Handle.TabID].Items.Num() : 0);
+		return false;
 	}
-	else
+
+	TabsAwaitingFile.Add(Handle.TabID);
+	UGameplayStatics::AsyncLoadGameFromSlot(BuildTabSlotName(Handle.TabID), 0,
+		FAsyncLoadGameFromSlotDelegate::CreateUObject(
+			this, &UStashSubsystem::HandleTabFileLoaded, Handle.TabID, SlotGeneration));
+
+	UE_LOG(LogStashSubsystem, Verbose,
+		TEXT("RequestTabData: Tab '%s' loading asynchronously"), *Handle.TabID.ToString());
+	return false;
+}
+
+bool UStashSubsystem::IsTabLoading(int32 TabIndex) const
+{
+	if (!IsValidTabIndex(TabIndex))
 	{
-		FStashTabData NewData(Handle.TabID);
-		NewData.GridSize = (Handle.TabType == EStashTabType::STT_Quad)
-			? FIntPoint(24, 24) : FIntPoint(12, 12);
-		LoadedTabs.Add(Handle.TabID, NewData);
-		Handle.bIsLoaded = true;
-		OnStashTabLoaded.Broadcast(Handle.TabID);
+		return false;
 	}
 
-	return true;
+	const FName TabID = TabHandles[TabIndex].TabID;
+	return TabsAwaitingFile.Contains(TabID)
+		|| PendingTabLoads.ContainsByPredicate([TabID](const FStashPendingTabLoad& Pending)
+		{
+			return Pending.TabID == TabID;
+		});
 }
 
 FStashTabData* UStashSubsystem::GetLoadedTabData(int32 TabIndex)
@@ -106,6 +156,30 @@ FStashTabData* UStashSubsystem::GetLoadedTabData(int32 TabIndex)
 	return LoadedTabs.Find(TabHandles[TabIndex].TabID);
 }
 
+UItemInstance* UStashSubsystem::GetTabItem(int32 TabIndex, FIntPoint GridPos)
+{
+	FStashTabData* TabData = GetLoadedTabData(TabIndex);
+	if (!TabData)
+	{
+		return nullptr;
+	}
+
+	FStashItemEntry* Entry = TabData->Items.FindByPredicate([GridPos](const FStashItemEntry& Candidate)
+	{
+		return Candidate.GridPosition == GridPos;
+	});
+	return Entry ? ResolveEntryItem(*Entry) : nullptr;
+}
+
+UItemInstance* UStashSubsystem::ResolveEntryItem(FStashItemEntry& Entry)
+{
+	if (!Entry.Item && Entry.Record.IsValid())
+	{
+		Entry.Item = Entry.Record.Materialize(this);
+	}
+	return Entry.Item;
+}
+
 bool UStashSubsystem::IsTabLoaded(int32 TabIndex) const
 {
 	return IsValidTabIndex(TabIndex) && TabHandles[TabIndex].bIsLoaded;
@@ -173,7 +247,7 @@ UItemInstance* UStashSubsystem::RemoveItemFromTab(int32 TabIndex, FIntPoint Grid
 	{
 		if (TabData->Items[i].GridPosition == GridPos)
 		{
-			UItemInstance* Item = TabData->Items[i].Item;
+			UItemInstance* Item = ResolveEntryItem(TabData->Items[i]);
 			TabData->Items.RemoveAt(i);
 
 			if (TabHandles[TabIndex].CachedItemCount > 0)
@@ -217,23 +291,92 @@ void UStashSubsystem::MarkTabDirty(int32 TabIndex)
 }
 
 void UStashSubsystem::FlushDirtyTabs()
+{
+	FlushDirtyTabsInternal(false);
+}
+
+void UStashSubsystem::FlushDirtyTabsInternal(bool bBlocking)
 {
 	bool bAnySaved = false;
 	for (int32 i = 0; i < TabHandles.Num(); ++i)
 	{
-		if (TabHandles[i].bIsDirty && TabHandles[i].bIsLoaded)
+		FStashTabHandle& Handle = TabHandles[i];
+		if (!Handle.bIsDirty || !Handle.bIsLoaded)
 		{
-			SaveTab(i);
-			TabHandles[i].bIsDirty = false;
-			bAnySaved = true;
-			UE_LOG(LogStashSubsystem, Log,
-				TEXT("FlushDirtyTabs: Saved tab '%s'"), *TabHandles[i].TabID.ToString());
+			continue;
+		}
+
+		// Saved again from HandleTabSaveCompleted, so two writes never race on one slot.
+		if (!bBlocking && TabSavesInFlight.Contains(Handle.TabID))
+		{
+			continue;
+		}
+
+		UStashTabSaveGame* SaveObj = BuildTabSave(i);
+		if (!SaveObj)
+		{
+			continue;
+		}
+
+		Handle.bIsDirty = false;
+		bAnySaved = true;
+
+		const FString SlotName = BuildTabSlotName(Handle.TabID);
+		if (bBlocking)
+		{
+			UGameplayStatics::SaveGameToSlot(SaveObj, SlotName, 0);
+		}
+		else
+		{
+			TabSavesInFlight.Add(Handle.TabID);
+			UGameplayStatics::AsyncSaveGameToSlot(SaveObj, SlotName, 0,
+				FAsyncSaveGameToSlotDelegate::CreateUObject(
+					this, &UStashSubsystem::HandleTabSaveCompleted, Handle.TabID, SlotGeneration));
 		}
+
+		UE_LOG(LogStashSubsystem, Log,
+			TEXT("FlushDirtyTabs: Saving tab '%s' (%d items, %s)"),
+			*Handle.TabID.ToString(), SaveObj->Items.Num(), bBlocking ? TEXT("blocking") : TEXT("async"));
 	}
 
-	if (bAnySaved)
+	SET_DWORD_STAT(STAT_StashSavesInFlight, TabSavesInFlight.Num());
+
+	if (bAnySaved || (bBlocking && bHandlesSaveQueued))
 	{
-		SaveHandles();
+		SaveHandles(bBlocking);
+	}
+}
+
+void UStashSubsystem::HandleTabSaveCompleted(const FString& SlotName, const int32 UserIndex, bool bSuccess,
+	FName TabID, uint32 Generation)
+{
+	TabSavesInFlight.Remove(TabID);
+	SET_DWORD_STAT(STAT_StashSavesInFlight, TabSavesInFlight.Num());
+
+	if (Generation != SlotGeneration)
+	{
+		return;
+	}
+
+	const int32 TabIndex = TabHandles.IndexOfByPredicate([TabID](const FStashTabHandle& Handle)
+	{
+		return Handle.TabID == TabID;
+	});
+
+	if (!bSuccess)
+	{
+		// No re-flush from here: a persistent failure (disk full, permissions)
+		// would loop save/fail forever. The next FlushDirtyTabs retries it.
+		UE_LOG(LogStashSubsystem, Warning,
+			TEXT("HandleTabSaveCompleted: Async save to slot '%s' failed - tab stays dirty until the next flush"), *SlotName);
+		MarkTabDirty(TabIndex);
+		return;
+	}
+
+	// Edited while the save was in flight.
+	if (!bDeinitializing && IsValidTabIndex(TabIndex) && TabHandles[TabIndex].bIsDirty)
+	{
+		FlushDirtyTabs();
 	}
 }
 
@@ -296,56 +439,119 @@ bool UStashSubsystem::FindFreeGridPosition(const FStashTabData& Tab, FIntPoint&
 	return false;
 }
 
-void UStashSubsystem::SaveTab(int32 TabIndex)
+UStashTabSaveGame* UStashSubsystem::BuildTabSave(int32 TabIndex) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_StashBuildTabSave);
+
 	const FStashTabHandle& Handle = TabHandles[TabIndex];
 	const FStashTabData* TabData = LoadedTabs.Find(Handle.TabID);
 	if (!TabData)
 	{
-		return;
+		return nullptr;
 	}
 
 	UStashTabSaveGame* SaveObj = Cast<UStashTabSaveGame>(
 		UGameplayStatics::CreateSaveGameObject(UStashTabSaveGame::StaticClass()));
 	if (!SaveObj)
 	{
-		return;
+		return nullptr;
 	}
 
 	SaveObj->TabID    = TabData->TabID;
 	SaveObj->GridSize = TabData->GridSize;
+	SaveObj->Items.Reserve(TabData->Items.Num());
 
+	FStashItemRecordWriter Writer(SaveObj->RecordNames);
 	for (const FStashItemEntry& Entry : TabData->Items)
 	{
-		if (!Entry.Item)
+		// OPT-COMPACTITEM: An item nobody changed since it rolled only needs its
+		// generation inputs, whether or not it was materialized in the meantime.
+		FCompactItemRecord Record = Entry.Record;
+		if (Entry.Item && !FCompactItemRecord::TryMakeFromItem(*Entry.Item, Record))
+		{
+			Record = FCompactItemRecord();
+		}
+
+		if (!Entry.Item && !Record.IsValid())
 		{
 			continue;
 		}
 
-		FStashItemSaveData ItemSave;
-		ItemSave.GridPosition  = Entry.GridPosition;
-		ItemSave.ItemClassPath = FSoftClassPath(Entry.Item->GetClass());
+		FStashItemSaveData& ItemSave = SaveObj->Items.AddDefaulted_GetRef();
+		ItemSave.GridPosition = Entry.GridPosition;
 
-		TArray<uint8> Bytes;
-		FMemoryWriter MemWriter(Bytes, true);
-		FObjectAndNameAsStringProxyArchive Ar(MemWriter, false);
-		Ar.ArIsSaveGame = true;
-		Entry.Item->Serialize(Ar);
-		ItemSave.ItemBytes = MoveTemp(Bytes);
+		if (Record.IsValid())
+		{
+			ItemSave.ItemClassPath = FSoftClassPath(UItemInstance::StaticClass());
+			Writer.WriteCompact(Record, ItemSave.RecordBytes);
+		}
+		else
+		{
+			WriteItemSaveData(*Entry.Item, Writer, ItemSave);
+		}
+	}
+
+	return SaveObj;
+}
+
+void UStashSubsystem::WriteItemSaveData(UItemInstance& Item, FStashItemRecordWriter& Writer,
+	FStashItemSaveData& OutSave)
+{
+	OutSave.ItemClassPath = FSoftClassPath(Item.GetClass());
 
-		SaveObj->Items.Add(MoveTemp(ItemSave));
+	// Subclasses may add SaveGame properties the record does not know about.
+	if (Item.GetClass() == UItemInstance::StaticClass() && Writer.Write(Item, OutSave.RecordBytes))
+	{
+		return;
 	}
 
-	const FString SlotName = BuildTabSlotName(Handle.TabID);
-	UGameplayStatics::SaveGameToSlot(SaveObj, SlotName, 0);
+	OutSave.RecordBytes.Reset();
+	StashSubsystemPrivate::WriteItemBytes(Item, OutSave.ItemBytes);
+}
 
-	UE_LOG(LogStashSubsystem, Log,
-		TEXT("SaveTab: Saved %d items for tab '%s' -> slot '%s'"),
-		SaveObj->Items.Num(), *Handle.TabID.ToString(), *SlotName);
+UItemInstance* UStashSubsystem::MaterializeItem(const FStashItemSaveData& ItemSave, FStashItemRecordReader& Reader)
+{
+	FCompactItemRecord Record;
+	if (Reader.ReadCompact(ItemSave.RecordBytes, Record))
+	{
+		return Record.Materialize(this);
+	}
+
+	UClass* ItemClass = ItemSave.ItemClassPath.TryLoadClass<UItemInstance>();
+	if (!ItemClass)
+	{
+		UE_LOG(LogStashSubsystem, Warning,
+			TEXT("MaterializeItem: Could not resolve item class '%s' - skipping"),
+			*ItemSave.ItemClassPath.ToString());
+		return nullptr;
+	}
+
+	UItemInstance* Item = NewObject<UItemInstance>(this, ItemClass);
+	if (!Item)
+	{
+		return nullptr;
+	}
+
+	if (ItemSave.RecordBytes.Num() > 0)
+	{
+		return Reader.Read(*Item, ItemSave.RecordBytes) ? Item : nullptr;
+	}
+
+	StashSubsystemPrivate::ReadItemBytes(*Item, ItemSave.ItemBytes);
+
+	// Run any version migration (added in ItemInstance serialization versioning)
+	Item->PostLoadInit();
+	return Item;
 }
 
-void UStashSubsystem::SaveHandles()
+void UStashSubsystem::SaveHandles(bool bBlocking)
 {
+	if (!bBlocking && bHandlesSaveInFlight)
+	{
+		bHandlesSaveQueued = true;
+		return;
+	}
+
 	UStashHandlesSaveGame* SaveObj = Cast<UStashHandlesSaveGame>(
 		UGameplayStatics::CreateSaveGameObject(UStashHandlesSaveGame::StaticClass()));
 	if (!SaveObj)
@@ -365,67 +571,283 @@ void UStashSubsystem::SaveHandles()
 	}
 
 	const FString Slot = ActiveSlotName + TEXT("_StashHandles");
-	UGameplayStatics::SaveGameToSlot(SaveObj, Slot, 0);
+	if (bBlocking)
+	{
+		UGameplayStatics::SaveGameToSlot(SaveObj, Slot, 0);
+	}
+	else
+	{
+		bHandlesSaveInFlight = true;
+		bHandlesSaveQueued = false;
+		UGameplayStatics::AsyncSaveGameToSlot(SaveObj, Slot, 0,
+			FAsyncSaveGameToSlotDelegate::CreateUObject(this, &UStashSubsystem::HandleHandlesSaveCompleted));
+	}
 
 	UE_LOG(LogStashSubsystem, Log,
-		TEXT("SaveHandles: Saved %d handles -> slot '%s'"),
+		TEXT("SaveHandles: Saving %d handles -> slot '%s'"),
 		SaveObj->Handles.Num(), *Slot);
 }
 
-bool UStashSubsystem::LoadTab(int32 TabIndex)
+void UStashSubsystem::HandleHandlesSaveCompleted(const FString& SlotName, const int32 UserIndex, bool bSuccess)
 {
-	const FString SlotName = BuildTabSlotName(TabHandles[TabIndex].TabID);
-	if (!UGameplayStatics::DoesSaveGameExist(SlotName, 0))
+	bHandlesSaveInFlight = false;
+
+	if (!bSuccess)
 	{
-		return false;
+		UE_LOG(LogStashSubsystem, Warning,
+			TEXT("HandleHandlesSaveCompleted: Async save to slot '%s' failed"), *SlotName);
 	}
 
-	USaveGame* Raw = UGameplayStatics::LoadGameFromSlot(SlotName, 0);
-	UStashTabSaveGame* TabSave = Raw ? Cast<UStashTabSaveGame>(Raw) : nullptr;
-	if (!TabSave)
+	if (bHandlesSaveQueued && !bDeinitializing)
 	{
-		UE_LOG(LogStashSubsystem, Warning,
-			TEXT("LoadTab: Failed to load/cast save game from slot '%s'"), *SlotName);
-		return false;
+		SaveHandles(false);
 	}
+}
 
-	FStashTabData TabData(TabSave->TabID);
-	TabData.GridSize = TabSave->GridSize;
+void UStashSubsystem::HandleTabFileLoaded(const FString& SlotName, const int32 UserIndex, USaveGame* LoadedSave,
+	FName TabID, uint32 Generation)
+{
+	if (Generation != SlotGeneration || !TabsAwaitingFile.Remove(TabID))
+	{
+		return;
+	}
 
-	for (const FStashItemSaveData& ItemSave : TabSave->Items)
+	const int32 TabIndex = TabHandles.IndexOfByPredicate([TabID](const FStashTabHandle& Handle)
 	{
-		UClass* ItemClass = ItemSave.ItemClassPath.TryLoadClass<UItemInstance>();
-		if (!ItemClass)
+		return Handle.TabID == TabID;
+	});
+	if (!IsValidTabIndex(TabIndex))
+	{
+		return;
+	}
+
+	UStashTabSaveGame* TabSave = Cast<UStashTabSaveGame>(LoadedSave);
+	FStashTabData& TabData = LoadedTabs.Add(TabID, FStashTabData(TabID));
+
+	if (!TabSave)
+	{
+		if (LoadedSave)
 		{
 			UE_LOG(LogStashSubsystem, Warning,
-				TEXT("LoadTab: Could not resolve item class '%s' - skipping"),
-				*ItemSave.ItemClassPath.ToString());
-			continue;
+				TEXT("HandleTabFileLoaded: Slot '%s' is not a stash tab save"), *SlotName);
 		}
 
-		UItemInstance* Item = NewObject<UItemInstance>(this, ItemClass);
-		if (!Item)
+		TabData.GridSize = (TabHandles[TabIndex].TabType == EStashTabType::STT_Quad)
+			? FIntPoint(24, 24) : FIntPoint(12, 12);
+		FinishTabLoad(TabID);
+		return;
+	}
+
+	TabData.GridSize = TabSave->GridSize;
+	TabData.Items.Reserve(TabSave->Items.Num());
+
+	FStashPendingTabLoad& Pending = PendingTabLoads.AddDefaulted_GetRef();
+	Pending.TabID = TabID;
+	Pending.SaveGame = TabSave;
+
+	if (!MaterializeTickerHandle.IsValid())
+	{
+		MaterializeTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UStashSubsystem::TickPendingTabLoads));
+	}
+}
+
+bool UStashSubsystem::TickPendingTabLoads(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_StashMaterializeItems);
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	const double BudgetSeconds = MaterializeBudgetMs / 1000.0;
+	int32 MaterializedThisFrame = 0;
+
+	while (PendingTabLoads.Num() > 0)
+	{
+		FStashPendingTabLoad& Pending = PendingTabLoads[0];
+		const UStashTabSaveGame* TabSave = Pending.SaveGame;
+		FStashTabData* TabData = LoadedTabs.Find(Pending.TabID);
+
+		if (TabSave && TabData)
 		{
-			continue;
+			FStashItemRecordReader Reader(TabSave->RecordNames);
+			while (Pending.NextItemIndex < TabSave->Items.Num())
+			{
+				if (MaterializedThisFrame > 0 && (FPlatformTime::Seconds() - StartSeconds) >= BudgetSeconds)
+				{
+					return true;
+				}
+
+				const FStashItemSaveData& ItemSave = TabSave->Items[Pending.NextItemIndex++];
+
+				// OPT-COMPACTITEM: Untouched items stay records until GetTabItem.
+				FCompactItemRecord Record;
+				if (Reader.ReadCompact(ItemSave.RecordBytes, Record))
+				{
+					TabData->Items.Add(FStashItemEntry(Record, ItemSave.GridPosition));
+					continue;
+				}
+
+				if (UItemInstance* Item = MaterializeItem(ItemSave, Reader))
+				{
+					TabData->Items.Add(FStashItemEntry(Item, ItemSave.GridPosition));
+				}
+				++MaterializedThisFrame;
+			}
 		}
 
-		FMemoryReader MemReader(ItemSave.ItemBytes, true);
-		FObjectAndNameAsStringProxyArchive Ar(MemReader, true);
-		Ar.ArIsSaveGame = true;
-		Item->Serialize(Ar);
+		const FName TabID = Pending.TabID;
+		PendingTabLoads.RemoveAt(0);
+		FinishTabLoad(TabID);
+	}
 
-		// Run any version migration (added in ItemInstance serialization versioning)
-		Item->PostLoadInit();
+	MaterializeTickerHandle.Reset();
+	return false;
+}
 
-		TabData.Items.Add(FStashItemEntry(Item, ItemSave.GridPosition));
+void UStashSubsystem::FinishTabLoad(FName TabID)
+{
+	const int32 TabIndex = TabHandles.IndexOfByPredicate([TabID](const FStashTabHandle& Handle)
+	{
+		return Handle.TabID == TabID;
+	});
+	if (!IsValidTabIndex(TabIndex))
+	{
+		return;
 	}
 
-	LoadedTabs.Add(TabData.TabID, MoveTemp(TabData));
+	FStashTabHandle& Handle = TabHandles[TabIndex];
+	const FStashTabData* TabData = LoadedTabs.Find(TabID);
+	Handle.bIsLoaded = true;
+	Handle.CachedItemCount = TabData ? TabData->Items.Num() : 0;
 
 	UE_LOG(LogStashSubsystem, Log,
-		TEXT("LoadTab: Loaded %d items from slot '%s'"),
-		LoadedTabs[TabHandles[TabIndex].TabID].Items.Num(), *SlotName);
-	return true;
+		TEXT("FinishTabLoad: Tab '%s' loaded (%d items)"), *TabID.ToString(), Handle.CachedItemCount);
+
+	OnStashTabLoaded.Broadcast(TabID);
+}
+
+void UStashSubsystem::WaitForPendingSaves()
+{
+	const double Deadline = FPlatformTime::Seconds() + StashSubsystemPrivate::PendingSaveTimeoutSeconds;
+	while ((TabSavesInFlight.Num() > 0 || bHandlesSaveInFlight) && FPlatformTime::Seconds() < Deadline)
+	{
+		// Completion delegates are dispatched to the game thread, which is this one.
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+		FPlatformProcess::Sleep(0.001f);
+	}
+
+	if (TabSavesInFlight.Num() > 0 || bHandlesSaveInFlight)
+	{
+		UE_LOG(LogStashSubsystem, Warning,
+			TEXT("WaitForPendingSaves: %d tab saves still in flight at shutdown"), TabSavesInFlight.Num());
+	}
+}
+
+FStashPersistenceBenchmarkResult UStashSubsystem::BenchmarkTabPersistence(FDataTableRowHandle BaseItemHandle,
+	int32 ItemCount, EItemRarity Rarity)
+{
+	FStashPersistenceBenchmarkResult Result;
+	Result.ItemCount = FMath::Max(1, ItemCount);
+
+	// Fixed seeds so runs are comparable across builds.
+	TArray<UItemInstance*> Items;
+	Items.Reserve(Result.ItemCount);
+	for (int32 Index = 0; Index < Result.ItemCount; ++Index)
+	{
+		UItemInstance* Item = NewObject<UItemInstance>(GetTransientPackage());
+		Item->SetSeed(0x57A5 + Index);
+		Item->Initialize(BaseItemHandle, 1 + Index % 100, Rarity, true);
+		Items.Add(Item);
+	}
+
+	// Legacy: every item through the full SaveGame property serializer.
+	double StartSeconds = FPlatformTime::Seconds();
+	UStashTabSaveGame* LegacySave = NewObject<UStashTabSaveGame>(GetTransientPackage());
+	LegacySave->Items.Reserve(Result.ItemCount);
+	for (UItemInstance* Item : Items)
+	{
+		FStashItemSaveData& ItemSave = LegacySave->Items.AddDefaulted_GetRef();
+		ItemSave.ItemClassPath = FSoftClassPath(Item->GetClass());
+		StashSubsystemPrivate::WriteItemBytes(*Item, ItemSave.ItemBytes);
+	}
+	TArray<uint8> LegacyBytes;
+	UGameplayStatics::SaveGameToMemory(LegacySave, LegacyBytes);
+	Result.LegacySaveMilliseconds = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+	Result.LegacyTabBytes = LegacyBytes.Num();
+
+	StartSeconds = FPlatformTime::Seconds();
+	UStashTabSaveGame* RecordSave = NewObject<UStashTabSaveGame>(GetTransientPackage());
+	RecordSave->Items.Reserve(Result.ItemCount);
+	{
+		FStashItemRecordWriter Writer(RecordSave->RecordNames);
+		for (UItemInstance* Item : Items)
+		{
+			WriteItemSaveData(*Item, Writer, RecordSave->Items.AddDefaulted_GetRef());
+		}
+	}
+	TArray<uint8> RecordBytes;
+	UGameplayStatics::SaveGameToMemory(RecordSave, RecordBytes);
+	Result.RecordSaveMilliseconds = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+	Result.RecordTabBytes = RecordBytes.Num();
+	Result.RecordItemCount = RecordSave->Items.FilterByPredicate([](const FStashItemSaveData& ItemSave)
+	{
+		return ItemSave.RecordBytes.Num() > 0;
+	}).Num();
+
+	StartSeconds = FPlatformTime::Seconds();
+	if (UStashTabSaveGame* Loaded = Cast<UStashTabSaveGame>(UGameplayStatics::LoadGameFromMemory(LegacyBytes)))
+	{
+		for (const FStashItemSaveData& ItemSave : Loaded->Items)
+		{
+			UItemInstance* Item = NewObject<UItemInstance>(GetTransientPackage());
+			StashSubsystemPrivate::ReadItemBytes(*Item, ItemSave.ItemBytes);
+			Item->PostLoadInit();
+		}
+	}
+	Result.LegacyLoadMilliseconds = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+
+	StartSeconds = FPlatformTime::Seconds();
+	TArray<UItemInstance*> RecordItems;
+	RecordItems.Reserve(Result.ItemCount);
+	if (UStashTabSaveGame* Loaded = Cast<UStashTabSaveGame>(UGameplayStatics::LoadGameFromMemory(RecordBytes)))
+	{
+		FStashItemRecordReader Reader(Loaded->RecordNames);
+		for (const FStashItemSaveData& ItemSave : Loaded->Items)
+		{
+			RecordItems.Add(MaterializeItem(ItemSave, Reader));
+		}
+	}
+	Result.RecordLoadMilliseconds = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+
+	Result.bResultsMatch = RecordItems.Num() == Items.Num();
+	for (int32 Index = 0; Result.bResultsMatch && Index < Items.Num(); ++Index)
+	{
+		const UItemInstance* Original = Items[Index];
+		const UItemInstance* Restored = RecordItems[Index];
+		Result.bResultsMatch = Restored
+			&& Restored->UniqueID == Original->UniqueID
+			&& Restored->Seed == Original->Seed
+			&& Restored->Rarity == Original->Rarity
+			&& Restored->Stats.GetTotalStatCount() == Original->Stats.GetTotalStatCount();
+
+		for (int32 StatIndex = 0; Result.bResultsMatch && StatIndex < Original->Stats.Prefixes.Num(); ++StatIndex)
+		{
+			const FPHAttributeData& A = Original->Stats.Prefixes[StatIndex];
+			const FPHAttributeData& B = Restored->Stats.Prefixes[StatIndex];
+			Result.bResultsMatch = A.AttributeUID == B.AttributeUID
+				&& A.AttributeName == B.AttributeName
+				&& A.RolledStatValue == B.RolledStatValue;
+		}
+	}
+
+	UE_LOG(LogStashSubsystem, Log,
+		TEXT("BenchmarkTabPersistence: %d items (%d as records) | bytes legacy %d record %d | "
+		     "save legacy %.2fms record %.2fms | load legacy %.2fms record %.2fms | match=%s"),
+		Result.ItemCount, Result.RecordItemCount, Result.LegacyTabBytes, Result.RecordTabBytes,
+		Result.LegacySaveMilliseconds, Result.RecordSaveMilliseconds,
+		Result.LegacyLoadMilliseconds, Result.RecordLoadMilliseconds,
+		Result.bResultsMatch ? TEXT("true") : TEXT("false"));
+
+	return Result;
 }
 
 bool UStashSubsystem::IsValidTabIndex(int32 TabIndex) const
@@ -16,6 +16,12 @@ FText UHunterDamagePopupWidget::GetDamageText() const
 
 void UHunterDamagePopupWidget::FinishDamagePopup()
 {
+	if (OnDamagePopupFinished.IsBound())
+	{
+		OnDamagePopupFinished.Execute(this);
+		return;
+	}
+
 	if (UWidgetComponent* WidgetComponent = OwningWorldWidgetComponent.Get())
 	{
 		OwningWorldWidgetComponent.Reset();
@@ -37,6 +37,18 @@ namespace ItemTooltipSectionWidgetPrivate
 	}
 }
 
+UItemTooltipSectionWidget::UItemTooltipSectionWidget(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+	, LineWidgetPool(*this)
+{
+}
+
+void UItemTooltipSectionWidget::ReleaseSlateResources(const bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+	LineWidgetPool.ReleaseAllSlateResources();
+}
+
 void UItemTooltipSectionWidget::SetSectionData(
 	const FItemTooltipSection& InSectionData,
 	const FLinearColor InHeadingColor)
@@ -75,6 +87,8 @@ void UItemTooltipSectionWidget::PopulateLines()
 	}
 
 	LinesContainer->ClearChildren();
+	LineWidgetPool.ReleaseAll();
+	FallbackLinesInUse = 0;
 
 	for (const FItemTooltipLine& Line : SectionData.Lines)
 	{
@@ -86,7 +100,7 @@ void UItemTooltipSectionWidget::PopulateLines()
 		if (LineWidgetClass && GetWorld())
 		{
 			if (UItemTooltipLineWidget* LineWidget =
-				CreateWidget<UItemTooltipLineWidget>(GetWorld(), LineWidgetClass))
+				LineWidgetPool.GetOrCreateInstance<UItemTooltipLineWidget>(LineWidgetClass))
 			{
 				LineWidget->SetLineData(Line);
 				LinesContainer->AddChildToVerticalBox(LineWidget);
@@ -100,17 +114,32 @@ void UItemTooltipSectionWidget::PopulateLines()
 
 void UItemTooltipSectionWidget::AddFallbackLine(const FItemTooltipLine& Line)
 {
-	if (!WidgetTree || !LinesContainer)
+	if (!LinesContainer)
 	{
 		return;
 	}
 
-	UTextBlock* TextBlock = WidgetTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass());
+	UTextBlock* TextBlock = nullptr;
+	if (FallbackLinePool.IsValidIndex(FallbackLinesInUse))
+	{
+		TextBlock = FallbackLinePool[FallbackLinesInUse];
+	}
+	else if (WidgetTree)
+	{
+		TextBlock = WidgetTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass());
+		if (TextBlock)
+		{
+			FallbackLinePool.Add(TextBlock);
+		}
+	}
+
 	if (!TextBlock)
 	{
 		return;
 	}
 
+	++FallbackLinesInUse;
+
 	TextBlock->SetText(ItemTooltipSectionWidgetPrivate::MakeFallbackLineText(Line));
 	TextBlock->SetColorAndOpacity(FSlateColor(Line.TextColor));
 	TextBlock->SetJustification(Line.bUseValueColumn ? ETextJustify::Left : ETextJustify::Center);
@@ -59,6 +59,12 @@ namespace ItemTooltipWidgetPrivate
 	}
 }
 
+UItemTooltipWidget::UItemTooltipWidget(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+	, SectionWidgetPool(*this)
+{
+}
+
 void UItemTooltipWidget::NativeConstruct()
 {
 	Super::NativeConstruct();
@@ -84,6 +90,12 @@ void UItemTooltipWidget::NativeDestruct()
 	Super::NativeDestruct();
 }
 
+void UItemTooltipWidget::ReleaseSlateResources(const bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+	SectionWidgetPool.ReleaseAllSlateResources();
+}
+
 void UItemTooltipWidget::UpdateTooltip(UItemInstance* Item)
 {
 	if (!Item)
@@ -92,18 +104,21 @@ void UItemTooltipWidget::UpdateTooltip(UItemInstance* Item)
 		return;
 	}
 
-	if (DisplayedItem.Get() == Item && TooltipData.bHasItem)
+	if (DisplayedItem.Get() == Item && DisplayedRevision == Item->GetRevision() && TooltipData.bHasItem)
 	{
 		return;
 	}
 
-	if (!UItemTooltipFunctionLibrary::BuildItemTooltipData(Item, TooltipData))
+	const TSharedPtr<const FItemTooltipData> CachedData = UItemTooltipFunctionLibrary::GetCachedItemTooltipData(Item);
+	if (!CachedData.IsValid())
 	{
 		ClearTooltip();
 		return;
 	}
 
+	TooltipData = *CachedData;
 	DisplayedItem = Item;
+	DisplayedRevision = Item->GetRevision();
 
 	if (ItemNameText)
 	{
@@ -179,12 +194,9 @@ void UItemTooltipWidget::HandleCloseAnimationFinished()
 void UItemTooltipWidget::ClearTooltip()
 {
 	DisplayedItem.Reset();
+	DisplayedRevision = INDEX_NONE;
 	TooltipData = FItemTooltipData();
-
-	if (SectionsContainer)
-	{
-		SectionsContainer->ClearChildren();
-	}
+	ReleaseSectionWidgets();
 
 	if (ItemNameText)
 	{
@@ -250,7 +262,7 @@ void UItemTooltipWidget::PopulateSections()
 		return;
 	}
 
-	SectionsContainer->ClearChildren();
+	ReleaseSectionWidgets();
 	const FLinearColor GradeColor = GetGradeColor(TooltipData.Rarity);
 
 	for (const FItemTooltipSection& Section : TooltipData.Sections)
@@ -263,7 +275,7 @@ void UItemTooltipWidget::PopulateSections()
 		if (SectionWidgetClass && GetWorld())
 		{
 			if (UItemTooltipSectionWidget* SectionWidget =
-				CreateWidget<UItemTooltipSectionWidget>(GetWorld(), SectionWidgetClass))
+				SectionWidgetPool.GetOrCreateInstance<UItemTooltipSectionWidget>(SectionWidgetClass))
 			{
 				SectionWidget->SetSectionData(Section, GradeColor);
 				SectionsContainer->AddChildToVerticalBox(SectionWidget);
@@ -275,6 +287,17 @@ void UItemTooltipWidget::PopulateSections()
 	}
 }
 
+void UItemTooltipWidget::ReleaseSectionWidgets()
+{
+	if (SectionsContainer)
+	{
+		SectionsContainer->ClearChildren();
+	}
+
+	SectionWidgetPool.ReleaseAll();
+	FallbackTextBlocksInUse = 0;
+}
+
 void UItemTooltipWidget::AddFallbackSection(const FItemTooltipSection& Section)
 {
 	if (!SectionsContainer)
@@ -314,17 +337,27 @@ UTextBlock* UItemTooltipWidget::CreateFallbackTextBlock(
 	const FLinearColor Color,
 	const ETextJustify::Type Justification)
 {
-	if (!WidgetTree)
+	UTextBlock* TextBlock = nullptr;
+	if (FallbackTextBlockPool.IsValidIndex(FallbackTextBlocksInUse))
 	{
-		return nullptr;
+		TextBlock = FallbackTextBlockPool[FallbackTextBlocksInUse];
+	}
+	else if (WidgetTree)
+	{
+		TextBlock = WidgetTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass());
+		if (TextBlock)
+		{
+			FallbackTextBlockPool.Add(TextBlock);
+		}
 	}
 
-	UTextBlock* TextBlock = WidgetTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass());
 	if (!TextBlock)
 	{
 		return nullptr;
 	}
 
+	++FallbackTextBlocksInUse;
+
 	TextBlock->SetText(Text);
 	TextBlock->SetColorAndOpacity(FSlateColor(Color));
 	TextBlock->SetJustification(Justification);
@@ -270,7 +270,7 @@ void UPHInventoryMenuPanelWidget::BindManagerDelegates()
 
 	if (InventoryManager)
 	{
-		InventoryManager->OnInventoryChanged.AddUniqueDynamic(this, &UPHInventoryMenuPanelWidget::HandleInventoryChanged);
+		InventoryManager->OnInventorySlotsChanged.AddUniqueDynamic(this, &UPHInventoryMenuPanelWidget::HandleInventorySlotsChanged);
 		InventoryManager->OnWeightChanged.AddUniqueDynamic(this, &UPHInventoryMenuPanelWidget::HandleCarryWeightChanged);
 	}
 }
@@ -284,7 +284,7 @@ void UPHInventoryMenuPanelWidget::UnbindManagerDelegates()
 
 	if (InventoryManager)
 	{
-		InventoryManager->OnInventoryChanged.RemoveDynamic(this, &UPHInventoryMenuPanelWidget::HandleInventoryChanged);
+		InventoryManager->OnInventorySlotsChanged.RemoveDynamic(this, &UPHInventoryMenuPanelWidget::HandleInventorySlotsChanged);
 		InventoryManager->OnWeightChanged.RemoveDynamic(this, &UPHInventoryMenuPanelWidget::HandleCarryWeightChanged);
 	}
 }
@@ -309,18 +309,48 @@ void UPHInventoryMenuPanelWidget::RebuildInventorySlots()
 	UE_LOG(LogPHMenu, Log, TEXT("%s: building %d inventory slots."), *GetName(), SlotCount);
 	for (int32 SlotIndex = 0; SlotIndex < SlotCount; ++SlotIndex)
 	{
-		UItemInstance* Item = InventoryManager->GetItemAtSlot(SlotIndex);
-		if (!bIncludeEmptyInventorySlots && !Item)
+		if (!bIncludeEmptyInventorySlots && !InventoryManager->GetItemAtSlot(SlotIndex))
 		{
 			continue;
 		}
 
-		const EEquipmentSlot SuggestedSlot = ResolveSuggestedSlot(Item);
-		const FEquipmentMenuInventorySlotViewData SlotData =
-			UMenuFunctionLibrary::MakeInventorySlotViewData(SlotIndex, Item, SuggestedSlot);
+		InventorySlots.Add(MakeSlotViewData(SlotIndex));
+	}
+}
+
+bool UPHInventoryMenuPanelWidget::RefreshInventorySlots(const TArray<int32>& SlotIndices)
+{
+	// With empty slots filtered out, view index != slot index and any change
+	// can shift the layout, so only the full grid path is in-place safe.
+	if (!InventoryManager
+		|| !bIncludeEmptyInventorySlots
+		|| InventorySlots.Num() != InventoryManager->GetSlotCount())
+	{
+		return false;
+	}
 
-		InventorySlots.Add(SlotData);
+	const bool bHasCells = bAutoBuildInventorySlotWidgets && InventorySlotWidgets.Num() == InventorySlots.Num();
+	for (const int32 SlotIndex : SlotIndices)
+	{
+		if (!InventorySlots.IsValidIndex(SlotIndex))
+		{
+			return false;
+		}
+
+		InventorySlots[SlotIndex] = MakeSlotViewData(SlotIndex);
+		if (bHasCells && InventorySlotWidgets[SlotIndex])
+		{
+			InventorySlotWidgets[SlotIndex]->SetSlotData(InventorySlots[SlotIndex]);
+		}
 	}
+
+	return true;
+}
+
+FEquipmentMenuInventorySlotViewData UPHInventoryMenuPanelWidget::MakeSlotViewData(int32 SlotIndex) const
+{
+	UItemInstance* Item = InventoryManager ? InventoryManager->GetItemAtSlot(SlotIndex) : nullptr;
+	return UMenuFunctionLibrary::MakeInventorySlotViewData(SlotIndex, Item, ResolveSuggestedSlot(Item));
 }
 
 void UPHInventoryMenuPanelWidget::UpdateInventorySummary()
@@ -386,9 +416,26 @@ void UPHInventoryMenuPanelWidget::HandleEquipmentChanged(EEquipmentSlot, UItemIn
 	RefreshInventoryData();
 }
 
-void UPHInventoryMenuPanelWidget::HandleInventoryChanged()
+void UPHInventoryMenuPanelWidget::HandleInventorySlotsChanged(const TArray<int32>& SlotIndices)
 {
-	RefreshInventoryData();
+	// OPT-INVENTORYREP: a move or stack change touches one or two cells, so
+	// refresh those instead of rebuilding every slot's view data.
+	if (!RefreshInventorySlots(SlotIndices))
+	{
+		RefreshInventoryData();
+		OnInventoryChanged();
+		return;
+	}
+
+	UpdateInventorySummary();
+
+	if (SelectedInventorySlotIndex != INDEX_NONE && SlotIndices.Contains(SelectedInventorySlotIndex))
+	{
+		SelectInventorySlot(SelectedInventorySlotIndex);
+	}
+
+	OnInventoryDataRefreshed();
+	InventoryDataRefreshed.Broadcast();
 	OnInventoryChanged();
 }
 
@@ -79,3 +79,33 @@ enum class EMobSpawnRuleLifetime : uint8
 	/** Fires, cools down for CooldownSeconds, then can fire again. */
 	RepeatableWithCooldown    UMETA(DisplayName = "Repeatable With Cooldown"),
 };
+
+// Ordering policy for UMobSpawnSchedulerSubsystem's shared spawn queue
+UENUM(BlueprintType)
+enum class EMobSpawnSchedulerPriority : uint8
+{
+	/** Managers closest to any player are serviced first. */
+	NearestPlayer       UMETA(DisplayName = "Nearest Player"),
+
+	/** Managers furthest below MaxNumOfMobs are serviced first. */
+	PopulationDeficit   UMETA(DisplayName = "Population Deficit"),
+};
+
+// Update detail UMobSignificanceSubsystem assigns a mob, most expensive first
+UENUM(BlueprintType)
+enum class EMobSignificanceTier : uint8
+{
+	/** Authored tick rates, full animation, foot IK, land prediction and mantle checks. */
+	Full        UMETA(DisplayName = "Full"),
+
+	/** Slightly throttled actor tick and animation update-rate optimization. */
+	Reduced     UMETA(DisplayName = "Reduced"),
+
+	/** Throttled actor and animation ticks, no IK or traversal checks. */
+	Low         UMETA(DisplayName = "Low"),
+
+	/** Far from every player; everything ticks at the slowest rate. */
+	Dormant     UMETA(DisplayName = "Dormant"),
+
+	MAX         UMETA(Hidden),
+};
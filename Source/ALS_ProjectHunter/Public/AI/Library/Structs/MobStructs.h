@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "AI/Library/Enums/MobEnumLibrary.h"
 #include "AttributeSet.h"
+#include "Components/SkinnedMeshComponent.h"
 #include "Engine/DataTable.h"
 #include "GameplayTagContainer.h"
 #include "MobStructs.generated.h"
@@ -256,3 +257,166 @@ struct ALS_PROJECTHUNTER_API FPlayerLocationSnapshot
 	UPROPERTY(BlueprintReadOnly) FVector Velocity  = FVector::ZeroVector;
 	UPROPERTY(BlueprintReadOnly) double  TimestampSeconds = 0.0;
 };
+
+// FMobSpawnPointBenchmarkResult - live vs cached spawn-point selection throughput
+USTRUCT(BlueprintType)
+struct ALS_PROJECTHUNTER_API FMobSpawnPointBenchmarkResult
+{
+	GENERATED_BODY()
+
+	/** Candidates evaluated per path. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 Iterations = 0;
+
+	/** Valid points per second through nav projection, ground trace, distance and capsule overlap. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double LivePointsPerSecond = 0.0;
+
+	/** Valid points per second picked from the baked cache with only the player-distance filter. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double CachedPointsPerSecond = 0.0;
+
+	/** Valid points produced by the live path out of Iterations. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 LiveValidCount = 0;
+
+	/** Valid points produced by the cached path out of Iterations. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 CachedValidCount = 0;
+};
+
+// FMobPoolClassStats - per-class UMobPoolSubsystem counters used to size MaxPoolSizePerClass
+USTRUCT(BlueprintType)
+struct ALS_PROJECTHUNTER_API FMobPoolClassStats
+{
+	GENERATED_BODY()
+
+	/** Acquire() calls served from the pool. */
+	UPROPERTY(BlueprintReadOnly, Category = "Pool")
+	int32 Hits = 0;
+
+	/** Acquire() calls that fell back to SpawnActor on an empty pool. */
+	UPROPERTY(BlueprintReadOnly, Category = "Pool")
+	int32 Misses = 0;
+
+	/** Instances spawned ahead of time by pre-warm or low-water refill. */
+	UPROPERTY(BlueprintReadOnly, Category = "Pool")
+	int32 Prewarmed = 0;
+
+	/** Releases destroyed because the pool was already at MaxPoolSizePerClass. */
+	UPROPERTY(BlueprintReadOnly, Category = "Pool")
+	int32 DestroyedOnRelease = 0;
+
+	/** Instances currently acquired and not yet released. */
+	UPROPERTY(BlueprintReadOnly, Category = "Pool")
+	int32 Outstanding = 0;
+
+	/** Highest Outstanding seen - a good starting point for MaxPoolSizePerClass. */
+	UPROPERTY(BlueprintReadOnly, Category = "Pool")
+	int32 PeakOutstanding = 0;
+
+	/** Sum of Acquire() wall time, in milliseconds. */
+	UPROPERTY(BlueprintReadOnly, Category = "Pool")
+	float TotalAcquireMs = 0.0f;
+
+	/** Slowest single Acquire(), in milliseconds. */
+	UPROPERTY(BlueprintReadOnly, Category = "Pool")
+	float MaxAcquireMs = 0.0f;
+
+	float GetAverageAcquireMs() const
+	{
+		const int32 Total = Hits + Misses;
+		return Total > 0 ? TotalAcquireMs / static_cast<float>(Total) : 0.0f;
+	}
+};
+
+// FMobSignificanceTierSettings - what one UMobSignificanceSubsystem tier does to a mob
+//
+// Intervals never go below the mob's authored ones, so a tier can only make a
+// mob cheaper than its Blueprint defaults.
+USTRUCT(BlueprintType)
+struct ALS_PROJECTHUNTER_API FMobSignificanceTierSettings
+{
+	GENERATED_BODY()
+
+	/** Mobs whose nearest player is within this distance qualify for the tier. Ignored for Dormant. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Significance", meta = (ClampMin = 0.0f))
+	float MaxDistance = 0.0f;
+
+	/** Mobs the tier holds at once, nearest first; the rest fall to the next tier. 0 = unlimited. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Significance", meta = (ClampMin = 0))
+	int32 MaxMobs = 0;
+
+	/** Actor and TagManager tick interval in seconds. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Significance", meta = (ClampMin = 0.0f))
+	float ActorTickInterval = 0.0f;
+
+	/** Skeletal mesh (animation) tick interval in seconds. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Significance", meta = (ClampMin = 0.0f))
+	float AnimTickInterval = 0.0f;
+
+	/** Character movement tick interval in seconds. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Significance", meta = (ClampMin = 0.0f))
+	float MovementTickInterval = 0.0f;
+
+	/** Turn on the mesh's animation update-rate optimization (URO). */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Significance")
+	bool bUpdateRateOptimizations = false;
+
+	/** Replace the mesh's VisibilityBasedAnimTickOption with AnimTickOption. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Significance")
+	bool bOverrideAnimTickOption = false;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Significance",
+		meta = (EditCondition = "bOverrideAnimTickOption"))
+	EVisibilityBasedAnimTickOption AnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPose;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Significance")
+	bool bFootIK = true;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Significance")
+	bool bLandPrediction = true;
+
+	/** Per-tick mantle checks while falling; jump-triggered mantles always work. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Significance")
+	bool bMantleChecks = true;
+};
+
+// FMobSignificanceStats - UMobSignificanceSubsystem state after the last evaluation
+USTRUCT(BlueprintType)
+struct ALS_PROJECTHUNTER_API FMobSignificanceStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Significance")
+	int32 FullMobs = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Significance")
+	int32 ReducedMobs = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Significance")
+	int32 LowMobs = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Significance")
+	int32 DormantMobs = 0;
+
+	/** Mobs pushed down a tier because a closer tier was full. */
+	UPROPERTY(BlueprintReadOnly, Category = "Significance")
+	int32 BudgetDemotions = 0;
+
+	/** Mobs pushed down because they were not rendered recently. */
+	UPROPERTY(BlueprintReadOnly, Category = "Significance")
+	int32 OffscreenDemotions = 0;
+
+	/** Tier changes applied in the last evaluation. */
+	UPROPERTY(BlueprintReadOnly, Category = "Significance")
+	int32 TierChanges = 0;
+
+	/** Measured cost of one mob actor tick, in milliseconds (moving average). */
+	UPROPERTY(BlueprintReadOnly, Category = "Significance")
+	float ActorTickMs = 0.0f;
+
+	/** Game thread time the current tiers save per frame against everything at Full, in milliseconds. */
+	UPROPERTY(BlueprintReadOnly, Category = "Significance")
+	float EstimatedSavedMs = 0.0f;
+};
@@ -11,6 +11,7 @@ class UBoxComponent;
 class APHBaseCharacter;
 class UMonsterModifierComponent;
 class UMobPoolSubsystem;
+class UMobSpawnSchedulerSubsystem;
 class UNavigationSystemV1;
 
 // Log category declared here, defined once in the .cpp.
@@ -101,6 +102,16 @@ public:
 		meta = (ClampMin = 0.0f, ClampMax = 16.0f))
 	float SpawnBudgetMs = 2.0f;
 
+	/**
+	 * OPT-SCHEDULER: Hand each SpawnTick to UMobSpawnSchedulerSubsystem instead
+	 * of spawning inside the timer callback.  The scheduler services every
+	 * manager under one shared per-frame budget, so managers sharing a
+	 * SpawnInterval no longer stack their SpawnBudgetMs into one frame.
+	 * SpawnBudgetMs still caps this manager's share of that frame.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mob Manager|Spawn")
+	bool bUseSpawnScheduler = true;
+
 	/** Start spawning automatically on BeginPlay. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mob Manager|Spawn")
 	bool bAutoActivate = true;
@@ -190,6 +201,47 @@ public:
 	float GroundTraceDistance = 500.0f;
 
 
+	/**
+	 * OPT-SPAWNCACHE: Pick spawn locations from a pool of pre-validated points
+	 * instead of running nav projection, ground trace and capsule overlap per
+	 * attempt.  The pool is baked in the editor (Bake Spawn Points) or at
+	 * BeginPlay, and consumed points are replaced a few at a time inside
+	 * SpawnBudgetMs.  Runtime picks only run the player-distance filter; the
+	 * live path is still used when the pool is empty.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mob Manager|Spawn Point Cache")
+	bool bUseSpawnPointCache = false;
+
+	/** Target number of pre-validated points kept in the pool. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mob Manager|Spawn Point Cache",
+		meta = (EditCondition = "bUseSpawnPointCache", ClampMin = 1, ClampMax = 1024))
+	int32 SpawnPointCacheSize = 64;
+
+	/**
+	 * Live candidates tried per missing point during a bake or refill.
+	 * A full bake runs at most SpawnPointCacheSize * this many validations.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mob Manager|Spawn Point Cache",
+		meta = (EditCondition = "bUseSpawnPointCache", ClampMin = 1, ClampMax = 16))
+	int32 SpawnPointBakeAttemptsPerPoint = 4;
+
+	/**
+	 * Seconds before the whole pool is considered stale and rebuilt lazily
+	 * (doors, destructibles, moving platforms).  0 = never expire; only
+	 * consumed points are replaced.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mob Manager|Spawn Point Cache",
+		meta = (EditCondition = "bUseSpawnPointCache", ClampMin = 0.0f))
+	float SpawnPointCacheRefreshInterval = 0.0f;
+
+	/**
+	 * Points baked in the editor, saved with the level.  Ignored at BeginPlay
+	 * if the SpawnArea has moved or resized since the bake.
+	 */
+	UPROPERTY(VisibleAnywhere, Category = "Mob Manager|Spawn Point Cache", AdvancedDisplay)
+	TArray<FVector> BakedSpawnPoints;
+
+
 	/**
 	 * Default wander radius passed to each mob via IMobWanderable::SetWanderRadius.
 	 * The BP AI Controller uses this to pick points within radius of HomeLocation.
@@ -375,6 +427,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Mob Manager")
 	void ForceSpawnBatch();
 
+	/**
+	 * Run one spawn tick on behalf of UMobSpawnSchedulerSubsystem.
+	 * BudgetSeconds is what remains of the scheduler's frame budget; the
+	 * manager uses the smaller of it and SpawnBudgetMs.  No-op unless Active
+	 * with authority.
+	 */
+	void ExecuteScheduledSpawnTick(double BudgetSeconds);
+
 	/** Number of valid (alive) mobs currently tracked. */
 	UFUNCTION(BlueprintPure, Category = "Mob Manager")
 	int32 GetActiveCount() const;
@@ -430,6 +490,29 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Mob Manager|Special Spawns")
 	void ResetKillCounts();
 
+	/**
+	 * Rebuild the spawn-point pool synchronously and store it in BakedSpawnPoints.
+	 * Needs a built NavMesh when bUseNavCheck is on.  Editor button + BP callable.
+	 */
+	UFUNCTION(BlueprintCallable, CallInEditor, Category = "Mob Manager|Spawn Point Cache")
+	void BakeSpawnPoints();
+
+	/** Drop every cached point; the pool refills lazily on following SpawnTicks. */
+	UFUNCTION(BlueprintCallable, Category = "Mob Manager|Spawn Point Cache")
+	void InvalidateSpawnPointCache();
+
+	/** Number of pre-validated points currently available. */
+	UFUNCTION(BlueprintPure, Category = "Mob Manager|Spawn Point Cache")
+	int32 GetCachedSpawnPointCount() const { return SpawnPointCache.Num(); }
+
+	/**
+	 * Times Iterations live candidate validations against Iterations cached
+	 * picks and logs points per second for both.  Builds the pool first if it
+	 * is empty.  Does not spawn anything or consume cached points.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Mob Manager|Debug")
+	FMobSpawnPointBenchmarkResult BenchmarkSpawnPointSelection(int32 Iterations = 1000);
+
 	/** Read-only access to the debug history (for custom visualisation in BP). */
 	UFUNCTION(BlueprintPure, Category = "Mob Manager|Debug")
 	const TArray<FSpawnAttemptDebug>& GetDebugHistory() const { return DebugHistory; }
@@ -455,14 +538,28 @@ protected:
 
 	// Core spawn pipeline (virtual so Blueprint-child C++ subclasses can extend)
 
-	/** Spawn-timer callback - runs every SpawnInterval seconds. */
+	/**
+	 * Spawn-timer callback - runs every SpawnInterval seconds.
+	 * Queues a request with the spawn scheduler when bUseSpawnScheduler is on,
+	 * otherwise runs RunSpawnTick() inline.
+	 */
 	virtual void SpawnTick();
 
+	/** Body of one spawn tick: cleanup, special rules, capacity check, spawning. */
+	virtual void RunSpawnTick();
+
+	/**
+	 * Seconds the current spawn tick may spend validating locations:
+	 * SpawnBudgetMs, further capped by the scheduler's remaining frame budget
+	 * while a scheduled tick is running.  0 = unbudgeted.
+	 */
+	double GetSpawnBudgetSeconds() const;
+
 	/**
-	 * Single mob spawn attempt.
+	 * Single mob spawn attempt within BudgetSeconds (<= 0 = unbudgeted).
 	 * Returns true on success, false if all MaxSpawnAttempts are exhausted.
 	 */
-	virtual bool TrySpawnMob();
+	virtual bool TrySpawnMob(double BudgetSeconds);
 
 	/**
 	 * Generate a candidate world position inside SpawnArea.
@@ -473,9 +570,10 @@ protected:
 
 	/**
 	 * Spawn a pack of mobs - finds one valid leader location, then spawns
-	 * PackSize mobs in a cluster around it.  Returns number of mobs spawned.
+	 * PackSize mobs in a cluster around it, within BudgetSeconds (<= 0 =
+	 * unbudgeted).  Returns number of mobs spawned.
 	 */
-	virtual int32 SpawnBatch();
+	virtual int32 SpawnBatch(double BudgetSeconds);
 
 	/**
 	 * Try to spawn a single mob at a specific location (with nearby jitter).
@@ -520,6 +618,27 @@ protected:
 	 */
 	bool GetSmartSpawnLocation(FVector& OutLocation);
 
+	/**
+	 * Pick a cached point that passes the player-distance filter, starting at a
+	 * random index.  When bConsume is true the point is removed so the next
+	 * spawn does not land on the same spot.  Returns false if none qualify.
+	 */
+	bool TakeCachedSpawnLocation(FVector& OutLocation, bool bConsume = true);
+
+	/**
+	 * Validate live candidates (nav, ground, collision) until the pool reaches
+	 * SpawnPointCacheSize, the attempt cap runs out, or BudgetSeconds elapses.
+	 * BudgetSeconds <= 0 means unbudgeted.  Requires CacheTickValues().
+	 * Returns the number of points added.
+	 */
+	int32 RefillSpawnPointCache(double BudgetSeconds);
+
+	/**
+	 * Expire the pool if SpawnPointCacheRefreshInterval has elapsed, then, if
+	 * bRefill, top it up within RefillBudgetSeconds (<= 0 means unbudgeted).
+	 */
+	void MaintainSpawnPointCache(bool bRefill, double RefillBudgetSeconds);
+
 	/**
 	 * Downward line trace.  Adjusts OutGroundLocation to the surface hit point.
 	 * Returns false if nothing is hit within GroundTraceDistance.
@@ -590,6 +709,13 @@ private:
 	/** Whether we already fired OnManagerFull this cycle. */
 	bool bFullEventFired = false;
 
+	/** OPT-SCHEDULER: Cached reference to the world spawn scheduler. */
+	UPROPERTY(Transient)
+	TObjectPtr<UMobSpawnSchedulerSubsystem> CachedSpawnScheduler;
+
+	/** Scheduler budget for the tick in progress.  0 outside ExecuteScheduledSpawnTick. */
+	double ScheduledBudgetSeconds = 0.0;
+
 	/** OPT-POOL: Cached reference to the world pool subsystem. */
 	UPROPERTY(Transient)
 	TObjectPtr<UMobPoolSubsystem> CachedPoolSubsystem;
@@ -633,6 +759,19 @@ private:
 	 */
 	EMonsterTier PendingForcedTier = EMonsterTier::MT_Normal;
 
+	/** OPT-SPAWNCACHE: Runtime pool of pre-validated, ground-snapped spawn points. */
+	TArray<FVector> SpawnPointCache;
+
+	/** World time the pool was last rebuilt from empty.  Drives SpawnPointCacheRefreshInterval. */
+	float SpawnPointCacheBuildTime = 0.0f;
+
+	/** SpawnArea transform and extent BakedSpawnPoints were validated against. */
+	UPROPERTY()
+	FTransform BakedSpawnAreaTransform;
+
+	UPROPERTY()
+	FVector BakedSpawnAreaExtent = FVector::ZeroVector;
+
 	/** Kill counters grouped by exact spawned class. Summed via IsChildOf lookups. */
 	TMap<TSubclassOf<APHBaseCharacter>, int32> KillsByClass;
 
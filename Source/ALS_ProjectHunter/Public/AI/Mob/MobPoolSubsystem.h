@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "AI/Library/Structs/MobStructs.h"
 #include "MobPoolSubsystem.generated.h"
 
 class APHBaseCharacter;
@@ -12,7 +13,7 @@ class UAbilitySystemComponent;
 DECLARE_LOG_CATEGORY_EXTERN(LogMobPool, Log, All);
 
 UCLASS()
-class ALS_PROJECTHUNTER_API UMobPoolSubsystem : public UWorldSubsystem
+class ALS_PROJECTHUNTER_API UMobPoolSubsystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
@@ -25,6 +26,47 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pool")
 	int32 MaxPoolSizePerClass = 20;
 
+	/**
+	 * Pre-warm the pool from every AMobManagerActor in the level when the
+	 * world begins play (floor load / portal transition), so the first wave
+	 * recycles instead of paying full construction cost.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pool|Prewarm")
+	bool bPrewarmOnWorldBeginPlay = true;
+
+	/**
+	 * Instances per class queued by the automatic pre-warm.
+	 * 0 = the summed MaxNumOfMobs of every pooled manager that spawns the class.
+	 * Always clamped to MaxPoolSizePerClass.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pool|Prewarm",
+		meta = (ClampMin = 0))
+	int32 PrewarmInstancesPerClass = 0;
+
+	/** Upper bound on pre-spawned actors per frame while a pre-warm is pending. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pool|Prewarm",
+		meta = (ClampMin = 1, ClampMax = 32))
+	int32 MaxPrewarmSpawnsPerFrame = 2;
+
+	/** Milliseconds per frame the pre-spawn queue may use. At least one actor is spawned per frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pool|Prewarm",
+		meta = (ClampMin = 0.1f, ClampMax = 16.0f))
+	float PrewarmBudgetMs = 3.0f;
+
+	/**
+	 * When an Acquire() leaves fewer than this many pooled instances of a
+	 * class, a background refill up to PoolRefillTarget is queued.
+	 * 0 disables background refill.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pool|Prewarm",
+		meta = (ClampMin = 0))
+	int32 PoolLowWaterMark = 0;
+
+	/** Pooled count a low-water refill tops each class back up to. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pool|Prewarm",
+		meta = (ClampMin = 1))
+	int32 PoolRefillTarget = 4;
+
 
 	/**
 	 * Get a mob from the pool, or spawn a fresh one if the pool is empty.
@@ -59,7 +101,50 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Mob Pool")
 	int32 GetTotalPooledCount() const;
 
+	/**
+	 * Queue pre-spawns so the pool holds at least Count inactive instances of
+	 * MobClass.  Spawning happens over following frames within
+	 * MaxPrewarmSpawnsPerFrame and PrewarmBudgetMs.  Actors are spawned hidden
+	 * and inert at Location.  Server only.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Mob Pool|Prewarm")
+	void PrewarmClass(TSubclassOf<APHBaseCharacter> MobClass, int32 Count, const FVector& Location);
+
+	/**
+	 * Queue a pre-warm for every class in the MobTypes of every pooled
+	 * AMobManagerActor in the level.  InstancesPerClass <= 0 uses each class's
+	 * summed MaxNumOfMobs.  Returns the number of classes queued.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Mob Pool|Prewarm")
+	int32 PrewarmFromLevelManagers(int32 InstancesPerClass = 0);
+
+	/** True while pre-spawns are still queued. */
+	UFUNCTION(BlueprintPure, Category = "Mob Pool|Prewarm")
+	bool IsPrewarmPending() const { return !PrewarmQueue.IsEmpty(); }
+
+	/** Hit/miss and timing counters for one class. */
+	UFUNCTION(BlueprintPure, Category = "Mob Pool|Stats")
+	FMobPoolClassStats GetClassStats(TSubclassOf<APHBaseCharacter> MobClass) const;
+
+	/**
+	 * Log every class's counters and the suggested MaxPoolSizePerClass: the
+	 * highest PeakOutstanding across classes, since one cap covers them all.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Mob Pool|Stats")
+	void LogPoolStats() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Mob Pool|Stats")
+	void ResetPoolStats();
+
+	//~ Begin UWorldSubsystem
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
 	virtual void Deinitialize() override;
+	//~ End UWorldSubsystem
+
+	//~ Begin FTickableGameObject (via UTickableWorldSubsystem)
+	virtual void Tick(float DeltaSeconds) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject
 
 protected:
 	/**
@@ -82,7 +167,37 @@ protected:
 	void PrepareMobForReuse(APHBaseCharacter* Mob,
 		const FVector& Location, const FRotator& Rotation) const;
 
+	/**
+	 * SpawnActor a new instance, hidden and inert (no collision, AI paused,
+	 * movement tick off).  Shared by the Acquire() miss path and pre-spawning.
+	 */
+	APHBaseCharacter* SpawnInertMob(UClass* MobClass,
+		const FVector& Location, const FRotator& Rotation) const;
+
+	/** Spawn queued pre-warm instances until the per-frame cap or budget is hit. */
+	void ProcessPrewarmQueue();
+
+	/**
+	 * Bound to OnDestroyed while a mob is acquired, so one destroyed without
+	 * going through Release() still leaves Outstanding.
+	 */
+	UFUNCTION()
+	void OnOutstandingMobDestroyed(AActor* DestroyedActor);
+
 private:
 	/** Per-class pool of inactive actors */
 	TMap<UClass*, TArray<TWeakObjectPtr<APHBaseCharacter>>> Pool;
+
+	struct FPrewarmRequest
+	{
+		TWeakObjectPtr<UClass> MobClass;
+		int32 TargetPooled = 0;
+		FVector Location = FVector::ZeroVector;
+	};
+
+	/** Pending pre-spawns, one entry per class, serviced front to back. */
+	TArray<FPrewarmRequest> PrewarmQueue;
+
+	/** Per-class counters, keyed like Pool. */
+	TMap<UClass*, FMobPoolClassStats> ClassStats;
 };
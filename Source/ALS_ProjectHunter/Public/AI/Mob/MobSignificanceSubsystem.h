@@ -0,0 +1,167 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AI/Library/Enums/MobEnumLibrary.h"
+#include "AI/Library/Structs/MobStructs.h"
+#include "MobSignificanceSubsystem.generated.h"
+
+class APHBaseCharacter;
+class UALSMantleComponent;
+class UPlayerLocationCacheSubsystem;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogMobSignificance, Log, All);
+
+/**
+ * UMobSignificanceSubsystem
+ *
+ * OPT-SIGNIFICANCE: Buckets every registered mob into an EMobSignificanceTier
+ * by distance to the nearest player (from UPlayerLocationCacheSubsystem) and,
+ * on clients, whether it was rendered recently. Each tier sets the actor,
+ * TagManager, mesh and movement tick intervals, animation update-rate
+ * optimization, ALS foot IK and land prediction, and per-tick mantle checks.
+ *
+ * - Tiers are re-evaluated every EvaluationIntervalSeconds, not per frame, and
+ *   only mobs whose tier changed are touched.
+ * - A tier holds at most MaxMobs, nearest first; the rest fall to the next one.
+ * - Promotion to a closer tier needs HysteresisDistance of margin so mobs on a
+ *   boundary do not flip every evaluation.
+ * - Player-controlled characters always stay at Full and hidden (pooled) mobs
+ *   are left alone until they are shown again.
+ *
+ * Compare with `stat MobSignificance` and Hunter.Debug.MobSignificance.
+ */
+UCLASS()
+class ALS_PROJECTHUNTER_API UMobSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UMobSignificanceSubsystem();
+
+	//~ Begin UWorldSubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~ End UWorldSubsystem
+
+	//~ Begin FTickableGameObject (via UTickableWorldSubsystem)
+	virtual void Tick(float DeltaSeconds) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject
+
+	/** Start managing Character. Its current tick settings are what Full and Unregister restore. */
+	void RegisterMob(APHBaseCharacter* Character);
+
+	/** Restore Character's authored settings and stop managing it (EndPlay). */
+	void UnregisterMob(APHBaseCharacter* Character);
+
+	/** Feed one measured mob actor tick into the saved-time estimate. */
+	void RecordActorTickCost(uint64 Cycles)
+	{
+		ActorTickCycles += Cycles;
+		++ActorTickCount;
+	}
+
+	UFUNCTION(BlueprintPure, Category = "ProjectHunter|AI|Significance")
+	EMobSignificanceTier GetMobTier(const APHBaseCharacter* Character) const;
+
+	UFUNCTION(BlueprintPure, Category = "ProjectHunter|AI|Significance")
+	const FMobSignificanceStats& GetSignificanceStats() const { return Stats; }
+
+	UFUNCTION(BlueprintPure, Category = "ProjectHunter|AI|Significance")
+	const FMobSignificanceTierSettings& GetTierSettings(EMobSignificanceTier Tier) const;
+
+	/** Seconds between tier evaluations. Matches the player location cache by default. */
+	UPROPERTY(EditDefaultsOnly, Category = "ProjectHunter|AI|Significance", meta = (ClampMin = 0.05f))
+	float EvaluationIntervalSeconds = 0.25f;
+
+	/** Distance a mob must be inside a closer tier's MaxDistance before it is promoted. */
+	UPROPERTY(EditDefaultsOnly, Category = "ProjectHunter|AI|Significance", meta = (ClampMin = 0.0f))
+	float HysteresisDistance = 200.0f;
+
+	/**
+	 * On clients, mobs not rendered for OffscreenGraceSeconds and further than
+	 * OffscreenMinDistance drop to at least OffscreenTier. Servers have no view
+	 * to judge by and skip this.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "ProjectHunter|AI|Significance")
+	EMobSignificanceTier OffscreenTier = EMobSignificanceTier::Low;
+
+	UPROPERTY(EditDefaultsOnly, Category = "ProjectHunter|AI|Significance", meta = (ClampMin = 0.0f))
+	float OffscreenMinDistance = 800.0f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "ProjectHunter|AI|Significance", meta = (ClampMin = 0.0f))
+	float OffscreenGraceSeconds = 0.5f;
+
+	/**
+	 * Cost of one mob animation update and one movement tick, in milliseconds,
+	 * for the saved-time estimate only. Seed from ALS.ReportAnimTimings and
+	 * `stat CharacterMovement`; the actor tick cost is measured.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "ProjectHunter|AI|Significance", meta = (ClampMin = 0.0f))
+	float EstimatedAnimUpdateMs = 0.05f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "ProjectHunter|AI|Significance", meta = (ClampMin = 0.0f))
+	float EstimatedMovementTickMs = 0.03f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "ProjectHunter|AI|Significance")
+	FMobSignificanceTierSettings FullTier;
+
+	UPROPERTY(EditDefaultsOnly, Category = "ProjectHunter|AI|Significance")
+	FMobSignificanceTierSettings ReducedTier;
+
+	UPROPERTY(EditDefaultsOnly, Category = "ProjectHunter|AI|Significance")
+	FMobSignificanceTierSettings LowTier;
+
+	/** MaxDistance and MaxMobs are ignored; every mob past LowTier lands here. */
+	UPROPERTY(EditDefaultsOnly, Category = "ProjectHunter|AI|Significance")
+	FMobSignificanceTierSettings DormantTier;
+
+private:
+	struct FTrackedMob
+	{
+		TWeakObjectPtr<APHBaseCharacter> Character;
+		TWeakObjectPtr<UALSMantleComponent> MantleComponent;
+		/** MAX while the authored settings are in place. */
+		EMobSignificanceTier Tier = EMobSignificanceTier::MAX;
+		float DistanceSq = 0.0f;
+		bool bOffscreen = false;
+
+		// Authored settings, captured at registration.
+		float ActorTickInterval = 0.0f;
+		float TagManagerTickInterval = 0.0f;
+		float MeshTickInterval = 0.0f;
+		float MovementTickInterval = 0.0f;
+		EVisibilityBasedAnimTickOption AnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPose;
+		bool bUpdateRateOptimizations = false;
+		bool bFootIK = true;
+		bool bLandPrediction = true;
+		bool bMantleChecks = true;
+	};
+
+	void Evaluate();
+
+	/** Closest tier Mob qualifies for by distance, before budgets. */
+	EMobSignificanceTier GetDistanceTier(const FTrackedMob& Mob) const;
+
+	/** A default FMobSignificanceTierSettings puts back Mob's authored settings. */
+	static void ApplySettings(const FTrackedMob& Mob, const FMobSignificanceTierSettings& Settings);
+
+	/** Put every mob back to its authored settings (subsystem disabled or shutting down). */
+	void RestoreAll();
+
+	float EstimateSavedMs() const;
+
+	TArray<FTrackedMob> Mobs;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UPlayerLocationCacheSubsystem> CachedPlayerLocationCache;
+
+	FMobSignificanceStats Stats;
+
+	float TimeSinceLastEvaluation = 0.0f;
+	float AverageFrameSeconds = 1.0f / 60.0f;
+	uint64 ActorTickCycles = 0;
+	int32 ActorTickCount = 0;
+	bool bApplied = true;
+};
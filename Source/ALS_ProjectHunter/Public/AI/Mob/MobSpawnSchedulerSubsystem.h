@@ -0,0 +1,105 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AI/Library/Enums/MobEnumLibrary.h"
+#include "MobSpawnSchedulerSubsystem.generated.h"
+
+class AMobManagerActor;
+class UPlayerLocationCacheSubsystem;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogMobSpawnScheduler, Log, All);
+
+/**
+ * UMobSpawnSchedulerSubsystem
+ *
+ * Shared spawn queue for every AMobManagerActor in the world. Managers enqueue
+ * a request when their SpawnInterval timer fires instead of spawning inline;
+ * the scheduler drains requests in priority order under one per-frame budget
+ * so managers sharing an interval no longer stack their SpawnBudgetMs into the
+ * same frame. Unserviced requests stay queued and gain priority while waiting.
+ *
+ * Server only - managers never enqueue without authority.
+ */
+UCLASS()
+class ALS_PROJECTHUNTER_API UMobSpawnSchedulerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UWorldSubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~ End UWorldSubsystem
+
+	//~ Begin FTickableGameObject (via UTickableWorldSubsystem)
+	virtual void Tick(float DeltaSeconds) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject
+
+	/** Queue one spawn tick for Manager. Duplicate requests for a queued manager are ignored. */
+	void EnqueueSpawnRequest(AMobManagerActor* Manager);
+
+	/** Drop any queued request for Manager (EndPlay, StopAndClear). */
+	void CancelSpawnRequests(const AMobManagerActor* Manager);
+
+	/** Requests waiting at the end of the last drain. */
+	UFUNCTION(BlueprintPure, Category = "ProjectHunter|AI|SpawnScheduler")
+	int32 GetQueueDepth() const { return Requests.Num(); }
+
+	/** Milliseconds spent servicing requests in the most recent frame. */
+	UFUNCTION(BlueprintPure, Category = "ProjectHunter|AI|SpawnScheduler")
+	float GetLastFrameSpendMs() const { return LastFrameSpendMs; }
+
+	/** Requests serviced in the most recent frame. */
+	UFUNCTION(BlueprintPure, Category = "ProjectHunter|AI|SpawnScheduler")
+	int32 GetLastFrameServicedCount() const { return LastFrameServicedCount; }
+
+	/**
+	 * Total milliseconds all managers together may spend spawning per frame.
+	 * At least one request is always serviced so the queue cannot stall.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "ProjectHunter|AI|SpawnScheduler",
+		meta = (ClampMin = 0.1f, ClampMax = 16.0f))
+	float FrameBudgetMs = 2.0f;
+
+	/** How queued managers are ordered before each drain. */
+	UPROPERTY(EditDefaultsOnly, Category = "ProjectHunter|AI|SpawnScheduler")
+	EMobSpawnSchedulerPriority PriorityMode = EMobSpawnSchedulerPriority::NearestPlayer;
+
+	/**
+	 * Distance at which NearestPlayer priority bottoms out. Managers further
+	 * than this from every player share the lowest proximity score.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "ProjectHunter|AI|SpawnScheduler",
+		meta = (ClampMin = 100.0f))
+	float PriorityDistanceRange = 10000.0f;
+
+	/**
+	 * Score added per second a request has waited. 1.0 lets a request that has
+	 * waited one second outrank any fresh request, so far managers still spawn.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "ProjectHunter|AI|SpawnScheduler",
+		meta = (ClampMin = 0.0f))
+	float WaitPriorityPerSecond = 1.0f;
+
+protected:
+	/** Base score in [0, 1] for a manager under the current PriorityMode. */
+	float ScoreManager(const AMobManagerActor& Manager) const;
+
+private:
+	struct FSpawnRequest
+	{
+		TWeakObjectPtr<AMobManagerActor> Manager;
+		double EnqueueTimeSeconds = 0.0;
+		float Score = 0.0f;
+	};
+
+	TArray<FSpawnRequest> Requests;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UPlayerLocationCacheSubsystem> CachedPlayerLocationCache;
+
+	float LastFrameSpendMs = 0.0f;
+	int32 LastFrameServicedCount = 0;
+};
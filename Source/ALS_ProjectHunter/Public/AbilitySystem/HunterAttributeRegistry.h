@@ -0,0 +1,104 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+#include "Stats/Library/Enums/StatsEnumLibrary.h"
+#include "Stats/Library/Structs/BaseStatsStructs.h"
+
+/**
+ * FHunterAttributeRegistry
+ *
+ * OPT-ATTRREGISTRY: Immutable lookup tables for every FGameplayAttributeData on
+ * UHunterAttributeSet, built once from reflection on first use. Replaces the
+ * TFieldIterator scan behind FindAttributeByName and the per-call definition
+ * gathering in the stats resolver.
+ *
+ * - Attributes live in a dense array in declaration order; an index is stable
+ *   for the life of the process.
+ * - EHunterAttribute maps straight to that index (the enum mirrors the
+ *   property names and is checked against them when the tables are built).
+ * - Names go through a hash-and-displace perfect hash: one bucket read, one
+ *   slot read and a single FName compare, never a probe sequence.
+ * - Stat definitions (UBaseStatsData::GatherStatDefinitionsFromAttributeSet)
+ *   are gathered once and indexed alongside the attributes.
+ */
+class ALS_PROJECTHUNTER_API FHunterAttributeRegistry
+{
+public:
+	static const FHunterAttributeRegistry& Get();
+
+	int32 Num() const { return Attributes.Num(); }
+
+	/** Dense index of AttributeName, or INDEX_NONE. */
+	int32 FindIndex(FName AttributeName) const;
+
+	int32 GetIndex(EHunterAttribute AttributeType) const
+	{
+		const int32 EnumValue = static_cast<int32>(AttributeType);
+		return EnumToIndex.IsValidIndex(EnumValue) ? EnumToIndex[EnumValue] : INDEX_NONE;
+	}
+
+	/** Invalid attribute when Index is out of range. */
+	const FGameplayAttribute& GetAttribute(int32 Index) const
+	{
+		return Attributes.IsValidIndex(Index) ? Attributes[Index] : InvalidAttribute;
+	}
+
+	const FGameplayAttribute& FindAttribute(FName AttributeName) const { return GetAttribute(FindIndex(AttributeName)); }
+	const FGameplayAttribute& GetAttribute(EHunterAttribute AttributeType) const { return GetAttribute(GetIndex(AttributeType)); }
+
+	FName GetAttributeName(int32 Index) const { return Names.IsValidIndex(Index) ? Names[Index] : NAME_None; }
+
+	/** Reflected definition for the attribute at Index; null for HideInStatsData attributes. */
+	const FStatInitializationEntry* GetDefinition(int32 Index) const
+	{
+		const int32 DefinitionIndex = DefinitionIndexByAttribute.IsValidIndex(Index) ? DefinitionIndexByAttribute[Index] : INDEX_NONE;
+		return DefinitionIndex != INDEX_NONE ? &Definitions[DefinitionIndex] : nullptr;
+	}
+
+	const FStatInitializationEntry* FindDefinition(FName AttributeName) const { return GetDefinition(FindIndex(AttributeName)); }
+
+	/**
+	 * Position of the attribute's definition in GetDefinitions(), or INDEX_NONE.
+	 * Authored BaseAttributes are rebuilt in the same order, so this is also the
+	 * first place to look for the row in a stats data asset.
+	 */
+	int32 GetDefinitionIndex(int32 Index) const
+	{
+		return DefinitionIndexByAttribute.IsValidIndex(Index) ? DefinitionIndexByAttribute[Index] : INDEX_NONE;
+	}
+
+	const TArray<FGameplayAttribute>& GetAttributes() const { return Attributes; }
+
+	/** Same rows, in the same order, as GatherStatDefinitionsFromAttributeSet(UHunterAttributeSet). */
+	const TArray<FStatInitializationEntry>& GetDefinitions() const { return Definitions; }
+
+	/** Perfect hash table size; with Num() this gives the load factor the seed search settled on. */
+	int32 GetHashSlotCount() const { return Slots.Num(); }
+
+private:
+	FHunterAttributeRegistry();
+
+	void BuildAttributes();
+	void BuildNameHash();
+	void BuildEnumTable();
+	void BuildDefinitions();
+
+	static uint32 HashName(FName Name, uint32 Seed);
+
+	TArray<FGameplayAttribute> Attributes;
+	TArray<FName> Names;
+
+	/** Per-bucket seed for the second hash; buckets are picked by HashName(Name, 0). */
+	TArray<uint32> BucketSeeds;
+
+	/** Dense attribute index per slot, INDEX_NONE when empty. */
+	TArray<int16> Slots;
+
+	TArray<int16> EnumToIndex;
+
+	TArray<FStatInitializationEntry> Definitions;
+	TArray<int16> DefinitionIndexByAttribute;
+
+	static const FGameplayAttribute InvalidAttribute;
+};
@@ -4,6 +4,9 @@
 #include "CoreMinimal.h"
 #include "AbilitySystemComponent.h"
 #include "AttributeSet.h"
+#include "AbilitySystem/Library/Enums/HunterAttributeEnums.h"
+#include "AbilitySystem/Library/Structs/HunterAttributeRepStructs.h"
+#include "Combat/Library/Structs/CombatSnapshotStructs.h"
 #include "HunterAttributeSet.generated.h"
 
 
@@ -33,7 +36,7 @@ public:
 
 	/**
 	 * Find a FGameplayAttribute by its name
-	 * Works with all 187 attributes automatically!
+	 * Constant time through FHunterAttributeRegistry; covers every attribute automatically.
 	 */
 	UFUNCTION(BlueprintPure, Category = "Attributes")
 	static FGameplayAttribute FindAttributeByName(FName AttributeName);
@@ -51,8 +54,55 @@ public:
 	void RecalculateAllDerivedVitals();
 	virtual void PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue) override;
 	virtual void PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) override;
+	virtual void PostAttributeBaseChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) const override;
 	virtual void PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data) override;
 	static bool ShouldUpdateThresholdTags(const FGameplayAttribute& Attribute);
+
+	/* === Replication === */
+	static EHunterAttributeRepGroup GetAttributeRepGroup(const FGameplayAttribute& Attribute);
+
+	/**
+	 * Groups this set keeps in sync with clients. Players replicate everything; mobs
+	 * register only what clients show for them. Adding groups flushes their current values.
+	 */
+	void SetReplicatedGroups(EHunterAttributeRepGroup InGroups);
+	EHunterAttributeRepGroup GetReplicatedGroups() const { return ReplicatedGroups; }
+
+	/** Queues a cold attribute for the next net update. Hot vitals and unregistered groups ignore it. */
+	void MarkAttributeDirty(const FGameplayAttribute& Attribute);
+
+	/** Queues every registered cold attribute, e.g. after a bulk rebuild that bypassed GAS callbacks. */
+	UFUNCTION(BlueprintCallable, Category = "Attributes|Replication")
+	void MarkAllAttributesDirty();
+
+	/**
+	 * Models the rep layout work for one mob in combat: health changes every update and
+	 * one cold stat changes every ColdChangeInterval updates. Reports compares, bytes for a
+	 * non-owning connection and CPU per update, with every attribute compared (Before) and
+	 * with the hot/cold split plus default mob groups (After).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Attributes|Debug")
+	static FHunterAttributeRepBenchmarkResult BenchmarkMobReplication(int32 Updates = 600, int32 ColdChangeInterval = 30);
+
+	/* === Combat Snapshots === */
+
+	/**
+	 * Offense/Defense attributes folded into lanes for the damage pipeline. Rebuilt on
+	 * read after a relevant attribute changed; rebuilt on every read until snapshot
+	 * tracking is enabled, so untracked sets are never stale.
+	 */
+	const FCombatOffenseSnapshot& GetCombatOffenseSnapshot() const;
+	const FCombatDefenseSnapshot& GetCombatDefenseSnapshot() const;
+
+	/** Subscribes snapshot invalidation to the ASC value-change delegate of every Offense and Defense attribute. */
+	void BindCombatSnapshotInvalidation(UAbilitySystemComponent* ASC);
+	void UnbindCombatSnapshotInvalidation();
+
+	/** Enables caching for a set with no ASC (headless simulation). The caller invalidates after every write. */
+	void TrackCombatSnapshotsManually();
+
+	/** Forces both snapshots to rebuild, e.g. after writes that bypass the ASC. */
+	void InvalidateCombatSnapshots();
 	TMap<FGameplayTag, TStaticFuncPtr<FGameplayAttribute()>> TagsToAttributes;
 
 	UPROPERTY(BlueprintReadOnly, Category = "Attribute Maps")
@@ -1779,6 +1829,25 @@ private:
 	bool IsStaminaVitalAttribute(const FGameplayAttribute& Attribute) const;
 	bool IsArcaneShieldVitalAttribute(const FGameplayAttribute& Attribute) const;
 
+	static EHunterAttributeRepGroup GetPropertyRepGroup(const FProperty* Property);
+
+	/** Direct write used by the derived vital pass, which runs outside SetNumericValueChecked. */
+	void AssignDerivedAttributeIfNeeded(const FGameplayAttribute& Attribute, FGameplayAttributeData& Data, float NewValue);
+
+	void HandleCombatSnapshotAttributeChanged(const FOnAttributeChangeData& Data);
+
 	bool bIsInitializingStats = false;
 	bool bIsUpdatingDerivedVitalAttributes = false;
+
+	EHunterAttributeRepGroup ReplicatedGroups = HunterAllAttributeRepGroups;
+
+	// OPT-COMBATSNAPSHOT: lazily rebuilt caches read on every hit.
+	mutable FCombatOffenseSnapshot CachedOffenseSnapshot;
+	mutable FCombatDefenseSnapshot CachedDefenseSnapshot;
+	mutable bool bOffenseSnapshotDirty = true;
+	mutable bool bDefenseSnapshotDirty = true;
+
+	bool bCombatSnapshotsTracked = false;
+
+	TWeakObjectPtr<UAbilitySystemComponent> SnapshotInvalidationASC;
 };
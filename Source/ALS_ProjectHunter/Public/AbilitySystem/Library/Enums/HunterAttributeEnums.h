@@ -0,0 +1,29 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HunterAttributeEnums.generated.h"
+
+/**
+ * Replication groups of UHunterAttributeSet. Vitals are compared every net update;
+ * every other group is push-model and only sent after a change marks it dirty.
+ */
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EHunterAttributeRepGroup : uint8
+{
+	None		= 0 UMETA(Hidden),
+	Vitals		= 1 << 0 UMETA(DisplayName = "Vitals"),
+	Primary		= 1 << 1 UMETA(DisplayName = "Primary & Progression"),
+	Resources	= 1 << 2 UMETA(DisplayName = "Regen, Reservation & Utility"),
+	Offense		= 1 << 3 UMETA(DisplayName = "Offense"),
+	Defense		= 1 << 4 UMETA(DisplayName = "Defense"),
+	Ailments	= 1 << 5 UMETA(DisplayName = "Ailments"),
+};
+ENUM_CLASS_FLAGS(EHunterAttributeRepGroup);
+
+constexpr EHunterAttributeRepGroup HunterAllAttributeRepGroups =
+	EHunterAttributeRepGroup::Vitals | EHunterAttributeRepGroup::Primary | EHunterAttributeRepGroup::Resources |
+	EHunterAttributeRepGroup::Offense | EHunterAttributeRepGroup::Defense | EHunterAttributeRepGroup::Ailments;
+
+/** Mobs only need what clients show for them: bars, level, and nothing that drives owner-only UI. */
+constexpr EHunterAttributeRepGroup HunterDefaultMobAttributeRepGroups =
+	EHunterAttributeRepGroup::Vitals | EHunterAttributeRepGroup::Primary;
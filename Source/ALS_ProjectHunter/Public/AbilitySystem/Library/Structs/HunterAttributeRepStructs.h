@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HunterAttributeRepStructs.generated.h"
+
+/** Replication cost of one attribute layout, averaged per net update. */
+USTRUCT(BlueprintType)
+struct FHunterAttributeRepProfile
+{
+	GENERATED_BODY()
+
+	/** Attribute properties the rep layout compared against shadow state */
+	UPROPERTY(BlueprintReadOnly, Category = "Replication")
+	float PropertiesComparedPerUpdate = 0.0f;
+
+	/** Payload written for a non-owning connection */
+	UPROPERTY(BlueprintReadOnly, Category = "Replication", meta = (Units = "Bytes"))
+	float BytesPerUpdate = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Replication", meta = (Units = "Microseconds"))
+	float MicrosecondsPerUpdate = 0.0f;
+};
+
+/** Result of UHunterAttributeSet::BenchmarkMobReplication. */
+USTRUCT(BlueprintType)
+struct FHunterAttributeRepBenchmarkResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Replication")
+	int32 Updates = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Replication")
+	int32 ReplicatedAttributeCount = 0;
+
+	/** Attributes still compared every update */
+	UPROPERTY(BlueprintReadOnly, Category = "Replication")
+	int32 HotAttributeCount = 0;
+
+	/** Every attribute compared each update, all groups replicated */
+	UPROPERTY(BlueprintReadOnly, Category = "Replication")
+	FHunterAttributeRepProfile Before;
+
+	/** Hot vitals compared each update, cold groups push-model and trimmed to the mob groups */
+	UPROPERTY(BlueprintReadOnly, Category = "Replication")
+	FHunterAttributeRepProfile After;
+};
@@ -169,7 +169,11 @@ public:
 	float GetCurrentHoldProgress() const;
 
 	UFUNCTION(BlueprintCallable, Category = "Interaction|Debug")
-	void PrintDebugStats() { DebugManager.PrintDebugStats(); }
+	void PrintDebugStats()
+	{
+		DebugManager.PrintDebugStats();
+		TraceManager.LogEvaluationStats();
+	}
 
 protected:
 	void InitializeInteractionSystem();
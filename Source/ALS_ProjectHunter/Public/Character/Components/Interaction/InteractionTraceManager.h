@@ -116,6 +116,40 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Aim", meta = (ClampMin = "1", ClampMax = "64"))
 	int32 MaxGroundItemCandidates = 16;
 
+	// INCREMENTAL CANDIDATES
+
+	/**
+	 * Cache the proximity candidate set and the last ranking. The overlap and
+	 * ground-item query re-run only when the player leaves the cached sphere,
+	 * ground items change, or ActorCandidateRefreshInterval passes; scoring
+	 * re-runs only when the view, player or candidate set moved.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Incremental")
+	bool bUseIncrementalCandidates = true;
+
+	/** Extra radius gathered around the player so small moves reuse the candidate set. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Incremental",
+		meta = (ClampMin = "0.0", Units = "cm", EditCondition = "bUseIncrementalCandidates"))
+	float CandidateRefreshDistance = 100.0f;
+
+	/**
+	 * Actor interactables raise no enter/leave events, so the actor overlap is
+	 * also refreshed at this rate to pick up spawned, moved or destroyed actors.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Incremental",
+		meta = (ClampMin = "0.05", Units = "s", EditCondition = "bUseIncrementalCandidates"))
+	float ActorCandidateRefreshInterval = 0.5f;
+
+	/** Player or camera movement below this reuses the previous ranking. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Incremental",
+		meta = (ClampMin = "0.0", Units = "cm", EditCondition = "bUseIncrementalCandidates"))
+	float RescoreMoveThreshold = 5.0f;
+
+	/** Camera or player facing change below this reuses the previous ranking. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Incremental",
+		meta = (ClampMin = "0.0", ClampMax = "45.0", Units = "deg", EditCondition = "bUseIncrementalCandidates"))
+	float RescoreAngleThreshold = 1.0f;
+
 	/** Use ALS camera origin calculation */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|ALS")
 	bool bUseALSCameraOrigin;
@@ -192,6 +226,14 @@ public:
 	/** Get last trace hit result */
 	const FHitResult& GetLastTraceResult() const { return LastTraceResult; }
 
+	/** Drop cached candidates and ranking so the next search runs in full. */
+	void InvalidateCandidateCache();
+
+	int32 GetEvaluationsPerformed() const { return EvaluationsPerformed; }
+	int32 GetEvaluationsSkipped() const { return EvaluationsSkipped; }
+	int32 GetCandidateQueries() const { return CandidateQueries; }
+	void LogEvaluationStats() const;
+
 private:
 	// INTERNAL HELPERS
 
@@ -206,6 +248,13 @@ private:
 	/** Returns true when TargetLocation is in the character's front half-space. */
 	bool PassesPlayerForwardGate(const FVector& TargetLocation, float& OutDot) const;
 
+	/** Re-gather CachedActorCandidates/CachedGroundItemIDs if stale. Returns true if it did. */
+	bool RefreshCandidateSetIfNeeded(const FVector& PlayerCenter, float SearchRadius);
+
+	bool CanReuseLastEvaluation(const FVector& PlayerCenter, const FVector& PlayerForward,
+		const FVector& TraceStart, const FVector& CameraForward,
+		const UObject* CurrentObject, int32 CurrentItemID) const;
+
 	// CACHED REFERENCES
 
 	AActor* OwnerActor;
@@ -218,4 +267,30 @@ private:
 	// STATE
 
 	FHitResult LastTraceResult;
+
+	// Candidate set gathered by the last proximity query.
+	TArray<TWeakObjectPtr<AActor>> CachedActorCandidates;
+	TArray<int32> CachedGroundItemIDs;
+	FVector CandidateQueryCenter = FVector::ZeroVector;
+	float CandidateQueryRadius = 0.0f;
+	double CandidateQueryTimeSeconds = -1.0;
+	uint32 CandidateGroundItemVersion = 0;
+	bool bHasCandidateSet = false;
+
+	// Inputs and outputs of the last full ranking.
+	FVector LastScoredPlayerCenter = FVector::ZeroVector;
+	FVector LastScoredPlayerForward = FVector::ZeroVector;
+	FVector LastScoredTraceStart = FVector::ZeroVector;
+	FVector LastScoredCameraForward = FVector::ZeroVector;
+	TWeakObjectPtr<const UObject> LastScoredCurrentObject;
+	int32 LastScoredCurrentItemID = INDEX_NONE;
+	TWeakObjectPtr<AActor> LastBestActor;
+	int32 LastBestItemID = INDEX_NONE;
+	TArray<FGroundItemInteractionCandidate> LastGroundItemCandidates;
+	bool bLastHadProximityCandidates = false;
+	bool bHasLastEvaluation = false;
+
+	int32 EvaluationsPerformed = 0;
+	int32 EvaluationsSkipped = 0;
+	int32 CandidateQueries = 0;
 };
@@ -12,6 +12,9 @@ class UPrimitiveComponent;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogPHWallTraversal, Log, All);
 
+/** Fired when the moving/stationary condition flips or the movement mode changes. */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPHMovementConditionChanged, bool /*bMoving*/);
+
 /**
  * ProjectHunter movement physics.
  *
@@ -170,6 +173,23 @@ public:
 		const FVector& WorldDirection,
 		bool bTreatIntoSurfaceAsUp) const;
 
+	/**
+	 * Moving/stationary state with start/stop hysteresis, re-evaluated after
+	 * every movement update. Condition tags read this instead of polling
+	 * velocity.
+	 */
+	bool IsMovingForConditions() const { return bMovingForConditions; }
+
+	/** Planar speed (squared) hysteresis for the moving/stationary condition. Shared with UTagManager's velocity fallback. */
+	static constexpr float MovementConditionStartSpeedSq = 400.0f;
+	static constexpr float MovementConditionStopSpeedSq = 25.0f;
+
+	/**
+	 * OPT-TAGEVENTS: Broadcast only on a moving/stationary crossing or a
+	 * movement-mode change, so listeners never need a tick.
+	 */
+	FOnPHMovementConditionChanged OnMovementConditionChanged;
+
 	virtual float GetMaxSpeed() const override;
 	virtual float GetMaxAcceleration() const override;
 	virtual float GetMaxBrakingDeceleration() const override;
@@ -179,6 +199,8 @@ public:
 		const FVector& MoveDelta = FVector::ZeroVector) override;
 
 protected:
+	virtual void OnMovementUpdated(float DeltaTime, const FVector& OldLocation, const FVector& OldVelocity) override;
+	virtual void OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode) override;
 	virtual void PhysCustom(float DeltaTime, int32 Iterations) override;
 
 	void PhysWallTraversal(float DeltaTime, int32 Iterations);
@@ -226,6 +248,7 @@ protected:
 	void RestoreWallTraversalRootMotionMode();
 	void ClearWallTraversalState();
 	void RecordWallDetachTime();
+	void UpdateMovementConditionState(bool bForceBroadcast);
 
 	UFUNCTION()
 	void OnRep_WallNormal();
@@ -468,4 +491,5 @@ protected:
 	FVector WallToGroundPlanarVelocity = FVector::ZeroVector;
 	FQuat WallToGroundStartRotation = FQuat::Identity;
 	FQuat WallToGroundTargetRotation = FQuat::Identity;
+	bool bMovingForConditions = false;
 };
@@ -9,6 +9,7 @@
 #include "Combat/Library/Structs/CombatStructs.h"
 #include "AbilitySystem/HunterAbilitySystemComponent.h"
 #include "AbilitySystem/PHAbilitySet.h"
+#include "AbilitySystem/Library/Enums/HunterAttributeEnums.h"
 #include "PHBaseCharacter.generated.h"
 
 struct FGameplayAbilitySpecHandle;
@@ -30,6 +31,7 @@ class UBaseStatsData;
 class UGameplayEffect;
 class UGameplayAbility;
 class UPHCharacterMovementComponent;
+class UMobSignificanceSubsystem;
 struct FOnAttributeChangeData;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnDeath, APHBaseCharacter*, DeadCharacter, AActor*, KillerActor);
@@ -44,6 +46,7 @@ public:
 
 	virtual void PostInitializeComponents() override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaSeconds) override;
 	virtual void PossessedBy(AController* NewController) override;
 	virtual void ForwardMovementAction_Implementation(float Value) override;
@@ -389,6 +392,14 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Abilities")
 	TArray<TSubclassOf<UGameplayEffect>> StartupEffects;
 
+	/**
+	 * Attribute groups replicated when an AI controller possesses this character.
+	 * Player-controlled characters always replicate every group.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Abilities|Replication",
+		meta = (Bitmask, BitmaskEnum = "/Script/ALS_ProjectHunter.EHunterAttributeRepGroup"))
+	int32 MobReplicatedAttributeGroups = static_cast<int32>(HunterDefaultMobAttributeRepGroups);
+
 	UFUNCTION(BlueprintCallable, Category = "Abilities")
 	void GiveDefaultAbilities();
 
@@ -435,4 +446,7 @@ protected:
 
 	UPROPERTY(EditDefaultsOnly, Category = "Movement|Wall Traversal", meta = (ClampMin = "0.0"))
 	float WallAttachRetryInterval = 0.05f;
+
+	/** Sets this character's tick and animation detail by distance to players (OPT-SIGNIFICANCE). */
+	TWeakObjectPtr<UMobSignificanceSubsystem> MobSignificance;
 };
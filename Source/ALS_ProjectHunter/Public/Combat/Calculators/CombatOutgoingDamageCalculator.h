@@ -6,6 +6,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Combat/Library/Structs/CombatSnapshotStructs.h"
 #include "Combat/Library/Structs/CombatStructs.h"
 
 class UHunterAttributeSet;
@@ -21,22 +22,36 @@ class UHunterAttributeSet;
  *   5. Crit:       one roll per hit; spells use spell crit attributes;
  *                  damage-over-time hits never crit.
  *
+ * Attacker attributes are read through UHunterAttributeSet's cached
+ * FCombatOffenseSnapshot, so a hit costs lane math rather than a per-type
+ * getter switch.
+ *
  * UCombatManager owns everything downstream of the resulting packet
  * (mitigation, application through GAS); this calculator never touches GAS.
  */
 class ALS_PROJECTHUNTER_API FCombatOutgoingDamageCalculator
 {
 public:
-	static float RollDamageRange(float MinDamage, float MaxDamage);
+	// Every roll draws from the caller's stream (normally the attacker's
+	// UCombatManager stream) so a seeded fight reproduces exactly.
+	static float RollDamageRange(float MinDamage, float MaxDamage, FRandomStream& RandStream);
+
+	// Folds every hit-independent attacker attribute into snapshot lanes.
+	// UHunterAttributeSet calls this when its cached snapshot is stale.
+	static void BuildOffenseSnapshot(
+		const UHunterAttributeSet* AttackerAttributes,
+		FCombatOffenseSnapshot& OutSnapshot);
 
 	static FCombatDamagePacket BuildOutgoingDamagePacket(
 		const UHunterAttributeSet* AttackerAttributes,
-		const FAnimationDamageInfo& DamageInfo);
+		const FAnimationDamageInfo& DamageInfo,
+		FRandomStream& RandStream);
 
 	// Weapon roll + flat added damage for one type, before any scaling.
 	static float CalculateBaseDamageForType(
 		EHunterDamageType DamageType,
-		const UHunterAttributeSet* AttackerAttributes);
+		const UHunterAttributeSet* AttackerAttributes,
+		FRandomStream& RandStream);
 
 	// One-pass attribute conversion. Runs on unscaled base damage so converted
 	// damage scales only with modifiers of its final type.
@@ -60,7 +75,8 @@ public:
 	static void ResolveCriticalStrike(
 		FCombatDamagePacket& Packet,
 		const UHunterAttributeSet* AttackerAttributes,
-		const FAnimationDamageInfo& DamageInfo);
+		const FAnimationDamageInfo& DamageInfo,
+		FRandomStream& RandStream);
 
 	// Debug/log formatting shared with UCombatManager's own ApplyHit logging.
 	static FString FormatPacket(const FCombatDamagePacket& Packet);
@@ -19,6 +19,9 @@ DECLARE_LOG_CATEGORY_EXTERN(LogCombatManager, Log, All);
  * Server-side Blueprint edit point handed out by OnEditIncomingHit before the
  * pipeline runs. Blueprint may adjust the animation info, override the hit
  * response, or reject the hit entirely.
+ *
+ * The manager reuses one context across hits, so listeners must not keep the
+ * pointer past the broadcast.
  */
 UCLASS(BlueprintType)
 class ALS_PROJECTHUNTER_API UCombatIncomingHitEditContext : public UObject
@@ -50,6 +53,24 @@ public:
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnEditIncomingHit, UCombatIncomingHitEditContext*, Context);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCombatDamagePopupRequested, const FCombatDamagePopupData&, PopupData);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCombatDamagePopupBatchRequested, const TArray<FCombatDamagePopupData>&, PopupData);
+
+/** Outcome of one hit's ailment rolls. Chill has no roll; it lands with any ice damage. */
+struct FCombatAilmentRolls
+{
+	bool bBleed = false;
+	bool bIgnite = false;
+	bool bCorruption = false;
+	bool bChill = false;
+	bool bFreeze = false;
+	bool bShock = false;
+	bool bPetrify = false;
+
+	int32 Num() const
+	{
+		return bBleed + bIgnite + bCorruption + bChill + bFreeze + bShock + bPetrify;
+	}
+};
 
 /**
  * Owner of hit resolution and damage application.
@@ -121,6 +142,11 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Combat|Damage Popup")
 	FOnCombatDamagePopupRequested OnDamagePopupRequested;
 
+	// Fired once per ApplyHitBatch with every landed hit. OnDamagePopupRequested
+	// still fires per hit afterwards, with bAlsoInBatch set when this was bound.
+	UPROPERTY(BlueprintAssignable, Category = "Combat|Damage Popup")
+	FOnCombatDamagePopupBatchRequested OnDamagePopupBatchRequested;
+
 	/**
 	 * Owned status helper (Bleed/Ignite/Poison/etc.). The class still derives
 	 * from UActorComponent for saved Blueprint compatibility, but CombatManager
@@ -159,7 +185,116 @@ public:
 		EHitResponse HitResponse = EHitResponse::Normal,
 		bool bCanApplyAilments = true);
 
+	/**
+	 * Cleave/AoE entry point: one swing against many defenders.
+	 *
+	 * The attacker side (attribute lookup, base roll, conversion,
+	 * increased/more, crit) is computed once and shared by every defender, so
+	 * a swing rolls damage and crit once rather than per target. Each defender
+	 * is then mitigated on its own. A defender whose OnEditIncomingHit edit
+	 * changes DamageInfo gets its own outgoing packet.
+	 *
+	 * On-hit recovery is summed into one RecoveryApplicationGE application and
+	 * popups go out in one OnDamagePopupBatchRequested broadcast.
+	 *
+	 * OutResults is index-aligned with Defenders; invalid or rejected entries
+	 * keep a default result. Returns the number of hits that resolved.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Combat|Hit")
+	int32 ApplyHitBatch(
+		AActor* AttackerActor,
+		const TArray<AActor*>& Defenders,
+		const FAnimationDamageInfo& DamageInfo,
+		TArray<FCombatResolveResult>& OutResults,
+		EHitResponse HitResponse = EHitResponse::Normal,
+		bool bCanApplyAilments = true);
+
+	/**
+	 * Hits resolved per millisecond for ApplyHit-style per-pair resolution vs
+	 * ApplyHitBatch-style shared-attacker resolution. Runs only the
+	 * calculator/resolver math, so no gameplay state is mutated.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Combat|Debug")
+	static FCombatHitBatchBenchmarkResult BenchmarkHitResolution(
+		AActor* AttackerActor,
+		const TArray<AActor*>& Defenders,
+		const FAnimationDamageInfo& DamageInfo,
+		int32 Iterations = 200);
+
+	//~ Random
+
+	/**
+	 * Seed for this combatant's combat stream (damage range, crit, ailment and
+	 * reflect rolls). Zero picks a random seed at BeginPlay. Fix it to make a
+	 * combatant's rolls reproducible.
+	 *
+	 * Neither the seed nor the stream replicates: the stream is authority-only.
+	 * Non-authority ApplyHit previews draw from a local stream and can roll
+	 * differently from the server, which stays the source of truth.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combat|Random")
+	int32 CombatSeed = 0;
+
+	UFUNCTION(BlueprintCallable, Category = "Combat|Random")
+	void ResetCombatRandomStream(int32 NewSeed);
+
+	/** Current stream state; pass to ResetCombatRandomStream to replay from here. */
+	UFUNCTION(BlueprintPure, Category = "Combat|Random")
+	int32 GetCombatRandomSeed() const { return CombatRandomStream.GetCurrentSeed(); }
+
+	FRandomStream& GetCombatRandomStream() { return CombatRandomStream; }
+
+	/**
+	 * Attacker rolls draw from the attacker's stream and reflect rolls from the
+	 * defender's, so a combatant's rolls do not depend on who else is fighting.
+	 * Falls back to this manager's stream for actors without a CombatManager.
+	 */
+	FRandomStream& GetCombatantRandomStream(const AActor* Combatant);
+
+	// Attacker ailment chances against per-type mitigated damage. Rolls in a
+	// fixed order so a seeded stream always gives the same result.
+	static FCombatAilmentRolls RollAilments(
+		const FCombatResolveResult& Result,
+		const UHunterAttributeSet* AttackerAttributes,
+		FRandomStream& RandStream);
+
+	// Defender reflect chance/percent attributes. Returns the damage to send
+	// back to the attacker, zero when nothing reflected.
+	static float RollReflectDamage(
+		const FCombatResolveResult& Result,
+		const UHunterAttributeSet* DefenderAttributes,
+		FRandomStream& RandStream);
+
+	//~ Hit log
+
+	/**
+	 * Records every ApplyHit and ApplyHitBatch hit this manager resolves on the
+	 * authority, after OnEditIncomingHit edits, in the order they draw from the
+	 * combat streams. Each actor's attributes and stream seed are
+	 * captured on its first hit in the log, as attacker or defender.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Combat|Simulation")
+	void StartHitLogRecording();
+
+	UFUNCTION(BlueprintCallable, Category = "Combat|Simulation")
+	FCombatHitLog StopHitLogRecording();
+
+	UFUNCTION(BlueprintPure, Category = "Combat|Simulation")
+	bool IsRecordingHitLog() const { return bRecordingHitLog; }
+
+	/** Replays a log headlessly through FCombatSimulationHarness. */
+	UFUNCTION(BlueprintCallable, Category = "Combat|Simulation")
+	static FCombatSimulationReport ReplayHitLog(const FCombatHitLog& HitLog, int32 Repetitions = 1);
+
+	/**
+	 * OnDamagePopupBatchRequested first, then OnDamagePopupRequested per entry
+	 * so per-hit listeners still see every hit. Also used for ailment ticks.
+	 */
+	void BroadcastDamagePopupBatch(TArray<FCombatDamagePopupData>& PopupBatch);
+
 protected:
+	virtual void BeginPlay() override;
+
 	//~ Application
 	//
 	// Hit-resolution math is split across plain, stateless C++ helpers
@@ -172,22 +307,79 @@ protected:
 	static UAbilitySystemComponent* GetAbilitySystemComponentFromActor(const AActor* Actor);
 	static const UHunterAttributeSet* GetHunterAttributeSetFromActor(const AActor* Actor);
 
+	// Runs OnEditIncomingHit on the pooled edit context. Returns false when a
+	// listener rejected the hit; otherwise writes the edited values back.
+	bool RunIncomingHitEdit(
+		AActor* AttackerActor,
+		AActor* DefenderActor,
+		FAnimationDamageInfo& InOutDamageInfo,
+		EHitResponse& InOutHitResponse,
+		bool& bInOutCanApplyAilments);
+
 	void ApplyResolvedDamage(AActor* AttackerActor, AActor* DefenderActor, const FCombatResolveResult& Result) const;
 
-	// LifeOnHit/ManaOnHit/StaminaOnHit plus leech percentages of damage dealt,
-	// routed through RecoveryApplicationGE on the attacker.
+	// LifeOnHit/ManaOnHit/StaminaOnHit per landed hit plus leech percentages
+	// of damage dealt, routed through RecoveryApplicationGE on the attacker.
 	void ApplyOnHitRecovery(
 		AActor* AttackerActor,
-		const FCombatResolveResult& Result,
+		float DamageDealt,
+		int32 LandedHits,
 		UAbilitySystemComponent* AttackerASC,
 		const UHunterAttributeSet* AttackerAttributes) const;
 
-	// Rolls attacker ailment chances against per-type mitigated damage and routes successful rolls through CombatStatus.
-	void ApplyAilments(AActor* AttackerActor, AActor* DefenderActor, const FCombatResolveResult& Result) const;
+	// Routes successful RollAilments results through CombatStatus.
+	void ApplyAilments(
+		AActor* AttackerActor,
+		AActor* DefenderActor,
+		const FCombatResolveResult& Result,
+		const FCombatAilmentRolls& Rolls,
+		const UHunterAttributeSet* AttackerAttributes) const;
+
+	// Returns RollReflectDamage output to the attacker through ReflectApplicationGE.
+	void ApplyReflect(AActor* AttackerActor, AActor* DefenderActor, float ReflectedDamage) const;
+
+	// Ailment and reflect rolls for one landed hit on the authority.
+	void ApplyHitRolls(
+		AActor* AttackerActor,
+		AActor* DefenderActor,
+		const FCombatResolveResult& Result,
+		const UHunterAttributeSet* AttackerAttributes,
+		const UHunterAttributeSet* DefenderAttributes);
+
+	void RecordHit(
+		AActor* AttackerActor,
+		AActor* DefenderActor,
+		const FAnimationDamageInfo& DamageInfo,
+		EHitResponse HitResponse,
+		bool bCanApplyAilments,
+		const UHunterAttributeSet* AttackerAttributes,
+		const UHunterAttributeSet* DefenderAttributes,
+		int32 BatchIndex = INDEX_NONE,
+		bool bUsesBatchPacket = false);
+
+	// Opens a Batches entry just before ApplyHitBatch rolls its shared packet.
+	// Returns its index.
+	int32 RecordHitBatch(AActor* AttackerActor, const FAnimationDamageInfo& DamageInfo, const UHunterAttributeSet* AttackerAttributes);
 
-	// Defender reflect chance/percent attributes returned to the attacker
-	// through ReflectApplicationGE.
-	void ApplyReflect(AActor* AttackerActor, AActor* DefenderActor, const FCombatResolveResult& Result) const;
+	// Combatants index for Actor, capturing it on first sight.
+	int32 FindOrAddRecordedCombatant(AActor* Actor, const UHunterAttributeSet* Attributes);
 
 	void BroadcastDamagePopup(AActor* AttackerActor, AActor* DefenderActor, const FCombatResolveResult& Result);
+
+private:
+	// OPT-COMBATBATCH: reused by RunIncomingHitEdit instead of a NewObject per
+	// hit. A listener that re-enters ApplyHit gets a fresh context.
+	UPROPERTY(Transient)
+	TObjectPtr<UCombatIncomingHitEditContext> PooledEditContext = nullptr;
+
+	bool bPooledEditContextInUse = false;
+
+	FRandomStream CombatRandomStream;
+
+	UPROPERTY(Transient)
+	FCombatHitLog RecordedHitLog;
+
+	TMap<TObjectKey<AActor>, int32> RecordedCombatantIndices;
+
+	bool bRecordingHitLog = false;
 };
@@ -7,6 +7,7 @@
 
 class APlayerController;
 class UCombatManager;
+class UHunterDamagePopupSubsystem;
 class UHunterDamagePopupWidget;
 class UWidgetComponent;
 
@@ -62,6 +63,26 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Damage Popup", meta = (ClampMin = "0.0"))
 	float AutoRemoveDelay = 1.25f;
 
+	/**
+	 * OPT-POPUPPOOL: Show popups through UHunterDamagePopupSubsystem's pool of
+	 * widget components for the local player instead of creating and
+	 * destroying one component per hit. Camera facing then runs in the
+	 * subsystem's single update and this component never ticks.
+	 * Set to false for the old per-hit components.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Damage Popup|Pool")
+	bool bUsePopupPool = true;
+
+	/** Most popups on screen at once for this player. Lower-priority numbers are dropped beyond it. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Damage Popup|Pool",
+		meta = (ClampMin = "1", ClampMax = "128", EditCondition = "bUsePopupPool"))
+	int32 MaxConcurrentPopups = 24;
+
+	/** Hits on a target that already shows a number this recently add to it. 0 disables merging. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Damage Popup|Pool",
+		meta = (ClampMin = "0.0", EditCondition = "bUsePopupPool"))
+	float MergeWindowSeconds = 0.15f;
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Damage Popup")
 	FVector2D ViewportAlignment = FVector2D(0.5f, 0.5f);
 
@@ -77,16 +98,22 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Damage Popup")
 	void HandleDamagePopupRequested(const FCombatDamagePopupData& PopupData);
 
+	UFUNCTION(BlueprintCallable, Category = "Damage Popup")
+	void HandleDamagePopupBatchRequested(const TArray<FCombatDamagePopupData>& PopupData);
+
+	/** Always creates a dedicated widget component, bypassing the pool. */
 	UFUNCTION(BlueprintCallable, Category = "Damage Popup")
 	UHunterDamagePopupWidget* SpawnDamagePopup(const FCombatDamagePopupData& PopupData);
 
 protected:
+	void PresentDamagePopup(const FCombatDamagePopupData& PopupData);
 	void BindToCombatManager();
 	void UnbindFromCombatManager();
 	APlayerController* ResolvePlayerController() const;
 	FRotator ResolveWorldWidgetRotation(const FVector& WorldLocation, const APlayerController* PlayerController) const;
 	void UpdateWorldWidgetFacing(UWidgetComponent* WidgetComponent, const APlayerController* PlayerController) const;
 	void UpdateActiveWorldWidgetFacing();
+	UHunterDamagePopupSubsystem* GetPopupSubsystem() const;
 
 	UPROPERTY(Transient)
 	TObjectPtr<UCombatManager> BoundCombatManager = nullptr;
@@ -166,4 +166,19 @@ private:
 		TSubclassOf<UGameplayEffect> EffectClass) const;
 
 	static UAbilitySystemComponent* GetTargetASC(AActor* Target);
+
+	/**
+	 * OPT-AILMENTSIM: Hands a damage DoT to UCombatAilmentSubsystem when the
+	 * simulation is enabled and Target is authoritative. EffectClass supplies
+	 * the tick period and, when Duration <= 0, a static default duration.
+	 * Returns false when the caller should apply the GE instead, including
+	 * when no positive duration resolves.
+	 */
+	bool TrySimulateAilment(ECombatAilmentType Type, TSubclassOf<UGameplayEffect> EffectClass, AActor* Target,
+		float DamagePerTick, float Duration, AActor* Instigator, FCombatStatusApplyResult& OutResult) const;
+
+	/** True while the simulated ailment's tag is raised; also valid on clients. */
+	static bool HasAilmentTag(AActor* Target, ECombatAilmentType Type);
+
+	static void RemoveSimulatedAilment(AActor* Target, ECombatAilmentType Type);
 };
@@ -33,3 +33,17 @@ enum class EHitResponse : uint8
 	Invincible UMETA(DisplayName = "Invincible"),
 	Blocked UMETA(DisplayName = "Blocked")
 };
+
+/**
+ * Damage-over-time ailments simulated by UCombatAilmentSubsystem.
+ * Poison stacks; every other type keeps one instance per target.
+ */
+UENUM(BlueprintType)
+enum class ECombatAilmentType : uint8
+{
+	Bleed UMETA(DisplayName = "Bleed"),
+	Ignite UMETA(DisplayName = "Ignite"),
+	Poison UMETA(DisplayName = "Poison"),
+	Corruption UMETA(DisplayName = "Corruption"),
+	MAX UMETA(Hidden)
+};
@@ -0,0 +1,97 @@
+// Per-actor combat stat snapshots read by the damage pipeline on every hit.
+// Plain C++, no USTRUCT: these are hot-path caches with no Blueprint or
+// serialization surface. UHunterAttributeSet owns one of each and rebuilds
+// them only after a relevant attribute changes.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Combat/Library/Enums/CombatEnums.h"
+
+/** Lane count of every per-type array below. Lanes follow EHunterDamageType order. */
+inline constexpr int32 HunterDamageTypeLaneCount = 6;
+
+FORCEINLINE int32 GetDamageTypeLane(const EHunterDamageType DamageType)
+{
+	return static_cast<int32>(DamageType);
+}
+
+/**
+ * Attacker-side attribute values folded into six-lane arrays. Only the parts
+ * that do not depend on the hit are cached; animation BaseMulti, skill-tag
+ * buckets and the current health state are added per hit.
+ *
+ * Built by FCombatOutgoingDamageCalculator::BuildOffenseSnapshot.
+ */
+struct alignas(16) FCombatOffenseSnapshot
+{
+	float MinDamage[HunterDamageTypeLaneCount] = {};
+	float MaxDamage[HunterDamageTypeLaneCount] = {};
+	float FlatDamage[HunterDamageTypeLaneCount] = {};
+
+	/** Global + type + elemental increased percent. */
+	float IncreasedPercent[HunterDamageTypeLaneCount] = {};
+
+	/** Global x elemental x type more multiplier, neutral defaults folded in. */
+	float MoreMultiplier[HunterDamageTypeLaneCount] = { 1.f, 1.f, 1.f, 1.f, 1.f, 1.f };
+
+	/**
+	 * Row = source type, column = destination type, as fractions. Over-allocated
+	 * rows are already scaled to 100% and the diagonal holds the unconverted
+	 * remainder, so a conversion pass is one 6x6 multiply.
+	 */
+	float ConversionFraction[HunterDamageTypeLaneCount][HunterDamageTypeLaneCount] =
+	{
+		{ 1.f, 0.f, 0.f, 0.f, 0.f, 0.f },
+		{ 0.f, 1.f, 0.f, 0.f, 0.f, 0.f },
+		{ 0.f, 0.f, 1.f, 0.f, 0.f, 0.f },
+		{ 0.f, 0.f, 0.f, 1.f, 0.f, 0.f },
+		{ 0.f, 0.f, 0.f, 0.f, 1.f, 0.f },
+		{ 0.f, 0.f, 0.f, 0.f, 0.f, 1.f }
+	};
+
+	/** Attribute resistance piercing. The physical lane is unused; armour uses ArmourPiercing. */
+	float ResistancePierce[HunterDamageTypeLaneCount] = {};
+	float ArmourPiercing = 0.f;
+
+	// Skill-tag conditional increased buckets.
+	float MeleeIncreased = 0.f;
+	float RangedIncreased = 0.f;
+	float SpellIncreased = 0.f;
+	float AreaIncreased = 0.f;
+	float DamageOverTimeIncreased = 0.f;
+	float ChainIncreased = 0.f;
+
+	// Health-state bonuses. The health ratio itself is read live per hit.
+	float FullHealthIncreased = 0.f;
+	float LowHealthIncreased = 0.f;
+
+	float CritChance = 0.f;
+	float SpellCritChance = 0.f;
+
+	/** Attribute crit multiplier with the default applied when unset. */
+	float CritMultiplier = 1.5f;
+
+	/** Added to CritMultiplier for spells. */
+	float SpellCritMultiplierBonus = 0.f;
+};
+
+/**
+ * Defender-side attribute values used by mitigation, folded into six-lane
+ * arrays. Built by FCombatIncomingDamageResolver::BuildDefenseSnapshot.
+ */
+struct alignas(16) FCombatDefenseSnapshot
+{
+	/** GlobalDefenses + flat + percent. The physical lane is unused; physical goes through armour. */
+	float Resistance[HunterDamageTypeLaneCount] = {};
+
+	/** Per-type max resistance with the default cap applied when unset. */
+	float ResistanceCap[HunterDamageTypeLaneCount] = { 90.f, 90.f, 90.f, 90.f, 90.f, 90.f };
+
+	/** Global x elemental x type damage-taken multiplier, neutral defaults folded in. */
+	float DamageTakenMultiplier[HunterDamageTypeLaneCount] = { 1.f, 1.f, 1.f, 1.f, 1.f, 1.f };
+
+	float BlockTypeMultiplier[HunterDamageTypeLaneCount] = { 1.f, 1.f, 1.f, 1.f, 1.f, 1.f };
+
+	/** (Armour + flat) x (1 + percent), before the attacker's armour piercing. */
+	float EffectiveArmour = 0.f;
+};
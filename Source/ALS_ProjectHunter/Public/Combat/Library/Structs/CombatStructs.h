@@ -289,6 +289,79 @@ struct ALS_PROJECTHUNTER_API FCombatDamagePopupData
 
 	UPROPERTY(BlueprintReadOnly, Category = "Combat|Damage Popup")
 	bool bKilledTarget = false;
+
+	/** Damage-over-time tick. Ranks with crits when the popup budget is full. */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat|Damage Popup")
+	bool bFromAilment = false;
+
+	/**
+	 * Per-hit copy of a popup that OnDamagePopupBatchRequested already carried.
+	 * Listeners bound to both delegates skip these to avoid showing it twice.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat|Damage Popup")
+	bool bAlsoInBatch = false;
+};
+
+/** Result of UCombatManager::BenchmarkHitResolution: per-pair vs batched hit resolution throughput. */
+USTRUCT(BlueprintType)
+struct ALS_PROJECTHUNTER_API FCombatHitBatchBenchmarkResult
+{
+	GENERATED_BODY()
+
+	/** Swings resolved per path. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 Iterations = 0;
+
+	/** Defenders with a valid attribute set hit by each swing. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 DefenderCount = 0;
+
+	/** Hits per millisecond resolving every defender the way ApplyHit does (attacker side rebuilt per pair). */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double PerHitHitsPerMs = 0.0;
+
+	/** Hits per millisecond resolving every defender the way ApplyHitBatch does (attacker side built once per swing). */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double BatchHitsPerMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double PerHitTotalMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double BatchTotalMs = 0.0;
+};
+
+/** Result of UCombatAilmentSubsystem::BenchmarkDamageOverTime: one periodic GE execution per stack vs one summed write per target. */
+USTRUCT(BlueprintType)
+struct ALS_PROJECTHUNTER_API FCombatAilmentBenchmarkResult
+{
+	GENERATED_BODY()
+
+	/** Concurrent DoT instances, spread round-robin over the targets. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 Stacks = 0;
+
+	/** Targets with an ability system the stacks were spread over. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 TargetCount = 0;
+
+	/** Damage ticks run per path. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 Ticks = 0;
+
+	/** Health writes made by one GE execution per stack per tick. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 EffectPathWrites = 0;
+
+	/** Health writes made by the subsystem: one per target per tick. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 SubsystemPathWrites = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double EffectPathMsPerTick = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double SubsystemPathMsPerTick = 0.0;
 };
 
 /** Result of a UCombatStatusEffectApplier Apply* call. */
@@ -303,3 +376,154 @@ struct ALS_PROJECTHUNTER_API FCombatStatusApplyResult
 	UPROPERTY(BlueprintReadOnly, Category = "Combat Status")
 	FActiveGameplayEffectHandle EffectHandle;
 };
+
+/** Attribute values by property name, enough to rebuild a UHunterAttributeSet without an actor. */
+USTRUCT(BlueprintType)
+struct ALS_PROJECTHUNTER_API FCombatAttributeProfile
+{
+	GENERATED_BODY()
+
+	/** Non-zero current values keyed by UHunterAttributeSet property name. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Simulation")
+	TMap<FName, float> Values;
+};
+
+/** One actor in a hit log, as it was just before its first recorded hit. */
+USTRUCT(BlueprintType)
+struct ALS_PROJECTHUNTER_API FCombatHitLogCombatant
+{
+	GENERATED_BODY()
+
+	/** Combat stream state, so a replay draws the same rolls. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Simulation")
+	int32 Seed = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Simulation")
+	FCombatAttributeProfile Profile;
+};
+
+/** One ApplyHitBatch swing: the shared packet its unedited hits resolve against. */
+USTRUCT(BlueprintType)
+struct ALS_PROJECTHUNTER_API FCombatHitLogBatch
+{
+	GENERATED_BODY()
+
+	/** Index into FCombatHitLog::Combatants. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Simulation")
+	int32 AttackerIndex = 0;
+
+	/** Hits.Num() when the shared packet was rolled; replay rolls it before that hit. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Simulation")
+	int32 FirstHitIndex = 0;
+
+	/** Unedited swing info the shared packet was built from. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Simulation")
+	FAnimationDamageInfo DamageInfo;
+};
+
+/** One ApplyHit call, or one ApplyHitBatch defender, as it entered the pipeline after OnEditIncomingHit edits. */
+USTRUCT(BlueprintType)
+struct ALS_PROJECTHUNTER_API FCombatHitLogEntry
+{
+	GENERATED_BODY()
+
+	/** Index into FCombatHitLog::Combatants. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Simulation")
+	int32 AttackerIndex = 0;
+
+	/** Index into FCombatHitLog::Combatants. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Simulation")
+	int32 DefenderIndex = 0;
+
+	/** World time of the hit. Only differences between entries matter. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Simulation")
+	float TimeSeconds = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Simulation")
+	FAnimationDamageInfo DamageInfo;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Simulation")
+	EHitResponse HitResponse = EHitResponse::Normal;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Simulation")
+	bool bCanApplyAilments = true;
+
+	/** Index into FCombatHitLog::Batches, INDEX_NONE for a single ApplyHit. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Simulation")
+	int32 BatchIndex = INDEX_NONE;
+
+	/** Resolved against the batch's shared packet instead of rolling its own. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Simulation")
+	bool bUsesBatchPacket = false;
+};
+
+/**
+ * Recorded fight. Every actor that attacked or was hit gets one Combatants
+ * entry, so AoE batches and target switches replay with each defender's own
+ * stream and attributes.
+ */
+USTRUCT(BlueprintType)
+struct ALS_PROJECTHUNTER_API FCombatHitLog
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Simulation")
+	TArray<FCombatHitLogCombatant> Combatants;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Simulation")
+	TArray<FCombatHitLogEntry> Hits;
+
+	/** ApplyHitBatch swings, in the order their shared packets were rolled. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Simulation")
+	TArray<FCombatHitLogBatch> Batches;
+};
+
+/** Result of FCombatSimulationHarness::ReplayHitLog. */
+USTRUCT(BlueprintType)
+struct ALS_PROJECTHUNTER_API FCombatSimulationReport
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Combat|Simulation")
+	int32 Repetitions = 0;
+
+	/** Hits resolved across all repetitions. */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat|Simulation")
+	int32 HitsReplayed = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Combat|Simulation")
+	int32 CritCount = 0;
+
+	/** Successful ailment rolls. Chill counts, since cold damage always chills. */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat|Simulation")
+	int32 AilmentCount = 0;
+
+	/** Times the defender reached zero health. The defender is restored to its recorded vitals after each kill. */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat|Simulation")
+	int32 KillCount = 0;
+
+	/** Average mitigated damage per repetition. */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat|Simulation")
+	double DamagePerRepetition = 0.0;
+
+	/** Log time from first to last hit. */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat|Simulation")
+	double FightSeconds = 0.0;
+
+	/** DamagePerRepetition over FightSeconds. Zero for single-hit logs. */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat|Simulation")
+	double DamagePerSecond = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Combat|Simulation")
+	double WallMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Combat|Simulation")
+	double HitsPerMs = 0.0;
+
+	/**
+	 * Hash of every resolved hit of the first repetition. Equal logs replay to
+	 * equal checksums, so a change means the math or the roll order changed.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat|Simulation")
+	int32 ResultChecksum = 0;
+};
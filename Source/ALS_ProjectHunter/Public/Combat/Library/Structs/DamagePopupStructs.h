@@ -0,0 +1,56 @@
+// Pooled world-space damage popup bookkeeping for UHunterDamagePopupSubsystem.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DamagePopupStructs.generated.h"
+
+class AActor;
+class APlayerController;
+class UHunterDamagePopupWidget;
+class UWidgetComponent;
+
+/** One pooled widget component. Inactive slots stay registered but hidden and untickable. */
+USTRUCT()
+struct ALS_PROJECTHUNTER_API FHunterDamagePopupSlot
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UWidgetComponent> WidgetComponent = nullptr;
+
+	UPROPERTY()
+	TObjectPtr<UHunterDamagePopupWidget> Widget = nullptr;
+
+	/** Class Widget was built from; a free slot is rebuilt when a presenter asks for another. */
+	UPROPERTY()
+	TSubclassOf<UHunterDamagePopupWidget> WidgetClass;
+
+	/** Target of the number on screen; later hits on it inside MergeWindowEnd add to it. */
+	UPROPERTY()
+	TWeakObjectPtr<AActor> Target;
+
+	double ExpireTime = 0.0;
+	double MergeWindowEnd = 0.0;
+
+	/** 0 plain, 1 crit or ailment, 2 killing blow. Damage breaks ties. */
+	int32 PriorityTier = 0;
+	float PriorityDamage = 0.f;
+
+	bool bActive = false;
+	bool bFaceCamera = false;
+};
+
+/** Popups shown to one local player. Every widget class shares the one budget. */
+USTRUCT()
+struct ALS_PROJECTHUNTER_API FHunterDamagePopupPlayerPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TWeakObjectPtr<APlayerController> PlayerController;
+
+	UPROPERTY()
+	TArray<FHunterDamagePopupSlot> Slots;
+
+	int32 ActiveCount = 0;
+};
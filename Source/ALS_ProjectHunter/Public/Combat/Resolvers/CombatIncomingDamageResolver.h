@@ -7,6 +7,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Combat/Library/Structs/CombatSnapshotStructs.h"
 #include "Combat/Library/Structs/CombatStructs.h"
 
 class AActor;
@@ -20,6 +21,9 @@ class UHunterAttributeSet;
  *   7. Block (angle, strength, flat, chip damage, stamina cost, guard break).
  *   8. Damage-taken multipliers, then stagger and hit-response gating.
  *
+ * Defender values are read through UHunterAttributeSet's cached
+ * FCombatDefenseSnapshot; attacker piercing through its FCombatOffenseSnapshot.
+ *
  * UCombatManager owns applying the resulting FCombatResolveResult through
  * GAS (damage, recovery, ailments, reflect); this resolver never mutates
  * gameplay state and never calls into GAS itself.
@@ -35,6 +39,12 @@ public:
 		const UHunterAttributeSet* DefenderAttributes,
 		const FAnimationDamageInfo& DamageInfo);
 
+	// Folds every mitigation attribute into snapshot lanes. UHunterAttributeSet
+	// calls this when its cached snapshot is stale.
+	static void BuildDefenseSnapshot(
+		const UHunterAttributeSet* DefenderAttributes,
+		FCombatDefenseSnapshot& OutSnapshot);
+
 	static float GetResistanceValue(EHunterDamageType DamageType, const UHunterAttributeSet* DefenderAttributes);
 	static float GetResistanceCap(EHunterDamageType DamageType, const UHunterAttributeSet* DefenderAttributes);
 
@@ -0,0 +1,28 @@
+// Headless combat replay: runs a recorded FCombatHitLog through the damage
+// pipeline without a world, actors or GAS. Plain C++, no UCLASS -- the same
+// calculator/resolver math and roll helpers UCombatManager uses, driven from
+// seeded streams so equal logs replay to equal results.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Combat/Library/Structs/CombatStructs.h"
+
+class UHunterAttributeSet;
+
+class ALS_PROJECTHUNTER_API FCombatSimulationHarness
+{
+public:
+	/**
+	 * Replays every hit of the log Repetitions times. Each repetition restarts
+	 * from the recorded attributes and seeds. Damage is written straight into
+	 * the defender's Stamina/ArcaneShield/Health; reflect, recovery and
+	 * ailment ticks are rolled but not applied.
+	 */
+	static FCombatSimulationReport ReplayHitLog(const FCombatHitLog& HitLog, int32 Repetitions = 1);
+
+	/** Every non-zero attribute current value, keyed by property name. */
+	static FCombatAttributeProfile CaptureAttributeProfile(const UHunterAttributeSet* Attributes);
+
+	/** Resets every attribute to zero, then writes the profile into base and current values. */
+	static void ApplyAttributeProfile(const FCombatAttributeProfile& Profile, UHunterAttributeSet* Attributes);
+};
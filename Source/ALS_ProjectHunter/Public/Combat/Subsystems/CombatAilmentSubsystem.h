@@ -0,0 +1,156 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "Combat/Library/Structs/CombatStructs.h"
+#include "CombatAilmentSubsystem.generated.h"
+
+class UAbilitySystemComponent;
+class UCombatManager;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogCombatAilments, Log, All);
+
+/**
+ * UCombatAilmentSubsystem
+ *
+ * OPT-AILMENTSIM: Server-side simulation of bleed, ignite, poison and
+ * corruption. Replaces one periodic UGameplayEffect per instance with compact
+ * per-target arrays (type, DPS, remaining time, source) advanced on one
+ * fixed-rate step.
+ *
+ * - Each step sums every instance on a target and applies the total as one
+ *   Health base write (ApplyModToAttribute), so a poisoned and ignited pack
+ *   costs one attribute callback chain per mob per step, not one per stack.
+ * - Poison stacks up to MaxPoisonStacks; the other types keep one instance per
+ *   target, replaced by an application with at least its DPS.
+ * - Condition.Self.* ailment tags are raised while a type is active and
+ *   replicated tag-only, so the HUD and UTagManager see them on clients.
+ * - Ticks reach the source's UCombatManager popup delegates flagged
+ *   bFromAilment, one popup per source and target per step.
+ *
+ * Compare with `stat CombatAilments` and Hunter.Debug.AilmentSimulation.
+ */
+UCLASS()
+class ALS_PROJECTHUNTER_API UCombatAilmentSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UWorldSubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~ End UWorldSubsystem
+
+	//~ Begin FTickableGameObject (via UTickableWorldSubsystem)
+	virtual void Tick(float DeltaSeconds) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject
+
+	/** False routes UCombatStatusEffectApplier back to one periodic GE per instance. */
+	static bool IsSimulationEnabled();
+
+	static FGameplayTag GetAilmentTag(ECombatAilmentType Type);
+
+	/**
+	 * Start an ailment on Target. Authority only. Returns false when the target
+	 * has no ability system, the values are not positive, or a stronger
+	 * instance of a non-stacking type is already running.
+	 */
+	bool ApplyAilment(ECombatAilmentType Type, AActor* Target, float DamagePerSecond, float Duration, AActor* Source);
+
+	void RemoveAilment(AActor* Target, ECombatAilmentType Type);
+
+	/** Drop every ailment on Target and lower its tags, e.g. before it returns to a pool. */
+	void ClearAilments(AActor* Target);
+
+	UFUNCTION(BlueprintPure, Category = "Combat|Ailments")
+	bool HasAilment(const AActor* Target, ECombatAilmentType Type) const { return GetAilmentStacks(Target, Type) > 0; }
+
+	UFUNCTION(BlueprintPure, Category = "Combat|Ailments")
+	int32 GetAilmentStacks(const AActor* Target, ECombatAilmentType Type) const;
+
+	UFUNCTION(BlueprintPure, Category = "Combat|Ailments")
+	int32 GetTrackedTargetCount() const { return Targets.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = "Combat|Ailments")
+	int32 GetActiveInstanceCount() const;
+
+	/**
+	 * Spreads Stacks DoT instances over Targets and times Ticks damage ticks
+	 * two ways: one instant Health GE execution per stack, standing in for a
+	 * periodic DoT effect firing, and this subsystem's one summed write per
+	 * target. Needs authority; every target's Health is restored afterwards.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Combat|Debug")
+	FCombatAilmentBenchmarkResult BenchmarkDamageOverTime(const TArray<AActor*>& InTargets, int32 Stacks = 500, int32 Ticks = 8);
+
+	/** Seconds of simulation per step. Damage per step is DPS times this. */
+	UPROPERTY(EditDefaultsOnly, Category = "Combat|Ailments", meta = (ClampMin = 0.05f))
+	float StepIntervalSeconds = 0.25f;
+
+	/** Steps run in one frame after a hitch; time beyond them is dropped, not caught up. */
+	UPROPERTY(EditDefaultsOnly, Category = "Combat|Ailments", meta = (ClampMin = 1))
+	int32 MaxStepsPerFrame = 4;
+
+	/** Poison instances kept per target; past this a new stack replaces the weakest one. */
+	UPROPERTY(EditDefaultsOnly, Category = "Combat|Ailments", meta = (ClampMin = 1))
+	int32 MaxPoisonStacks = 64;
+
+private:
+	struct FAilmentInstance
+	{
+		TWeakObjectPtr<AActor> Source;
+		/** Source's combat owner, for popups. */
+		TWeakObjectPtr<UCombatManager> SourceCombat;
+		float DamagePerSecond = 0.0f;
+		float RemainingSeconds = 0.0f;
+		ECombatAilmentType Type = ECombatAilmentType::Bleed;
+	};
+
+	struct FAilmentTarget
+	{
+		/** TargetIndices key; still valid for removal after the actor is gone. */
+		TObjectKey<AActor> Key;
+		TWeakObjectPtr<AActor> Actor;
+		TWeakObjectPtr<UAbilitySystemComponent> ASC;
+		TArray<FAilmentInstance, TInlineAllocator<4>> Instances;
+		/** Bit per ECombatAilmentType whose tag is raised. */
+		uint8 TaggedTypes = 0;
+	};
+
+	// One source's share of a target's step, for its popup.
+	struct FSourceDamage
+	{
+		UCombatManager* SourceCombat = nullptr;
+		float Damage = 0.0f;
+		float DominantDamage = 0.0f;
+		ECombatAilmentType DominantType = ECombatAilmentType::Bleed;
+	};
+
+	using FSourceDamageArray = TArray<FSourceDamage, TInlineAllocator<4>>;
+
+	void Step(float StepSeconds);
+
+	/** Damage Target takes over StepSeconds; expired instances are removed. */
+	static float AdvanceTarget(FAilmentTarget& Target, float StepSeconds, FSourceDamageArray* OutSourceDamage);
+
+	void AddInstance(FAilmentTarget& Target, FAilmentInstance&& Instance, bool& bOutApplied) const;
+
+	/** Raise or lower tags so they match the types Target still has. */
+	static void RefreshTags(FAilmentTarget& Target);
+
+	/** Lower Target's tags and swap-remove it. Not during a step. */
+	void RemoveTargetAt(int32 Index);
+
+	const FAilmentTarget* FindTarget(const AActor* Actor) const;
+	FAilmentTarget* FindTarget(const AActor* Actor);
+
+	TArray<FAilmentTarget> Targets;
+	TMap<TObjectKey<AActor>, int32> TargetIndices;
+
+	float StepAccumulator = 0.0f;
+
+	/** Set while Step writes Health; death handlers that clear ailments then must not reshuffle Targets. */
+	bool bIsStepping = false;
+};
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Combat/Library/Structs/CombatStructs.h"
+#include "Combat/Library/Structs/DamagePopupStructs.h"
+#include "HunterDamagePopupSubsystem.generated.h"
+
+class APlayerController;
+class UHunterDamagePopupPresentationComponent;
+class UHunterDamagePopupWidget;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogDamagePopupPool, Log, All);
+
+DECLARE_STATS_GROUP(TEXT("DamagePopups"), STATGROUP_DamagePopups, STATCAT_Advanced);
+
+/**
+ * UHunterDamagePopupSubsystem
+ *
+ * OPT-POPUPPOOL: Shows damage popups through a fixed pool of world-space
+ * widget components per local player instead of one new UWidgetComponent per
+ * hit. Components are owned by the player controller, so they survive pawn
+ * respawns, and are hidden rather than destroyed when a popup expires.
+ *
+ * - At most MaxConcurrentPopups (from the presenter) are on screen per player,
+ *   whatever widget class each presenter uses.
+ * - A hit on a target that already shows a number within MergeWindowSeconds
+ *   adds to that number instead of taking a new slot.
+ * - With the budget full, a new popup replaces the lowest-priority one
+ *   (killing blow > crit / ailment > plain, then damage) or is dropped.
+ * - Expiry and camera facing for every active popup run in one Tick.
+ *
+ * Compare with `stat DamagePopups`.
+ */
+UCLASS()
+class ALS_PROJECTHUNTER_API UHunterDamagePopupSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UWorldSubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~ End UWorldSubsystem
+
+	//~ Begin FTickableGameObject (via UTickableWorldSubsystem)
+	virtual void Tick(float DeltaSeconds) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject
+
+	/** Show, merge or drop one popup for PlayerController using Presenter's widget class and layout. */
+	void RequestPopup(const UHunterDamagePopupPresentationComponent& Presenter,
+		APlayerController* PlayerController, const FCombatDamagePopupData& PopupData);
+
+	UFUNCTION(BlueprintPure, Category = "Damage Popup")
+	int32 GetActivePopupCount() const;
+
+	/** Popups merged into an existing number since the world started. */
+	UFUNCTION(BlueprintPure, Category = "Damage Popup")
+	int32 GetMergedPopupCount() const { return MergedPopupCount; }
+
+	/** Popups dropped or displaced by the budget since the world started. */
+	UFUNCTION(BlueprintPure, Category = "Damage Popup")
+	int32 GetDroppedPopupCount() const { return DroppedPopupCount; }
+
+private:
+	FHunterDamagePopupPlayerPool* FindOrAddPool(APlayerController* PlayerController);
+
+	/** Free slot of Presenter's widget class, a new or rebuilt slot while under Capacity, or INDEX_NONE. */
+	int32 AcquireSlot(FHunterDamagePopupPlayerPool& Pool,
+		const UHunterDamagePopupPresentationComponent& Presenter, int32 Capacity);
+
+	/** Builds Slot's component from Presenter's widget class, destroying any previous one. */
+	bool CreateSlotComponent(FHunterDamagePopupPlayerPool& Pool, FHunterDamagePopupSlot& Slot,
+		const UHunterDamagePopupPresentationComponent& Presenter);
+
+	void ShowInSlot(FHunterDamagePopupPlayerPool& Pool, FHunterDamagePopupSlot& Slot,
+		const UHunterDamagePopupPresentationComponent& Presenter, const FCombatDamagePopupData& PopupData,
+		double Now);
+
+	void ReleaseSlot(FHunterDamagePopupPlayerPool& Pool, FHunterDamagePopupSlot& Slot);
+
+	void HandlePopupFinished(UHunterDamagePopupWidget* Widget);
+
+	static void GetPopupPriority(const FCombatDamagePopupData& PopupData, int32& OutTier, float& OutDamage);
+
+	UPROPERTY()
+	TArray<FHunterDamagePopupPlayerPool> PlayerPools;
+
+	int32 MergedPopupCount = 0;
+	int32 DroppedPopupCount = 0;
+};
@@ -6,16 +6,16 @@
 #include "Item/Library/Enums/ItemEnums.h"
 #include "Inventory/Library/Enums/InventoryEnums.h"
 #include "Inventory/Library/InventoryLog.h"
+#include "Inventory/Library/Structs/InventoryIndex.h"
+#include "Inventory/Library/Structs/InventoryStructs.h"
 #include "InventoryManager.generated.h"
 
 class UItemInstance;
-class UActorChannel;
-class FOutBunch;
-struct FReplicationFlags;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnItemAdded, UItemInstance*, Item);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnItemRemoved, UItemInstance*, Item);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnInventoryChanged);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInventorySlotsChanged, const TArray<int32>&, SlotIndices);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnWeightChanged, float, CurrentWeight, float, MaxWeight);
 
 /**
@@ -32,6 +32,8 @@ class ALS_PROJECTHUNTER_API UInventoryManager : public UActorComponent
 	friend class FInventorySwapper;
 	friend class FInventoryValidator;
 	friend class FInventoryWeightCalculator;
+	friend struct FInventoryItemEntry;
+	friend struct FInventoryItemList;
 
 public:
 	UInventoryManager();
@@ -40,7 +42,6 @@ public:
 
 	// Owner-only inventory replication keeps equipment and pickup validation authoritative.
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
-	virtual bool ReplicateSubobjects(UActorChannel* Channel, FOutBunch* Bunch, FReplicationFlags* RepFlags) override;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory|Config")
 	int32 MaxSlots = 60;
@@ -62,10 +63,10 @@ public:
 	float GroundDropForwardDistance = 150.0f;
 
 	/** All items in inventory (slot-based array).
-	 *  OnRep_Items keeps the client UI consistent after server-authoritative changes.
-	 *  COND_OwnerOnly: only the owning client receives the full inventory.
+	 *  Not replicated directly: the server mirrors it into ReplicatedItems and
+	 *  the owning client rebuilds it slot by slot from there.
 	 */
-	UPROPERTY(SaveGame, BlueprintReadOnly, ReplicatedUsing = OnRep_Items, Category = "Inventory")
+	UPROPERTY(SaveGame, BlueprintReadOnly, Category = "Inventory")
 	TArray<UItemInstance*> Items;
 
 	UPROPERTY(BlueprintAssignable, Category = "Inventory|Events")
@@ -77,6 +78,14 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Inventory|Events")
 	FOnInventoryChanged OnInventoryChanged;
 
+	/**
+	 * Slots whose item or stack size changed. Fires just before
+	 * OnInventoryChanged on the server and on the owning client, so UI can
+	 * refresh only the touched cells.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "Inventory|Events")
+	FOnInventorySlotsChanged OnInventorySlotsChanged;
+
 	UPROPERTY(BlueprintAssignable, Category = "Inventory|Events")
 	FOnWeightChanged OnWeightChanged;
 
@@ -99,8 +108,8 @@ public:
 	 * Move/swap two slots.
 	 *
 	 * Safe to call from client UI: when the caller has no authority this
-	 * forwards to the server and returns false (the change arrives via
-	 * OnRep_Items). Mirrors how UEquipmentManager::EquipItem behaves.
+	 * forwards to the server and returns false (the change arrives through
+	 * OnInventorySlotsChanged). Mirrors how UEquipmentManager::EquipItem behaves.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	bool SwapItems(int32 SlotA, int32 SlotB);
@@ -230,8 +239,29 @@ private:
 
 	void BroadcastInventoryChanged();
 
+	/** Server: diffs Items into ReplicatedItems and keeps the subobject list in step. */
+	void SyncReplicatedItems();
+
+	/** Owning client: fast-array callbacks write each entry back into Items. */
+	void HandleReplicatedSlot(int32 SlotIndex, UItemInstance* Item);
+	void FlushReplicatedSlots();
+
 	UItemInstance* FindStackableItem(UItemInstance* Item) const;
 
+	/** The only way helpers write a slot, so InventoryIndex never lags Items. */
+	void SetSlotItem(int32 SlotIndex, UItemInstance* Item);
+
+	/** Re-reads an item's weight and quantity after an in-place stack change. */
+	void RefreshItemIndex(UItemInstance* Item);
+
+	/** Full re-index after bulk writes to Items (sort, compact, clear, BeginPlay). */
+	void RebuildInventoryIndex();
+
+	/** Debug consistency check; rebuilds the index when it disagrees with Items. */
+	void VerifyInventoryIndex(const TCHAR* Context);
+
+	TArray<UItemInstance*> GatherIndexedItems(const TArray<int32>* SlotIndices) const;
+
 	bool HasInventoryWriteAuthority(const TCHAR* FunctionName) const;
 
 	/** True when this instance may mutate the inventory directly. */
@@ -249,9 +279,15 @@ private:
 	UFUNCTION(Server, Reliable)
 	void ServerDropItemToGround(UItemInstance* Item);
 
-	/** Called on owning client when Items array replicates from server.
-	 *  Rebroadcasts OnInventoryChanged and OnWeightChanged so UI stays in sync. */
-	UFUNCTION()
-	void OnRep_Items();
+	/** COND_OwnerOnly: only the owning client receives the inventory. */
+	UPROPERTY(Replicated)
+	FInventoryItemList ReplicatedItems;
+
+	/** Client slots touched by the current bunch, flushed in PostReplicatedReceive. */
+	TArray<int32> PendingReplicatedSlots;
+
+	// OPT-INVENTORYINDEX: running count/weight, free-slot bitset and
+	// BaseID/type/rarity buckets, maintained on every slot write.
+	FInventoryIndex InventoryIndex;
 };
 
@@ -0,0 +1,85 @@
+// Running inventory aggregates and lookup indexes over UInventoryManager::Items.
+// Plain C++, no USTRUCT: derived data rebuilt from Items on load, never saved
+// or replicated. The owning manager updates it on every slot write, so
+// count/weight/free-slot queries are O(1) and searches are O(matches).
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Item/Library/Enums/ItemEnums.h"
+
+class UItemInstance;
+
+class ALS_PROJECTHUNTER_API FInventoryIndex
+{
+public:
+	/** Drops everything and re-indexes every slot. Used after bulk writes (sort, compact, clear). */
+	void Rebuild(const TArray<UItemInstance*>& Slots, int32 MaxSlots);
+
+	/**
+	 * Records that SlotIndex now holds Item (nullptr for empty). Reads the item's
+	 * current weight, quantity and keys, so it also refreshes a slot whose item
+	 * changed in place (stack size, weight).
+	 */
+	void SetSlot(int32 SlotIndex, UItemInstance* Item);
+
+	/** SetSlot on whichever slot holds Item. No-op for items not in the index. */
+	void RefreshItem(UItemInstance* Item);
+
+	int32 GetItemCount() const { return ItemCount; }
+	float GetTotalWeight() const { return ItemCount > 0 ? static_cast<float>(TotalWeight) : 0.f; }
+
+	/** First empty slot below MaxSlots, or INDEX_NONE. */
+	int32 FindFirstEmptySlot(int32 MaxSlots) const;
+
+	int32 FindSlotForItem(const UItemInstance* Item) const;
+	bool HasItemWithID(const FGuid& UniqueID) const { return UniqueIDCounts.Contains(UniqueID); }
+
+	// Slot indexes in ascending order, or nullptr when nothing matches.
+	const TArray<int32>* FindSlotsByBaseID(FName BaseItemID) const { return SlotsByBaseID.Find(BaseItemID); }
+	const TArray<int32>* FindSlotsByType(EItemType ItemType) const { return SlotsByType.Find(ItemType); }
+	const TArray<int32>* FindSlotsByRarity(EItemRarity Rarity) const { return SlotsByRarity.Find(Rarity); }
+
+	int32 GetTotalQuantityOfItem(FName BaseItemID) const;
+
+	/**
+	 * Compares every aggregate and index against a fresh scan of Slots.
+	 * Returns false and describes the first mismatch in OutError.
+	 */
+	bool Verify(const TArray<UItemInstance*>& Slots, int32 MaxSlots, FString& OutError) const;
+
+private:
+	/** Keys captured when the item entered the slot, so removal never depends on the item's current state. */
+	struct FSlotRecord
+	{
+		UItemInstance* Item = nullptr;
+		float Weight = 0.f;
+		int32 Quantity = 0;
+		FName BaseItemID;
+		EItemType ItemType = EItemType::IT_None;
+		EItemRarity Rarity = EItemRarity::IR_None;
+		FGuid UniqueID;
+	};
+
+	void Reset(int32 SlotCount);
+	void RemoveRecord(int32 SlotIndex);
+	void AddRecord(int32 SlotIndex, UItemInstance* Item);
+
+	TArray<FSlotRecord> Records;
+
+	/** Set bit = occupied. Sized to the slot array, so free-slot search is a word scan. */
+	TBitArray<> OccupiedSlots;
+
+	TMap<const UItemInstance*, int32> SlotByItem;
+
+	/** Count per ID rather than a slot: split stacks may share an ID. */
+	TMap<FGuid, int32> UniqueIDCounts;
+
+	TMap<FName, TArray<int32>> SlotsByBaseID;
+	TMap<EItemType, TArray<int32>> SlotsByType;
+	TMap<EItemRarity, TArray<int32>> SlotsByRarity;
+
+	int32 ItemCount = 0;
+
+	/** Double so thousands of add/remove deltas do not drift. */
+	double TotalWeight = 0.0;
+};
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "InventoryStructs.generated.h"
+
+class UInventoryManager;
+class UItemInstance;
+
+/**
+ * One occupied inventory slot on the wire. Empty slots have no entry, and an
+ * entry keeps its SlotIndex for life: emptying the slot removes the entry.
+ */
+USTRUCT(BlueprintType)
+struct ALS_PROJECTHUNTER_API FInventoryItemEntry : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Inventory")
+	int32 SlotIndex = INDEX_NONE;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Inventory")
+	TObjectPtr<UItemInstance> Item = nullptr;
+
+	/**
+	 * Mirror of Item->Quantity. The item's own properties replicate through its
+	 * subobject, but a stack change must also dirty the entry so the owning
+	 * client refreshes that slot.
+	 */
+	UPROPERTY()
+	int32 Quantity = 0;
+
+	void PreReplicatedRemove(const struct FInventoryItemList& InArraySerializer);
+	void PostReplicatedAdd(const struct FInventoryItemList& InArraySerializer);
+	void PostReplicatedChange(const struct FInventoryItemList& InArraySerializer);
+};
+
+/**
+ * OPT-INVENTORYREP: delta-replicated view of UInventoryManager::Items.
+ *
+ * The server diffs the slot array into entries after every mutation, so a
+ * move touches two entries and a stack change one, instead of the whole
+ * array. The owning client writes each entry back into its own slot array
+ * and reports the touched slots once per bunch.
+ */
+USTRUCT()
+struct ALS_PROJECTHUNTER_API FInventoryItemList : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FInventoryItemEntry> Entries;
+
+	/** Not replicated. Set by the owning manager so client callbacks can reach it. */
+	UPROPERTY(NotReplicated)
+	TObjectPtr<UInventoryManager> OwnerComponent = nullptr;
+
+	/**
+	 * Server side. Brings Entries in line with Slots, marking only the entries
+	 * that changed. Appends every touched slot to OutChangedSlots, items that
+	 * entered an entry to OutAddedItems and items that left one to OutRemovedItems.
+	 */
+	void SyncFromSlots(
+		const TArray<UItemInstance*>& Slots,
+		TArray<int32>& OutChangedSlots,
+		TArray<UItemInstance*>& OutAddedItems,
+		TArray<UItemInstance*>& OutRemovedItems);
+
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FInventoryItemEntry, FInventoryItemList>(
+			Entries, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FInventoryItemList> : public TStructOpsTypeTraitsBase2<FInventoryItemList>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
@@ -6,6 +6,8 @@
 #include "Item/Library/Enums/AffixEnums.h"
 #include "AffixGenerator.generated.h"
 
+struct FAffixSampler;
+
 USTRUCT(BlueprintType)
 struct ALS_PROJECTHUNTER_API FAffixGenerator
 {
@@ -25,6 +27,17 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Affix Generator")
 	int32 DefaultAffixWeight = 100;
 
+	/** Version used for new items. Older versions stay selectable so saved seeds reproduce. */
+	static constexpr EAffixRollVersion LatestRollVersion = EAffixRollVersion::ARV_Alias;
+
+	/**
+	 * Weighted pick algorithm. Cumulative reproduces items rolled before the
+	 * alias table; set this from UItemInstance::AffixRollVersion when
+	 * regenerating an existing item from its Seed.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Affix Generator")
+	EAffixRollVersion RollVersion = LatestRollVersion;
+
 	FPHItemStats GenerateAffixes(
 		const FItemBase& BaseItem,
 		int32 ItemLevel,
@@ -42,6 +55,12 @@ public:
 
 	UDataTable* GetAffixDataTable(EAffixes AffixType) const;
 
+	/**
+	 * Resolves the default prefix and suffix tables on the calling thread. Once done,
+	 * GenerateAffixes on this generator never loads and can run on worker threads.
+	 */
+	void PreloadDefaultTables() const;
+
 	// Items can only hold one enchant at a time; a successful roll replaces the current enchant.
 	bool ApplyEnchant(
 		const FItemBase& BaseItem,
@@ -51,17 +70,27 @@ public:
 
 private:
 	TArray<FPHAttributeData> RollAffixesWithCorruption(
-		const TArray<FPHAttributeData*>& SourceAffixes,
+		const FItemBase& BaseItem,
+		UDataTable* ConfiguredTable,
 		EAffixes AffixType,
 		int32 Count,
 		int32 ItemLevel,
-		EItemType ItemType,
-		EItemSubType ItemSubType,
 		float CorruptionChance,
 		bool bMustRollOneCorrupted,
 		bool& bOutHasRolledCorrupted,
 		FRandomStream& RandStream) const;
 
+	/**
+	 * Cached sampler for one pool. ConfiguredTable is the per-item override
+	 * (filtered to AffixType); null falls back to the generator's default table.
+	 */
+	TSharedRef<const FAffixSampler> FindAffixSampler(
+		const FItemBase& BaseItem,
+		UDataTable* ConfiguredTable,
+		EAffixes AffixType,
+		int32 ItemLevel,
+		bool bCorrupted) const;
+
 	mutable UDataTable* CachedPrefixTable = nullptr;
 
 	mutable UDataTable* CachedSuffixTable = nullptr;
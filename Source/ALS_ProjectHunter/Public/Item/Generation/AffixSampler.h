@@ -0,0 +1,105 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+#include "UObject/ObjectKey.h"
+#include "Item/Library/Enums/AffixEnums.h"
+#include "Item/Library/Enums/ItemEnums.h"
+
+struct FPHAttributeData;
+class UDataTable;
+
+/**
+ * FAffixSampler
+ *
+ * One pre-filtered affix pool (item type, subtype, level and corruption
+ * already applied) with a Vose alias table over its weights. A pick is O(1)
+ * after the one-time build. Pool keeps source-table order so the cumulative
+ * scan produces the same result as the original per-roll pool rebuild.
+ */
+struct ALS_PROJECTHUNTER_API FAffixSampler
+{
+	TArray<FPHAttributeData*> Pool;
+	TArray<float> Probability;
+	TArray<int32> Alias;
+	int64 TotalWeight = 0;
+
+	void Build(TArray<FPHAttributeData*>&& InPool);
+
+	bool IsEmpty() const { return Pool.IsEmpty(); }
+
+	/**
+	 * Weighted pick that skips excluded names and groups. Alias picks reject
+	 * excluded entries a few times, then fall back to a scan over the masked
+	 * pool so heavy exclusion never loops.
+	 */
+	const FPHAttributeData* Select(
+		EAffixRollVersion Version,
+		FRandomStream& RandStream,
+		const TSet<FName>& ExcludeAffixes,
+		const TSet<FName>& ExcludeGroups) const;
+
+private:
+	static bool IsExcluded(const FPHAttributeData& Affix, const TSet<FName>& ExcludeAffixes, const TSet<FName>& ExcludeGroups);
+
+	const FPHAttributeData* SelectFromMaskedPool(
+		FRandomStream& RandStream,
+		const TSet<FName>& ExcludeAffixes,
+		const TSet<FName>& ExcludeGroups) const;
+};
+
+/**
+ * Process-wide cache of FAffixSampler keyed by (source table, pool, item type,
+ * subtype, item level, corruption). Safe to query from worker threads; built
+ * samplers are immutable and shared.
+ */
+class ALS_PROJECTHUNTER_API FAffixSamplerCache
+{
+public:
+	struct FKey
+	{
+		TObjectKey<UDataTable> Table;
+		EAffixes PoolType = EAffixes::AF_None;
+		/** Rows were filtered to PoolType-compatible affixes (per-item configured tables). */
+		bool bPoolTypeChecked = false;
+		EItemType ItemType = EItemType::IT_None;
+		EItemSubType ItemSubType = EItemSubType::IST_None;
+		int32 ItemLevel = 0;
+		bool bCorrupted = false;
+
+		bool operator==(const FKey& Other) const
+		{
+			return Table == Other.Table
+				&& PoolType == Other.PoolType
+				&& bPoolTypeChecked == Other.bPoolTypeChecked
+				&& ItemType == Other.ItemType
+				&& ItemSubType == Other.ItemSubType
+				&& ItemLevel == Other.ItemLevel
+				&& bCorrupted == Other.bCorrupted;
+		}
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			uint32 Hash = GetTypeHash(Key.Table);
+			Hash = HashCombineFast(Hash, static_cast<uint32>(Key.PoolType));
+			Hash = HashCombineFast(Hash, static_cast<uint32>(Key.bPoolTypeChecked));
+			Hash = HashCombineFast(Hash, static_cast<uint32>(Key.ItemType));
+			Hash = HashCombineFast(Hash, static_cast<uint32>(Key.ItemSubType));
+			Hash = HashCombineFast(Hash, static_cast<uint32>(Key.ItemLevel));
+			return HashCombineFast(Hash, static_cast<uint32>(Key.bCorrupted));
+		}
+	};
+
+	/**
+	 * Returns the sampler for Key, building it on first use by filtering the
+	 * rows returned by GetSourceRows. Never returns null.
+	 */
+	static TSharedRef<const FAffixSampler> FindOrBuild(
+		const FKey& Key,
+		TFunctionRef<TArray<FPHAttributeData*>()> GetSourceRows);
+
+	/** Drop every cached sampler; called when a source table changes. */
+	static void Reset();
+
+	static int32 Num();
+};
@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "Item/Library/Enums/ItemEnums.h"
+#include "Item/Library/Enums/AffixEnums.h"
 #include "Item/Library/Structs/ItemStructs.h"
 #include "GameplayEffectTypes.h"
 #include "ItemInstance.generated.h"
@@ -11,6 +12,8 @@ class UAbilitySystemComponent;
 class UStaticMesh;
 class USkeletalMesh;
 class UTexture2D;
+struct FCompactItemRecord;
+struct FItemTooltipData;
 
 /**
  * Runtime Item Instance
@@ -25,6 +28,7 @@ public:
 
 	virtual bool IsSupportedForNetworking() const override { return true; }
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void PostRepNotifies() override;
 
 	/**
 	 * Migrate this item from an older serialization version to ITEM_CURRENT_VERSION.
@@ -55,6 +59,22 @@ public:
 	UPROPERTY(SaveGame, BlueprintReadOnly, Replicated, Category = "Item")
 	int32 Seed;
 
+	/**
+	 * Affix pick algorithm this item was rolled with. Defaults to Cumulative so
+	 * saves written before the field existed load as the original algorithm.
+	 */
+	UPROPERTY(SaveGame, BlueprintReadOnly, Category = "Item")
+	EAffixRollVersion AffixRollVersion = EAffixRollVersion::ARV_Cumulative;
+
+	/**
+	 * OPT-COMPACTITEM: Roll inputs of the last initialization that are not
+	 * otherwise kept on the item, so an untouched item can fold back into an
+	 * FCompactItemRecord. Not saved; loaded items are never folded.
+	 */
+	float GenerationCorruptionChance = 0.0f;
+	bool bGenerationRolledAffixes = false;
+	bool bGenerationForcedCorrupted = false;
+
 
 	/**
 	 * Schema version for save-data migration.
@@ -187,6 +207,13 @@ public:
 	UPROPERTY(Transient)
 	mutable bool bCacheDirty = true;
 
+	/**
+	 * OPT-TOOLTIPCACHE: Tooltip model built by UItemTooltipFunctionLibrary.
+	 * Valid while CachedTooltipRevision matches GetRevision().
+	 */
+	mutable TSharedPtr<const FItemTooltipData> CachedTooltipData;
+	mutable int32 CachedTooltipRevision = INDEX_NONE;
+
 
 	/**
 	 * Initialize item instance (NO corruption)
@@ -223,6 +250,31 @@ public:
 		float CorruptionChance,
 		bool bForceCorrupted);
 
+	/**
+	 * InitializeWithCorruption with the affixes already rolled, e.g. by a batched loot
+	 * pass on worker threads. PreRolledAffixes must come from FAffixGenerator::GenerateAffixes
+	 * at LatestRollVersion with this item's Seed so the item still reproduces from it.
+	 */
+	void InitializeWithPreRolledAffixes(
+		FDataTableRowHandle InBaseItemHandle,
+		int32 InItemLevel,
+		EItemRarity InRarity,
+		const FPHItemStats& PreRolledAffixes);
+
+	/**
+	 * OPT-COMPACTITEM: Rebuild the item a compact record describes, through the
+	 * record's regeneration path and affix roll version. Use
+	 * FCompactItemRecord::Materialize rather than calling this directly.
+	 */
+	void InitializeFromCompactRecord(const FCompactItemRecord& Record, const FPHItemStats* PreRolledAffixes = nullptr);
+
+	/**
+	 * True while the revision has not moved since Initialize, InitializeWithCorruption
+	 * or InitializeFromCompactRecord. Relies on direct property edits calling
+	 * BumpRevision, as the tooltip cache already does.
+	 */
+	bool IsUnmodifiedSinceGeneration() const { return GenerationRevision == Revision; }
+
 
 	/**
 	 * Get display name (generates if not cached)
@@ -340,7 +392,21 @@ public:
 	 * @param InQuantity - Stack count
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Item")
-	void SetQuantity(const int32 InQuantity) { Quantity = InQuantity; };
+	void SetQuantity(const int32 InQuantity) { Quantity = InQuantity; BumpRevision(); };
+
+	/**
+	 * Local change counter for anything a tooltip or slot shows. Bumped by the
+	 * mutators on this class and after replicated updates; not replicated.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Item")
+	int32 GetRevision() const { return Revision; }
+
+	/**
+	 * Call after editing display-relevant properties directly (reinforcement,
+	 * rune crafting, affix edits from Blueprint) so cached tooltips rebuild.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Item")
+	void BumpRevision() { ++Revision; }
 
 	/**
 	 * Reduce remaining uses
@@ -453,11 +519,11 @@ public:
 
 	/** Reduce durability by amount */
 	UFUNCTION(BlueprintCallable, Category = "Item|Durability")
-	void ReduceDurability(float Amount) { Durability.Reduce(Amount); }
+	void ReduceDurability(float Amount) { Durability.Reduce(Amount); BumpRevision(); }
 
 	/** Repair item to full durability */
 	UFUNCTION(BlueprintCallable, Category = "Item|Durability")
-	void RepairToFull() { Durability.RepairFull(); }
+	void RepairToFull() { Durability.RepairFull(); BumpRevision(); }
 
 	/** Get durability as percentage (0.0 to 1.0) */
 	UFUNCTION(BlueprintPure, Category = "Item|Durability")
@@ -548,6 +614,11 @@ public:
 
 
 private:
+	int32 Revision = 0;
+
+	/** Revision right after the last generation, or INDEX_NONE if the item was never generated here. */
+	int32 GenerationRevision = INDEX_NONE;
+
 	/** Generate rare/legendary name for high-grade items */
 	FText GenerateRareName() const;
 
@@ -261,3 +261,14 @@ enum class EAttributeDisplayFormat : uint8
 	ADF_SkillGrant     UMETA(DisplayName = "Skill Grant (Grants [Skill] Level X)"),
 	ADF_CustomText     UMETA(DisplayName = "Custom Text"),
 };
+
+/**
+ * How random affixes are picked from a weighted pool. Items record the
+ * version they were rolled with so regenerating from Seed reproduces them.
+ */
+UENUM(BlueprintType)
+enum class EAffixRollVersion : uint8
+{
+	ARV_Cumulative  UMETA(DisplayName = "Cumulative Scan"),  // Original linear weight scan
+	ARV_Alias       UMETA(DisplayName = "Alias Table")       // O(1) Vose alias sampling
+};
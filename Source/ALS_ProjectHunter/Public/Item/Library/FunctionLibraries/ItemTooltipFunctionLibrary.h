@@ -18,4 +18,11 @@ public:
 
 	UFUNCTION(BlueprintPure, Category = "Item|Tooltip")
 	static FItemTooltipData GetItemTooltipData(UItemInstance* Item);
+
+	/**
+	 * OPT-TOOLTIPCACHE: BuildItemTooltipData, cached on the item. Rebuilds only
+	 * when the item's revision moved since the last build. Null when the item
+	 * has no base data.
+	 */
+	static TSharedPtr<const FItemTooltipData> GetCachedItemTooltipData(UItemInstance* Item);
 };
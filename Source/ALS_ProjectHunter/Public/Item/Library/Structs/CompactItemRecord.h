@@ -0,0 +1,136 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataTable.h"
+#include "Item/Library/Enums/AffixEnums.h"
+#include "Item/Library/Enums/ItemEnums.h"
+#include "CompactItemRecord.generated.h"
+
+class UItemInstance;
+struct FItemBase;
+struct FPHItemStats;
+
+/**
+ * FCompactItemRecord
+ *
+ * OPT-COMPACTITEM: The generation inputs of an item that nobody has touched
+ * yet: base row, seed, level, rarity, corruption roll parameters, quantity and
+ * identity. Affixes, stats, durability and the display name all follow from
+ * these, so ground items, deferred loot batches and stash tabs can hold this
+ * instead of a UItemInstance and only build the object when the item is
+ * inspected, picked up or equipped.
+ *
+ * RecordVersion selects the regeneration path and AffixRollVersion the affix
+ * sampler, so a record keeps producing the same item after either changes.
+ */
+USTRUCT(BlueprintType)
+struct ALS_PROJECTHUNTER_API FCompactItemRecord
+{
+	GENERATED_BODY()
+
+	/** Bump when Materialize would produce a different item from the same fields, and keep the old branch. */
+	static constexpr uint8 CurrentVersion = 1;
+
+	UPROPERTY(BlueprintReadOnly, SaveGame, Category = "Item")
+	FDataTableRowHandle BaseItemHandle;
+
+	UPROPERTY(BlueprintReadOnly, SaveGame, Category = "Item")
+	FGuid UniqueID;
+
+	UPROPERTY(BlueprintReadOnly, SaveGame, Category = "Item")
+	int32 Seed = 0;
+
+	UPROPERTY(BlueprintReadOnly, SaveGame, Category = "Item")
+	float CorruptionChance = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, SaveGame, Category = "Item")
+	int32 Quantity = 1;
+
+	UPROPERTY(BlueprintReadOnly, SaveGame, Category = "Item")
+	uint8 ItemLevel = 1;
+
+	/** IR_None resolves to the base item's rarity, exactly as in item initialization. */
+	UPROPERTY(BlueprintReadOnly, SaveGame, Category = "Item")
+	EItemRarity Rarity = EItemRarity::IR_None;
+
+	UPROPERTY(BlueprintReadOnly, SaveGame, Category = "Item")
+	EAffixRollVersion AffixRollVersion = EAffixRollVersion::ARV_Cumulative;
+
+	/** 0 for an empty record. */
+	UPROPERTY(BlueprintReadOnly, SaveGame, Category = "Item")
+	uint8 RecordVersion = 0;
+
+	UPROPERTY(BlueprintReadOnly, SaveGame, Category = "Item")
+	uint8 bGenerateAffixes : 1;
+
+	UPROPERTY(BlueprintReadOnly, SaveGame, Category = "Item")
+	uint8 bForceCorrupted : 1;
+
+	FCompactItemRecord()
+		: bGenerateAffixes(true)
+		, bForceCorrupted(false)
+	{}
+
+	/**
+	 * Record for a freshly rolled item, rolled with the current affix sampler.
+	 * A zero InSeed picks a random one, like UItemInstance::SetSeed.
+	 */
+	static FCompactItemRecord Make(const FDataTableRowHandle& InBaseItemHandle, int32 InItemLevel,
+		EItemRarity InRarity, int32 InSeed, bool bInGenerateAffixes = true,
+		float InCorruptionChance = 0.0f, bool bInForceCorrupted = false, int32 InQuantity = 1);
+
+	/**
+	 * Fold Item back into a record. Fails unless the item came from a generation
+	 * path that records its inputs and nothing has changed it since (see
+	 * UItemInstance::IsUnmodifiedSinceGeneration).
+	 */
+	static bool TryMakeFromItem(const UItemInstance& Item, FCompactItemRecord& OutRecord);
+
+	bool IsValid() const { return RecordVersion != 0 && !BaseItemHandle.IsNull(); }
+
+	/** Base row without building the item, e.g. for the ground mesh. */
+	const FItemBase* GetBaseData() const;
+
+	/**
+	 * Build the UItemInstance this record describes. PreRolledAffixes, if set,
+	 * must come from FAffixGenerator::GenerateAffixes with this record's inputs
+	 * (see FLootGenerator::PreRollAffixes). Returns nullptr for an empty record
+	 * or one written by a newer build. Game thread only.
+	 */
+	UItemInstance* Materialize(UObject* Outer, const FPHItemStats* PreRolledAffixes = nullptr) const;
+};
+
+// Memory held by ItemCount rolled items as UItemInstance objects versus compact records
+USTRUCT(BlueprintType)
+struct ALS_PROJECTHUNTER_API FCompactItemMemoryBenchmarkResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 ItemCount = 0;
+
+	/** Items that folded into a record; the rest would stay materialized. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 RecordCount = 0;
+
+	/** Objects plus everything they allocate (affix arrays, names, cached text), as counted by FArchiveCountMem. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int64 ItemInstanceBytes = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int64 CompactRecordBytes = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double CreateItemsMilliseconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double CreateRecordsMilliseconds = 0.0;
+
+	/** Rebuilding every record into an item, i.e. the worst case of picking all of them up. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double MaterializeMilliseconds = 0.0;
+
+	/** Every materialized item matched the original's affixes, values and identity. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	bool bResultsMatch = true;
+};
@@ -6,9 +6,36 @@
 
 class UItemInstance;
 class UObject;
+struct FAffixGenerator;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogLootGenerator, Log, All);
 
+/** One drop decided by FLootGenerator::RollLoot. Plain data, so it can be built off the game thread. */
+struct FLootItemRoll
+{
+	/** Index into FLootRollBatch::Entries. */
+	int32 EntryIndex = INDEX_NONE;
+
+	int32 Quantity = 1;
+	int32 ItemLevel = 1;
+	EItemRarity Rarity = EItemRarity::IR_None;
+	int32 ItemSeed = 0;
+	float CorruptionChance = 0.0f;
+	bool bForceCorrupted = false;
+
+	/** Filled by FLootGenerator::PreRollAffixes; ignored unless bAffixesGenerated is set. */
+	FPHItemStats PreRolledAffixes;
+};
+
+/** Every roll from one loot table pass, before any UItemInstance exists. */
+struct FLootRollBatch
+{
+	/** Filtered entries the rolls index into. */
+	TArray<FLootEntry> Entries;
+	TArray<FLootItemRoll> Rolls;
+	int32 Seed = 0;
+};
+
 USTRUCT(BlueprintType)
 struct ALS_PROJECTHUNTER_API FLootGenerator
 {
@@ -40,6 +67,33 @@ public:
 		int32 Seed,
 		UObject* Outer) const;
 
+	/**
+	 * Selection, quantity, level, rarity and item seeds for one table pass. Touches no
+	 * UObjects, so it is safe on worker threads. Consumes the stream exactly like GenerateLoot.
+	 */
+	void RollLoot(
+		const FLootTable& LootTable,
+		const FLootDropSettings& Settings,
+		int32 Seed,
+		FLootRollBatch& OutRolls) const;
+
+	/**
+	 * Rolls equipment affixes for every roll in the batch from its item seed. Safe on
+	 * worker threads once AffixGenerator.PreloadDefaultTables() has run on the game thread.
+	 */
+	void PreRollAffixes(FLootRollBatch& Rolls, const FAffixGenerator& AffixGenerator) const;
+
+	/** Creates the item instances for a rolled batch. Game thread only. */
+	FLootResultBatch CreateItemsFromRolls(const FLootRollBatch& Rolls, UObject* Outer) const;
+
+	/**
+	 * OPT-COMPACTITEM: CreateItemsFromRolls without the item instances. Each result
+	 * holds an FCompactItemRecord that builds the same item on demand, so neither
+	 * PreRollAffixes nor any UObject work is needed up front. Entries without an
+	 * item row still get an instance, created with Outer.
+	 */
+	FLootResultBatch CreateRecordsFromRolls(const FLootRollBatch& Rolls, UObject* Outer) const;
+
 	FLootResult CreateItemFromEntry(
 		const FLootEntry& Entry,
 		const FLootDropSettings& Settings,
@@ -64,14 +118,17 @@ public:
 	static const FLootTable* GetLootTableFromHandle(const FDataTableRowHandle& Handle);
 
 private:
-	UItemInstance* CreateItemInstance(
+	FLootItemRoll RollItem(
 		const FLootEntry& Entry,
-		int32 ItemLevel,
-		EItemRarity Rarity,
-		float CorruptionChance,
-		bool bForceCorrupted,
-		int32 Seed,
+		const FLootDropSettings& Settings,
+		FRandomStream& RandStream) const;
+
+	FLootResult CreateItemFromRoll(
+		const FLootEntry& Entry,
+		const FLootItemRoll& Roll,
 		UObject* Outer) const;
+
+	static FCompactItemRecord MakeRecordFromRoll(const FLootEntry& Entry, const FLootItemRoll& Roll);
 };
 
 FORCEINLINE const FLootTable* FLootGenerator::GetLootTableFromHandle(const FDataTableRowHandle& Handle)
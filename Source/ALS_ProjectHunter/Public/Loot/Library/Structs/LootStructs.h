@@ -5,6 +5,7 @@
 #include "Loot/Library/Enums/LootEnums.h"
 #include "Engine/DataTable.h"
 #include "Item/ItemInstance.h"
+#include "Item/Library/Structs/CompactItemRecord.h"
 #include "Item/Library/Structs/ItemStructs.h"
 #include "Item/Library/Enums/ItemEnums.h"
 #include "LootStructs.generated.h"
@@ -469,10 +470,17 @@ struct FLootResult
 {
 	GENERATED_BODY()
 
-	/** Generated item instance */
+	/** Generated item instance. Null for deferred drops until MaterializeItem is called. */
 	UPROPERTY(BlueprintReadOnly, Category = "Result")
 	TObjectPtr<UItemInstance> Item = nullptr;
 
+	/**
+	 * OPT-COMPACTITEM: Set instead of Item when the batch was generated with
+	 * deferred item creation (see FLootGenerator::CreateRecordsFromRolls).
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Result")
+	FCompactItemRecord Record;
+
 	/** Quantity of this item */
 	UPROPERTY(BlueprintReadOnly, Category = "Result")
 	int32 Quantity = 1;
@@ -481,7 +489,7 @@ struct FLootResult
 	UPROPERTY(BlueprintReadOnly, Category = "Debug")
 	int32 SourceEntryIndex = -1;
 
-	/** Was this item corrupted during generation? */
+	/** Was this item corrupted during generation? For deferred drops only forced corruption is known. */
 	UPROPERTY(BlueprintReadOnly, Category = "Result")
 	bool bWasCorrupted = false;
 
@@ -499,7 +507,17 @@ struct FLootResult
 		, bWasCorrupted(bCorrupted)
 	{}
 
-	bool IsValid() const { return Item.Get() != nullptr && Quantity > 0; }
+	bool IsValid() const { return (Item.Get() != nullptr || Record.IsValid()) && Quantity > 0; }
+
+	/** Item, building it from Record first if this is a deferred drop. */
+	UItemInstance* MaterializeItem(UObject* Outer)
+	{
+		if (!Item && Record.IsValid())
+		{
+			Item = Record.Materialize(Outer);
+		}
+		return Item;
+	}
 };
 
 /**
@@ -654,6 +672,51 @@ struct FLootRequest
 };
 
 
+/**
+ * FLootBatchStats - Counts and per-stage wall times for one ULootSubsystem::GenerateLootBatch call
+ */
+USTRUCT(BlueprintType)
+struct FLootBatchStats
+{
+	GENERATED_BODY()
+
+	/** Requests passed in */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 RequestCount = 0;
+
+	/** Distinct sources resolved (registry row + loot table) */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 SourceCount = 0;
+
+	/** Drops created, as item instances or as compact records when deferred */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 ItemCount = 0;
+
+	/** Items committed to the ground */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 SpawnedCount = 0;
+
+	/** Registry lookups, table loads and settings */
+	UPROPERTY(BlueprintReadOnly, Category = "Timing", meta = (Units = "ms"))
+	float ResolveMs = 0.0f;
+
+	/** Selection, rarity, affix and corruption rolls (worker threads) */
+	UPROPERTY(BlueprintReadOnly, Category = "Timing", meta = (Units = "ms"))
+	float RollMs = 0.0f;
+
+	/** Item instance or record creation and OnLootGenerated broadcasts */
+	UPROPERTY(BlueprintReadOnly, Category = "Timing", meta = (Units = "ms"))
+	float CreateMs = 0.0f;
+
+	/** Ground item commit and OnLootSpawned broadcasts */
+	UPROPERTY(BlueprintReadOnly, Category = "Timing", meta = (Units = "ms"))
+	float SpawnMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Timing", meta = (Units = "ms"))
+	float TotalMs = 0.0f;
+};
+
+
 /**
  * FLootSpawnSettings - Controls how loot is spawned in world
  */
@@ -14,6 +14,7 @@ class UItemInstance;
 DECLARE_LOG_CATEGORY_EXTERN(LogLootSubsystem, Log, All);
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLootGeneratedDelegate, const FLootResultBatch&, Results, FName, SourceID);
+/** Item is null for drops spawned as compact records; UGroundItemSubsystem::GetItemByID(GroundItemID) builds it. */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnLootSpawnedDelegate, UItemInstance*, Item, FVector, Location, int32, GroundItemID);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLootTableLoadedDelegate, FName, SourceID, bool, bSuccess);
 
@@ -33,6 +34,21 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Loot|Config")
 	float GlobalDropChanceMultiplier = 1.0f;
 
+	/** Batches with fewer requests than this roll on the calling thread instead of ParallelFor. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Loot|Config", meta = (ClampMin = "1"))
+	int32 BatchParallelThreshold = 8;
+
+	/**
+	 * OPT-COMPACTITEM: GenerateAndSpawnLootBatch puts drops on the ground as
+	 * FCompactItemRecords and skips item creation and affix rolls entirely; an
+	 * item is only built when a player looks at or picks up that drop.
+	 *
+	 * Opt-in: results then carry Record instead of Item, and OnLootSpawned
+	 * fires without an item, so enable it only once listeners read the record.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Loot|Config")
+	bool bDeferBatchItemCreation = false;
+
 	UPROPERTY(BlueprintAssignable, Category = "Loot|Events")
 	FOnLootGeneratedDelegate OnLootGenerated;
 
@@ -48,6 +64,25 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Loot|Generation")
 	FLootResultBatch GenerateAndSpawnLoot(const FLootRequest& Request, FLootSpawnSettings SpawnSettings);
 
+	/**
+	 * GenerateLoot for many requests at once, e.g. every mob from one AoE clear. Each
+	 * distinct source is resolved once and the rolls run across worker threads. Results
+	 * are index-aligned with Requests; failed requests yield an empty batch.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Loot|Generation")
+	TArray<FLootResultBatch> GenerateLootBatch(const TArray<FLootRequest>& Requests, FLootBatchStats& OutStats);
+
+	/**
+	 * GenerateLootBatch plus a single ground item commit for every drop. SpawnSettings
+	 * is either index-aligned with Requests or a single entry shared by all of them.
+	 * See bDeferBatchItemCreation.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Loot|Generation")
+	TArray<FLootResultBatch> GenerateAndSpawnLootBatch(
+		const TArray<FLootRequest>& Requests,
+		const TArray<FLootSpawnSettings>& SpawnSettings,
+		FLootBatchStats& OutStats);
+
 	UFUNCTION(BlueprintCallable, Category = "Loot|Spawning")
 	bool SpawnLootAtLocation(const FLootResultBatch& Batch, FVector Location, float SpreadRadius = 50.0f);
 
@@ -75,6 +110,15 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Loot|Cache")
 	int32 GetCachedTableCount() const { return LootTableCache.Num(); }
 
+	/**
+	 * Roll ItemCount items of BaseItemHandle as UItemInstances, fold them into
+	 * FCompactItemRecords and compare the memory each form holds, then rebuild
+	 * every record and check it matches the original. Does not touch live loot.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Loot|Debug")
+	FCompactItemMemoryBenchmarkResult BenchmarkCompactItemMemory(FDataTableRowHandle BaseItemHandle,
+		int32 ItemCount = 10000, EItemRarity Rarity = EItemRarity::IR_GradeA);
+
 protected:
 	void LoadRegistry();
 	void OnRegistryLoaded();
@@ -83,6 +127,17 @@ protected:
 	bool LoadLootTableAsync(const FLootSourceEntry& Source);
 	bool EnsureGroundItemSubsystem();
 
+	/** Request.Seed, or a time-based seed when it is 0. Salt separates requests in one batch. */
+	static int32 ResolveRequestSeed(const FLootRequest& Request, uint32 Salt = 0);
+
+	/** Settings for Request after global and player modifiers. */
+	FLootDropSettings BuildFinalSettings(const FLootSourceEntry& Source, const FLootRequest& Request) const;
+
+	TArray<FLootResultBatch> GenerateLootBatchInternal(
+		const TArray<FLootRequest>& Requests,
+		const TArray<FLootSpawnSettings>* SpawnSettings,
+		FLootBatchStats& OutStats);
+
 	UPROPERTY()
 	UDataTable* CachedRegistry = nullptr;
 
@@ -5,6 +5,7 @@
 #include "GameplayEffectTypes.h"
 #include "Stats/Debug/StatsDebugManager.h"
 #include "Stats/Library/Enums/StatsEnumLibrary.h"
+#include "Stats/Library/Structs/EquipmentModifierStructs.h"
 #include "StatsManager.generated.h"
 
 class FEquipmentStatsApplier;
@@ -62,6 +63,10 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Stats|Equipment")
 	bool HasEquipmentStatsApplied(UItemInstance* Item) const;
 
+	/** Time, effect changes and GE allocations of the most recent equip, unequip, swap or refresh. */
+	UFUNCTION(BlueprintPure, Category = "Stats|Equipment")
+	const FEquipmentStatsChangeReport& GetLastEquipmentStatsReport() const { return LastEquipmentStatsReport; }
+
 	UFUNCTION(BlueprintCallable, Category = "Stats|Effects")
 	bool ApplyGameplayEffectToSelf(TSubclassOf<UGameplayEffect> EffectClass, float Level = 1.0f);
 
@@ -143,6 +148,10 @@ public:
 	bool ResolveAttributeByName(FName AttributeName, FGameplayAttribute& OutAttribute, FStatInitializationEntry* OutDefinition) const;
 	void GatherStatDefinitions(TArray<FStatInitializationEntry>& OutDefinitions) const;
 
+	/** OPT-ATTRREGISTRY: Resolves per second through reflection vs FHunterAttributeRegistry; logs the result. */
+	UFUNCTION(BlueprintCallable, Category = "Stats|Debug")
+	FStatsAttributeResolveBenchmarkResult BenchmarkAttributeResolve(int32 Iterations = 100000, int32 DefinitionIterations = 200) const;
+
 	UFUNCTION(BlueprintPure, Category = "Stats")
 	TSubclassOf<UAttributeSet> GetSourceAttributeSetClass() const;
 
@@ -174,6 +183,9 @@ protected:
 	void LogAbilitySystemState(const TCHAR* Context, UAbilitySystemComponent* ASC, const UAttributeSet* LiveAttributeSet) const;
 	void LogWarningOnce(const FString& Key, const FString& Message) const;
 
+	/** Hot-path LogWarningOnce: keyed on (Context, Class, Name), MakeMessage only runs the first time. */
+	void LogWarningOnce(FName Context, const UClass* Class, FName Name, TFunctionRef<FString()> MakeMessage) const;
+
 	bool SetNumericAttributeByName(FName AttributeName, float Value, bool bAutoInitializeCurrentFromMax = true);
 	bool TryGetStatValueForInitialization(const UBaseStatsData* InStatsData, const TMap<FName, float>& StatsMap, FName StatName, float& OutValue) const;
 	bool ApplyStatIfPresent(const UBaseStatsData* InStatsData, const TMap<FName, float>& StatsMap, FName StatName, bool bAutoInitializeCurrentFromMax = true);
@@ -192,10 +204,20 @@ protected:
 
 	bool bHasInitializedConfiguredStats = false;
 	mutable TSet<FString> EmittedWarningKeys;
+	mutable TSet<TTuple<FName, TObjectKey<UClass>, FName>> EmittedWarningIds;
 
 	UPROPERTY()
 	TMap<FGuid, FActiveGameplayEffectHandle> ActiveEquipmentEffects;
 
 	UPROPERTY()
 	TMap<FGuid, TObjectPtr<UItemInstance>> ActiveEquipmentItems;
+
+	/** Modifier layer: each equipped item's resolved modifiers, kept so removal subtracts exactly what was added. */
+	TMap<FGuid, TArray<FEquipmentAttributeModifier>> EquipmentModifiers;
+
+	/** Modifier layer: summed modifiers and the active effect per attribute and op. */
+	TMap<FEquipmentModifierChannelKey, FEquipmentModifierChannel> EquipmentChannels;
+
+	UPROPERTY(Transient)
+	FEquipmentStatsChangeReport LastEquipmentStatsReport;
 };
@@ -5,7 +5,8 @@
 
 /**
  * Enum-based attribute selector for UStatsManager::GetAttributeByType().
- *
+ * Each value must be named exactly like its UHunterAttributeSet property;
+ * FHunterAttributeRegistry maps them by name and warns about any that miss.
  */
 UENUM(BlueprintType)
 enum class EHunterAttribute : uint8
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Stats/Library/Structs/EquipmentModifierStructs.h"
 
+class UAbilitySystemComponent;
 class UGameplayEffect;
 class UItemInstance;
 class UStatsManager;
@@ -9,6 +11,16 @@ struct FGameplayAttribute;
 struct FGameplayEffectSpecHandle;
 struct FPHAttributeData;
 
+/**
+ * OPT-EQUIPLAYER: Equipment stats reach the ability system through a modifier
+ * layer. Each item is resolved once into flat modifiers, which are summed per
+ * attribute and op into channels on the UStatsManager; each channel is one
+ * active GE built from a shared template. Equipping, unequipping or swapping
+ * a slot only updates the channels the items touch, in place, so nothing is
+ * allocated and untouched attributes (and their derived-vital MMCs) are not
+ * recalculated. Hunter.Debug.EquipmentPerItemEffects restores one new GE per
+ * item for comparison.
+ */
 class ALS_PROJECTHUNTER_API FEquipmentStatsApplier
 {
 public:
@@ -16,6 +28,27 @@ public:
 	static void RemoveEquipmentStats(UStatsManager& Manager, UItemInstance* Item);
 	static void RefreshEquipmentStats(UStatsManager& Manager);
 	static void HandleEquipmentChanged(UStatsManager& Manager, UItemInstance* NewItem, UItemInstance* OldItem);
+	static bool HasEquipmentStatsApplied(const UStatsManager& Manager, const UItemInstance* Item);
+
+	/** Item's affixes, folded local weapon damage and base weapon/armour stats as flat modifiers. False if none. */
+	static bool BuildEquipmentModifiers(UStatsManager& Manager, UItemInstance* Item, const TArray<FPHAttributeData>& Stats,
+		TArray<FEquipmentAttributeModifier>& OutModifiers);
+
+	/** Per-item path: a new UGameplayEffect carrying every modifier of Item. */
 	static FGameplayEffectSpecHandle CreateEquipmentEffect(UStatsManager& Manager, UItemInstance* Item, const TArray<FPHAttributeData>& Stats);
 	static bool ApplyStatModifier(UGameplayEffect* Effect, const FPHAttributeData& Stat, const FGameplayAttribute& Attribute);
+	static bool ResolveStatModifier(const FPHAttributeData& Stat, const FGameplayAttribute& Attribute, FEquipmentAttributeModifier& OutModifier);
+
+private:
+	static bool AddItem(UStatsManager& Manager, UAbilitySystemComponent& ASC, UItemInstance& Item,
+		TSet<FEquipmentModifierChannelKey>& DirtyChannels, FEquipmentStatsChangeReport& Report);
+	static void RemoveItem(UStatsManager& Manager, UAbilitySystemComponent& ASC, const UItemInstance& Item,
+		TSet<FEquipmentModifierChannelKey>& DirtyChannels, FEquipmentStatsChangeReport& Report);
+
+	/** Push DirtyChannels' totals to their effects. bDropNeutral also removes effects nothing contributes to. */
+	static void FlushModifierLayer(UStatsManager& Manager, UAbilitySystemComponent& ASC,
+		const TSet<FEquipmentModifierChannelKey>& DirtyChannels, bool bDropNeutral, FEquipmentStatsChangeReport& Report);
+
+	static FGameplayEffectSpecHandle MakePerItemEffectSpec(UAbilitySystemComponent& ASC, UItemInstance& Item,
+		const TArray<FEquipmentAttributeModifier>& Modifiers);
 };
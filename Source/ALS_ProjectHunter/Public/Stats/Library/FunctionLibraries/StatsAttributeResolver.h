@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Stats/Library/Structs/StatsDebugStructs.h"
 
 class UAbilitySystemComponent;
 class UAttributeSet;
@@ -22,4 +23,11 @@ public:
 	static bool HasLiveAttribute(const UStatsManager& Manager, const FGameplayAttribute& Attribute);
 	static TSubclassOf<UAttributeSet> GetSourceAttributeSetClass(const UStatsManager& Manager);
 	static void GatherStatDefinitions(const UStatsManager& Manager, TArray<FStatInitializationEntry>& OutDefinitions);
+
+	/**
+	 * Times name, enum and definition lookups through the reflection scans this
+	 * resolver used to run against FHunterAttributeRegistry, then the full
+	 * ResolveAttributeByName path on Manager, and checks both agree on every name.
+	 */
+	static FStatsAttributeResolveBenchmarkResult BenchmarkResolve(const UStatsManager& Manager, int32 Iterations, int32 DefinitionIterations);
 };
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ActiveGameplayEffectHandle.h"
+#include "AttributeSet.h"
+#include "GameplayEffectTypes.h"
+#include "EquipmentModifierStructs.generated.h"
+
+class UGameplayEffect;
+
+// One resolved modifier from an equipped item, kept so unequipping subtracts exactly what equipping added
+struct ALS_PROJECTHUNTER_API FEquipmentAttributeModifier
+{
+	FGameplayAttribute Attribute;
+	EGameplayModOp::Type ModOp = EGameplayModOp::Additive;
+	float Magnitude = 0.0f;
+};
+
+struct ALS_PROJECTHUNTER_API FEquipmentModifierChannelKey
+{
+	FGameplayAttribute Attribute;
+	EGameplayModOp::Type ModOp = EGameplayModOp::Additive;
+
+	bool operator==(const FEquipmentModifierChannelKey& Other) const
+	{
+		return Attribute == Other.Attribute && ModOp == Other.ModOp;
+	}
+
+	friend uint32 GetTypeHash(const FEquipmentModifierChannelKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.Attribute), ::GetTypeHash(static_cast<uint8>(Key.ModOp)));
+	}
+};
+
+/**
+ * OPT-EQUIPLAYER: Every equipped item's modifiers on one attribute and op,
+ * summed and applied as a single infinite GE. GAS folds multiplicative mods as
+ * 1 + sum(Magnitude - 1), so one summed modifier evaluates exactly like one
+ * modifier per item.
+ */
+struct ALS_PROJECTHUNTER_API FEquipmentModifierChannel
+{
+	/** Additive: sum of magnitudes. Multiplicitive: sum of (magnitude - 1). Unused for Override. */
+	double Total = 0.0;
+
+	/**
+	 * Override values in equip order. The oldest one wins, matching the GAS
+	 * aggregator, which takes the first qualifying Override mod across GEs.
+	 */
+	TArray<TPair<FGuid, float>> Overrides;
+
+	/** Magnitude currently on the active effect. */
+	float AppliedMagnitude = 0.0f;
+
+	FActiveGameplayEffectHandle Handle;
+
+	float GetMagnitude(EGameplayModOp::Type ModOp) const
+	{
+		switch (ModOp)
+		{
+		case EGameplayModOp::Multiplicitive:
+			return static_cast<float>(1.0 + Total);
+		case EGameplayModOp::Override:
+			return Overrides.Num() > 0 ? Overrides[0].Value : 0.0f;
+		default:
+			return static_cast<float>(Total);
+		}
+	}
+
+	/** Nothing equipped contributes; the effect could be dropped without changing the attribute. */
+	bool IsNeutral(EGameplayModOp::Type ModOp) const
+	{
+		return ModOp == EGameplayModOp::Override
+			? Overrides.Num() == 0
+			: FMath::IsNearlyZero(Total, UE_KINDA_SMALL_NUMBER);
+	}
+};
+
+// What one equip, unequip, swap or refresh cost (UStatsManager::GetLastEquipmentStatsReport)
+USTRUCT(BlueprintType)
+struct ALS_PROJECTHUNTER_API FEquipmentStatsChangeReport
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats|Equipment")
+	FName Operation;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats|Equipment")
+	double Milliseconds = 0.0;
+
+	/** Item modifiers added or subtracted. */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats|Equipment")
+	int32 Modifiers = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats|Equipment")
+	int32 EffectsApplied = 0;
+
+	/** Active effects whose magnitude was changed in place. */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats|Equipment")
+	int32 EffectsUpdated = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats|Equipment")
+	int32 EffectsRemoved = 0;
+
+	/** UGameplayEffect objects allocated: one per item on the per-item path, first-use templates otherwise. */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats|Equipment")
+	int32 EffectObjectsCreated = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats|Equipment")
+	bool bPerItemEffects = false;
+};
@@ -135,3 +135,46 @@ private:
 	TSet<FName> WarnedCustomBucketStats;
 	TMap<FName, float> CachedLiveValues;
 };
+
+/** Result of UStatsManager::BenchmarkAttributeResolve: reflection scans vs FHunterAttributeRegistry lookups. */
+USTRUCT(BlueprintType)
+struct ALS_PROJECTHUNTER_API FStatsAttributeResolveBenchmarkResult
+{
+	GENERATED_BODY()
+
+	/** Name lookups timed per path, cycling through every attribute. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 Iterations = 0;
+
+	/** Definition lookups timed per path; the reflected path gathers every definition per lookup. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 DefinitionIterations = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 AttributeCount = 0;
+
+	/** Names the registry resolved differently from the reflection scan; anything but zero is a bug. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 Mismatches = 0;
+
+	/** TFieldIterator scan over UHunterAttributeSet, as FindAttributeByName used to do. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double ReflectedResolvesPerSecond = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double RegistryResolvesPerSecond = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double EnumResolvesPerSecond = 0.0;
+
+	/** GatherStatDefinitionsFromAttributeSet plus a search, as the resolver's definition fallback used to do. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double ReflectedDefinitionResolvesPerSecond = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double RegistryDefinitionResolvesPerSecond = 0.0;
+
+	/** FStatsAttributeResolver::ResolveAttributeByName end to end, definition included, on this manager. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double ResolverResolvesPerSecond = 0.0;
+};
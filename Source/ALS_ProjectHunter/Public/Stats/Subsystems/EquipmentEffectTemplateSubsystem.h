@@ -0,0 +1,40 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "Stats/Library/Structs/EquipmentModifierStructs.h"
+#include "EquipmentEffectTemplateSubsystem.generated.h"
+
+class UGameplayEffect;
+
+/**
+ * UEquipmentEffectTemplateSubsystem
+ *
+ * OPT-EQUIPLAYER: Shared infinite GEs for the equipment modifier layer, one
+ * per attribute and op, each with a single modifier whose magnitude is
+ * SetByCaller Data.Equipment.Magnitude. Built on first use and reused by every
+ * character for the rest of the session, so equipping never allocates a GE.
+ */
+UCLASS()
+class ALS_PROJECTHUNTER_API UEquipmentEffectTemplateSubsystem : public UEngineSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin USubsystem
+	virtual void Deinitialize() override;
+	//~ End USubsystem
+
+	/** Template for Key, created if this is the first request for it. */
+	const UGameplayEffect* GetModifierTemplate(const FEquipmentModifierChannelKey& Key);
+
+	/** Templates built so far - the only GE allocations the layer makes. */
+	int32 GetTemplateCount() const { return AllTemplates.Num(); }
+
+private:
+	TMap<FEquipmentModifierChannelKey, TObjectPtr<UGameplayEffect>> Templates;
+
+	// Keeps the templates alive; the map above is not a UPROPERTY.
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UGameplayEffect>> AllTemplates;
+};
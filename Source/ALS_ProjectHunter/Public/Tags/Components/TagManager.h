@@ -10,9 +10,19 @@
 class ACharacter;
 class UAbilitySystemComponent;
 class UHunterAttributeSet;
+class UPHCharacterMovementComponent;
+class UTagConditionSubsystem;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogTagManager, Log, All);
 
+/**
+ * Owns an actor's loose condition tags (resources, movement, combat).
+ *
+ * Fully event-driven: attribute-change delegates, movement-condition
+ * notifications from UPHCharacterMovementComponent and combat tag events only
+ * set dirty flags, and UTagConditionSubsystem refreshes dirty managers once
+ * per frame. The component ticks only to draw debug in non-shipping builds.
+ */
 UCLASS(ClassGroup = (Managers), meta = (BlueprintSpawnableComponent))
 class ALS_PROJECTHUNTER_API UTagManager : public UActorComponent
 {
@@ -68,6 +78,16 @@ public:
 	FTagDebugManager DebugManager;
 
 private:
+	friend class UTagConditionSubsystem;
+
+	/** Called by UTagConditionSubsystem once per frame while this manager is queued. */
+	void FlushDirtyConditions();
+	void MarkConditionsDirty(bool bBaseConditions, bool bMovementConditions);
+	void HandleMovementConditionChanged(bool bMoving);
+	void HandleCombatTagChanged(const FGameplayTag Tag, int32 NewCount);
+	UTagConditionSubsystem* GetConditionSubsystem() const;
+	UPHCharacterMovementComponent* GetPHMovementComponent() const;
+
 	void ApplyPendingStates();
 	bool HasPendingEnabledTag(const FGameplayTag& Tag) const;
 	bool ComputeMovementConditionState(const ACharacter* CharacterOwner);
@@ -77,14 +97,24 @@ private:
 	void RefreshMovementConditionTags();
 	void BindAttributeChangeDelegates();
 	void UnbindAttributeChangeDelegates();
+	void BindConditionEventDelegates();
+	void UnbindConditionEventDelegates();
 
 	UPROPERTY()
 	TObjectPtr<UAbilitySystemComponent> ASC;
 
 	TArray<FTagAttributeDelegateBinding> AttributeDelegateBindings;
+	TArray<FTagEventDelegateBinding> CombatTagEventBindings;
+	FDelegateHandle MovementConditionHandle;
 	TMap<FGameplayTag, bool> PendingTagStates;
 	bool bBaseConditionsDirty = false;
+	bool bMovementConditionsDirty = false;
+	bool bQueuedForConditionFlush = false;
+	bool bRegisteredWithConditionSubsystem = false;
 	bool bHasMovementConditionState = false;
 	bool bLastMovementConditionMoving = false;
+
+	/** Only used by the non-shipping legacy polling comparison path. */
+	bool bLegacyConditionPolling = false;
 	float ConditionRefreshAccumulator = 0.0f;
 };
@@ -8,3 +8,9 @@ struct FTagAttributeDelegateBinding
 	FGameplayAttribute Attribute;
 	FDelegateHandle Handle;
 };
+
+struct FTagEventDelegateBinding
+{
+	FGameplayTag Tag;
+	FDelegateHandle Handle;
+};
@@ -342,6 +342,7 @@ public:
 	static FGameplayTag Condition_Self_Shocked;
 	static FGameplayTag Condition_Self_Burned;
 	static FGameplayTag Condition_Self_Corrupted;
+	static FGameplayTag Condition_Self_Poisoned;
 	static FGameplayTag Condition_Self_Purified;
 	static FGameplayTag Condition_Self_Petrified;
 	static FGameplayTag Condition_Self_CannotRegenHP;
@@ -494,6 +495,8 @@ public:
 	static FGameplayTag Data_DoT_Corruption_DamagePerTick;
 	static FGameplayTag Data_DoT_Chill_Magnitude;
 	static FGameplayTag Data_DoT_Shock_Magnitude;
+	// SetByCaller key for the shared per-attribute equipment modifier GEs (FEquipmentStatsApplier).
+	static FGameplayTag Data_Equipment_Magnitude;
 	// Active Regen/Degen Effect State Tags
 	static FGameplayTag Effect_Stamina_RegenActive;
 	static FGameplayTag Effect_Stamina_DegenActive;
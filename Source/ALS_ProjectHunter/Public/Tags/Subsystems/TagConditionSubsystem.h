@@ -0,0 +1,63 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TagConditionSubsystem.generated.h"
+
+class UTagManager;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogTagConditions, Log, All);
+
+DECLARE_STATS_GROUP(TEXT("TagConditions"), STATGROUP_TagConditions, STATCAT_Advanced);
+
+/**
+ * UTagConditionSubsystem
+ *
+ * OPT-TAGEVENTS: Batches condition-tag refreshes for every UTagManager in the
+ * world. Managers never tick; attribute, movement and combat-tag notifications
+ * only mark a manager dirty here, and each dirty manager is refreshed once at
+ * the end of the frame no matter how many notifications it received.
+ *
+ * Compare against the old per-component polling with `stat TagConditions`
+ * and Hunter.Debug.TagManagerLegacyPolling (non-shipping).
+ */
+UCLASS()
+class ALS_PROJECTHUNTER_API UTagConditionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UWorldSubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~ End UWorldSubsystem
+
+	//~ Begin FTickableGameObject (via UTickableWorldSubsystem)
+	virtual void Tick(float DeltaSeconds) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject
+
+	void RegisterManager(UTagManager* Manager);
+	void UnregisterManager(UTagManager* Manager);
+
+	/** Queue Manager for a refresh at the end of this frame. Callers dedupe. */
+	void EnqueueDirtyManager(UTagManager* Manager);
+
+	UFUNCTION(BlueprintPure, Category = "ProjectHunter|Tags|Conditions")
+	int32 GetRegisteredManagerCount() const { return RegisteredManagerCount; }
+
+	/** Managers refreshed in the most recent frame. */
+	UFUNCTION(BlueprintPure, Category = "ProjectHunter|Tags|Conditions")
+	int32 GetLastFrameFlushCount() const { return LastFrameFlushCount; }
+
+	/** Milliseconds spent refreshing dirty managers in the most recent frame. */
+	UFUNCTION(BlueprintPure, Category = "ProjectHunter|Tags|Conditions")
+	float GetLastFrameFlushMs() const { return LastFrameFlushMs; }
+
+private:
+	TArray<TWeakObjectPtr<UTagManager>> DirtyManagers;
+
+	int32 RegisteredManagerCount = 0;
+	int32 LastFrameFlushCount = 0;
+	float LastFrameFlushMs = 0.0f;
+};
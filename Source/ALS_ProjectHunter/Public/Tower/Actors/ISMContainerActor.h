@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Tower/Library/Structs/GroundItemAnimationStructs.h"
+#include "UObject/ObjectKey.h"
 #include "ISMContainerActor.generated.h"
 
 class UInstancedStaticMeshComponent;
@@ -56,6 +57,18 @@ public:
 		meta = (ClampMin = "0.0", Units = "s", EditCondition = "bSkipRecentlyUnrenderedMeshes"))
 	float RecentlyRenderedTolerance = 0.25f;
 
+	/** Instance count in one mesh group above which transforms are computed with ParallelFor. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ground Items|Animation|Optimization",
+		meta = (ClampMin = "1"))
+	int32 ParallelAnimationThreshold = 2048;
+
+	/** Wall time of the last animation tick, for profiling large drop counts. */
+	UFUNCTION(BlueprintPure, Category = "Ground Items|Animation|Debug")
+	float GetLastAnimationUpdateMs() const { return LastAnimationUpdateMs; }
+
+	UFUNCTION(BlueprintPure, Category = "Ground Items|Animation|Debug")
+	int32 GetAnimatedItemCount() const { return AnimationHandles.Num(); }
+
 	void RegisterItemForAnimation(
 		int32 ItemID,
 		UInstancedStaticMeshComponent* ISM,
@@ -73,10 +86,18 @@ protected:
 	TObjectPtr<USceneComponent> RootSceneComponent;
 
 private:
+	/** One packed batch per ISM component. Batches are only dropped on ClearAllAnimationState. */
 	UPROPERTY()
-	TMap<int32, FGroundItemAnimState> AnimationStates;
+	TArray<FGroundItemAnimBatch> AnimationBatches;
+
+	TMap<TObjectKey<UInstancedStaticMeshComponent>, int32> ISMToBatchIndex;
+	TMap<int32, FGroundItemAnimHandle> AnimationHandles;
 
 	float AnimationTime = 0.0f;
+	float LastAnimationUpdateMs = 0.0f;
+
+	/** Writes the animated transforms for [FirstIndex, FirstIndex + Count) into Batch.ScratchTransforms. */
+	void ComputeBatchTransforms(FGroundItemAnimBatch& Batch, int32 FirstIndex, int32 Count) const;
 
 	void RefreshAnimationTickState();
 };
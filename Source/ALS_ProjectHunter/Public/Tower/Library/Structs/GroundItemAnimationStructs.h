@@ -5,19 +5,78 @@
 
 class UInstancedStaticMeshComponent;
 
+/**
+ * Animation state for every animated instance of one ISM component, packed as
+ * parallel arrays indexed by ISM instance index. Removal swap-removes in the
+ * same way the ISM does, so array slot N is always instance N and a tick can
+ * upload one contiguous transform range per component.
+ */
 USTRUCT()
-struct ALS_PROJECTHUNTER_API FGroundItemAnimState
+struct ALS_PROJECTHUNTER_API FGroundItemAnimBatch
 {
 	GENERATED_BODY()
 
 	UPROPERTY()
 	TObjectPtr<UInstancedStaticMeshComponent> ISMComponent = nullptr;
 
-	int32 InstanceIndex = INDEX_NONE;
-	FVector BaseLocation = FVector::ZeroVector;
-	float BasePitch = 0.0f;
-	float BaseRoll = 0.0f;
-	float PhaseOffset = 0.0f;
+	TArray<int32> ItemIDs;
+	TArray<FVector> BaseLocations;
+	TArray<float> BasePitches;
+	TArray<float> BaseRolls;
+	TArray<float> PhaseOffsets;
+
+	/** Per-tick output, reused between ticks to avoid reallocating. */
+	TArray<FTransform> ScratchTransforms;
+
+	int32 Num() const { return ItemIDs.Num(); }
+
+	/** Grows or shrinks every array; new slots have no owning item. */
+	void SetNum(int32 NewNum)
+	{
+		const int32 OldNum = ItemIDs.Num();
+		ItemIDs.SetNum(NewNum, EAllowShrinking::No);
+		for (int32 Index = OldNum; Index < NewNum; ++Index)
+		{
+			ItemIDs[Index] = INDEX_NONE;
+		}
+		BaseLocations.SetNum(NewNum, EAllowShrinking::No);
+		BasePitches.SetNum(NewNum, EAllowShrinking::No);
+		BaseRolls.SetNum(NewNum, EAllowShrinking::No);
+		PhaseOffsets.SetNum(NewNum, EAllowShrinking::No);
+	}
+
+	void RemoveAtSwap(int32 Index)
+	{
+		ItemIDs.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		BaseLocations.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		BasePitches.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		BaseRolls.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		PhaseOffsets.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	}
 
-	bool IsValid() const { return ISMComponent != nullptr && InstanceIndex != INDEX_NONE; }
+	void Swap(int32 A, int32 B)
+	{
+		ItemIDs.Swap(A, B);
+		BaseLocations.Swap(A, B);
+		BasePitches.Swap(A, B);
+		BaseRolls.Swap(A, B);
+		PhaseOffsets.Swap(A, B);
+	}
+
+	void Reset()
+	{
+		ItemIDs.Reset();
+		BaseLocations.Reset();
+		BasePitches.Reset();
+		BaseRolls.Reset();
+		PhaseOffsets.Reset();
+		ScratchTransforms.Reset();
+	}
+};
+
+/** Where an animated item lives: batch in AISMContainerActor and slot within it. */
+struct FGroundItemAnimHandle
+{
+	int32 BatchIndex = INDEX_NONE;
+	int32 InstanceIndex = INDEX_NONE;
 };
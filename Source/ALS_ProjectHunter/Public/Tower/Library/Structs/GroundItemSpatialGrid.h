@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * FGroundItemSpatialGrid
+ *
+ * Uniform XY hash grid over ground item IDs. Owned by UGroundItemSubsystem and
+ * kept in sync with every add, remove and move so radius and nearest queries
+ * only touch the cells they overlap instead of every item on the floor.
+ *
+ * Items are bucketed by X/Y only; distances are still tested in 3D, so
+ * stacked floors share a column but never produce wrong answers.
+ */
+struct ALS_PROJECTHUNTER_API FGroundItemSpatialGrid
+{
+public:
+	explicit FGroundItemSpatialGrid(float InCellSize = 400.0f);
+
+	/** Change the cell size. Rebuilds every bucket, so call it before filling the grid. */
+	void SetCellSize(float InCellSize);
+	float GetCellSize() const { return CellSize; }
+
+	void Add(int32 ItemID, const FVector& Location);
+
+	/** Returns false if ItemID was not in the grid. */
+	bool Remove(int32 ItemID);
+
+	/** Moves ItemID, re-bucketing only if it crossed a cell boundary. Adds it if missing. */
+	void Update(int32 ItemID, const FVector& NewLocation);
+
+	void Reset();
+
+	int32 Num() const { return ItemToCell.Num(); }
+
+	/** Appends every item within Radius of Center to OutItemIDs. Returns the number appended. */
+	int32 QueryRadius(const FVector& Center, float Radius, TArray<int32>& OutItemIDs) const;
+
+	/**
+	 * Closest item strictly inside MaxDistance of Center, searching outward one
+	 * ring of cells at a time and stopping once no unvisited cell can be closer.
+	 * Returns INDEX_NONE if nothing is in range.
+	 */
+	int32 FindNearest(const FVector& Center, float MaxDistance, float* OutDistSq = nullptr) const;
+
+private:
+	struct FEntry
+	{
+		int32 ItemID = INDEX_NONE;
+		FVector Location = FVector::ZeroVector;
+	};
+
+	FIntPoint ToCell(const FVector& Location) const;
+	void AddToCell(const FIntPoint& Cell, int32 ItemID, const FVector& Location);
+	void RemoveFromCell(const FIntPoint& Cell, int32 ItemID);
+
+	float CellSize = 400.0f;
+	float InvCellSize = 1.0f / 400.0f;
+
+	TMap<FIntPoint, TArray<FEntry>> Cells;
+	TMap<int32, FIntPoint> ItemToCell;
+
+	/** Occupied cell bounds. Only grows until Reset, which keeps FindNearest's ring limit conservative. */
+	FIntPoint MinCell = FIntPoint(MAX_int32, MAX_int32);
+	FIntPoint MaxCell = FIntPoint(MIN_int32, MIN_int32);
+};
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "Item/Library/Structs/CompactItemRecord.h"
+#include "GroundItemStore.generated.h"
+
+class UInstancedStaticMeshComponent;
+class UItemInstance;
+class UStaticMesh;
+
+/**
+ * FGroundItemStore
+ *
+ * Dense slot map behind UGroundItemSubsystem. Item pointer, ISM component,
+ * ISM instance index, mesh and location live in parallel contiguous arrays
+ * indexed by a dense slot; removal swap-removes in O(1).
+ *
+ * The public int32 ItemID is a packed handle: the low SlotBits hold a sparse
+ * slot index and the next GenerationBits hold that slot's generation. Lookups
+ * are arithmetic plus one generation compare, with no hashing, and a stale ID
+ * for a reused slot is rejected. Generations wrap after 2^GenerationBits reuses
+ * of the same slot.
+ *
+ * Also tracks which ItemID owns each ISM instance index, so the index patch
+ * after an ISM swap-removal is a direct lookup instead of a scan.
+ *
+ * OPT-COMPACTITEM: A slot may hold an FCompactItemRecord and no item yet; the
+ * owning subsystem materializes it on first access and stores it with SetItemAt.
+ */
+USTRUCT()
+struct ALS_PROJECTHUNTER_API FGroundItemStore
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr int32 SlotBits = 20;
+	static constexpr int32 GenerationBits = 11;
+	static constexpr int32 MaxSlots = 1 << SlotBits;
+
+	/** Returns the new ItemID, or INDEX_NONE if every slot is in use. */
+	int32 Add(UItemInstance* Item, const FVector& Location,
+		UInstancedStaticMeshComponent* ISMComponent, int32 InstanceIndex, UStaticMesh* Mesh);
+
+	/** Add for a drop that is not materialized yet. */
+	int32 AddRecord(const FCompactItemRecord& Record, const FVector& Location,
+		UInstancedStaticMeshComponent* ISMComponent, int32 InstanceIndex, UStaticMesh* Mesh);
+
+	/** Swap-removes ItemID. The ISM owner table is left to HandleISMSwapRemove. Returns false if stale. */
+	bool Remove(int32 ItemID);
+
+	void Reset();
+
+	/** Dense index for ItemID, or INDEX_NONE if it is stale or was never issued. */
+	int32 FindDenseIndex(int32 ItemID) const;
+
+	bool Contains(int32 ItemID) const { return FindDenseIndex(ItemID) != INDEX_NONE; }
+	int32 Num() const { return Items.Num(); }
+
+	UItemInstance* FindItem(int32 ItemID) const;
+	const FVector* FindLocation(int32 ItemID) const;
+	bool SetLocation(int32 ItemID, const FVector& NewLocation);
+
+	int32 GetItemIDAt(int32 DenseIndex) const { return DenseItemIDs[DenseIndex]; }
+	UItemInstance* GetItemAt(int32 DenseIndex) const { return Items[DenseIndex]; }
+	const FCompactItemRecord& GetRecordAt(int32 DenseIndex) const { return Records[DenseIndex]; }
+	void SetItemAt(int32 DenseIndex, UItemInstance* Item) { Items[DenseIndex] = Item; }
+	const FVector& GetLocationAt(int32 DenseIndex) const { return Locations[DenseIndex]; }
+	UInstancedStaticMeshComponent* GetISMAt(int32 DenseIndex) const { return ISMComponents[DenseIndex]; }
+	int32 GetInstanceIndexAt(int32 DenseIndex) const { return InstanceIndices[DenseIndex]; }
+
+	TConstArrayView<FVector> GetLocations() const { return Locations; }
+
+	/** ItemID rendered by InstanceIndex of ISMComponent, or INDEX_NONE. */
+	int32 FindByISMInstance(const UInstancedStaticMeshComponent* ISMComponent, int32 InstanceIndex) const;
+
+	/**
+	 * Mirror an ISM swap-removal: the instance at LastIndex moved into
+	 * RemovedIndex and LastIndex is gone. Patches the moved item's instance
+	 * index and returns its ItemID, or INDEX_NONE if nothing moved.
+	 */
+	int32 HandleISMSwapRemove(const UInstancedStaticMeshComponent* ISMComponent, int32 RemovedIndex, int32 LastIndex);
+
+	/** Forget every instance owner for ISMComponent (after ClearInstances). */
+	void ResetISMInstances(const UInstancedStaticMeshComponent* ISMComponent);
+
+private:
+	struct FSlot
+	{
+		int32 DenseIndex = INDEX_NONE;
+		uint16 Generation = 0;
+	};
+
+	static int32 MakeItemID(int32 SlotIndex, uint16 Generation)
+	{
+		return (static_cast<int32>(Generation) << SlotBits) | SlotIndex;
+	}
+
+	int32 AddInternal(UItemInstance* Item, const FCompactItemRecord& Record, const FVector& Location,
+		UInstancedStaticMeshComponent* ISMComponent, int32 InstanceIndex, UStaticMesh* Mesh);
+
+	/** Null while the slot only holds its record. */
+	UPROPERTY()
+	TArray<TObjectPtr<UItemInstance>> Items;
+
+	/** Empty record for items that were added already materialized. */
+	UPROPERTY()
+	TArray<FCompactItemRecord> Records;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UInstancedStaticMeshComponent>> ISMComponents;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UStaticMesh>> Meshes;
+
+	TArray<FVector> Locations;
+	TArray<int32> InstanceIndices;
+	TArray<int32> DenseItemIDs;
+
+	TArray<FSlot> Slots;
+	TArray<int32> FreeSlots;
+
+	/** Per ISM component, the ItemID that owns each instance index; INDEX_NONE when unowned. */
+	TMap<TObjectKey<UInstancedStaticMeshComponent>, TArray<int32>> InstanceOwners;
+};
@@ -30,3 +30,32 @@ struct ALS_PROJECTHUNTER_API FGroundItemISMData
 
 	bool IsValid() const { return ISMComponent != nullptr && InstanceIndex != INDEX_NONE; }
 };
+
+// Latency of UGroundItemSubsystem queries through the spatial grid versus a linear scan
+USTRUCT(BlueprintType)
+struct ALS_PROJECTHUNTER_API FGroundItemQueryBenchmarkResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 ItemCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 QueryCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double LinearRadiusQueryMicroseconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double GridRadiusQueryMicroseconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double LinearNearestQueryMicroseconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double GridNearestQueryMicroseconds = 0.0;
+
+	/** False if any grid query returned a different item set or nearest distance than the scan. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	bool bResultsMatch = true;
+};
@@ -0,0 +1,139 @@
+// Compact binary item records for stash tab persistence.
+// Plain C++, no USTRUCT: the bytes live in FStashItemSaveData::RecordBytes
+// and every name they reference lives once per tab in
+// UStashTabSaveGame::RecordNames.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Item/Generation/AffixGenerator.h"
+#include "Item/Library/Enums/AffixEnums.h"
+
+class UDataTable;
+class UItemInstance;
+struct FCompactItemRecord;
+struct FItemBase;
+struct FPHAttributeData;
+
+/**
+ * OPT-STASHIO: Layout version written as the first byte of every record.
+ * Bump it whenever the field order below changes and keep the old branch in
+ * FStashItemRecordReader so existing stash files still load.
+ */
+inline constexpr uint8 StashItemRecordVersion = 1;
+
+/**
+ * OPT-COMPACTITEM: First byte of a record that only holds an FCompactItemRecord
+ * (see FStashItemRecordWriter::WriteCompact). Above any layout version, so
+ * FStashItemRecordReader::Read rejects it instead of misreading it.
+ */
+inline constexpr uint8 StashCompactRecordTag = 0x80;
+
+/**
+ * Where an affix definition comes from. Records never carry the definition
+ * itself, only enough to find it again plus the per-instance state
+ * (UID, rolled value, identified flag).
+ */
+enum class EStashAffixSource : uint8
+{
+	BaseImplicit,	// Index into FItemBase::ImplicitMods
+	BaseUnique,		// Index into FItemBase::UniqueAffixes
+	TableRow		// Row of a prefix, suffix or enchant DataTable
+};
+
+/**
+ * Writes UItemInstance state as a compact record: base row handle, seed,
+ * level, rarity, quantity, durability, rune sockets and per-affix row
+ * references with their rolled values. Names are pooled in the table the
+ * writer was constructed with, so a tab of one base item stores its path once.
+ *
+ * Game thread only; resolving affix tables may load them.
+ */
+class ALS_PROJECTHUNTER_API FStashItemRecordWriter
+{
+public:
+	explicit FStashItemRecordWriter(TArray<FName>& InNames);
+
+	/**
+	 * Returns false if some affix cannot be expressed as a row reference
+	 * (e.g. a crafted mod whose table row was edited since it rolled). The
+	 * caller stores the item with the full property serializer instead.
+	 */
+	bool Write(const UItemInstance& Item, TArray<uint8>& OutBytes);
+
+	/** Generation inputs only, for items that have not changed since they rolled. */
+	void WriteCompact(const FCompactItemRecord& Record, TArray<uint8>& OutBytes);
+
+private:
+	struct FAffixRowKey
+	{
+		FName AttributeName;
+		FName AffixGroup;
+		ERankPoints RankPoints = ERankPoints::RP_0;
+		float MinValue = 0.0f;
+		float MaxValue = 0.0f;
+
+		explicit FAffixRowKey(const FPHAttributeData& Affix);
+
+		bool operator==(const FAffixRowKey& Other) const
+		{
+			return AttributeName == Other.AttributeName
+				&& AffixGroup == Other.AffixGroup
+				&& RankPoints == Other.RankPoints
+				&& MinValue == Other.MinValue
+				&& MaxValue == Other.MaxValue;
+		}
+
+		friend uint32 GetTypeHash(const FAffixRowKey& Key)
+		{
+			uint32 Hash = HashCombine(GetTypeHash(Key.AttributeName), GetTypeHash(Key.AffixGroup));
+			Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Key.RankPoints)));
+			Hash = HashCombine(Hash, GetTypeHash(Key.MinValue));
+			return HashCombine(Hash, GetTypeHash(Key.MaxValue));
+		}
+	};
+
+	uint32 AddName(FName Name);
+
+	bool WriteAffixList(FArchive& Ar, const TArray<FPHAttributeData>& Affixes, const FItemBase& Base);
+
+	bool ResolveAffixSource(const FPHAttributeData& Affix, const FItemBase& Base,
+		EStashAffixSource& OutSource, uint32& OutA, uint32& OutB);
+
+	/** Row name of a definition matching Affix in Table, built once per table per writer. */
+	const FName* FindAffixRow(const UDataTable* Table, const FPHAttributeData& Affix);
+
+	TArray<FName>& Names;
+	TMap<FName, uint32> NameLookup;
+	TMap<const UDataTable*, TMap<FAffixRowKey, FName>> RowIndex;
+
+	/** Supplies the shared prefix, suffix and enchant tables when a base item leaves them unset. */
+	FAffixGenerator Generator;
+};
+
+/**
+ * Rebuilds a UItemInstance from a record. Affix tables are resolved once per
+ * reader, so keep one alive for all items of a tab or time slice.
+ *
+ * Game thread only.
+ */
+class ALS_PROJECTHUNTER_API FStashItemRecordReader
+{
+public:
+	explicit FStashItemRecordReader(const TArray<FName>& InNames);
+
+	/** Returns false if the record is malformed or its base item no longer exists. */
+	bool Read(UItemInstance& Item, const TArray<uint8>& Bytes);
+
+	/** Returns false unless Bytes were written by WriteCompact and their base table resolves. */
+	bool ReadCompact(const TArray<uint8>& Bytes, FCompactItemRecord& OutRecord);
+
+private:
+	FName GetName(uint32 Index) const;
+
+	bool ReadAffixList(FArchive& Ar, TArray<FPHAttributeData>& OutAffixes, const FItemBase& Base);
+
+	UDataTable* ResolveTable(FName TablePath);
+
+	const TArray<FName>& Names;
+	TMap<FName, UDataTable*> Tables;
+};
@@ -12,6 +12,15 @@ struct ALS_PROJECTHUNTER_API FStashItemSaveData
 	UPROPERTY()
 	FIntPoint GridPosition = FIntPoint::ZeroValue;
 
+	/**
+	 * OPT-STASHIO: Compact record written by FStashItemRecordWriter. Empty for
+	 * items saved before the record format and for items it cannot express;
+	 * those load from ItemBytes instead.
+	 */
+	UPROPERTY()
+	TArray<uint8> RecordBytes;
+
+	/** Full SaveGame property serialization. Only written when RecordBytes is empty. */
 	UPROPERTY()
 	TArray<uint8> ItemBytes;
 
@@ -39,3 +48,42 @@ struct ALS_PROJECTHUNTER_API FStashTabHandleSaveData
 	UPROPERTY()
 	FLinearColor AccentColor = FLinearColor::White;
 };
+
+// Game-thread cost of saving and loading one stash tab, compact records versus full property serialization
+USTRUCT(BlueprintType)
+struct ALS_PROJECTHUNTER_API FStashPersistenceBenchmarkResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 ItemCount = 0;
+
+	/** Items the record format could express. The rest fell back to ItemBytes. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 RecordItemCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 LegacyTabBytes = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 RecordTabBytes = 0;
+
+	/** Per-item property serialization plus SaveGameToMemory of the tab. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double LegacySaveMilliseconds = 0.0;
+
+	/** Record encoding plus SaveGameToMemory of the tab. The file write itself runs off the game thread. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double RecordSaveMilliseconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double LegacyLoadMilliseconds = 0.0;
+
+	/** Total materialization time; live loads spread this across frames. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double RecordLoadMilliseconds = 0.0;
+
+	/** False if any item read back from its record differs from the original. */
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	bool bResultsMatch = true;
+};
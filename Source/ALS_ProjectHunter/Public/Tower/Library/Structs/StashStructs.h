@@ -1,26 +1,36 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Item/Library/Structs/CompactItemRecord.h"
 #include "Tower/Library/Enums/StashEnumLibrary.h"
 #include "StashStructs.generated.h"
 
 class UItemInstance;
+class UStashTabSaveGame;
 
 USTRUCT(BlueprintType)
 struct ALS_PROJECTHUNTER_API FStashItemEntry
 {
 	GENERATED_BODY()
 
+	/** Null while the entry only holds Record; UStashSubsystem::GetTabItem builds it. */
 	UPROPERTY(BlueprintReadWrite, Category = "Stash")
 	TObjectPtr<UItemInstance> Item;
 
 	UPROPERTY(BlueprintReadWrite, Category = "Stash")
 	FIntPoint GridPosition = FIntPoint::ZeroValue;
 
+	/** OPT-COMPACTITEM: Set for items loaded from a compact record and not materialized yet. */
+	UPROPERTY(BlueprintReadOnly, Category = "Stash")
+	FCompactItemRecord Record;
+
 	FStashItemEntry() = default;
 	FStashItemEntry(UItemInstance* InItem, FIntPoint InPos)
 		: Item(InItem), GridPosition(InPos)
 	{}
+	FStashItemEntry(const FCompactItemRecord& InRecord, FIntPoint InPos)
+		: GridPosition(InPos), Record(InRecord)
+	{}
 };
 
 USTRUCT(BlueprintType)
@@ -72,3 +82,21 @@ struct ALS_PROJECTHUNTER_API FStashTabHandle
 		: TabID(InID), TabName(InName), TabType(InType)
 	{}
 };
+
+/**
+ * OPT-STASHIO: A tab whose save file finished loading off the game thread and
+ * is being turned back into UItemInstances a few items per frame.
+ */
+USTRUCT()
+struct ALS_PROJECTHUNTER_API FStashPendingTabLoad
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FName TabID;
+
+	UPROPERTY()
+	TObjectPtr<UStashTabSaveGame> SaveGame;
+
+	int32 NextItemIndex = 0;
+};
@@ -4,6 +4,8 @@
 #include "HAL/CriticalSection.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "Tower/Library/Structs/GroundItemStructs.h"
+#include "Tower/Library/Structs/GroundItemSpatialGrid.h"
+#include "Tower/Library/Structs/GroundItemStore.h"
 #include "GroundItemSubsystem.generated.h"
 
 class AISMContainerActor;
@@ -26,14 +28,36 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Ground Items")
 	int32 AddItemToGround(UItemInstance* Item, FVector Location, FRotator Rotation = FRotator::ZeroRotator);
 
+	/**
+	 * Adds many items in one pass. Instances are grouped by ground mesh so each ISM
+	 * receives a single AddInstances call. OutItemIDs is index-aligned with Items and
+	 * holds INDEX_NONE for rejected entries. Returns the number of items added.
+	 */
+	int32 AddItemsToGround(TConstArrayView<UItemInstance*> Items, TConstArrayView<FVector> Locations, TArray<int32>& OutItemIDs);
+
+	/**
+	 * OPT-COMPACTITEM: Put a drop on the ground without building its item. The
+	 * UItemInstance is created from Record the first time the item is looked up,
+	 * picked up or removed; until then the ground holds only the record.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Ground Items")
+	int32 AddRecordToGround(const FCompactItemRecord& Record, FVector Location, FRotator Rotation = FRotator::ZeroRotator);
+
+	/** AddItemsToGround for compact records. */
+	int32 AddRecordsToGround(TConstArrayView<FCompactItemRecord> Records, TConstArrayView<FVector> Locations, TArray<int32>& OutItemIDs);
+
 	UFUNCTION(BlueprintCallable, Category = "Ground Items")
 	UItemInstance* RemoveItemFromGround(int32 ItemID);
 
 	UFUNCTION(BlueprintCallable, Category = "Ground Items")
 	TArray<UItemInstance*> RemoveMultipleItemsFromGround(const TArray<int32>& ItemIDs);
 
-	UFUNCTION(BlueprintPure, Category = "Ground Items")
-	UItemInstance* GetItemByID(int32 ItemID) const;
+	/** Materializes the item if it is still a compact record. */
+	UFUNCTION(BlueprintCallable, Category = "Ground Items")
+	UItemInstance* GetItemByID(int32 ItemID);
+
+	/** Record of a drop that has not been materialized yet, or nullptr. Never builds the item. */
+	const FCompactItemRecord* FindItemRecord(int32 ItemID) const;
 
 	UFUNCTION(BlueprintCallable, Category = "Ground Items")
 	UItemInstance* GetNearestItem(FVector Location, float MaxDistance, int32& OutItemID);
@@ -41,7 +65,8 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Ground Items")
 	int32 GetItemsInRadius(FVector Location, float Radius, TArray<int32>& OutItemIDs);
 
-	UFUNCTION(BlueprintPure, Category = "Ground Items")
+	/** Materializes every compact record in range. Prefer GetItemsInRadius when IDs are enough. */
+	UFUNCTION(BlueprintCallable, Category = "Ground Items")
 	TArray<UItemInstance*> GetItemInstancesInRadius(FVector Location, float Radius);
 
 	UFUNCTION(BlueprintPure, Category = "Ground Items")
@@ -56,9 +81,35 @@ public:
 	void ClearAllItems();
 
 	UFUNCTION(BlueprintPure, Category = "Ground Items")
-	int32 GetTotalItemCount() const { return GroundItems.Num(); }
-
-	const TMap<int32, FVector>& GetInstanceLocations() const { return InstanceLocations; }
+	int32 GetTotalItemCount() const { return Store.Num(); }
+
+	/** Ground location of ItemID, or nullptr if the ID is stale. Valid until the next add/remove. */
+	const FVector* FindItemLocation(int32 ItemID) const { return Store.FindLocation(ItemID); }
+
+	/**
+	 * Bumped on every add, remove, move and clear. Callers that cache query
+	 * results compare it to know when the ground contents changed.
+	 */
+	uint32 GetContentVersion() const { return ContentVersion; }
+
+	/** Dense view of the store, for code that wants to walk every ground item. */
+	const FGroundItemStore& GetItemStore() const { return Store; }
+
+	/**
+	 * Edge length of the spatial grid cells backing radius and nearest queries.
+	 * Roughly the common interaction radius works best.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Ground Items|Spatial Grid", meta = (ClampMin = 50.0f))
+	float SpatialGridCellSize = 400.0f;
+
+	/**
+	 * Build ItemCount synthetic locations in a square of AreaExtent half-size
+	 * and time QueryCount radius and nearest queries through the spatial grid
+	 * against a linear scan of the same data. Does not touch live ground items.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Ground Items|Debug")
+	FGroundItemQueryBenchmarkResult BenchmarkSpatialQueries(int32 ItemCount = 10000, int32 QueryCount = 1000,
+		float QueryRadius = 400.0f, float AreaExtent = 10000.0f) const;
 
 #if WITH_EDITOR
 	UFUNCTION(BlueprintCallable, Category = "Ground Items|Debug")
@@ -73,17 +124,22 @@ protected:
 private:
 	UItemInstance* RemoveItemFromGroundInternal(int32 ItemID);
 
-	UPROPERTY()
-	TWeakObjectPtr<AISMContainerActor> ISMContainerActor;
+	/** Exactly one of Item and Record is set. */
+	int32 AddToGroundInternal(UItemInstance* Item, const FCompactItemRecord* Record, const FVector& Location, FRotator Rotation);
 
-	UPROPERTY()
-	TMap<int32, UItemInstance*> GroundItems;
+	/** Exactly one of Items and Records is non-empty. */
+	int32 AddManyToGroundInternal(TConstArrayView<UItemInstance*> Items, TConstArrayView<FCompactItemRecord> Records,
+		TConstArrayView<FVector> Locations, TArray<int32>& OutItemIDs);
+
+	/** Item at DenseIndex, materializing its compact record on first access. */
+	UItemInstance* ResolveItemAt(int32 DenseIndex);
 
 	UPROPERTY()
-	TMap<int32, FVector> InstanceLocations;
+	TWeakObjectPtr<AISMContainerActor> ISMContainerActor;
 
+	/** Per-item state in dense arrays; ItemIDs are generation-checked handles into it. */
 	UPROPERTY()
-	TMap<int32, FGroundItemISMData> ItemISMData;
+	FGroundItemStore Store;
 
 	UPROPERTY()
 	TMap<UStaticMesh*, UInstancedStaticMeshComponent*> MeshToISM;
@@ -91,7 +147,10 @@ private:
 	UPROPERTY()
 	TMap<UItemInstance*, int32> InstanceToIDMap;
 
-	int32 NextItemID = 0;
+	/** XY hash of the store locations; kept in lockstep with it. */
+	FGroundItemSpatialGrid SpatialGrid;
+
+	uint32 ContentVersion = 0;
 	bool bIsProcessingRemoval = false;
 	FCriticalSection PendingRemovalsCS;
 	TArray<int32> PendingRemovals;
@@ -19,6 +19,10 @@ public:
 
 	UPROPERTY()
 	TArray<FStashItemSaveData> Items;
+
+	/** Name pool indexed by every FStashItemSaveData::RecordBytes in this tab. */
+	UPROPERTY()
+	TArray<FName> RecordNames;
 };
 
 UCLASS()
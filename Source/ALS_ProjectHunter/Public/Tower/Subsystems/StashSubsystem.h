@@ -2,13 +2,21 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Containers/Ticker.h"
+#include "Engine/DataTable.h"
+#include "Item/Library/Enums/ItemEnums.h"
 #include "Tower/Library/Enums/StashEnumLibrary.h"
 #include "Tower/Library/Structs/StashStructs.h"
+#include "Tower/Library/Structs/StashSaveStructs.h"
 #include "StashSubsystem.generated.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogStashSubsystem, Log, All);
 
 class UItemInstance;
+class USaveGame;
+class UStashTabSaveGame;
+class FStashItemRecordReader;
+class FStashItemRecordWriter;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnStashTabLoaded, FName, TabID);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStashItemAdded,
@@ -28,12 +36,30 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Stash")
 	void LoadStashHandles(const FString& CharacterSlotName);
 
+	/**
+	 * Returns true if the tab is already loaded. Otherwise starts loading it:
+	 * the save file is read off the game thread, its items are materialized
+	 * within MaterializeBudgetMs per frame, and OnStashTabLoaded fires once the
+	 * whole tab is ready.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Stash")
 	bool RequestTabData(int32 TabIndex);
 
-	// C++ only because UHT cannot expose USTRUCT pointers.
+	UFUNCTION(BlueprintPure, Category = "Stash")
+	bool IsTabLoading(int32 TabIndex) const;
+
+	// C++ only because UHT cannot expose USTRUCT pointers. Entries may still be
+	// compact records with a null Item; use GetTabItem to get the instance.
 	FStashTabData* GetLoadedTabData(int32 TabIndex);
 
+	/**
+	 * Item at GridPos in a loaded tab, or nullptr. OPT-COMPACTITEM: Items that
+	 * were saved untouched load as compact records and are only built here, on
+	 * first inspection or withdrawal.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Stash")
+	UItemInstance* GetTabItem(int32 TabIndex, FIntPoint GridPos);
+
 	UFUNCTION(BlueprintPure, Category = "Stash")
 	bool IsTabLoaded(int32 TabIndex) const;
 
@@ -52,6 +78,11 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Stash")
 	void MarkTabDirty(int32 TabIndex);
 
+	/**
+	 * Saves every dirty tab with AsyncSaveGameToSlot. Building the save object
+	 * stays on the game thread; the file write does not. A tab dirtied again
+	 * while its save is in flight is saved again when that save completes.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Stash")
 	void FlushDirtyTabs();
 
@@ -70,6 +101,23 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Stash")
 	int32 GetTabCount() const { return TabHandles.Num(); }
 
+	/**
+	 * Build ItemCount items of BaseItemHandle and time one tab's save and load
+	 * through compact records against full property serialization. Nothing is
+	 * written to disk and live tabs are untouched.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Stash|Debug")
+	FStashPersistenceBenchmarkResult BenchmarkTabPersistence(FDataTableRowHandle BaseItemHandle,
+		int32 ItemCount = 1000, EItemRarity Rarity = EItemRarity::IR_GradeA);
+
+	/**
+	 * OPT-STASHIO: Game-thread milliseconds per frame spent turning a loaded
+	 * tab's records back into UItemInstances. At least one item is
+	 * materialized per frame so a tab always finishes.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Stash|Loading", meta = (ClampMin = 0.1f, ClampMax = 16.0f))
+	float MaterializeBudgetMs = 1.0f;
+
 	UPROPERTY(BlueprintAssignable, Category = "Stash|Events")
 	FOnStashTabLoaded OnStashTabLoaded;
 
@@ -89,15 +137,58 @@ private:
 	UPROPERTY()
 	FString ActiveSlotName;
 
+	/** Tabs whose save file is being materialized, oldest request first. */
+	UPROPERTY()
+	TArray<FStashPendingTabLoad> PendingTabLoads;
+
+	/** Tabs waiting on AsyncLoadGameFromSlot. */
+	TSet<FName> TabsAwaitingFile;
+
+	/** Tabs with an AsyncSaveGameToSlot in flight. */
+	TSet<FName> TabSavesInFlight;
+
+	bool bHandlesSaveInFlight = false;
+	bool bHandlesSaveQueued = false;
+	bool bDeinitializing = false;
+
+	/** Bumped by LoadStashHandles so callbacks for the previous character are ignored. */
+	uint32 SlotGeneration = 0;
+
+	FTSTicker::FDelegateHandle MaterializeTickerHandle;
+
 	FString BuildTabSlotName(FName TabID) const;
 
 	bool FindFreeGridPosition(const FStashTabData& Tab, FIntPoint& OutPos) const;
 
-	void SaveTab(int32 TabIndex);
+	void FlushDirtyTabsInternal(bool bBlocking);
+
+	/**
+	 * Snapshot of one tab as a save object: compact records for untouched items,
+	 * full records for what they can express, ItemBytes otherwise.
+	 */
+	UStashTabSaveGame* BuildTabSave(int32 TabIndex) const;
+
+	static void WriteItemSaveData(UItemInstance& Item, FStashItemRecordWriter& Writer, FStashItemSaveData& OutSave);
+
+	UItemInstance* MaterializeItem(const FStashItemSaveData& ItemSave, FStashItemRecordReader& Reader);
+
+	/** Entry.Item, building it from Entry.Record first if needed. */
+	UItemInstance* ResolveEntryItem(FStashItemEntry& Entry);
+
+	void SaveHandles(bool bBlocking);
+
+	void HandleTabSaveCompleted(const FString& SlotName, const int32 UserIndex, bool bSuccess, FName TabID, uint32 Generation);
+
+	void HandleHandlesSaveCompleted(const FString& SlotName, const int32 UserIndex, bool bSuccess);
+
+	void HandleTabFileLoaded(const FString& SlotName, const int32 UserIndex, USaveGame* LoadedSave, FName TabID, uint32 Generation);
+
+	bool TickPendingTabLoads(float DeltaTime);
 
-	void SaveHandles();
+	void FinishTabLoad(FName TabID);
 
-	bool LoadTab(int32 TabIndex);
+	/** Pumps game-thread tasks until async save callbacks have run, for shutdown. */
+	void WaitForPendingSaves();
 
 	bool IsValidTabIndex(int32 TabIndex) const;
 };
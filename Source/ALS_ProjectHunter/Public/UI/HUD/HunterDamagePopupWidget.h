@@ -6,6 +6,9 @@
 #include "HunterDamagePopupWidget.generated.h"
 
 class UWidgetComponent;
+class UHunterDamagePopupWidget;
+
+DECLARE_DELEGATE_OneParam(FOnHunterDamagePopupFinished, UHunterDamagePopupWidget*);
 
 UCLASS(Abstract, BlueprintType, Blueprintable)
 class ALS_PROJECTHUNTER_API UHunterDamagePopupWidget : public UUserWidget
@@ -30,6 +33,13 @@ public:
 
 	void SetOwningWorldWidgetComponent(UWidgetComponent* InWidgetComponent);
 
+	/**
+	 * Bound by UHunterDamagePopupSubsystem for pooled popups. When bound,
+	 * FinishDamagePopup hands the widget back to the pool instead of
+	 * destroying its component.
+	 */
+	FOnHunterDamagePopupFinished OnDamagePopupFinished;
+
 protected:
 	UFUNCTION(BlueprintImplementableEvent, Category = "HUD|Damage Popup")
 	void OnDamagePopupInitialized(const FCombatDamagePopupData& InPopupData);
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "Blueprint/UserWidgetPool.h"
 #include "Item/Library/Structs/ItemTooltipStructs.h"
 #include "ItemTooltipSectionWidget.generated.h"
 
@@ -15,6 +16,9 @@ class ALS_PROJECTHUNTER_API UItemTooltipSectionWidget : public UUserWidget
 	GENERATED_BODY()
 
 public:
+	UItemTooltipSectionWidget(const FObjectInitializer& ObjectInitializer);
+
+	/** Rebinds this section; line widgets are reused from the previous binding. */
 	UFUNCTION(BlueprintCallable, Category = "Item|Tooltip")
 	void SetSectionData(const FItemTooltipSection& InSectionData, FLinearColor InHeadingColor);
 
@@ -22,6 +26,8 @@ public:
 	FItemTooltipSection GetSectionData() const { return SectionData; }
 
 protected:
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+
 	UPROPERTY(BlueprintReadOnly, Category = "Item|Tooltip")
 	FItemTooltipSection SectionData;
 
@@ -43,4 +49,14 @@ protected:
 private:
 	void PopulateLines();
 	void AddFallbackLine(const FItemTooltipLine& Line);
+
+	/** OPT-TOOLTIPCACHE: Line widgets, released (Slate kept) on every repopulate. */
+	UPROPERTY(Transient)
+	FUserWidgetPool LineWidgetPool;
+
+	/** Fallback text blocks reused in order; the first FallbackLinesInUse are live. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UTextBlock>> FallbackLinePool;
+
+	int32 FallbackLinesInUse = 0;
 };
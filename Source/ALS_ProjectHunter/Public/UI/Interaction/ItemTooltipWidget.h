@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "Blueprint/UserWidgetPool.h"
 #include "Item/ItemInstance.h"
 #include "Item/Library/Enums/ItemEnums.h"
 #include "Item/Library/Structs/ItemTooltipStructs.h"
@@ -19,6 +20,13 @@ class UItemTooltipWidget : public UUserWidget
 {
 	GENERATED_BODY()
 public:
+	UItemTooltipWidget(const FObjectInitializer& ObjectInitializer);
+
+	/**
+	 * Shows Item. The model comes from the item's tooltip cache and section
+	 * widgets are rebound from a pool, so flicking between items builds nothing
+	 * new once the pool is warm.
+	 */
 	UFUNCTION(BlueprintCallable)
 	void UpdateTooltip(UItemInstance* Item);
 
@@ -39,6 +47,7 @@ public:
 protected:
 	virtual void NativeConstruct() override;
 	virtual void NativeDestruct() override;
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
 
 	/**
 	 * Fired after the C++ population pass so a Blueprint child can extend the
@@ -111,14 +120,26 @@ protected:
 
 private:
 	TWeakObjectPtr<UItemInstance> DisplayedItem;
+	int32 DisplayedRevision = INDEX_NONE;
 	bool bCloseRequested = false;
 
+	/** OPT-TOOLTIPCACHE: Section widgets, released (Slate kept) on every repopulate. */
+	UPROPERTY(Transient)
+	FUserWidgetPool SectionWidgetPool;
+
+	/** Fallback text blocks reused in order; the first FallbackTextBlocksInUse are live. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UTextBlock>> FallbackTextBlockPool;
+
+	int32 FallbackTextBlocksInUse = 0;
+
 	UFUNCTION()
 	void HandleCloseAnimationFinished();
 
 	void SetGradeVisuals(EItemRarity Grade);
 	FLinearColor GetGradeColor(EItemRarity Grade) const;
 	void PopulateSections();
+	void ReleaseSectionWidgets();
 	void AddFallbackSection(const FItemTooltipSection& Section);
 	UTextBlock* CreateFallbackTextBlock(
 		const FText& Text,
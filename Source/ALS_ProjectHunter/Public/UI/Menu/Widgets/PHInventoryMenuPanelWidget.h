@@ -212,6 +212,14 @@ private:
 	void BindManagerDelegates();
 	void UnbindManagerDelegates();
 	void RebuildInventorySlots();
+
+	/**
+	 * Rebuilds view data and cells for the given slots only. Returns false when
+	 * the grid layout no longer matches the inventory and a full rebuild is needed.
+	 */
+	bool RefreshInventorySlots(const TArray<int32>& SlotIndices);
+
+	FEquipmentMenuInventorySlotViewData MakeSlotViewData(int32 SlotIndex) const;
 	void UpdateInventorySummary();
 	EEquipmentSlot ResolveSuggestedSlot(UItemInstance* Item) const;
 	void SetSelection(UItemInstance* Item, int32 InventorySlotIndex, EEquipmentSlot SuggestedEquipmentSlot);
@@ -220,7 +228,7 @@ private:
 	void HandleEquipmentChanged(EEquipmentSlot EquipmentSlot, UItemInstance* NewItem, UItemInstance* OldItem);
 
 	UFUNCTION()
-	void HandleInventoryChanged();
+	void HandleInventorySlotsChanged(const TArray<int32>& SlotIndices);
 
 	UFUNCTION()
 	void HandleCarryWeightChanged(float NewCurrentWeight, float NewMaxWeight);